@@ -24,6 +24,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     __compiled_time__,
     __repo__,
     __version__,
+    PROFILING_COMPILED_IN,
     a_star,
     a_star_distance,
     a_star_params,
@@ -33,6 +34,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     and_or_not,
     and_or_not_maj,
     apply_bestagon_library,
+    apply_gate_library_params,
     apply_qca_one_library,
     apply_topolinano_library,
     area,
@@ -65,6 +67,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     clocked_hexagonal_layout,
     clocked_shifted_cartesian_layout,
     clustercomplete,
+    clustercomplete_batch,
     clustercomplete_params,
     color_mode,
     color_routing,
@@ -103,7 +106,9 @@ from .pyfiction import (  # type: ignore[import-not-found]
     critical_temperature_domain_grid_search,
     critical_temperature_domain_random_sampling,
     critical_temperature_gate_based,
+    critical_temperature_gate_based_batch,
     critical_temperature_non_gate_based,
+    critical_temperature_non_gate_based_batch,
     critical_temperature_params,
     critical_temperature_stats,
     cube_area,
@@ -123,18 +128,22 @@ from .pyfiction import (  # type: ignore[import-not-found]
     determine_displacement_robustness_domain_100,
     determine_displacement_robustness_domain_111,
     dimer_displacement_policy,
+    disable_profiling,
     displacement_analysis_mode,
     displacement_robustness_domain_100,
     displacement_robustness_domain_111,
     displacement_robustness_domain_params,
     displacement_robustness_domain_stats,
     dynamic_truth_table,
+    enable_profiling,
     energy_calculation,
     energy_distribution,
+    energy_window_restriction,
     enumerate_all_paths,
     enumerate_all_paths_params,
     eq_type,
     equivalence_checking,
+    equivalence_checking_params,
     equivalence_checking_stats,
     euclidean_distance,
     exact_cartesian,
@@ -175,6 +184,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     inml_layout,
     inml_technology,
     input_bdl_configuration,
+    input_pattern_order,
     is_balanced,
     is_charged_defect_type,
     is_crossable_wire,
@@ -185,8 +195,10 @@ from .pyfiction import (  # type: ignore[import-not-found]
     is_neutral_defect_type,
     is_neutrally_charged_defect,
     is_operational,
+    is_operational_batch,
     is_operational_params,
     is_positively_charged_defect,
+    is_profiling_enabled,
     kink_induced_non_operational_input_patterns,
     manhattan_distance,
     # maximum_defect_influence_distance_params,
@@ -233,11 +245,15 @@ from .pyfiction import (  # type: ignore[import-not-found]
     post_layout_optimization_params,
     post_layout_optimization_stats,
     potential_to_distance_conversion,
+    profiling_params,
+    profiling_summary,
     qca_layout,
     qca_technology,
     quickexact,
+    quickexact_batch,
     quickexact_params,
     quicksim,
+    quicksim_batch,
     quicksim_params,
     random_coordinate,
     read_cartesian_fgl_layout,
@@ -248,6 +264,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     read_sqd_layout_111,
     read_technology_network,
     reserve_input_nodes,
+    reset_profiling,
     route_path,
     # write_location_and_ground_state,
     sample_writing_mode,
@@ -272,6 +289,8 @@ from .pyfiction import (  # type: ignore[import-not-found]
     sidb_simulation_result_111,
     sidb_technology,
     sign_to_charge_state,
+    sim_anneal,
+    sim_anneal_params,
     simulate,
     siqad_area,
     siqad_coordinate,
@@ -301,6 +320,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     wiring_reduction,
     wiring_reduction_params,
     wiring_reduction_stats,
+    write_chrome_trace,
     write_critical_temperature_domain,
     write_critical_temperature_domain_to_string,
     write_dot_layout,
@@ -311,6 +331,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     write_operational_domain,
     write_operational_domain_params,
     write_operational_domain_to_string,
+    write_profiling_summary,
     write_qca_layout,
     write_qca_layout_params,
     write_qca_layout_svg,
@@ -331,6 +352,7 @@ __all__ = [
     "__compiled_time__",
     "__repo__",
     "__version__",
+    "PROFILING_COMPILED_IN",
     "a_star",
     "a_star_distance",
     "a_star_params",
@@ -340,6 +362,7 @@ __all__ = [
     "and_or_not",
     "and_or_not_maj",
     "apply_bestagon_library",
+    "apply_gate_library_params",
     "apply_qca_one_library",
     "apply_topolinano_library",
     "area",
@@ -372,6 +395,7 @@ __all__ = [
     "clocked_hexagonal_layout",
     "clocked_shifted_cartesian_layout",
     "clustercomplete",
+    "clustercomplete_batch",
     "clustercomplete_params",
     "color_mode",
     "color_routing",
@@ -410,7 +434,9 @@ __all__ = [
     "critical_temperature_domain_grid_search",
     "critical_temperature_domain_random_sampling",
     "critical_temperature_gate_based",
+    "critical_temperature_gate_based_batch",
     "critical_temperature_non_gate_based",
+    "critical_temperature_non_gate_based_batch",
     "critical_temperature_params",
     "critical_temperature_stats",
     "cube_area",
@@ -430,18 +456,22 @@ __all__ = [
     "determine_displacement_robustness_domain_100",
     "determine_displacement_robustness_domain_111",
     "dimer_displacement_policy",
+    "disable_profiling",
     "displacement_analysis_mode",
     "displacement_robustness_domain_100",
     "displacement_robustness_domain_111",
     "displacement_robustness_domain_params",
     "displacement_robustness_domain_stats",
     "dynamic_truth_table",
+    "enable_profiling",
     "energy_calculation",
     "energy_distribution",
+    "energy_window_restriction",
     "enumerate_all_paths",
     "enumerate_all_paths_params",
     "eq_type",
     "equivalence_checking",
+    "equivalence_checking_params",
     "equivalence_checking_stats",
     "euclidean_distance",
     "exact_cartesian",
@@ -482,6 +512,7 @@ __all__ = [
     "inml_layout",
     "inml_technology",
     "input_bdl_configuration",
+    "input_pattern_order",
     "is_balanced",
     "is_charged_defect_type",
     "is_crossable_wire",
@@ -492,8 +523,10 @@ __all__ = [
     "is_neutral_defect_type",
     "is_neutrally_charged_defect",
     "is_operational",
+    "is_operational_batch",
     "is_operational_params",
     "is_positively_charged_defect",
+    "is_profiling_enabled",
     "kink_induced_non_operational_input_patterns",
     "manhattan_distance",
     # "maximum_defect_influence_distance_params",
@@ -540,11 +573,15 @@ __all__ = [
     "post_layout_optimization_params",
     "post_layout_optimization_stats",
     "potential_to_distance_conversion",
+    "profiling_params",
+    "profiling_summary",
     "qca_layout",
     "qca_technology",
     "quickexact",
+    "quickexact_batch",
     "quickexact_params",
     "quicksim",
+    "quicksim_batch",
     "quicksim_params",
     "random_coordinate",
     "read_cartesian_fgl_layout",
@@ -555,6 +592,7 @@ __all__ = [
     "read_sqd_layout_111",
     "read_technology_network",
     "reserve_input_nodes",
+    "reset_profiling",
     "route_path",
     # "write_location_and_ground_state",
     "sample_writing_mode",
@@ -579,6 +617,8 @@ __all__ = [
     "sidb_simulation_result_111",
     "sidb_technology",
     "sign_to_charge_state",
+    "sim_anneal",
+    "sim_anneal_params",
     "simulate",
     "siqad_area",
     "siqad_coordinate",
@@ -608,6 +648,7 @@ __all__ = [
     "wiring_reduction",
     "wiring_reduction_params",
     "wiring_reduction_stats",
+    "write_chrome_trace",
     "write_critical_temperature_domain",
     "write_critical_temperature_domain_to_string",
     "write_dot_layout",
@@ -618,6 +659,7 @@ __all__ = [
     "write_operational_domain",
     "write_operational_domain_params",
     "write_operational_domain_to_string",
+    "write_profiling_summary",
     "write_qca_layout",
     "write_qca_layout_params",
     "write_qca_layout_svg",
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <string>
+#include <utility>
 
 namespace pyfiction
 {
@@ -92,6 +93,23 @@ void bdl_input_iterator(pybind11::module& m, const std::string& lattice)
             { return self[n]; }, py::arg("m"), DOC(fiction_bdl_input_iterator_operator_array))
 
         .def("num_input_pairs", &fiction::bdl_input_iterator<Lyt>::num_input_pairs)
+        .def("get_current_input_index", &fiction::bdl_input_iterator<Lyt>::get_current_input_index,
+             DOC(fiction_bdl_input_iterator_get_current_input_index))
+        .def("get_input_pattern_of_state", &fiction::bdl_input_iterator<Lyt>::get_input_pattern_of_state,
+             py::arg("state"), DOC(fiction_bdl_input_iterator_get_input_pattern_of_state))
+        .def(
+            "set_input_pattern",
+            [](fiction::bdl_input_iterator<Lyt>& self, const uint64_t pattern) -> fiction::bdl_input_iterator<Lyt>&
+            { return self.set_input_pattern(pattern); }, py::arg("pattern"),
+            DOC(fiction_bdl_input_iterator_set_input_pattern))
+        .def(
+            "get_delta",
+            [](const fiction::bdl_input_iterator<Lyt>& self)
+            {
+                const auto& delta = self.get_delta();
+                return std::make_pair(delta.removed_sidbs, delta.added_sidbs);
+            },
+            DOC(fiction_bdl_input_iterator_get_delta))
         .def("get_layout", [](const fiction::bdl_input_iterator<Lyt>& self) -> const Lyt& { return *self; })
 
         ;
@@ -114,6 +132,15 @@ inline void bdl_input_iterator(pybind11::module& m)
                fiction::bdl_input_iterator_params::input_bdl_configuration::PERTURBER_DISTANCE_ENCODED,
                DOC(fiction_bdl_input_iterator_params_input_bdl_configuration_PERTURBER_DISTANCE_ENCODED));
 
+    /**
+     * Input pattern order
+     */
+    py::enum_<typename fiction::bdl_input_iterator_params::input_pattern_order>(m, "input_pattern_order")
+        .value("BINARY", fiction::bdl_input_iterator_params::input_pattern_order::BINARY,
+               DOC(fiction_bdl_input_iterator_params_input_pattern_order_BINARY))
+        .value("GRAY_CODE", fiction::bdl_input_iterator_params::input_pattern_order::GRAY_CODE,
+               DOC(fiction_bdl_input_iterator_params_input_pattern_order_GRAY_CODE));
+
     /**
      * BDL input iterator parameters.
      */
@@ -122,7 +149,9 @@ inline void bdl_input_iterator(pybind11::module& m)
         .def_readwrite("bdl_wire_params", &fiction::bdl_input_iterator_params::bdl_wire_params,
                        DOC(fiction_bdl_input_iterator_params_bdl_wire_params))
         .def_readwrite("input_bdl_config", &fiction::bdl_input_iterator_params::input_bdl_config,
-                       DOC(fiction_bdl_input_iterator_params_input_bdl_config));
+                       DOC(fiction_bdl_input_iterator_params_input_bdl_config))
+        .def_readwrite("input_order", &fiction::bdl_input_iterator_params::input_order,
+                       DOC(fiction_bdl_input_iterator_params_input_order));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
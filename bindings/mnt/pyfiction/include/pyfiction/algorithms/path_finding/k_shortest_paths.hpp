@@ -62,6 +62,8 @@ inline void yen_k_shortest_paths(pybind11::module& m)
         .def(py::init<>())
         .def_readwrite("a_star_params", &fiction::yen_k_shortest_paths_params::astar_params,
                        DOC(fiction_yen_k_shortest_paths_params_astar_params))
+        .def_readwrite("num_threads", &fiction::yen_k_shortest_paths_params::num_threads,
+                       DOC(fiction_yen_k_shortest_paths_params_num_threads))
 
         ;
 
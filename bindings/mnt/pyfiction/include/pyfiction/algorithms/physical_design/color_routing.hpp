@@ -60,6 +60,7 @@ inline void color_routing(pybind11::module& m)
         .value("LMXRLF", fiction::graph_coloring_engine::LMXRLF, DOC(fiction_graph_coloring_engine_LMXRLF))
         .value("TABUCOL", fiction::graph_coloring_engine::TABUCOL, DOC(fiction_graph_coloring_engine_TABUCOL))
         .value("SAT", fiction::graph_coloring_engine::SAT, DOC(fiction_graph_coloring_engine_SAT))
+        .value("PORTFOLIO", fiction::graph_coloring_engine::PORTFOLIO, DOC(fiction_graph_coloring_engine_PORTFOLIO))
 
         ;
 
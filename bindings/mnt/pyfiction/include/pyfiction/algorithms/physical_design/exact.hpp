@@ -90,6 +90,8 @@ inline void exact(pybind11::module& m)
                       DOC(fiction_exact_physical_design_stats_num_crossings))
         .def_readonly("num_aspect_ratios", &fiction::exact_physical_design_stats::num_aspect_ratios,
                       DOC(fiction_exact_physical_design_stats_num_aspect_ratios))
+        .def_readonly("num_symmetric_aspect_ratios", &fiction::exact_physical_design_stats::num_symmetric_aspect_ratios,
+                      DOC(fiction_exact_physical_design_stats_num_symmetric_aspect_ratios))
 
         ;
 
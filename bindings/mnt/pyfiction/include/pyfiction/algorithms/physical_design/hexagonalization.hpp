@@ -39,7 +39,9 @@ inline void hexagonalization(pybind11::module& m)
         .def_readwrite("input_pin_extension", &fiction::hexagonalization_params::input_pin_extension,
                        DOC(fiction_hexagonalization_params_input_pin_extension))
         .def_readwrite("output_pin_extension", &fiction::hexagonalization_params::output_pin_extension,
-                       DOC(fiction_hexagonalization_params_output_pin_extension));
+                       DOC(fiction_hexagonalization_params_output_pin_extension))
+        .def_readwrite("num_threads", &fiction::hexagonalization_params::num_threads,
+                       DOC(fiction_hexagonalization_params_num_threads));
 
     py::class_<fiction::hexagonalization_stats>(m, "hexagonalization_stats", DOC(fiction_hexagonalization_stats))
         .def(py::init<>())
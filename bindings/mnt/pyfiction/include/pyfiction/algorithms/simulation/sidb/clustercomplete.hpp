@@ -7,6 +7,7 @@
 
 #if (FICTION_ALGLIB_ENABLED)
 
+#include "pyfiction/batch.hpp"
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
@@ -16,6 +17,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace pyfiction
 {
 
@@ -28,7 +32,18 @@ void clustercomplete(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("clustercomplete", &fiction::clustercomplete<Lyt>, py::arg("lyt"),
-          py::arg("params") = fiction::clustercomplete_params<>{}, DOC(fiction_clustercomplete));
+          py::arg("params") = fiction::clustercomplete_params<>{}, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_clustercomplete));
+
+    m.def(
+        "clustercomplete_batch",
+        [](const std::vector<Lyt>& lyts, const fiction::clustercomplete_params<>& params, const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&params](const Lyt& lyt) { return fiction::clustercomplete(lyt, params); }, num_threads);
+        },
+        py::arg("lyts"), py::arg("params") = fiction::clustercomplete_params<>{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_clustercomplete_batch));
 }
 
 }  // namespace detail
@@ -58,6 +73,8 @@ inline void clustercomplete(pybind11::module& m)
                        DOC(fiction_clustercomplete_params_local_external_potential))
         .def_readwrite("global_potential", &fiction::clustercomplete_params<>::global_potential,
                        DOC(fiction_clustercomplete_params_global_potential))
+        .def_readwrite("energy_window", &fiction::clustercomplete_params<>::energy_window,
+                       DOC(fiction_clustercomplete_params_energy_window))
         .def_readwrite("validity_witness_partitioning_max_cluster_size_gss",
                        &fiction::clustercomplete_params<>::validity_witness_partitioning_max_cluster_size_gss,
                        DOC(fiction_clustercomplete_params_validity_witness_partitioning_max_cluster_size_gss))
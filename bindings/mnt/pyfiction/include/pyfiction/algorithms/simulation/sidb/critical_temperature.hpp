@@ -5,6 +5,7 @@
 #ifndef PYFICTION_CRITICAL_TEMPERATURE_HPP
 #define PYFICTION_CRITICAL_TEMPERATURE_HPP
 
+#include "pyfiction/batch.hpp"
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
@@ -13,7 +14,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace pyfiction
 {
@@ -28,11 +31,35 @@ void critical_temperature(pybind11::module& m)
 
     m.def("critical_temperature_gate_based", &fiction::critical_temperature_gate_based<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_gate_based));
 
     m.def("critical_temperature_non_gate_based", &fiction::critical_temperature_non_gate_based<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_non_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_non_gate_based));
+
+    m.def(
+        "critical_temperature_gate_based_batch",
+        [](const std::vector<Lyt>& lyts, const std::vector<py_tt>& spec,
+           const fiction::critical_temperature_params& params, const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&spec, &params](const Lyt& lyt)
+                { return fiction::critical_temperature_gate_based(lyt, spec, params); }, num_threads);
+        },
+        py::arg("lyts"), py::arg("spec"), py::arg("params") = fiction::critical_temperature_params{},
+        py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+        DOC(pyfiction_critical_temperature_gate_based_batch));
+
+    m.def(
+        "critical_temperature_non_gate_based_batch",
+        [](const std::vector<Lyt>& lyts, const fiction::critical_temperature_params& params, const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&params](const Lyt& lyt) { return fiction::critical_temperature_non_gate_based(lyt, params); },
+                num_threads);
+        },
+        py::arg("lyts"), py::arg("params") = fiction::critical_temperature_params{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_critical_temperature_non_gate_based_batch));
 }
 
 }  // namespace detail
@@ -65,6 +92,16 @@ inline void critical_temperature(pybind11::module& m)
 
         ;
 
+    /**
+     * Energy window restriction.
+     */
+    py::enum_<fiction::critical_temperature_params::energy_window_restriction>(
+        m, "energy_window_restriction", DOC(fiction_critical_temperature_params_energy_window_restriction))
+        .value("ON", fiction::critical_temperature_params::energy_window_restriction::ON,
+               DOC(fiction_critical_temperature_params_energy_window_restriction_ON))
+        .value("OFF", fiction::critical_temperature_params::energy_window_restriction::OFF,
+               DOC(fiction_critical_temperature_params_energy_window_restriction_OFF));
+
     /**
      * Critical temperature parameters.
      */
@@ -76,7 +113,11 @@ inline void critical_temperature(pybind11::module& m)
         .def_readwrite("confidence_level", &fiction::critical_temperature_params::confidence_level,
                        DOC(fiction_critical_temperature_params_confidence_level))
         .def_readwrite("max_temperature", &fiction::critical_temperature_params::max_temperature,
-                       DOC(fiction_critical_temperature_params_max_temperature));
+                       DOC(fiction_critical_temperature_params_max_temperature))
+        .def_readwrite("energy_window", &fiction::critical_temperature_params::energy_window,
+                       DOC(fiction_critical_temperature_params_energy_window))
+        .def_readwrite("number_threads", &fiction::critical_temperature_params::number_threads,
+                       DOC(fiction_critical_temperature_params_number_threads));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
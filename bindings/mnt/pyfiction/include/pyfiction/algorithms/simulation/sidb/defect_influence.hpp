@@ -27,7 +27,7 @@ void maximum_defect_influence_distance(pybind11::module& m)
     m.def("maximum_defect_influence_position_and_distance",
           &fiction::maximum_defect_influence_position_and_distance<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::maximum_defect_influence_distance_params{},
-          DOC(fiction_maximum_defect_influence_position_and_distance));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_maximum_defect_influence_position_and_distance));
 }
 
 }  // namespace detail
@@ -34,7 +34,7 @@ void determine_displacement_robustness_domain(pybind11::module& m, const std::st
 
     m.def(fmt::format("determine_displacement_robustness_domain_{}", lattice).c_str(),
           &fiction::determine_displacement_robustness_domain<Lyt, py_tt>, py::arg("layout"), py::arg("spec"),
-          py::arg("params"), py::arg("stats") = nullptr);
+          py::arg("params"), py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace detail
@@ -56,7 +56,9 @@ inline void determine_displacement_robustness_domain(pybind11::module& m)
         .value("EXHAUSTIVE", fiction::displacement_robustness_domain_params<
                                  fiction::offset::ucoord_t>::displacement_analysis_mode::EXHAUSTIVE)
         .value("RANDOM", fiction::displacement_robustness_domain_params<
-                             fiction::offset::ucoord_t>::displacement_analysis_mode::RANDOM);
+                             fiction::offset::ucoord_t>::displacement_analysis_mode::RANDOM)
+        .value("MONTE_CARLO", fiction::displacement_robustness_domain_params<
+                                  fiction::offset::ucoord_t>::displacement_analysis_mode::MONTE_CARLO);
 
     py::class_<fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>>(
         m, "displacement_robustness_domain_params")
@@ -74,7 +76,20 @@ inline void determine_displacement_robustness_domain(pybind11::module& m)
         .def_readwrite("fixed_sidbs",
                        &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::fixed_sidbs)
         .def_readwrite("dimer_policy",
-                       &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::dimer_policy);
+                       &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::dimer_policy)
+        .def_readwrite(
+            "confidence_interval_width",
+            &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::confidence_interval_width)
+        .def_readwrite("confidence_level",
+                       &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::confidence_level)
+        .def_readwrite(
+            "max_number_of_samples",
+            &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::max_number_of_samples)
+        .def_readwrite("batch_size",
+                       &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::batch_size)
+        .def_readwrite("number_of_threads",
+                       &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::number_of_threads)
+        .def_readwrite("seed", &fiction::displacement_robustness_domain_params<fiction::offset::ucoord_t>::seed);
 
     py::class_<fiction::displacement_robustness_domain_stats>(m, "displacement_robustness_domain_stats")
         .def(py::init<>())
@@ -82,7 +97,11 @@ inline void determine_displacement_robustness_domain(pybind11::module& m)
         .def_readwrite("num_operational_sidb_displacements",
                        &fiction::displacement_robustness_domain_stats::num_operational_sidb_displacements)
         .def_readwrite("num_non_operational_sidb_displacements",
-                       &fiction::displacement_robustness_domain_stats::num_non_operational_sidb_displacements);
+                       &fiction::displacement_robustness_domain_stats::num_non_operational_sidb_displacements)
+        .def_readwrite("confidence_interval_lower_bound",
+                       &fiction::displacement_robustness_domain_stats::confidence_interval_lower_bound)
+        .def_readwrite("confidence_interval_upper_bound",
+                       &fiction::displacement_robustness_domain_stats::confidence_interval_upper_bound);
 
     // NOTE: be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::determine_displacement_robustness_domain<py_sidb_100_lattice>(m, "100");
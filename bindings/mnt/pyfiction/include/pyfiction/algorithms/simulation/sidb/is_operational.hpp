@@ -5,6 +5,7 @@
 #ifndef PYFICTION_IS_OPERATIONAL_HPP
 #define PYFICTION_IS_OPERATIONAL_HPP
 
+#include "pyfiction/batch.hpp"
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
@@ -14,6 +15,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
 #include <optional>
 #include <vector>
 
@@ -32,20 +34,21 @@ void is_operational(pybind11::module& m)
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
               &fiction::is_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
-          DOC(fiction_is_operational));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_is_operational));
 
     m.def("is_operational",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&,
                             const std::vector<fiction::bdl_wire<Lyt>>&, const std::vector<fiction::bdl_wire<Lyt>>&,
                             const std::optional<Lyt>&>(&fiction::is_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params"), py::arg("input_bdl_wire"), py::arg("output_bdl_wire"),
-          py::arg("canvas_lyt") = std::nullopt, DOC(fiction_is_operational_2));
+          py::arg("canvas_lyt") = std::nullopt, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_is_operational_2));
 
     m.def("operational_input_patterns",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
               &fiction::operational_input_patterns<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
-          DOC(fiction_operational_input_patterns));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_input_patterns));
 
     m.def("operational_input_patterns",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&,
@@ -53,13 +56,13 @@ void is_operational(pybind11::module& m)
                             const std::optional<Lyt>&>(&fiction::operational_input_patterns<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
           py::arg("input_bdl_wire"), py::arg("output_bdl_wire"), py::arg("canvas_lyt") = std::nullopt,
-          DOC(fiction_operational_input_patterns_2));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_input_patterns_2));
 
     m.def("kink_induced_non_operational_input_patterns",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
               &fiction::kink_induced_non_operational_input_patterns<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
-          DOC(fiction_kink_induced_non_operational_input_patterns));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_kink_induced_non_operational_input_patterns));
 
     m.def(
         "kink_induced_non_operational_input_patterns",
@@ -67,20 +70,45 @@ void is_operational(pybind11::module& m)
                           const std::vector<fiction::bdl_wire<Lyt>>&, const std::vector<fiction::bdl_wire<Lyt>>&,
                           const std::optional<Lyt>&>(&fiction::kink_induced_non_operational_input_patterns<Lyt, py_tt>),
         py::arg("lyt"), py::arg("spec"), py::arg("params"), py::arg("input_bdl_wire"), py::arg("output_bdl_wire"),
-        py::arg("canvas_lyt") = std::nullopt, DOC(fiction_kink_induced_non_operational_input_patterns_2));
+        py::arg("canvas_lyt") = std::nullopt, py::call_guard<py::gil_scoped_release>(),
+        DOC(fiction_kink_induced_non_operational_input_patterns_2));
 
     m.def("is_kink_induced_non_operational",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&>(
               &fiction::is_kink_induced_non_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
-          DOC(fiction_is_kink_induced_non_operational));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_is_kink_induced_non_operational));
 
     m.def("is_kink_induced_non_operational",
           py::overload_cast<const Lyt&, const std::vector<py_tt>&, const fiction::is_operational_params&,
                             const std::vector<fiction::bdl_wire<Lyt>>&, const std::vector<fiction::bdl_wire<Lyt>>&,
                             const std::optional<Lyt>&>(&fiction::is_kink_induced_non_operational<Lyt, py_tt>),
           py::arg("lyt"), py::arg("spec"), py::arg("params"), py::arg("input_bdl_wire"), py::arg("output_bdl_wire"),
-          py::arg("canvas_lyt") = std::nullopt, DOC(fiction_is_kink_induced_non_operational_2));
+          py::arg("canvas_lyt") = std::nullopt, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_is_kink_induced_non_operational_2));
+
+    m.def(
+        "is_operational_batch",
+        [](const std::vector<Lyt>& lyts, const std::vector<py_tt>& spec, const fiction::is_operational_params& params,
+           const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&spec, &params](const Lyt& lyt) { return fiction::is_operational(lyt, spec, params); },
+                num_threads);
+        },
+        py::arg("lyts"), py::arg("spec"), py::arg("params") = fiction::is_operational_params{},
+        py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_is_operational_batch));
+
+    m.def(
+        "is_operational_batch",
+        [](const Lyt& lyt, const std::vector<py_tt>& spec, const std::vector<fiction::is_operational_params>& params,
+           const uint64_t num_threads)
+        {
+            return batch_apply(
+                params, [&lyt, &spec](const auto& p) { return fiction::is_operational(lyt, spec, p); }, num_threads);
+        },
+        py::arg("lyt"), py::arg("spec"), py::arg("params"), py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_is_operational_batch_2));
 }
 
 }  // namespace detail
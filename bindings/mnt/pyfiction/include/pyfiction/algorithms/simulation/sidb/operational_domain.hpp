@@ -6,15 +6,22 @@
 #define PYFICTION_OPERATIONAL_DOMAIN_HPP
 
 #include "pyfiction/documentation.hpp"
+#include "pyfiction/numpy_views.hpp"
 #include "pyfiction/types.hpp"
 
 #include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
 
 #include <fmt/format.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace pyfiction
@@ -30,19 +37,22 @@ void operational_domain(pybind11::module& m)
 
     m.def("operational_domain_grid_search", &fiction::operational_domain_grid_search<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_operational_domain_grid_search));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_grid_search));
 
     m.def("operational_domain_random_sampling", &fiction::operational_domain_random_sampling<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_random_sampling));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_random_sampling));
 
     m.def("operational_domain_flood_fill", &fiction::operational_domain_flood_fill<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_flood_fill));
 
     m.def("operational_domain_contour_tracing", &fiction::operational_domain_contour_tracing<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_contour_tracing));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_contour_tracing));
 }
 
 template <typename Lyt>
@@ -52,21 +62,99 @@ void critical_temperature_domain(pybind11::module& m)
 
     m.def("critical_temperature_domain_grid_search", &fiction::critical_temperature_domain_grid_search<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_grid_search));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_grid_search));
 
     m.def("critical_temperature_domain_random_sampling",
           &fiction::critical_temperature_domain_random_sampling<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_random_sampling));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_random_sampling));
 
     m.def("critical_temperature_domain_flood_fill", &fiction::critical_temperature_domain_flood_fill<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_flood_fill));
 
     m.def("critical_temperature_domain_contour_tracing",
           &fiction::critical_temperature_domain_contour_tracing<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_contour_tracing));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_contour_tracing));
+}
+
+/**
+ * Converts the given domain into NumPy arrays in a single pass over its entries. The parameter values of all points
+ * are written into one `(n, d)` array and each value type of the domain into one column of length `n`.
+ *
+ * @tparam Domain Domain type, i.e., `operational_domain` or `critical_temperature_domain`.
+ * @param domain The domain to convert.
+ * @return Tuple of the coordinate array, the boolean operational status array and, for critical temperature domains,
+ * the critical temperature array.
+ */
+template <typename Domain>
+pybind11::tuple domain_to_numpy(const Domain& domain)
+{
+    namespace py = pybind11;
+
+    constexpr bool has_critical_temperature = std::is_same_v<Domain, fiction::critical_temperature_domain>;
+
+    std::vector<double>  coordinates{};
+    std::vector<uint8_t> operational{};
+    std::vector<double>  critical_temperatures{};
+
+    operational.reserve(domain.size());
+    coordinates.reserve(domain.size() * domain.get_number_of_dimensions());
+
+    if constexpr (has_critical_temperature)
+    {
+        critical_temperatures.reserve(domain.size());
+    }
+
+    std::size_t num_dimensions = domain.get_number_of_dimensions();
+    bool        consistent     = true;
+
+    domain.for_each(
+        [&](const fiction::parameter_point& pp, const auto& value)
+        {
+            const auto& parameters = pp.get_parameters();
+
+            if (operational.empty())
+            {
+                num_dimensions = parameters.size();
+            }
+            else if (parameters.size() != num_dimensions)
+            {
+                consistent = false;
+            }
+
+            coordinates.insert(coordinates.cend(), parameters.cbegin(), parameters.cend());
+            operational.push_back(std::get<0>(value) == fiction::operational_status::OPERATIONAL ? 1 : 0);
+
+            if constexpr (has_critical_temperature)
+            {
+                critical_temperatures.push_back(std::get<1>(value));
+            }
+        });
+
+    if (!consistent)
+    {
+        throw py::value_error("All parameter points must have the same number of dimensions");
+    }
+
+    const auto num_points = static_cast<py::ssize_t>(operational.size());
+
+    auto coordinate_array =
+        owning_array(std::move(coordinates), {num_points, static_cast<py::ssize_t>(num_dimensions)});
+    auto operational_array = owning_array(std::move(operational), {num_points}, py::dtype("bool"));
+
+    if constexpr (has_critical_temperature)
+    {
+        return py::make_tuple(std::move(coordinate_array), std::move(operational_array),
+                              owning_array(std::move(critical_temperatures), {num_points}));
+    }
+    else
+    {
+        return py::make_tuple(std::move(coordinate_array), std::move(operational_array));
+    }
 }
 
 }  // namespace detail
@@ -110,6 +198,8 @@ inline void operational_domain(pybind11::module& m)
              DOC(fiction_critical_temperature_domain_minimum_ct))
         .def("maximum_ct", &fiction::critical_temperature_domain::maximum_ct,
              DOC(fiction_critical_temperature_domain_maximum_ct))
+        .def("to_numpy", &detail::domain_to_numpy<fiction::critical_temperature_domain>,
+             DOC(pyfiction_critical_temperature_domain_to_numpy))
 
         // Pythonic interface functions
         .def("__getitem__",
@@ -176,6 +266,8 @@ inline void operational_domain(pybind11::module& m)
              DOC(fiction_operational_domain_get_dimension))
         .def("get_number_of_dimensions", &fiction::operational_domain::get_number_of_dimensions,
              DOC(fiction_operational_domain_get_number_of_dimensions))
+        .def("to_numpy", &detail::domain_to_numpy<fiction::operational_domain>,
+             DOC(pyfiction_operational_domain_to_numpy))
 
         // Pythonic interface functions
         .def("__getitem__",
@@ -5,6 +5,7 @@
 #ifndef PYFICTION_QUICKEXACT_HPP
 #define PYFICTION_QUICKEXACT_HPP
 
+#include "pyfiction/batch.hpp"
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
@@ -14,6 +15,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace pyfiction
 {
 
@@ -26,7 +30,24 @@ void quickexact(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quickexact", &fiction::quickexact<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quickexact_params<>{},
-          DOC(fiction_quickexact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quickexact));
+
+    m.def(
+        "quickexact_batch",
+        [](const std::vector<Lyt>& lyts, const fiction::quickexact_params<>& params, const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&params](const Lyt& lyt) { return fiction::quickexact(lyt, params); }, num_threads);
+        },
+        py::arg("lyts"), py::arg("params") = fiction::quickexact_params<>{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_quickexact_batch));
+
+    m.def(
+        "quickexact_batch",
+        [](const Lyt& lyt, const std::vector<fiction::quickexact_params<>>& params, const uint64_t num_threads)
+        { return batch_apply(params, [&lyt](const auto& p) { return fiction::quickexact(lyt, p); }, num_threads); },
+        py::arg("lyt"), py::arg("params"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+        DOC(pyfiction_quickexact_batch_2));
 }
 
 }  // namespace detail
@@ -54,7 +75,9 @@ inline void quickexact(pybind11::module& m)
         .def_readwrite("local_external_potential", &fiction::quickexact_params<>::local_external_potential,
                        DOC(fiction_quickexact_params_local_external_potential))
         .def_readwrite("global_potential", &fiction::quickexact_params<>::global_potential,
-                       DOC(fiction_quickexact_params_global_potential));
+                       DOC(fiction_quickexact_params_global_potential))
+        .def_readwrite("energy_window", &fiction::quickexact_params<>::energy_window,
+                       DOC(fiction_quickexact_params_energy_window));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
@@ -5,6 +5,7 @@
 #ifndef PYFICTION_QUICKSIM_HPP
 #define PYFICTION_QUICKSIM_HPP
 
+#include "pyfiction/batch.hpp"
 #include "pyfiction/documentation.hpp"
 #include "pyfiction/types.hpp"
 
@@ -13,6 +14,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace pyfiction
 {
 
@@ -25,7 +29,24 @@ void quicksim(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quicksim", &fiction::quicksim<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quicksim_params{},
-          DOC(fiction_quicksim));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quicksim));
+
+    m.def(
+        "quicksim_batch",
+        [](const std::vector<Lyt>& lyts, const fiction::quicksim_params& params, const uint64_t num_threads)
+        {
+            return batch_apply(
+                lyts, [&params](const Lyt& lyt) { return fiction::quicksim(lyt, params); }, num_threads);
+        },
+        py::arg("lyts"), py::arg("params") = fiction::quicksim_params{}, py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(), DOC(pyfiction_quicksim_batch));
+
+    m.def(
+        "quicksim_batch",
+        [](const Lyt& lyt, const std::vector<fiction::quicksim_params>& params, const uint64_t num_threads)
+        { return batch_apply(params, [&lyt](const auto& p) { return fiction::quicksim(lyt, p); }, num_threads); },
+        py::arg("lyt"), py::arg("params"), py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+        DOC(pyfiction_quicksim_batch_2));
 }
 
 }  // namespace detail
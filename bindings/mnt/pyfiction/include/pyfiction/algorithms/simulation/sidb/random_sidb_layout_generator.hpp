@@ -81,7 +81,10 @@ inline void random_sidb_layout_generator(pybind11::module& m)
         .def_readwrite("maximal_attempts_for_multiple_layouts",
                        &fiction::generate_random_sidb_layout_params<
                            fiction::offset::ucoord_t>::maximal_attempts_for_multiple_layouts,
-                       DOC(fiction_generate_random_sidb_layout_params_maximal_attempts_for_multiple_layouts));
+                       DOC(fiction_generate_random_sidb_layout_params_maximal_attempts_for_multiple_layouts))
+        .def_readwrite("number_threads",
+                       &fiction::generate_random_sidb_layout_params<fiction::offset::ucoord_t>::number_threads,
+                       DOC(fiction_generate_random_sidb_layout_params_number_threads));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::random_layout_generator<py_sidb_100_lattice>(m);
@@ -45,6 +45,7 @@ inline void sidb_simulation_engine(pybind11::module& m)
         .value("CLUSTERCOMPLETE", fiction::sidb_simulation_engine::CLUSTERCOMPLETE,
                DOC(fiction_sidb_simulation_engine_CLUSTERCOMPLETE))
 #endif  // FICTION_ALGLIB_ENABLED
+        .value("SIMANNEAL", fiction::sidb_simulation_engine::SIMANNEAL, DOC(fiction_sidb_simulation_engine_SIMANNEAL))
 
         ;
 
@@ -64,6 +65,8 @@ inline void sidb_simulation_engine(pybind11::module& m)
                                                          DOC(fiction_heuristic_sidb_simulation_engine))
         .value("QUICKSIM", fiction::heuristic_sidb_simulation_engine::QUICKSIM,
                DOC(fiction_heuristic_sidb_simulation_engine_QUICKSIM))
+        .value("SIMANNEAL", fiction::heuristic_sidb_simulation_engine::SIMANNEAL,
+               DOC(fiction_heuristic_sidb_simulation_engine_SIMANNEAL))
 
         ;
 
@@ -0,0 +1,72 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef PYFICTION_SIM_ANNEAL_HPP
+#define PYFICTION_SIM_ANNEAL_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/algorithms/simulation/sidb/sim_anneal.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+void sim_anneal(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    m.def("sim_anneal", &fiction::sim_anneal<Lyt>, py::arg("lyt"), py::arg("params") = fiction::sim_anneal_params{},
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_sim_anneal));
+}
+
+}  // namespace detail
+
+inline void sim_anneal(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    /**
+     * SimAnneal parameters.
+     */
+    py::class_<fiction::sim_anneal_params>(m, "sim_anneal_params", DOC(fiction_sim_anneal_params))
+        .def(py::init<>())
+        .def_readwrite("simulation_parameters", &fiction::sim_anneal_params::simulation_parameters,
+                       DOC(fiction_sim_anneal_params_simulation_parameters))
+        .def_readwrite("number_of_chains", &fiction::sim_anneal_params::number_of_chains,
+                       DOC(fiction_sim_anneal_params_number_of_chains))
+        .def_readwrite("initial_temperature", &fiction::sim_anneal_params::initial_temperature,
+                       DOC(fiction_sim_anneal_params_initial_temperature))
+        .def_readwrite("final_temperature", &fiction::sim_anneal_params::final_temperature,
+                       DOC(fiction_sim_anneal_params_final_temperature))
+        .def_readwrite("cooling_factor", &fiction::sim_anneal_params::cooling_factor,
+                       DOC(fiction_sim_anneal_params_cooling_factor))
+        .def_readwrite("sweeps_per_temperature", &fiction::sim_anneal_params::sweeps_per_temperature,
+                       DOC(fiction_sim_anneal_params_sweeps_per_temperature))
+        .def_readwrite("hop_probability", &fiction::sim_anneal_params::hop_probability,
+                       DOC(fiction_sim_anneal_params_hop_probability))
+        .def_readwrite("chemical_potential_spread", &fiction::sim_anneal_params::chemical_potential_spread,
+                       DOC(fiction_sim_anneal_params_chemical_potential_spread))
+        .def_readwrite("number_threads", &fiction::sim_anneal_params::number_threads,
+                       DOC(fiction_sim_anneal_params_number_threads))
+        .def_readwrite("seed", &fiction::sim_anneal_params::seed, DOC(fiction_sim_anneal_params_seed))
+
+        ;
+
+    // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
+
+    detail::sim_anneal<py_sidb_100_lattice>(m);
+    detail::sim_anneal<py_sidb_111_lattice>(m);
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_SIM_ANNEAL_HPP
@@ -24,12 +24,20 @@ void time_to_solution(pybind11::module& m)
 {
     namespace py = pybind11;
 
-    m.def("time_to_solution", &fiction::time_to_solution<Lyt>, py::arg("lyt"), py::arg("quicksim_params"),
-          py::arg("tts_params") = fiction::time_to_solution_params{}, py::arg("ps") = nullptr,
-          DOC(fiction_time_to_solution));
+    m.def("time_to_solution",
+          py::overload_cast<const Lyt&, const fiction::quicksim_params&, const fiction::time_to_solution_params&,
+                            fiction::time_to_solution_stats*>(&fiction::time_to_solution<Lyt>),
+          py::arg("lyt"), py::arg("quicksim_params"), py::arg("tts_params") = fiction::time_to_solution_params{},
+          py::arg("ps") = nullptr, py::call_guard<py::gil_scoped_release>(), DOC(fiction_time_to_solution));
+    m.def("time_to_solution",
+          py::overload_cast<const Lyt&, const fiction::sim_anneal_params&, const fiction::time_to_solution_params&,
+                            fiction::time_to_solution_stats*>(&fiction::time_to_solution<Lyt>),
+          py::arg("lyt"), py::arg("sim_anneal_params"), py::arg("tts_params") = fiction::time_to_solution_params{},
+          py::arg("ps") = nullptr, py::call_guard<py::gil_scoped_release>(), DOC(fiction_time_to_solution_2));
     m.def("time_to_solution_for_given_simulation_results", &fiction::time_to_solution_for_given_simulation_results<Lyt>,
           py::arg("results_exact"), py::arg("results_heuristic"), py::arg("confidence_level") = 0.997,
-          py::arg("ps") = nullptr, DOC(fiction_time_to_solution_for_given_simulation_results));
+          py::arg("ps") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_time_to_solution_for_given_simulation_results));
 }
 
 }  // namespace detail
@@ -72,6 +72,8 @@ inline void design_rule_violations(pybind11::module& m)
         .def_readwrite("io_pins", &fiction::gate_level_drv_params::io_pins, DOC(fiction_gate_level_drv_params_io_pins))
         .def_readwrite("border_io", &fiction::gate_level_drv_params::border_io,
                        DOC(fiction_gate_level_drv_params_border_io))
+        .def_readwrite("num_threads", &fiction::gate_level_drv_params::num_threads,
+                       DOC(fiction_gate_level_drv_params_num_threads))
 
         ;
 
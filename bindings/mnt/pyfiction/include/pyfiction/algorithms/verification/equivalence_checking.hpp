@@ -26,10 +26,11 @@ void equivalence_checking(pybind11::module& m)
 
     m.def(
         "equivalence_checking",
-        [](const Spec& spec, const Impl& impl, fiction::equivalence_checking_stats* pst = nullptr) -> fiction::eq_type
+        [](const Spec& spec, const Impl& impl, fiction::equivalence_checking_stats* pst = nullptr,
+           const fiction::equivalence_checking_params& params = {}) -> fiction::eq_type
         {
             fiction::equivalence_checking_stats stats{};
-            fiction::equivalence_checking(spec, impl, &stats);
+            fiction::equivalence_checking(spec, impl, params, &stats);
 
             if (pst != nullptr)
             {
@@ -39,7 +40,7 @@ void equivalence_checking(pybind11::module& m)
             return stats.eq;
         },
         py::arg("specification"), py::arg("implementation"), py::arg("statistics") = nullptr,
-        DOC(fiction_equivalence_checking));
+        py::arg("params") = fiction::equivalence_checking_params{}, DOC(fiction_equivalence_checking));
 }
 
 }  // namespace detail
@@ -58,6 +59,19 @@ inline void equivalence_checking(pybind11::module& m)
 
         ;
 
+    py::class_<fiction::equivalence_checking_params>(m, "equivalence_checking_params",
+                                                     DOC(fiction_equivalence_checking_params))
+        .def(py::init<>())
+        .def_readwrite("max_exhaustive_simulation_pis",
+                       &fiction::equivalence_checking_params::max_exhaustive_simulation_pis,
+                       DOC(fiction_equivalence_checking_params_max_exhaustive_simulation_pis))
+        .def_readwrite("num_random_patterns", &fiction::equivalence_checking_params::num_random_patterns,
+                       DOC(fiction_equivalence_checking_params_num_random_patterns))
+        .def_readwrite("seed", &fiction::equivalence_checking_params::seed,
+                       DOC(fiction_equivalence_checking_params_seed))
+
+        ;
+
     py::class_<fiction::equivalence_checking_stats>(m, "equivalence_checking_stats",
                                                     DOC(fiction_equivalence_checking_stats))
         .def(py::init<>())
@@ -76,6 +90,10 @@ inline void equivalence_checking(pybind11::module& m)
                       DOC(fiction_equivalence_checking_stats_spec_drv_stats))
         .def_readonly("impl_drv_stats", &fiction::equivalence_checking_stats::impl_drv_stats,
                       DOC(fiction_equivalence_checking_stats_impl_drv_stats))
+        .def_readonly("simulated_patterns", &fiction::equivalence_checking_stats::simulated_patterns,
+                      DOC(fiction_equivalence_checking_stats_simulated_patterns))
+        .def_readonly("sat_solver_invoked", &fiction::equivalence_checking_stats::sat_solver_invoked,
+                      DOC(fiction_equivalence_checking_stats_sat_solver_invoked))
 
         ;
 
@@ -0,0 +1,112 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef PYFICTION_BATCH_HPP
+#define PYFICTION_BATCH_HPP
+
+#include <fiction/utils/profiling.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace pyfiction
+{
+
+/**
+ * Applies `fn` to all given inputs in parallel and returns the results in the order of the inputs. This function is
+ * used to implement the batch entry points of pyfiction that process lists of layouts or parameter sets in C++ instead
+ * of requiring Python-side multiprocessing. It must be called without holding the GIL, i.e., `fn` must not interact
+ * with Python objects.
+ *
+ * If `fn` throws, the remaining inputs are skipped and the first exception is rethrown once all threads have finished.
+ *
+ * @tparam Input Input type.
+ * @tparam Fn Callable that maps a `const Input&` to a default-constructible result.
+ * @param inputs Inputs to process.
+ * @param fn Function to apply to each input.
+ * @param num_threads Number of threads to use. If `0`, the number of hardware threads is used.
+ * @return Results of `fn` for all inputs.
+ */
+template <typename Input, typename Fn>
+[[nodiscard]] std::vector<std::invoke_result_t<Fn, const Input&>> batch_apply(const std::vector<Input>& inputs,
+                                                                               Fn&& fn, uint64_t num_threads = 0)
+{
+    // std::vector<bool> packs its elements into shared words, which cannot be written concurrently
+    static_assert(!std::is_same_v<std::invoke_result_t<Fn, const Input&>, bool>, "Fn must not return bool");
+
+    std::vector<std::invoke_result_t<Fn, const Input&>> results(inputs.size());
+
+    if (num_threads == 0)
+    {
+        num_threads = std::max(uint64_t{1}, static_cast<uint64_t>(std::thread::hardware_concurrency()));
+    }
+
+    num_threads = std::min(num_threads, static_cast<uint64_t>(inputs.size()));
+
+    // index of the next input to process
+    std::atomic<std::size_t> next_input{0};
+
+    std::exception_ptr first_exception{};
+    std::mutex         exception_mutex{};
+
+    fiction::thread_idle_recorder idle_recorder{"pyfiction::batch_apply::thread_idle_time"};
+
+    const auto process_inputs = [&]()
+    {
+        for (auto i = next_input++; i < inputs.size(); i = next_input++)
+        {
+            try
+            {
+                results[i] = fn(inputs[i]);
+            }
+            catch (...)
+            {
+                const std::lock_guard lock{exception_mutex};
+
+                if (!first_exception)
+                {
+                    first_exception = std::current_exception();
+                }
+
+                // skip all remaining inputs
+                next_input = inputs.size();
+            }
+        }
+
+        idle_recorder.worker_finished();
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+
+    for (uint64_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(process_inputs);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    idle_recorder.threads_joined();
+
+    if (first_exception)
+    {
+        std::rethrow_exception(first_exception);
+    }
+
+    return results;
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_BATCH_HPP
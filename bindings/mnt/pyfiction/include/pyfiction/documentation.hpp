@@ -92,4 +92,270 @@ empty layout coordinates.
 Returns:
     The minimum  and maximum enclosing coordinate in the associated layout.)doc";
 
+static const char* __doc_pyfiction_charge_distribution_surface_get_all_sidb_charges_array =
+    R"doc(Returns the charge states of all SiDBs as a read-only NumPy array of
+type ``int8`` without copying them. The entries are ordered as in
+``get_sidb_order`` and encode the charge states by their signs, i.e.,
+``-1`` for negative, ``0`` for neutral, and ``1`` for positive SiDBs.
+
+The array is a view into the charge distribution surface and reflects
+subsequent charge assignments. It is invalidated if cells are assigned
+or the surface is reinitialized; use ``numpy.array(view)`` to obtain an
+independent copy.
+
+Returns:
+    Read-only view of the SiDB charge states.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_chargeless_potential_matrix =
+    R"doc(Returns the chargeless electrostatic potentials between all pairs of
+SiDBs as a read-only two-dimensional NumPy array of type ``float64``
+without copying them (unit: V). Rows and columns are ordered as in
+``get_sidb_order``. The array is empty if the surface was initialized
+with ``cds_configuration.CHARGE_LOCATION_ONLY``.
+
+The array is a view into the charge distribution surface and reflects
+subsequent changes of the physical parameters. It is invalidated if
+cells are assigned or the surface is reinitialized; use
+``numpy.array(view)`` to obtain an independent copy.
+
+Returns:
+    Read-only view of the chargeless potential matrix.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_local_external_potentials =
+    R"doc(Returns the local external electrostatic potentials at all SiDBs as a
+read-only NumPy array of type ``float64`` without copying them (unit:
+V). The entries are ordered as in ``get_sidb_order``.
+
+The array is a view into the charge distribution surface and reflects
+subsequent updates of the external potentials. It is invalidated if
+cells are assigned or the surface is reinitialized; use
+``numpy.array(view)`` to obtain an independent copy.
+
+Returns:
+    Read-only view of the local external electrostatic potentials.)doc";
+
+static const char* __doc_pyfiction_charge_distribution_surface_get_local_internal_potentials =
+    R"doc(Returns the local internal electrostatic potentials, i.e., the
+potentials generated by charged SiDBs and defects, at all SiDBs as a
+read-only NumPy array of type ``float64`` without copying them (unit:
+V). The entries are ordered as in ``get_sidb_order``.
+
+The array is a view into the charge distribution surface and reflects
+subsequent potential updates. It is invalidated if cells are assigned
+or the surface is reinitialized; use ``numpy.array(view)`` to obtain an
+independent copy.
+
+Returns:
+    Read-only view of the local internal electrostatic potentials.)doc";
+
+static const char* __doc_pyfiction_clustercomplete_batch =
+    R"doc(Runs ``clustercomplete`` on multiple layouts in parallel. The GIL is
+released for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    ClusterComplete parameters that are applied to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``clustercomplete`` in the order of the given
+    layouts.)doc";
+
+static const char* __doc_pyfiction_critical_temperature_domain_to_numpy =
+    R"doc(Converts the domain into NumPy arrays in a single pass. Row ``i`` of
+all returned arrays belongs to the same parameter point. The order of
+the points is unspecified but consistent across the arrays.
+
+Returns:
+    A tuple ``(coordinates, operational, critical_temperatures)`` where
+    ``coordinates`` is a ``float64`` array of shape ``(n, d)`` that
+    holds the parameter values of the ``n`` points in ``d``
+    dimensions, ``operational`` is a ``bool`` array of shape ``(n,)``
+    that is ``True`` for operational points, and
+    ``critical_temperatures`` is a ``float64`` array of shape ``(n,)``
+    that holds the critical temperatures (unit: K).)doc";
+
+static const char* __doc_pyfiction_critical_temperature_gate_based_batch =
+    R"doc(Runs ``critical_temperature_gate_based`` on multiple layouts in
+parallel. The GIL is released for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``spec``:
+    Expected Boolean function of the layouts given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Critical temperature parameters that are applied to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``critical_temperature_gate_based`` in the order of
+    the given layouts.)doc";
+
+static const char* __doc_pyfiction_critical_temperature_non_gate_based_batch =
+    R"doc(Runs ``critical_temperature_non_gate_based`` on multiple layouts in
+parallel. The GIL is released for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    Critical temperature parameters that are applied to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``critical_temperature_non_gate_based`` in the
+    order of the given layouts.)doc";
+
+static const char* __doc_pyfiction_is_operational_batch =
+    R"doc(Runs ``is_operational`` on multiple layouts in parallel. The GIL is
+released for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``spec``:
+    Expected Boolean function of the layouts given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    Parameters for the operational status assessment that are applied
+    to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``is_operational`` in the order of the given
+    layouts.)doc";
+
+static const char* __doc_pyfiction_is_operational_batch_2 =
+    R"doc(Runs ``is_operational`` on a single layout for multiple parameter sets
+in parallel. The GIL is released for the entire batch.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``params``:
+    The parameter sets to apply.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``is_operational`` in the order of the given
+    parameter sets.)doc";
+
+static const char* __doc_pyfiction_operational_domain_to_numpy =
+    R"doc(Converts the domain into NumPy arrays in a single pass. Row ``i`` of
+both returned arrays belongs to the same parameter point. The order of
+the points is unspecified but consistent across the arrays.
+
+Returns:
+    A tuple ``(coordinates, operational)`` where ``coordinates`` is a
+    ``float64`` array of shape ``(n, d)`` that holds the parameter
+    values of the ``n`` points in ``d`` dimensions and ``operational``
+    is a ``bool`` array of shape ``(n,)`` that is ``True`` for
+    operational points.)doc";
+
+static const char* __doc_pyfiction_profiling_summary =
+    R"doc(Returns the aggregated instrumentation data of all threads. Timers,
+counters, and histograms are keyed by their name. The data is only
+collected if pyfiction was compiled with ``FICTION_PROFILING`` (see
+``PROFILING_COMPILED_IN``) and profiling was enabled via
+``enable_profiling``.
+
+Returns:
+    A dictionary with the keys ``timers``, ``counters``,
+    ``histograms``, and ``dropped trace events``.)doc";
+
+static const char* __doc_pyfiction_quickexact_batch =
+    R"doc(Runs ``quickexact`` on multiple layouts in parallel. The GIL is
+released for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    QuickExact parameters that are applied to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``quickexact`` in the order of the given layouts.)doc";
+
+static const char* __doc_pyfiction_quickexact_batch_2 =
+    R"doc(Runs ``quickexact`` on a single layout for multiple parameter sets in
+parallel. The GIL is released for the entire batch.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``params``:
+    The parameter sets to apply.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``quickexact`` in the order of the given parameter
+    sets.)doc";
+
+static const char* __doc_pyfiction_quicksim_batch =
+    R"doc(Runs ``quicksim`` on multiple layouts in parallel. The GIL is released
+for the entire batch.
+
+Parameter ``lyts``:
+    The layouts to simulate.
+
+Parameter ``params``:
+    QuickSim parameters that are applied to all layouts.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``quicksim`` in the order of the given layouts.)doc";
+
+static const char* __doc_pyfiction_quicksim_batch_2 =
+    R"doc(Runs ``quicksim`` on a single layout for multiple parameter sets in
+parallel. The GIL is released for the entire batch.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``params``:
+    The parameter sets to apply.
+
+Parameter ``num_threads``:
+    Number of threads to use. If ``0``, the number of hardware threads
+    is used.
+
+Returns:
+    The results of ``quicksim`` in the order of the given parameter
+    sets.)doc";
+
 #endif  // PYFICTION_DOCSTRINGS_HPP
@@ -26,6 +26,8 @@ inline void write_qca_layout(pybind11::module& m)
         .def(py::init<>())
         .def_readwrite("create_inter_layer_via_cells", &fiction::write_qca_layout_params::create_inter_layer_via_cells,
                        DOC(fiction_write_qca_layout_params_create_inter_layer_via_cells))
+        .def_readwrite("num_threads", &fiction::write_qca_layout_params::num_threads,
+                       DOC(fiction_write_qca_layout_params_num_threads))
 
         ;
 
@@ -92,6 +92,8 @@ void write_svg_layout(pybind11::module& m)
                        DOC(fiction_write_sidb_layout_svg_params_color_background))
         .def_readwrite("lattice_mode", &fiction::write_sidb_layout_svg_params::lattice_mode,
                        DOC(fiction_write_sidb_layout_svg_params_lattice_mode))
+        .def_readwrite("num_threads", &fiction::write_sidb_layout_svg_params::num_threads,
+                       DOC(fiction_write_sidb_layout_svg_params_num_threads))
 
         ;
 
@@ -99,7 +101,9 @@ void write_svg_layout(pybind11::module& m)
                                                      DOC(fiction_write_qca_layout_svg_params))
         .def(py::init<>())
         .def_readwrite("simple", &fiction::write_qca_layout_svg_params::simple,
-                       DOC(fiction_write_qca_layout_svg_params_simple));
+                       DOC(fiction_write_qca_layout_svg_params_simple))
+        .def_readwrite("num_threads", &fiction::write_qca_layout_svg_params::num_threads,
+                       DOC(fiction_write_qca_layout_svg_params_num_threads));
     ;
 
     detail::write_sidb_layout_svg_impl<py_charge_distribution_surface_111>(m);
@@ -0,0 +1,70 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef PYFICTION_NUMPY_VIEWS_HPP
+#define PYFICTION_NUMPY_VIEWS_HPP
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <utility>
+#include <vector>
+
+namespace pyfiction
+{
+
+/**
+ * Creates a read-only NumPy array that views the contiguous data of the given vector without copying it. The Python
+ * object `owner` is referenced by the array to keep the C++ object that holds `data` alive as long as the view exists.
+ *
+ * The view reflects all subsequent in-place modifications of `data`. It is invalidated if `data` is reallocated, which
+ * is why it must only be created over storage whose size does not change during the lifetime of `owner`'s state.
+ *
+ * @tparam T NumPy element type. Must have the same size as `Value`.
+ * @tparam Value Element type of the vector.
+ * @param data Vector to view.
+ * @param shape Shape of the resulting array. The product of its entries must equal `data.size()`.
+ * @param owner Python object that owns `data`.
+ * @return Read-only NumPy array over `data`.
+ */
+template <typename T, typename Value>
+[[nodiscard]] pybind11::array_t<T> read_only_view(const std::vector<Value>& data,
+                                                  const std::vector<pybind11::ssize_t>& shape,
+                                                  const pybind11::handle& owner)
+{
+    static_assert(sizeof(T) == sizeof(Value), "T and Value must have the same size");
+
+    pybind11::array_t<T> view{shape, reinterpret_cast<const T*>(data.data()), owner};
+
+    // the C++ object must not be modified through the view
+    pybind11::detail::array_proxy(view.ptr())->flags &= ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+    return view;
+}
+
+/**
+ * Creates a NumPy array that takes ownership of the given vector without copying its data. This allows results that
+ * are assembled in C++ to be handed to Python without an additional copy and without creating a Python object per
+ * element.
+ *
+ * @tparam T Element type of the vector.
+ * @param data Vector to move into the array.
+ * @param shape Shape of the resulting array. The product of its entries must equal `data.size()`.
+ * @param dt NumPy data type of the array. Its item size must equal `sizeof(T)`.
+ * @return NumPy array that owns `data`.
+ */
+template <typename T>
+[[nodiscard]] pybind11::array owning_array(std::vector<T>&& data, const std::vector<pybind11::ssize_t>& shape,
+                                           const pybind11::dtype& dt = pybind11::dtype::of<T>())
+{
+    auto* const storage = new std::vector<T>(std::move(data));
+
+    const pybind11::capsule owner{storage, [](void* ptr) { delete static_cast<std::vector<T>*>(ptr); }};
+
+    return pybind11::array{dt, shape, storage->data(), owner};
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_NUMPY_VIEWS_HPP
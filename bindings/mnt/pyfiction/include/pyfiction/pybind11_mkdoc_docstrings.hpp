@@ -195,6 +195,116 @@ Parameter ``n``:
 Returns:
     A vector of all possible edge paths leading from terminals to `v`.)doc";
 
+static const char *__doc_fiction_all_paths_enumerator =
+R"doc(A lazy generator for all paths in a layout that start at a given
+source coordinate and lead to a given target coordinate. Paths are
+generated one at a time on demand via `next()` in the same order in
+which `enumerate_all_paths` returns them. Thus, callers that only
+require a subset of all paths, e.g., because they stop after a certain
+number of paths or after finding a path with a desired property,
+neither have to wait for nor store the remaining ones.
+
+The generator implements a depth-first search with an explicit stack
+instead of recursion. Thereby, its memory consumption is linear in the
+length of the longest path and independent of the number of paths.
+Coordinates along the current path are tracked in a `coordinate_set`,
+which is a bitset over the layout's coordinates if `Lyt` uses
+`offset::ucoord_t`.
+
+See `enumerate_all_paths` for a description of the generated paths.
+The layout must outlive the generator and must not be modified while
+paths are generated.
+
+Template parameter ``Path``:
+    Type of the generated paths.
+
+Template parameter ``Lyt``:
+    Type of the layout to perform path finding on.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_all_paths_enumerator =
+R"doc(Standard constructor.
+
+Parameter ``lyt``:
+    The layout whose paths are to be enumerated.
+
+Parameter ``obj``:
+    Source-target coordinate pair.
+
+Parameter ``p``:
+    Parameters.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_current_path =
+R"doc(The current path from `objective.source` to the coordinate on top of
+the stack.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_layout = R"doc(The layout whose paths are to be enumerated.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_next =
+R"doc(Generates the next path from `objective.source` to `objective.target`.
+
+Returns:
+    The next path or `std::nullopt` if all paths have been generated
+    already.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_objective = R"doc(The source-target coordinate pair.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_params = R"doc(Routing parameters.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_pop =
+R"doc(Removes the top coordinate from the current path and the stack and
+marks it as unvisited to allow it in other paths.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_push =
+R"doc(Appends the given coordinate to the current path and pushes its
+successors onto the stack. If the coordinate is the target, the
+current path is complete and no successors are pushed.
+
+Parameter ``c``:
+    Coordinate to append to the current path.
+
+Returns:
+    `true` iff `c` is the target coordinate.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_stack =
+R"doc(Depth-first search stack that contains one frame for each coordinate
+of the current path.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_stack_frame =
+R"doc(A coordinate on the current path together with its successors and the
+index of the next one to explore.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_stack_frame_coord = R"doc(Coordinate on the current path.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_stack_frame_next_successor = R"doc(Index of the next successor to explore.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_stack_frame_successors =
+R"doc(Successors of `coord` that are neither obstructed nor reachable only
+via an obstructed connection.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_started =
+R"doc(Flag to indicate whether the source coordinate has been pushed
+already.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_successors =
+R"doc(Collects the successors of coordinate `src` that paths can be extended
+by. If the given layout implements the obstruction interface (see
+`obstruction_layout`), obstructed coordinates and connections are
+skipped. If the given layout is a gate-level layout and implements the
+obstruction interface (see `obstruction_layout`), successors may be
+located in the crossing layer if specified in the parameters. Wire
+crossings are only allowed over other wires and only if the crossing
+layer is not obstructed. Furthermore, it is ensured that crossings do
+not run along another wire but cross only in a single point
+(orthogonal crossings + knock-knees/double wires).
+
+Parameter ``src``:
+    Coordinate whose successors are to be collected.
+
+Returns:
+    All coordinates that paths ending in `src` can be extended by.)doc";
+
+static const char *__doc_fiction_all_paths_enumerator_visited = R"doc(Set of coordinates on the current path.)doc";
+
 static const char *__doc_fiction_all_standard_2_input_functions =
 R"doc(Auxiliary function to create technology mapping parameters for AND,
 OR, NAND, NOR, XOR, XNOR, and NOT gates.
@@ -261,10 +371,22 @@ Template parameter ``GateLyt``:
 Parameter ``lyt``:
     The gate-level layout.
 
+Parameter ``params``:
+    Parameters.
+
 Returns:
     A cell-level layout that implements `lyt`'s gate types with
     building blocks defined in `GateLibrary`.)doc";
 
+static const char *__doc_fiction_apply_gate_library_params = R"doc(Parameters for `apply_gate_library`.)doc";
+
+static const char *__doc_fiction_apply_gate_library_params_num_threads =
+R"doc(Number of threads to use for expanding tiles into cells. Each thread
+sets up the gate implementations of a contiguous range of tiles, and
+the resulting cells are inserted into the pre-allocated cell-level
+layout in tile order. By default, the number of threads is set to the
+number of available hardware threads.)doc";
+
 static const char *__doc_fiction_apply_gate_library_to_defective_surface =
 R"doc(Applies a gate library to a given gate-level layout and maps the SiDB
 and defect locations onto a defect surface. The gate library type
@@ -289,6 +411,12 @@ Template parameter ``GateLyt``:
 Parameter ``lyt``:
     The gate-level layout.
 
+Parameter ``defect_surface``:
+    Defect surface whose defects are copied to the resulting layout.
+
+Parameter ``params``:
+    Parameters.
+
 Returns:
     A cell-level layout that implements `lyt`'s gate types with
     building blocks defined in `GateLibrary`.)doc";
@@ -602,6 +730,19 @@ static const char *__doc_fiction_band_bending_resilience_params_assess_populatio
 
 static const char *__doc_fiction_band_bending_resilience_params_bdl_iterator_params = R"doc(Parameters for the input BDL iterator.)doc";
 
+static const char *__doc_fiction_bdl_input_delta =
+R"doc(The SiDBs that changed between two input states of a
+`bdl_input_iterator`. If both vectors have the same size, the
+:math:`i`-th removed SiDB and the :math:`i`-th added SiDB belong to
+the same input BDL pair.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.)doc";
+
+static const char *__doc_fiction_bdl_input_delta_added_sidbs = R"doc(Cells to which SiDBs were added.)doc";
+
+static const char *__doc_fiction_bdl_input_delta_removed_sidbs = R"doc(Cells whose SiDBs were removed.)doc";
+
 static const char *__doc_fiction_bdl_input_iterator =
 R"doc(Iterator that iterates over all possible input states of a BDL layout.
 There are :math:`2^n` possible input states for an :math:`n`-input BDL
@@ -614,6 +755,16 @@ creates and stores a deep-copy of the given layout. The state
 enumeration wraps around, i.e., after the last possible input state,
 the first input state is set again.
 
+If `input_order` is set to `GRAY_CODE` in the parameters, the input
+states are enumerated in Gray code order, i.e., the :math:`i`-th input
+state applies the input pattern :math:`i \oplus \lfloor i / 2
+\rfloor` and consecutive input states differ in a single input. The
+SiDBs that changed with the last state change can be obtained via
+`get_delta`. Together with
+`charge_distribution_surface::apply_sidb_delta`, this allows to update
+electrostatic properties incrementally instead of recomputing them for
+each input pattern.
+
 The iterator satisfies the requirements of
 `LegacyRandomAccessIterator` and can be used in iterator-based `for`
 loops.
@@ -621,6 +772,16 @@ loops.
 Template parameter ``Lyt``:
     SiDB cell-level layout type.)doc";
 
+static const char *__doc_fiction_bdl_input_iterator_assign_input_cell =
+R"doc(Assigns the given cell type to the given input cell and records the
+change in `delta`.
+
+Parameter ``c``:
+    Input cell to assign.
+
+Parameter ``ct``:
+    Cell type to assign.)doc";
+
 static const char *__doc_fiction_bdl_input_iterator_bdl_input_iterator =
 R"doc(Standard constructor. It alters the layout to set the first input
 state, which assigns binary `0` to all input BDL pairs.
@@ -649,6 +810,8 @@ static const char *__doc_fiction_bdl_input_iterator_current_input_index =
 R"doc(The current input index. There are :math:`2^n` possible input states
 for an :math:`n`-input BDL layout.)doc";
 
+static const char *__doc_fiction_bdl_input_iterator_delta = R"doc(The SiDBs that changed with the last change of the input state.)doc";
+
 static const char *__doc_fiction_bdl_input_iterator_determine_last_bdl_for_each_wire =
 R"doc(This function iterates through each wire in `input_bdl_wires`,
 identifies the first BDL pair of type `INPUT`, and then finds the BDL
@@ -660,11 +823,33 @@ starting pair. The resulting last BDL pairs are stored in
 accessible within the scope.)doc";
 
 static const char *__doc_fiction_bdl_input_iterator_get_current_input_index =
-R"doc(Returns the current input index.
+R"doc(Returns the input pattern of the current input state. In `BINARY`
+order, it is equal to the position of the iterator. In `GRAY_CODE`
+order, it is the Gray code of the position.
 
 Returns:
     The current input index.)doc";
 
+static const char *__doc_fiction_bdl_input_iterator_get_delta =
+R"doc(Returns the SiDBs that were removed and added by the last change of
+the input state. Input BDL dots that were set already are not
+reported. After construction, the delta holds the changes that were
+applied to the given layout to set the first input state.
+
+Returns:
+    The SiDBs that changed with the last change of the input state.)doc";
+
+static const char *__doc_fiction_bdl_input_iterator_get_input_pattern_of_state =
+R"doc(Returns the input pattern that is applied at the given input state. In
+`BINARY` order, it is equal to the input state. In `GRAY_CODE` order,
+it is the Gray code of the input state.
+
+Parameter ``state``:
+    The input state, i.e., the position of the iterator.
+
+Returns:
+    The input pattern that is applied at the given input state.)doc";
+
 static const char *__doc_fiction_bdl_input_iterator_input_bdl_wires = R"doc(The detected input BDL wires.)doc";
 
 static const char *__doc_fiction_bdl_input_iterator_input_pairs = R"doc(The detected input BDL pairs.)doc";
@@ -877,13 +1062,36 @@ R"doc(An input of `1` is generated by placing a perturber closer to the BDL
 wire, whereas a `0` is produced by positioning the perturber farther
 away (as described in https://dl.acm.org/doi/10.1145/3489517.3530525).)doc";
 
+static const char *__doc_fiction_bdl_input_iterator_params_input_order = R"doc(The order in which the input patterns are enumerated.)doc";
+
+static const char *__doc_fiction_bdl_input_iterator_params_input_pattern_order = R"doc(Orders in which the input patterns are enumerated.)doc";
+
+static const char *__doc_fiction_bdl_input_iterator_params_input_pattern_order_BINARY =
+R"doc(The :math:`i`-th input state is the input pattern :math:`i`, i.e., the
+patterns are enumerated in ascending binary order.)doc";
+
+static const char *__doc_fiction_bdl_input_iterator_params_input_pattern_order_GRAY_CODE =
+R"doc(The :math:`i`-th input state is the input pattern :math:`i \oplus
+\lfloor i / 2 \rfloor`, i.e., the patterns are enumerated in Gray code
+order. Consecutive input states differ in a single input, which
+minimizes the number of SiDBs that change between them.)doc";
+
 static const char *__doc_fiction_bdl_input_iterator_set_all_inputs =
 R"doc(Sets all input cells of the layout according to the current input
 index. The input index is interpreted as a binary number, where the
 :math:`i`-th bit represents the input state of the :math:`i`-th input
 BDL pair. If the bit is `1`, the lower BDL dot is set and the upper
 BDL dot removed. If the bit is `0`, the upper BDL dot is removed and
-the lower BDL dot set.)doc";
+the lower BDL dot set. Cells whose type actually changes are recorded
+in `delta`.)doc";
+
+static const char *__doc_fiction_bdl_input_iterator_set_input_pattern =
+R"doc(Sets the input state that applies the given input pattern. In `BINARY`
+order, this is equivalent to the assignment operator. In `GRAY_CODE`
+order, the input state is the inverse Gray code of the pattern.
+
+Parameter ``pattern``:
+    The input pattern to apply.)doc";
 
 static const char *__doc_fiction_bdl_pair =
 R"doc(A Binary-dot Logic (BDL) pair is a pair of SiDBs that are close to
@@ -1519,6 +1727,27 @@ Parameter ``sim_params``:
     Physical parameters used to determine whether positively charged
     SiDBs can occur.)doc";
 
+static const char *__doc_fiction_canonical_cell_layout_hash =
+R"doc(Computes a hash value of the given cell-level layout that does not
+depend on the order in which its cells were assigned. It covers the
+same properties as `are_cell_layouts_identical`, i.e., the positions
+and types of all cells, defects (if applicable), and charge states (if
+applicable). Hence, layouts that are identical have identical hash
+values, which allows to find identical layouts in large collections
+without pairwise comparisons.
+
+@note Different layouts can have identical hash values. Use
+`are_cell_layouts_identical` to confirm a match.
+
+Template parameter ``Lyt``:
+    The layout type. Must be a cell-level layout.
+
+Parameter ``lyt``:
+    The layout to hash.
+
+Returns:
+    Hash value of `lyt`.)doc";
+
 static const char *__doc_fiction_cartesian_combinations =
 R"doc(This function computes the Cartesian product of a list of vectors.
 Each vector in the input list represents a dimension, and the function
@@ -2530,6 +2759,16 @@ R"doc(Returns the number of primary output cells in the layout.
 Returns:
     Number of primary output cells.)doc";
 
+static const char *__doc_fiction_cell_level_layout_reserve =
+R"doc(Pre-allocates memory for the given number of cells such that bulk
+insertions, e.g., when applying a gate library to a large gate-level
+layout, do not repeatedly grow and rehash the cell type storage. Under
+`dense_coordinate_storage`, the cell grid is allocated to span the
+current layout bounds instead.
+
+Parameter ``num_cells``:
+    Expected total number of cells.)doc";
+
 static const char *__doc_fiction_cell_level_layout_set_layout_name =
 R"doc(Assigns or overrides the layout name.
 
@@ -2606,8 +2845,69 @@ static const char *__doc_fiction_charge_distribution_surface_4 = R"doc()doc";
 
 static const char *__doc_fiction_charge_distribution_surface_5 = R"doc()doc";
 
+static const char *__doc_fiction_charge_distribution_surface_apply_sidb_delta =
+R"doc(This function applies a change of SiDB positions, e.g., the change
+between two input patterns that is reported by `bdl_input_iterator`.
+Each removed SiDB is paired with an added one and moved via
+`move_sidb` in :math:`\mathcal{O}(N)` time. If the numbers of removed
+and added SiDBs differ, the surplus SiDBs are removed or added via
+`assign_cell_type`, which reinitializes the charge distribution
+surface.
+
+Parameter ``removed_sidbs``:
+    Cells whose SiDBs are removed.
+
+Parameter ``added_sidbs``:
+    Empty cells to which SiDBs are added.
+
+Parameter ``added_type``:
+    Cell type of surplus added SiDBs. Moved SiDBs keep their cell
+    type.)doc";
+
+static const char *__doc_fiction_charge_distribution_surface_change_charge_state_by_index =
+R"doc(This function changes the charge state of the SiDB at the given index
+and incrementally updates the local internal electrostatic potentials
+of all SiDBs as well as the system's electrostatic potential energy.
+While `update_after_charge_change` recomputes all local potentials in
+:math:`\mathcal{O}(N^2)` time, this update requires
+:math:`\mathcal{O}(N)` time only, where :math:`N` is the number of
+SiDBs. It is therefore suited for local search algorithms that change
+one charge state at a time. Neither the charge index nor the physical
+validity are updated.
+
+@note The local electrostatic potentials at defect positions are not
+updated.
+
+Parameter ``index``:
+    The index of the SiDB whose charge state is to be changed.
+
+Parameter ``cs``:
+    The new charge state of the SiDB.)doc";
+
 static const char *__doc_fiction_charge_distribution_surface_charge_distribution_surface = R"doc()doc";
 
+static const char *__doc_fiction_charge_distribution_surface_move_sidb =
+R"doc(This function moves an SiDB to an empty cell and incrementally
+updates the distance and potential matrices, the local electrostatic
+potentials of all SiDBs, and the system's electrostatic potential
+energy. While assigning cell types reinitializes the charge
+distribution surface in :math:`\mathcal{O}(N^2)` time, this update
+requires :math:`\mathcal{O}(N)` time only, where :math:`N` is the
+number of SiDBs. The moved SiDB keeps its cell type, its charge state,
+and its index. Hence, the order of SiDBs may differ from the one of a
+freshly constructed charge distribution surface. A local external
+potential that is stored for `from` is carried over to `to`. Neither
+the charge index nor the physical validity are updated.
+
+@note Cells that were determined by
+`is_three_state_simulation_required` are not updated.
+
+Parameter ``from``:
+    Cell of the SiDB to move.
+
+Parameter ``to``:
+    Empty cell to move the SiDB to.)doc";
+
 static const char *__doc_fiction_charge_index_mode =
 R"doc(An enumeration of modes for handling the charge index during charge
 state assignment.)doc";
@@ -3082,6 +3382,14 @@ static const char *__doc_fiction_clustercomplete_params_available_threads =
 R"doc(Number of threads to make available to *ClusterComplete* for the
 unfolding stage.)doc";
 
+static const char *__doc_fiction_clustercomplete_params_energy_window =
+R"doc(Only physically valid charge distributions whose electrostatic
+potential energy exceeds the one of the ground state by at most this
+value are returned (unit: eV). Charge distributions outside the window
+above the lowest energy found so far are discarded during the
+unfolding stage. By default, all physically valid charge distributions
+are returned.)doc";
+
 static const char *__doc_fiction_clustercomplete_params_global_potential =
 R"doc(Global external electrostatic potential. Value is applied on each cell
 in the layout.)doc";
@@ -3405,6 +3713,77 @@ static const char *__doc_fiction_coord_iterator_operator_mul = R"doc()doc";
 
 static const char *__doc_fiction_coord_iterator_operator_ne = R"doc()doc";
 
+static const char *__doc_fiction_coordinate_set =
+R"doc(A set of coordinates of a given layout that is tailored to the visited
+sets of path finding algorithms. If `Lyt` uses `offset::ucoord_t` as
+its coordinate type, membership of coordinates within the layout
+bounds is stored in a bitset over their indices in row-major order
+with the layers outermost. This requires a single bit per coordinate
+and avoids hashing entirely. All other coordinates are stored in a
+hash set.
+
+Template parameter ``Lyt``:
+    Coordinate layout type.)doc";
+
+static const char *__doc_fiction_coordinate_set_bits = R"doc(Membership of all coordinates within the layout bounds.)doc";
+
+static const char *__doc_fiction_coordinate_set_contains =
+R"doc(Checks whether the given coordinate is contained in the set.
+
+Parameter ``c``:
+    Coordinate to check.
+
+Returns:
+    `true` iff `c` is contained in the set.)doc";
+
+static const char *__doc_fiction_coordinate_set_coordinate_set =
+R"doc(Standard constructor. Allocates the bitset for the bounds of the given
+layout.
+
+Parameter ``lyt``:
+    Layout whose coordinates are to be stored.)doc";
+
+static const char *__doc_fiction_coordinate_set_depth = R"doc(Extents of the bitset.)doc";
+
+static const char *__doc_fiction_coordinate_set_erase =
+R"doc(Removes the given coordinate from the set.
+
+Parameter ``c``:
+    Coordinate to remove.)doc";
+
+static const char *__doc_fiction_coordinate_set_height = R"doc(Extents of the bitset.)doc";
+
+static const char *__doc_fiction_coordinate_set_index =
+R"doc(Computes the bitset index of the given coordinate.
+
+Parameter ``c``:
+    Coordinate within the bitset.
+
+Returns:
+    Index of `c` in `bits`.)doc";
+
+static const char *__doc_fiction_coordinate_set_insert =
+R"doc(Adds the given coordinate to the set.
+
+Parameter ``c``:
+    Coordinate to add.)doc";
+
+static const char *__doc_fiction_coordinate_set_is_dense = R"doc(Offset coordinates can be mapped to consecutive indices.)doc";
+
+static const char *__doc_fiction_coordinate_set_is_within_bitset =
+R"doc(Checks whether the given coordinate can be stored in the bitset.
+
+Parameter ``c``:
+    Coordinate to check.
+
+Returns:
+    `true` iff `c` is not dead and lies within the layout bounds
+    passed to the constructor.)doc";
+
+static const char *__doc_fiction_coordinate_set_sparse = R"doc(Coordinates that cannot be stored in the bitset.)doc";
+
+static const char *__doc_fiction_coordinate_set_width = R"doc(Extents of the bitset.)doc";
+
 static const char *__doc_fiction_cost_function_chi =
 R"doc(Calculates the cost function :math:` \chi = \sum_{i=1} w_{i} \cdot
 \chi_{i} ` by summing the product of normalized chi values :math:`
@@ -4119,6 +4498,27 @@ probability of less than the given percentage, is determined to be the
 critical temperature. For gate-based simulation, this is the
 probability of erroneous calculations of the gate.)doc";
 
+static const char *__doc_fiction_critical_temperature_params_energy_window =
+R"doc(Restriction of gate-based simulations to an energy window above the
+ground state. If `ON`, the
+`energy_between_ground_state_and_first_erroneous` statistic is only
+determined for erroneous states within the window and `num_valid_lyt`
+only counts charge distributions within the window. By default, the
+restriction is disabled.)doc";
+
+static const char *__doc_fiction_critical_temperature_params_energy_window_restriction =
+R"doc(Modes to restrict gate-based simulations to the charge distributions
+that are relevant for the critical temperature.)doc";
+
+static const char *__doc_fiction_critical_temperature_params_energy_window_restriction_OFF =
+R"doc(All physically valid charge distributions are considered.)doc";
+
+static const char *__doc_fiction_critical_temperature_params_energy_window_restriction_ON =
+R"doc(Charge distributions whose energy above the ground state is too large
+to be noticeably populated at `max_temperature` for the given
+`confidence_level` are discarded. The exact simulation engines prune
+them already during the enumeration.)doc";
+
 static const char *__doc_fiction_critical_temperature_params_iteration_steps =
 R"doc(Number of iteration steps for the *QuickSim* algorithm (only
 applicable if engine == QUICKSIM).)doc";
@@ -4127,6 +4527,10 @@ static const char *__doc_fiction_critical_temperature_params_max_temperature =
 R"doc(Maximum simulation temperature beyond which no simulation will be
 conducted (~ 126 °C by default) (unit: K).)doc";
 
+static const char *__doc_fiction_critical_temperature_params_number_threads =
+R"doc(Number of threads to simulate the input patterns of gate-based
+simulations in parallel.)doc";
+
 static const char *__doc_fiction_critical_temperature_params_operational_params =
 R"doc(The parameters used to determine if a layout is `operational` or `non-
 operational`.)doc";
@@ -5147,19 +5551,6 @@ static const char *__doc_fiction_detail_apply_gate_library_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_apply_gate_library_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_apply_gate_library_impl_assign_gate =
-R"doc(This function assigns a given FCN gate implementation to the total
-cell layout.
-
-Parameter ``c``:
-    Top-left cell of the tile where the gate is placed.
-
-Parameter ``g``:
-    Gate implementation.
-
-Parameter ``n``:
-    Corresponding node in the gate-level layout.)doc";
-
 static const char *__doc_fiction_detail_apply_gate_library_impl_cell_lyt = R"doc(Cell-level layout.)doc";
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_determine_aspect_ratio_for_cell_level_layout =
@@ -5175,8 +5566,46 @@ Returns:
     Aspect ratio for a cell-level layout that corresponds to the
     dimensions of the given gate-level layout.)doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_expand_gate =
+R"doc(This function collects the non-empty cells of a given FCN gate
+implementation in their absolute positions.
+
+Parameter ``c``:
+    Top-left cell of the tile where the gate is placed.
+
+Parameter ``g``:
+    Gate implementation.
+
+Parameter ``n``:
+    Corresponding node in the gate-level layout.
+
+Parameter ``cells``:
+    Container to append the cells of `g` to.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl_gate_lyt = R"doc(Gate-level layout.)doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_insert_cells =
+R"doc(Inserts the given cells into the cell-level layout in bulk. Memory for
+all cells is allocated up front.
+
+Parameter ``cells``:
+    Cells to insert in the order of insertion.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_min_nodes_per_thread =
+R"doc(Minimum number of nodes per thread. Smaller layouts are expanded
+sequentially as the overhead of spawning threads would outweigh the
+gains.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_placed_cell = R"doc(Non-empty cell of a gate implementation.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_placed_cell_node = R"doc(Node in the gate-level layout whose implementation contains the cell.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_placed_cell_position = R"doc(Position of the cell in the cell-level layout.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_placed_cell_type = R"doc(Type of the cell.)doc";
+
+static const char *__doc_fiction_detail_apply_gate_library_impl_ps = R"doc(Parameters.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl_run_parameterized_gate_library =
 R"doc(Run the cell layout generation process.
 
@@ -5217,6 +5646,52 @@ Parameter ``defect_lyt``:
 Returns:
     A `CellLyt` object representing the generated cell layout.)doc";
 
+static const char *__doc_fiction_detail_apply_gate_library_impl_top_left_cell =
+R"doc(Returns the top-leftmost cell of the given tile.
+
+Parameter ``t``:
+    Tile in the gate-level layout.
+
+Returns:
+    Top-leftmost cell of `t` in the cell-level layout.)doc";
+
+static const char *__doc_fiction_detail_bit_parallel_simulator =
+R"doc(Simulates a logic network or a gate-level layout bit-parallel on 64
+input patterns per machine word. Each node is evaluated word-wise as a
+sum of products over either the on-set or the off-set of its function,
+whichever is smaller. Only nodes in the transitive fanin of the
+primary outputs are simulated.
+
+Template parameter ``Ntk``:
+    Logic network or gate-level layout type.)doc";
+
+static const char *__doc_fiction_detail_bit_parallel_simulator_bit_parallel_simulator =
+R"doc(Standard constructor. Determines a topological order of all nodes in
+the transitive fanin of the primary outputs.
+
+Parameter ``network``:
+    Logic network or gate-level layout to simulate.)doc";
+
+static const char *__doc_fiction_detail_bit_parallel_simulator_is_acyclic =
+R"doc(Returns whether the simulated network or layout is free of
+combinational cycles. Cyclic structures cannot be simulated.
+
+Returns:
+    `true` iff all nodes in the transitive fanin of the primary
+    outputs could be ordered topologically.)doc";
+
+static const char *__doc_fiction_detail_bit_parallel_simulator_simulate =
+R"doc(Simulates a block of input patterns.
+
+Parameter ``pi_words``:
+    Input patterns as `num_words` consecutive words per primary input.
+
+Parameter ``num_words``:
+    Number of words per primary input.
+
+Returns:
+    Output values as `num_words` consecutive words per primary output.)doc";
+
 static const char *__doc_fiction_detail_calculate_offset_matrix =
 R"doc(Calculate an offset matrix based on a to-delete list in a
 `wiring_reduction_layout`.
@@ -5225,9 +5700,10 @@ The offset matrix represents the number of deletable coordinates in
 the same column but above of each specific coordinate when searching
 from left to right. When searching from top to bottom, the offset
 matrix represents the number of deletable coordinates in the same row
-but to the left of each specific coordinate. The matrix is initialized
-with zeros and updated by incrementing the values for each deletable
-coordinate.
+but to the left of each specific coordinate. The matrix is computed in
+:math:`\mathcal{O}(w \cdot h)` time by marking the coordinate below
+(right of) each deletable coordinate and accumulating these marks
+along the columns (rows).
 
 Template parameter ``WiringReductionLyt``:
     Type of the `wiring_reduction_layout`.
@@ -5259,6 +5735,23 @@ Parameter ``lyt``:
 Parameter ``moved_gates``:
     Moved gates counter to decrement if PO is moved.)doc";
 
+static const char *__doc_fiction_detail_clocking_components =
+R"doc(Partitions the tiles of all non-constant nodes of the given layout into
+connected components. Two tiles are connected if information flows
+between them or if one of them crosses the other. Clocking constraints
+only exist between connected tiles. Thus, the clock numbers of
+different components can be determined independently of each other.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Parameter ``lyt``:
+    The gate-level layout whose tiles are to be partitioned.
+
+Returns:
+    The tiles of each component in the order in which their nodes are
+    visited by `foreach_node`.)doc";
+
 static const char *__doc_fiction_detail_clustercomplete_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_clustercomplete_impl_add_composition =
@@ -5397,6 +5890,10 @@ Parameter ``top_cluster``:
     The top cluster that is returned by the *Ground State Space
     construction; it contains the entire cluster hierarchy construct.)doc";
 
+static const char *__doc_fiction_detail_clustercomplete_impl_energy_window =
+R"doc(Maximum energy above the ground state of the charge distributions to
+return (unit: eV).)doc";
+
 static const char *__doc_fiction_detail_clustercomplete_impl_extract_work_from_top_cluster =
 R"doc(Work in the form of compositions of charge space elements of the top
 cluster are extracted into a vector and shuffled at random before
@@ -5479,6 +5976,11 @@ Parameter ``work_from_top_cluster``:
     A vector containing all compositions of all charge space elements
     of the top cluster.)doc";
 
+static const char *__doc_fiction_detail_clustercomplete_impl_lowest_energy_found =
+R"doc(Lowest electrostatic potential energy of all charge distributions
+found so far (unit: eV). It is protected by
+`mutex_to_protect_the_simulation_results`.)doc";
+
 static const char *__doc_fiction_detail_clustercomplete_impl_lb_fail_onto_neutral_charge =
 R"doc(Performs V > e - mu+.
 
@@ -5758,6 +6260,39 @@ Parameter ``workers``:
 
 static const char *__doc_fiction_detail_clustercomplete_impl_workers = R"doc(Vector containing all workers.)doc";
 
+static const char *__doc_fiction_detail_collect_cuts =
+R"doc(Collects a maximal set of disjoint cuts through a
+`wiring_reduction_layout` in a single sweep and adds their coordinates
+to the to-delete list.
+
+Repeatedly searching for a cut via A* and obstructing it afterward
+explores the whole layout once per cut. Instead, this function
+performs a depth-first search from the upper left to the lower right
+corner that prefers the uppermost (leftmost) successors. Whenever a
+cut is found, it is obstructed via `update_to_delete_list` and the
+search restarts. Coordinates from which the lower right corner turned
+out to be unreachable are remembered across restarts because
+obstructions are only ever added. Since all cuts are monotone, the
+search graph is acyclic and each coordinate is discarded at most once,
+which results in a total runtime of :math:`\mathcal{O}(w \cdot h + k
+\cdot (w + h))` for :math:`k` cuts on a :math:`w \times h` layout.
+
+Template parameter ``Lyt``:
+    Cartesian gate-level layout type.
+
+Template parameter ``WiringReductionLyt``:
+    Type of the `wiring_reduction_layout`.
+
+Parameter ``lyt``:
+    The `wiring_reduction_layout` to search and obstruct.
+
+Parameter ``to_delete``:
+    Reference to the to-delete list to be updated with the coordinates
+    of all cuts.
+
+Returns:
+    The number of cuts found.)doc";
+
 static const char *__doc_fiction_detail_color_routing_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_color_routing_impl_color_routing_impl = R"doc()doc";
@@ -5982,8 +6517,6 @@ static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl
 
 static const char *__doc_fiction_detail_critical_temperature_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_critical_temperature_impl_bii = R"doc(Iterator that iterates over all possible input states.)doc";
-
 static const char *__doc_fiction_detail_critical_temperature_impl_critical_temperature = R"doc(Critical temperature [K].)doc";
 
 static const char *__doc_fiction_detail_critical_temperature_impl_critical_temperature_impl = R"doc()doc";
@@ -5993,7 +6526,12 @@ R"doc(The *Critical Temperature* is determined.
 
 Parameter ``energy_state_type``:
     All energies of all physically valid charge distributions with the
-    corresponding state type (i.e. transparent, erroneous).)doc";
+    corresponding state type (i.e. transparent, erroneous).
+
+Returns:
+    The lowest temperature at which the occupation probability of
+    erroneous states exceeds the threshold, or `max_temperature` if
+    there is none (unit: K).)doc";
 
 static const char *__doc_fiction_detail_critical_temperature_impl_gate_based_simulation =
 R"doc(*Gate-based Critical Temperature* Simulation of a SiDB layout for a
@@ -6012,22 +6550,21 @@ R"doc(Returns the critical temperature.
 Returns:
     The critical temperature (unit: K).)doc";
 
-static const char *__doc_fiction_detail_critical_temperature_impl_is_ground_state_transparent =
-R"doc(The energy difference between the ground state and the first erroneous
-state is determined. Additionally, the state type of the ground state
-is determined and returned.
+static const char *__doc_fiction_detail_critical_temperature_impl_input_pattern_result = R"doc(Result of the simulation of a single input pattern.)doc";
 
-Parameter ``energy_and_state_type``:
-    All energies of all physically valid charge distributions with the
-    corresponding state type (i.e. transparent, erroneous).
+static const char *__doc_fiction_detail_critical_temperature_impl_input_pattern_result_critical_temperature =
+R"doc(Critical temperature for this input pattern alone (unit: K).)doc";
 
-Parameter ``min_energy``:
-    Minimal energy of all physically valid charge distributions of a
-    given layout (unit: eV).
+static const char *__doc_fiction_detail_critical_temperature_impl_input_pattern_result_energy_to_first_erroneous =
+R"doc(Energy difference between the ground state and the first erroneous
+state (unit: meV).)doc";
 
-Returns:
-    State type (i.e. transparent, erroneous) of the ground state is
-    returned.)doc";
+static const char *__doc_fiction_detail_critical_temperature_impl_input_pattern_result_ground_state_is_transparent =
+R"doc(`true` iff at least one ground state fulfills the logic.)doc";
+
+static const char *__doc_fiction_detail_critical_temperature_impl_input_pattern_result_num_valid_lyt =
+R"doc(Number of physically valid charge configurations within the energy
+window.)doc";
 
 static const char *__doc_fiction_detail_critical_temperature_impl_layout = R"doc(SiDB cell-level layout.)doc";
 
@@ -6037,19 +6574,71 @@ given Boolean function.)doc";
 
 static const char *__doc_fiction_detail_critical_temperature_impl_params = R"doc(Parameters for the critical_temperature algorithm.)doc";
 
-static const char *__doc_fiction_detail_critical_temperature_impl_physical_simulation_of_bdl_iterator =
+static const char *__doc_fiction_detail_critical_temperature_impl_physical_simulation =
 R"doc(This function conducts physical simulation of the given layout (gate
-layout with certain input combination). The simulation results are
-stored in the `sim_result_100` variable.
+layout with certain input combination).
 
-Parameter ``bdl_iterator``:
-    A reference to a BDL input iterator representing the gate layout
-    at a given input combination. The simulation is performed based on
-    the configuration represented by the iterator.
+Parameter ``lyt``:
+    The gate layout at a given input combination.
+
+Parameter ``energy_window``:
+    Only charge distributions within this energy window above the
+    ground state are returned (unit: eV). The exact simulators discard
+    the remaining ones already during their enumeration.
 
 Returns:
     Simulation results.)doc";
 
+static const char *__doc_fiction_detail_critical_temperature_impl_relevant_energy_window =
+R"doc(Determines the energy window above the ground state that contains all
+charge distributions that are relevant for the critical temperature.
+The Boltzmann factor of a charge distribution with energy
+:math:`\Delta E` above the ground state is at most :math:`e^{-\Delta
+E / k_B T_{max}}` for all considered temperatures. With at most
+:math:`b^N` charge distributions for :math:`N` SiDBs and base number
+:math:`b`, the occupation probability of all charge distributions
+outside the window is bounded by `ENERGY_WINDOW_TOLERANCE`
+:math:`\cdot (1 - \eta)`. Hence, pruning them cannot change the
+critical temperature beyond that tolerance.
+
+Returns:
+    Energy window above the ground state (unit: eV).)doc";
+
+static const char *__doc_fiction_detail_critical_temperature_impl_simulate_input_pattern =
+R"doc(Simulates the layout at a single input pattern and determines the
+critical temperature for this pattern alone. This function does not
+alter the state of this object and can, thus, be called concurrently.
+
+Template parameter ``TT``:
+    Type of the truth table.
+
+Parameter ``lyt``:
+    Layout with the input pattern applied.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``input_pattern``:
+    Index of the input pattern.
+
+Parameter ``energy_window``:
+    Energy window above the ground state that is relevant (unit: eV).
+
+Parameter ``output_bdl_pairs``:
+    Output BDL pairs.
+
+Parameter ``input_bdl_wires``:
+    Input BDL wires.
+
+Parameter ``output_bdl_wires``:
+    Output BDL wires.
+
+Returns:
+    Result of the input pattern or `std::nullopt` if the layout is
+    non-operational at this pattern because positively charged SiDBs
+    can occur or no physically valid charge distribution exists.)doc";
+
 static const char *__doc_fiction_detail_critical_temperature_impl_stats = R"doc(Statistics.)doc";
 
 static const char *__doc_fiction_detail_defect_influence_impl = R"doc()doc";
@@ -6506,6 +7095,17 @@ static const char *__doc_fiction_detail_determine_clocking_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_determine_clocking_impl_determine_clocking_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_determine_clocking_impl_determine_clocks =
+R"doc(Determines clock numbers for all components of the layout, each with a
+separate solver instance. The components are solved concurrently and
+the layout is only modified if all of them could be clocked.
+
+Template parameter ``SolverType``:
+    The SAT solver to use.
+
+Returns:
+    `true` iff a valid clocking scheme could be found.)doc";
+
 static const char *__doc_fiction_detail_determine_clocking_impl_layout = R"doc(The layout to assign clock numbers to.)doc";
 
 static const char *__doc_fiction_detail_determine_clocking_impl_params = R"doc(Parameters.)doc";
@@ -6599,6 +7199,28 @@ Parameter ``ps``:
 Parameter ``st``:
     Statistics related to the displacement robustness computation.)doc";
 
+static const char *__doc_fiction_detail_displacement_robustness_domain_impl_draw_displaced_sidb_layout =
+R"doc(Draws a displaced layout at random. First, `num_displaced` SiDBs are
+chosen uniformly from `displaceable_sidbs`. Afterward, each chosen SiDB
+is moved to a position drawn uniformly from its permitted
+displacements, which include its original position. Displaced layouts
+are derived from the original layout by moving only the displaced
+SiDBs instead of building them from scratch. Draws in which two SiDBs
+end up on the same position are rejected and repeated.
+
+Parameter ``displaceable_sidbs``:
+    Indices of the SiDBs that may be displaced.
+
+Parameter ``num_displaced``:
+    Number of SiDBs to displace.
+
+Parameter ``generator``:
+    Random number generator to draw with.
+
+Returns:
+    The displaced layout or `std::nullopt` if no SiDB left its
+    original position.)doc";
+
 static const char *__doc_fiction_detail_displacement_robustness_domain_impl_generate_valid_displaced_sidb_layouts =
 R"doc(This function generates all SiDB layouts with displacements based on
 the original layout. It filters out layouts where two or more SiDBs
@@ -6621,6 +7243,26 @@ static const char *__doc_fiction_detail_displacement_robustness_domain_impl_rd =
 R"doc(Random device for obtaining seed for the random number generator.
 Provides a source of quasi-non-deterministic pseudo-random numbers.)doc";
 
+static const char *__doc_fiction_detail_displacement_robustness_domain_impl_sample_displaced_layouts =
+R"doc(Draws displaced layouts on demand and determines their operational
+status in parallel until the confidence interval of the share of
+operational layouts is at most `confidence_interval_width` wide or
+`max_number_of_samples` layouts have been drawn. Layouts in which no
+SiDB left its original position share the operational status of the
+original layout and are not simulated again. The operational and
+non-operational counts as well as the confidence interval are stored
+in the statistics.
+
+Parameter ``displaceable_sidbs``:
+    Indices of the SiDBs that may be displaced.
+
+Parameter ``num_displaced``:
+    Number of SiDBs to displace in each layout.
+
+Parameter ``domain``:
+    Displacement robustness domain to add the drawn layouts to. May be
+    `nullptr`.)doc";
+
 static const char *__doc_fiction_detail_displacement_robustness_domain_impl_sidbs_of_the_original_layout = R"doc(SiDB positions of the originally given SiDB layout.)doc";
 
 static const char *__doc_fiction_detail_displacement_robustness_domain_impl_stats = R"doc(The statistics of the displacement robustness computation.)doc";
@@ -6648,73 +7290,6 @@ Parameter ``status``:
 
 static const char *__doc_fiction_detail_east_south_edge_coloring = R"doc()doc";
 
-static const char *__doc_fiction_detail_enumerate_all_paths_impl = R"doc()doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_collection = R"doc(Collection of all enumerated paths.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_enumerate_all_paths_impl = R"doc()doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_is_visited =
-R"doc(Check if a coordinate has been visited.
-
-Parameter ``c``:
-    Coordinate to check.
-
-Returns:
-    `true` if the coordinate has been visited, `false` otherwise.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_layout = R"doc(The layout whose paths are to be enumerated.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_mark_unvisited =
-R"doc(Mark a coordinate as unvisited.
-
-Parameter ``c``:
-    Coordinate to mark as unvisited.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_mark_visited =
-R"doc(Mark a coordinate as visited.
-
-Parameter ``c``:
-    Coordinate to mark as visited.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_objective = R"doc(The source-target coordinate pair.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_params = R"doc(Routing parameters.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_recursively_enumerate_all_paths =
-R"doc(Recursively enumerate all paths from `src` to `tgt` in the given
-layout. This function is called recursively until the target
-coordinate is reached. Along each path, each coordinate can occur at
-maximum once. This function does not generate duplicate or looping
-paths. If the given layout implements the obstruction interface (see
-`obstruction_layout`), paths will not be routed via obstructed
-coordinates or connections. If the given layout is a gate-level layout
-and implements the obstruction interface (see `obstruction_layout`),
-paths may contain wire crossings if specified in the parameters. Wire
-crossings are only allowed over other wires and only if the crossing
-layer is not obstructed. Furthermore, it is ensured that crossings do
-not run along another wire but cross only in a single point
-(orthogonal crossings + knock-knees/double wires).
-
-Parameter ``src``:
-    Source coordinate.
-
-Parameter ``tgt``:
-    Target coordinate.
-
-Parameter ``p``:
-    Current path to extend.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_run =
-R"doc(Enumerate all possible paths in a layout that start at
-`objective.source` and lead to `objective.target`.
-
-Returns:
-    A collection of all unique paths in `layout` from
-    `objective.source` to `objective.target`.)doc";
-
-static const char *__doc_fiction_detail_enumerate_all_paths_impl_visited = R"doc(Set of visited coordinates.)doc";
-
 static const char *__doc_fiction_detail_equivalence_checking_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_equivalence_checking_impl_equivalence_checking_impl =
@@ -6736,10 +7311,24 @@ static const char *__doc_fiction_detail_equivalence_checking_impl_has_drvs = R"d
 
 static const char *__doc_fiction_detail_equivalence_checking_impl_impl = R"doc(Implementation.)doc";
 
+static const char *__doc_fiction_detail_equivalence_checking_impl_ps = R"doc(Parameters.)doc";
+
 static const char *__doc_fiction_detail_equivalence_checking_impl_pst = R"doc()doc";
 
 static const char *__doc_fiction_detail_equivalence_checking_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_equivalence_checking_impl_simulate =
+R"doc(Simulates `spec` and `impl` on the same input patterns. If the number
+of primary inputs does not exceed `max_exhaustive_simulation_pis`, all
+input patterns are simulated. Otherwise, `num_random_patterns` random
+input patterns are simulated. The first input pattern for which the
+outputs differ is stored as a counter example.
+
+Returns:
+    `false` if a counter example was found, `true` if all input
+    patterns were simulated without finding one, and `std::nullopt` if
+    simulation is inconclusive.)doc";
+
 static const char *__doc_fiction_detail_equivalence_checking_impl_spec = R"doc(Specification.)doc";
 
 static const char *__doc_fiction_detail_exact_impl = R"doc()doc";
@@ -7571,6 +8160,25 @@ R"doc(Checks if all PI/POs are located at the layout's borders.
 Returns:
     Check summary as a one liner.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_cached_tile_drvs = R"doc(Tile-local violations that are reported by the checks.)doc";
+
+static const char *__doc_fiction_detail_gate_level_drvs_impl_check_tile =
+R"doc(Checks a single tile for all enabled tile-local design rule
+violations and warnings. This function only reads from the layout and
+can thus be called concurrently for different tiles.
+
+Parameter ``lyt``:
+    Gate layout to check.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``t``:
+    Tile to check.
+
+Returns:
+    Violations and warnings of `t`.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_clocked_data_flow_check =
 R"doc(Checks for proper clocking of connected tiles based on their assigned
 nodes.
@@ -7578,6 +8186,23 @@ nodes.
 Returns:
     Check summary as a one liner.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_collect_tile_drvs =
+R"doc(Determines the tile-local design rule violations and warnings of all
+occupied tiles. Instead of visiting every tile within the layout
+bounds, only the tiles that are stored in the tile-to-node mapping are
+checked. For large layouts, these tiles are partitioned into contiguous
+chunks that are checked concurrently, each thread collecting its
+violations in a local buffer that is merged afterward.
+
+Parameter ``lyt``:
+    Gate layout to check.
+
+Parameter ``ps``:
+    Parameters.
+
+Returns:
+    Violations and warnings of all tiles that have any.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_crossing_gates_check =
 R"doc(Check for wires crossing gates.
 
@@ -7590,6 +8215,21 @@ R"doc(Checks if no PI/PO is assigned to an empty tile.
 Returns:
     Check summary as a one liner.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_fanin_tiles =
+R"doc(Returns the tiles that the fanin signals of the node on the given tile
+point to, including the ones that are not adjacent, not properly
+clocked, or not even occupied.
+
+Parameter ``lyt``:
+    Gate layout.
+
+Parameter ``t``:
+    Tile whose fanins are desired.
+
+Returns:
+    Fanin signal tiles of the node on `t` or an empty vector if `t` is
+    empty.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_gate_level_drvs_impl =
 R"doc(Standard constructor.
 
@@ -7600,7 +8240,12 @@ Parameter ``p``:
     Parameters.
 
 Parameter ``st``:
-    Statistics.)doc";
+    Statistics.
+
+Parameter ``tile_violations``:
+    Tile-local violations of `lyt` that have been determined
+    beforehand via `collect_tile_drvs`. If `nullptr`, they are
+    determined by `run`.)doc";
 
 static const char *__doc_fiction_detail_gate_level_drvs_impl_has_io_check =
 R"doc(Checks if PI/PO assignments are present.
@@ -7628,6 +8273,11 @@ Parameter ``report``:
 
 static const char *__doc_fiction_detail_gate_level_drvs_impl_lyt = R"doc(Layout to perform design rule checks on.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_min_tiles_per_thread =
+R"doc(Minimum number of occupied tiles per thread. Smaller layouts are
+checked on fewer threads because spawning a thread costs more than
+checking a few hundred tiles.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_missing_connections_check =
 R"doc(Checks for non-PO tiles with successors and non-PI tiles without
 predecessors.
@@ -7642,6 +8292,10 @@ nodes.
 Returns:
     Check summary as a one liner.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_ordered_tile_drvs =
+R"doc(Tiles of `cached_tile_drvs` in the order in which the layout iterates
+its tiles, each paired with its violations.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_placed_dead_nodes_check =
 R"doc(Checks for nodes that are placed but dead.
 
@@ -7679,6 +8333,10 @@ Parameter ``brk``:
 Returns:
     Formatted summary message.)doc";
 
+static const char *__doc_fiction_detail_gate_level_drvs_impl_tile_violations =
+R"doc(Tile-local violations that were determined by `run` if none were
+provided.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl_unplaced_nodes_check =
 R"doc(Checks for nodes that are not placed but still alive.
 
@@ -7797,6 +8455,29 @@ static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_ps
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_generate_random_sidb_layout =
+R"doc(Generates a layout featuring a random arrangement of SiDBs using the
+given random number generator.
+
+Template parameter ``Lyt``:
+    SiDB cell-level SiDB layout type.
+
+Template parameter ``RandomEngine``:
+    Type of the random number generator.
+
+Parameter ``params``:
+    The parameters for generating the random layout.
+
+Parameter ``skeleton``:
+    Optional layout to which random dots are added.
+
+Parameter ``generator``:
+    Random number generator to draw the SiDB positions from.
+
+Returns:
+    A randomly generated SiDB layout, or `std::nullopt` if the process
+    failed due to conflicting parameters.)doc";
+
 static const char *__doc_fiction_detail_get_offset =
 R"doc(Utility function to calculate the offset that has to be subtracted
 from any x-coordinate on the hexagonal layout.
@@ -8668,6 +9349,10 @@ Returns:
     The network with virtual primary inputs removed, or the original
     network if unsupported.)doc";
 
+static const char *__doc_fiction_detail_has_design_cache =
+R"doc(Detects whether the parameters of a parameterized gate library provide
+a `design_cache` member.)doc";
+
 static const char *__doc_fiction_detail_hexagonalization_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_hexagonalization_impl_hexagonalization_impl = R"doc()doc";
@@ -8815,6 +9500,13 @@ Returns:
 
 static const char *__doc_fiction_detail_is_operational_impl_input_bdl_wires = R"doc(Input BDL wires.)doc";
 
+static const char *__doc_fiction_detail_is_operational_impl_input_cds =
+R"doc(Charge distribution surface of the layout under the input pattern
+`input_cds_index`. It is reused by `is_layout_invalid` to update only
+the SiDBs that change between consecutive input patterns.)doc";
+
+static const char *__doc_fiction_detail_is_operational_impl_input_cds_index = R"doc(Input pattern that `input_cds` represents.)doc";
+
 static const char *__doc_fiction_detail_is_operational_impl_is_io_signal_unstable =
 R"doc(This function iterates through various input patterns and output wire
 indices to determine if any configuration results in a physically
@@ -8851,7 +9543,7 @@ constraints under the I/O pin conditions required for the desired
 Boolean function, and (3) detecting I/O signal instability.
 
 Parameter ``input_pattern``:
-    The current input pattern.
+    The current input pattern, i.e., the row of the truth table.
 
 Returns:
     A `layout_invalidity_reason` object indicating why the layout is
@@ -9001,6 +9693,19 @@ Parameter ``output_wire_index``:
     The index representing the current input pattern of the output
     wire.)doc";
 
+static const char *__doc_fiction_detail_is_operational_impl_set_input_pattern =
+R"doc(Sets the BDL input iterator to the state that applies the given input
+pattern and updates `input_cds` accordingly. If `input_cds` represents
+the previous input pattern of the iterator, only the SiDBs that
+changed are moved instead of constructing a new charge distribution
+surface. Afterward, all SiDBs of `input_cds` are negatively charged.
+To this end, only the SiDBs that were assigned a different charge
+state, e.g., the I/O pins and canvas SiDBs set by `is_layout_invalid`,
+are updated in :math:`\mathcal{O}(N)` time each.
+
+Parameter ``input_pattern``:
+    The input pattern to set, i.e., the row of the truth table.)doc";
+
 static const char *__doc_fiction_detail_is_operational_impl_simulator_invocations = R"doc(Number of simulator invocations.)doc";
 
 static const char *__doc_fiction_detail_is_operational_impl_truth_table = R"doc(The specification of the layout.)doc";
@@ -9215,6 +9920,37 @@ the canvas SiDBs satisfies the criteria for physical validity.)doc";
 
 static const char *__doc_fiction_detail_layout_invalidity_reason_POTENTIAL_POSITIVE_CHARGES = R"doc(Positive SiDBs can potentially occur.)doc";
 
+static const char *__doc_fiction_detail_make_stream_generator =
+R"doc(Creates the random number generator of the task with index `stream`.
+Generators of different streams are independent of each other, which
+allows parallel tasks to draw reproducible random numbers regardless
+of the number of threads they are executed on.
+
+Parameter ``seed``:
+    Base seed.
+
+Parameter ``stream``:
+    Index of the random stream.
+
+Returns:
+    A generator whose state is derived from both `seed` and `stream`.)doc";
+
+static const char *__doc_fiction_detail_metropolis_accept =
+R"doc(Decides whether a transition with the given cost change is accepted at
+temperature `temp` according to the Metropolis criterion.
+
+Parameter ``cost_delta``:
+    Cost change of the transition.
+
+Parameter ``temp``:
+    Current temperature.
+
+Parameter ``generator``:
+    Random number generator.
+
+Returns:
+    `true` iff the transition is accepted.)doc";
+
 static const char *__doc_fiction_detail_nested_vector_hash =
 R"doc(This struct defines a hash function for a nested vector of layout
 tiles. It calculates a combined hash value for a vector of tiles based
@@ -9851,6 +10587,87 @@ static const char *__doc_fiction_detail_placement_info_current_po = R"doc(The in
 
 static const char *__doc_fiction_detail_placement_info_node2pos = R"doc(Mapping of nodes to their positions in the layout.)doc";
 
+static const char *__doc_fiction_detail_positive_charge_tracker =
+R"doc(This class keeps track of the local electrostatic potentials at all
+SiDBs of a layout under the assumption that all SiDBs are negatively
+charged. In this extreme case, the local potentials are maximal, which
+is why `can_positive_charges_occur` evaluates them to decide whether
+positively charged SiDBs can occur. Instead of setting up a
+`charge_distribution_surface` with all pairwise potentials after each
+insertion, adding an SiDB only adds one term to each local potential.
+Hence, checking and inserting an SiDB requires
+:math:`\mathcal{O}(N)` time.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_add_sidb =
+R"doc(Registers an SiDB at the given cell.
+
+Parameter ``c``:
+    Cell of the SiDB.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_add_sidb_if_no_positive_charges_can_occur =
+R"doc(Registers an SiDB at the given cell unless positively charged SiDBs
+could occur afterward.
+
+Parameter ``c``:
+    Cell of the SiDB.
+
+Returns:
+    `true` iff the SiDB was registered.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_can_positive_charges_occur =
+R"doc(Checks whether positively charged SiDBs can occur among all
+registered SiDBs.
+
+Returns:
+    `true` iff positively charged SiDBs can occur.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_charged_defects = R"doc(Positions (unit: nm) and properties of all charged defects.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_compute_potentials_to =
+R"doc(Computes the chargeless potentials between all registered SiDBs and
+an SiDB at the given cell and stores them in `potentials_to_new_sidb`.
+
+Parameter ``c``:
+    Cell of the SiDB that is to be added.
+
+Returns:
+    Negated local electrostatic potential at `c` if all SiDBs are
+    negatively charged (unit: V).)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_layout = R"doc(Layout whose SiDBs are tracked.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_local_potentials =
+R"doc(Negated local electrostatic potentials at all registered SiDBs if all
+SiDBs are negatively charged (unit: V).)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_positions = R"doc(Positions of all registered SiDBs (unit: nm).)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_positive_charge_threshold =
+R"doc(Local potential that needs to be exceeded for positively charged
+SiDBs to occur (unit: V).)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_positive_charge_tracker =
+R"doc(Standard constructor. Registers all SiDBs and charged defects of the
+given layout.
+
+Parameter ``lyt``:
+    Layout whose SiDBs are tracked. SiDBs that are added later have to
+    be registered via `add_sidb` or
+    `add_sidb_if_no_positive_charges_can_occur`.
+
+Parameter ``params``:
+    Physical parameters used to determine whether positively charged
+    SiDBs can occur.)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_potentials_to_new_sidb =
+R"doc(Chargeless potentials between all registered SiDBs and the SiDB that
+is to be added (unit: V).)doc";
+
+static const char *__doc_fiction_detail_positive_charge_tracker_simulation_parameters = R"doc(Physical parameters.)doc";
+
 static const char *__doc_fiction_detail_post_layout_optimization_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_post_layout_optimization_impl_add_fanin_to_route =
@@ -10147,8 +10964,31 @@ assigns the local external potential from the
 - It assigns the global external potential from
 `params.global_potential` to the charge layout.)doc";
 
+static const char *__doc_fiction_detail_quickexact_impl_is_within_energy_window =
+R"doc(Checks whether the given physically valid charge distribution lies
+within the energy window above the lowest energy found so far. Since
+the local potentials are up-to-date during the enumeration, the
+electrostatic potential energy is obtained in :math:`\mathcal{O}(N)`
+without copying the charge distribution. The pre-assigned negatively
+charged SiDBs are treated as defects in `charge_layout`, which shifts
+all energies by the same constant offset.
+
+Template parameter ``ChargeLyt``:
+    Type of the charge distribution surface.
+
+Parameter ``charge_layout``:
+    Physically valid charge distribution.
+
+Returns:
+    `true` iff the charge distribution is to be stored.)doc";
+
 static const char *__doc_fiction_detail_quickexact_impl_layout = R"doc(Layout to simulate.)doc";
 
+static const char *__doc_fiction_detail_quickexact_impl_lowest_energy_found =
+R"doc(Lowest electrostatic potential energy of all physically valid charge
+distributions enumerated so far. It is only determined up to an offset
+that is identical for all charge distributions (unit: eV).)doc";
+
 static const char *__doc_fiction_detail_quickexact_impl_number_of_sidbs = R"doc(Number of SiDBs of the input layout.)doc";
 
 static const char *__doc_fiction_detail_quickexact_impl_params = R"doc(Parameters used for the simulation.)doc";
@@ -10434,13 +11274,25 @@ fanout gate is asymmetric.
 
 If this flag is true, the fanin signals need to be reordered.)doc";
 
+static const char *__doc_fiction_detail_run_on_bounded_threads =
+R"doc(Runs `task(i)` for all :math:`i \in [0, \texttt{num_tasks})` on at
+most `num_threads` threads. Tasks are distributed dynamically to
+balance differing runtimes.
+
+Parameter ``num_tasks``:
+    Number of tasks.
+
+Parameter ``num_threads``:
+    Maximum number of threads.
+
+Parameter ``task``:
+    Function that executes the task with the given index.)doc";
+
 static const char *__doc_fiction_detail_sat_clocking_handler = R"doc()doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_assign_clock_numbers =
-R"doc(Assigns clock numbers to the layout based on the provided model.
-
-Parameter ``model``:
-    The model to extract the clocking scheme from.)doc";
+R"doc(Assigns the clock numbers found by the last successful call of
+`determine_clocks` to the layout.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_at_least_one_clock_number_per_tile =
 R"doc(Adds constraints to the solver that enforce the assignment of at least
@@ -10451,10 +11303,11 @@ R"doc(Adds constraints to the solver that enforce the assignment of at most
 one clock number per tile.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_determine_clocks =
-R"doc(Determines clock numbers for the layout.
+R"doc(Determines clock numbers for the tiles.
 
 Constructs a SAT instance and passes it to a solver to find a valid
-clocking scheme.
+clocking scheme. The layout is not modified. To apply the clock
+numbers, call `assign_clock_numbers`.
 
 Returns:
     `true` iff a valid clocking scheme could be found.)doc";
@@ -10469,15 +11322,31 @@ adjacently clocked tiles.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_layout = R"doc(The layout to clock.)doc";
 
+static const char *__doc_fiction_detail_sat_clocking_handler_model = R"doc(The model of the last satisfiable SAT instance.)doc";
+
 static const char *__doc_fiction_detail_sat_clocking_handler_number_of_clocks = R"doc(Number of clocks in layout's clocking scheme.)doc";
 
-static const char *__doc_fiction_detail_sat_clocking_handler_sat_clocking_handler = R"doc(Default constructor.)doc";
+static const char *__doc_fiction_detail_sat_clocking_handler_sat_clocking_handler =
+R"doc(Standard constructor. Creates the variables of the given tiles.
+
+Parameter ``lyt``:
+    The layout to clock.
+
+Parameter ``ts``:
+    Tiles of the non-constant nodes to clock. The tiles must form a
+    union of connected components as determined by
+    `clocking_components`.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_solver = R"doc(The solver used to find a solution to the clocking problem.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_symmetry_breaking =
 R"doc(Adds constraints to the solver that help to speed up the solving
-process by breaking symmetries in the solution space.)doc";
+process by breaking symmetries in the solution space. Since clock
+numbers can be shifted cyclically within a component, the clock
+numbers of a path that starts at the first PI of the tiles, or at the
+first tile if there is no PI, are fixed.)doc";
+
+static const char *__doc_fiction_detail_sat_clocking_handler_tiles = R"doc(Tiles to clock.)doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler_variables = R"doc(Stores all variables.)doc";
 
@@ -10608,6 +11477,64 @@ static const char *__doc_fiction_detail_search_space_graph_pi_locs =
 R"doc(Enum indicating if primary inputs (PIs) can be placed at the top or
 left.)doc";
 
+static const char *__doc_fiction_detail_seed_or_random =
+R"doc(Returns `seed` or a random one if none is provided.
+
+Parameter ``seed``:
+    Optional base seed.
+
+Returns:
+    Base seed.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout =
+R"doc(Layers the temporary obstructions of a single spur search on top of a
+layout that implements the obstruction interface. In contrast to
+obstructing coordinates and connections in the layout itself, the
+layout is not modified. Hence, multiple spur searches can be conducted
+concurrently on the same layout.
+
+Template parameter ``Lyt``:
+    Coordinate layout type that implements the obstruction interface.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout_is_obstructed_connection =
+R"doc(Checks if the given connection is temporarily obstructed or obstructed
+in the underlying layout.
+
+Parameter ``src``:
+    Source coordinate.
+
+Parameter ``tgt``:
+    Target coordinate.
+
+Returns:
+    `true` iff the connection from `src` to `tgt` is obstructed.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout_is_obstructed_coordinate =
+R"doc(Checks if the given coordinate is temporarily obstructed or obstructed
+in the underlying layout.
+
+Parameter ``c``:
+    Coordinate to check.
+
+Returns:
+    `true` iff `c` is obstructed.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout_obstructed_connections = R"doc(Temporarily obstructed connections.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout_obstructed_coordinates = R"doc(Temporarily obstructed coordinates.)doc";
+
+static const char *__doc_fiction_detail_spur_obstruction_layout_spur_obstruction_layout =
+R"doc(Standard constructor.
+
+Parameter ``lyt``:
+    Layout to layer the temporary obstructions on top of.
+
+Parameter ``coords``:
+    Temporarily obstructed coordinates. Must outlive this layout.
+
+Parameter ``conns``:
+    Temporarily obstructed connections. Must outlive this layout.)doc";
+
 static const char *__doc_fiction_detail_sweep_parameter_to_string =
 R"doc(Converts a sweep parameter to a string representation. This is used to
 write the parameter name to the CSV file.
@@ -10648,6 +11575,64 @@ static const char *__doc_fiction_detail_technology_mapping_impl_stats = R"doc(Te
 
 static const char *__doc_fiction_detail_technology_mapping_impl_technology_mapping_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_thread_barrier =
+R"doc(A reusable barrier that blocks the calling threads until a fixed
+number of threads has arrived. Afterward, the barrier resets itself
+for the next phase.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_arrive_and_wait =
+R"doc(Blocks the calling thread until all threads have arrived in the
+current phase.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_mutex = R"doc(Mutex that protects the counters.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_phase = R"doc(Index of the current phase.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_phase_completed = R"doc(Notifies waiting threads about completed phases.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_remaining = R"doc(Number of threads that have not arrived in the current phase yet.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_thread_barrier =
+R"doc(Standard constructor.
+
+Parameter ``num_threads``:
+    Number of threads that have to arrive to complete a phase.)doc";
+
+static const char *__doc_fiction_detail_thread_barrier_threshold = R"doc(Number of threads that have to arrive to complete a phase.)doc";
+
+static const char *__doc_fiction_detail_tile_drv_map =
+R"doc(Maps all tiles with violations or warnings to their violations.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs =
+R"doc(Design rule violations and warnings that are local to a single occupied
+tile.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_crossing_gate = R"doc(The tile hosts a wire that crosses a non-wire tile.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_empty =
+R"doc(Checks whether the tile has no violations.
+
+Returns:
+    `true` iff no violation or warning was found on the tile.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_improperly_clocked_fanins =
+R"doc(Fanin tiles that do not feed the tile according to the clocking
+scheme.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_missing_connection =
+R"doc(The tile has no predecessors but is no PI or no successors but is no
+PO.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_non_adjacent_fanins = R"doc(Fanin tiles that are not adjacent to the tile.)doc";
+
+static const char *__doc_fiction_detail_tile_drvs_placed_dead_node = R"doc(The node on the tile is dead.)doc";
+
 static const char *__doc_fiction_detail_to_hex =
 R"doc(Utility function to transform a Cartesian tile into a hexagonal one.
 
@@ -10979,67 +11964,175 @@ static const char *__doc_fiction_detail_write_location_and_ground_state_impl_wri
 
 static const char *__doc_fiction_detail_write_qca_layout_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_impl_bb_cy_offset = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_cell_color = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_cell_function = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_cell_mode = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_cell_size = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_dot_size = R"doc()doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_impl_lyt = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_os = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_ps = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_run = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_render_cell =
+R"doc(Appends the QCADesigner representation of a cell to a buffer. This
+function only reads from the layout and can thus be called
+concurrently for different cells.
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_via_counter = R"doc()doc";
+Parameter ``c``:
+    Cell to render.
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_via_layer_cells = R"doc()doc";
+Parameter ``buffer``:
+    Buffer to append to.)doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_render_cell_name = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_colors = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_render_quantum_dots = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_function = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_run = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_layers = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_stream_representation = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_mode = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_via_counter = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_impl_via_layer_cells = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_name = R"doc()doc";
+static const char *__doc_fiction_detail_write_qca_layout_impl_write_cell_layers = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_header = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_qca_layout_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_write_qca_layout_impl_write_quantum_dots = R"doc()doc";
-
 static const char *__doc_fiction_detail_write_qca_layout_impl_write_via_cells = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_cell_symbol =
+R"doc(Returns the index of the symbol definition of the given cell
+description and creates it if necessary.
+
+Parameter ``desc_col``:
+    Description template and color of a cell.
+
+Returns:
+    Index of the symbol definition of `desc_col`.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_cell_symbols =
+R"doc(Distinct cell descriptions that are defined as reusable SVG symbols.
+Their indices form their symbol IDs.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_cell_based_svg =
 R"doc(Generates an SVG string representing the cell-based clocked cell
 layout and appends it to the output stream.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_description_color =
-R"doc(Generates and returns a pair of strings representing the description
-and color of the given cell.
+R"doc(Generates and returns a pair of a description template and a color
+representing the given cell.
 
 Parameter ``c``:
     The cell for which to generate the description and color.
 
 Returns:
-    A pair of strings representing the description and color of the
-    given cell `c`.)doc";
+    A pair of the description template and the color of the given
+    cell `c`. The template is `nullptr` if `c` has no visual
+    representation.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_tile_based_svg =
 R"doc(Generates an SVG string representing the tile-based clocked cell
-layout and appends it to the output stream.)doc";
+layout and appends it to the output stream. Tiles with equal
+descriptions, e.g., multiple instances of the same gate implementation
+in the same clock zone, are defined once as a symbol and instanced at
+each of their positions.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_lyt = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_min_tiles_per_thread = R"doc(Tiles that are rendered by a single thread at least.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_os = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_placed_cell =
+R"doc(A cell description instance that refers to its symbol definition and
+is placed at an offset.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_placed_cell_symbol = R"doc(Index of the cell symbol definition.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_placed_cell_x = R"doc(Offset in x-direction.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_placed_cell_y = R"doc(Offset in y-direction.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_ps = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_render_tile =
+R"doc(Renders the description of a tile without its placement, i.e., its
+background, its clock zone labels, and its cell instances. Tiles with
+equal descriptions are instances of the same symbol.
+
+Parameter ``t``:
+    Tile to render.
+
+Returns:
+    The SVG description of `t`.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_render_tiles =
+R"doc(Renders the descriptions of all given tiles. Large numbers of tiles
+are rendered in parallel.
+
+Parameter ``tiles``:
+    Tiles to render.
+
+Returns:
+    The SVG descriptions of all tiles in the order of `tiles`.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_render_use =
+R"doc(Appends an instance of the given cell symbol to a buffer.
+
+Parameter ``pc``:
+    Cell symbol instance.
+
+Parameter ``buffer``:
+    Buffer to append to.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_sorted_cells =
+R"doc(Collects all non-empty cells of the layout in the order of their
+coordinates.
+
+Returns:
+    All non-empty cells sorted by their coordinates.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_svg_tile =
+R"doc(A regular or latch tile with its clock zone and the cell description
+instances it contains.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_svg_tile_cells = R"doc(Cell description instances placed relative to the tile.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_svg_tile_clock_zone =
+R"doc(Clock zone of the tile. For latch tiles, this is the clock zone of its
+upper half.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_svg_tile_coord = R"doc(Coordinate of the tile.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_svg_tile_latch_delay = R"doc(Latch delay of the tile. Regular tiles have a latch delay of 0.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_write_header =
+R"doc(Writes the SVG header including the symbol definitions of all cell
+descriptions.
+
+Parameter ``viewbox_x``:
+    Width of the view box.
+
+Parameter ``viewbox_y``:
+    Height of the view box.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_write_qca_layout_svg_impl = R"doc(Default constructor.)doc";
 
 static const char *__doc_fiction_detail_write_qcc_layout_impl = R"doc()doc";
@@ -11140,8 +12233,9 @@ Parameter ``y``:
 Parameter ``fill_color``:
     The fill color of the lattice point.
 
-Returns:
-    The SVG string representing the lattice point.)doc";
+Parameter ``buffer``:
+    The buffer to append the SVG string representing the lattice point
+    to.)doc";
 
 static const char *__doc_fiction_detail_write_sidb_layout_svg_impl_generate_sidb =
 R"doc(Generates an SVG string representing an SiDB.
@@ -11152,13 +12246,15 @@ Parameter ``x``:
 Parameter ``y``:
     The y-coordinate of the SiDB.
 
-Parameter ``charge_state``:
-    The charge state of the SiDB.
+Parameter ``buffer``:
+    The buffer to append the SVG string representing the SiDB to.
 
-Returns:
-    The SVG string representing the SiDB.)doc";
+Parameter ``charge_state``:
+    The charge state of the SiDB.)doc";
 
-static const char *__doc_fiction_detail_write_sidb_layout_svg_impl_generate_svg = R"doc(Generates the SVG layout with both H-Si lattice points and SiDBs.)doc";
+static const char *__doc_fiction_detail_write_sidb_layout_svg_impl_generate_svg =
+R"doc(Generates the SVG layout with both H-Si lattice points and SiDBs. The
+SVG content is rendered in chunks and streamed into the output stream.)doc";
 
 static const char *__doc_fiction_detail_write_sidb_layout_svg_impl_lyt = R"doc(The SiDB layout to be written.)doc";
 
@@ -11225,12 +12321,66 @@ static const char *__doc_fiction_detail_write_sqd_sim_result_impl_write_sqd_sim_
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_compute_target_distances =
+R"doc(Determines the distances of all ground layer coordinates to the target
+via a reverse breadth-first search from the target. If crossings are
+disabled, the search respects the obstructions of the layout.
+Obstructed coordinates are assigned a distance, since they can act as
+a spur, but paths are not extended through them. If crossings are
+enabled, obstructed coordinates might be crossed and, therefore, all
+obstructions are disregarded. Since the temporary obstructions of spur
+searches can only make paths longer, these distances are lower bounds
+for the lengths of all spur paths and, thus, an admissible and
+consistent heuristic for A*. Unlike the Manhattan distance, they
+respect the information flow imposed by the clocking scheme.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_follow_target_distances =
+R"doc(Attempts to construct a shortest path from `spur` to the target by
+following strictly decreasing distances to the target without
+searching. If the resulting path avoids all obstructions, it is a
+shortest path in `lyt` because its length equals the lower bound given
+by `target_distance`.
+
+Parameter ``lyt``:
+    Layout with the temporary obstructions of the current spur.
+
+Parameter ``spur``:
+    Spur coordinate.
+
+Returns:
+    A shortest path from `spur` to the target or an empty path if the
+    distances lead into an obstruction.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_foreach_successor =
+R"doc(Applies the given function to all coordinates that can be reached from
+`c` in a single step.
+
+Template parameter ``SpurLyt``:
+    Layout type.
+
+Template parameter ``Fn``:
+    Functor type.
+
+Parameter ``lyt``:
+    Layout.
+
+Parameter ``c``:
+    Coordinate whose successors are to be visited.
+
+Parameter ``fn``:
+    Functor to apply to each successor.)doc";
+
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_k_shortest_paths = R"doc(The list of k shortest paths that is created during the algorithm.)doc";
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_layout =
 R"doc(The layout in which k shortest paths are to be found extended by an
 obstruction functionality layer.)doc";
 
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_min_spurs_per_thread =
+R"doc(Minimum number of spur searches per thread. Fewer spur searches are
+conducted sequentially since the overhead of launching threads would
+outweigh the benefits.)doc";
+
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_num_shortest_paths = R"doc(The number of paths to determine, i.e., k.)doc";
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_objective = R"doc(Source and target coordinates.)doc";
@@ -11249,8 +12399,6 @@ Parameter ``p``:
 Returns:
     Costs of path p.)doc";
 
-static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_reset_temporary_obstructions = R"doc(Resets all temporary obstructions.)doc";
-
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_run =
 R"doc(Enumerate up to k shortest paths in a layout that start at
 `objective.source` and lead to `objective.target`.
@@ -11261,9 +12409,60 @@ Returns:
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_shortest_path_candidates = R"doc(A set of potential shortest paths.)doc";
 
-static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_temporarily_obstructed_coordinates =
-R"doc(A temporary storage for coordinates that are obstructed during the
-algorithm.)doc";
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_spur_path =
+R"doc(Determines the path that deviates from `latest_path` at its `i`th
+coordinate, the spur. That is, the returned path shares the first `i`
+coordinates (the root path) with `latest_path` but continues from the
+spur with a shortest path to the target that neither revisits the root
+path nor uses a connection from the spur that a previously found path
+with the same root path already used.
+
+This function does not modify any state and can, thus, be called
+concurrently.
+
+Parameter ``latest_path``:
+    The most recently found shortest path.
+
+Parameter ``i``:
+    Index of the spur coordinate in `latest_path`.
+
+Returns:
+    The concatenation of the root path and the spur path or an empty
+    path if no spur path exists.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_spur_paths =
+R"doc(Determines the spur paths for all coordinates of `latest_path` except
+the last one. The spur searches are distributed among
+`params.num_threads` threads.
+
+Parameter ``latest_path``:
+    The most recently found shortest path.
+
+Returns:
+    The spur paths in the order of their spur coordinates in
+    `latest_path`. Spurs without a path are represented by empty
+    paths.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_target_distance =
+R"doc(Returns the distance of the given coordinate to the target as
+determined by `compute_target_distances`.
+
+Parameter ``c``:
+    Coordinate whose distance to the target is desired.
+
+Returns:
+    Lower bound for the length of a path from `c` to the target or
+    `unreachable_distance` if there is none.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_target_distances =
+R"doc(Length of the shortest path from each ground layer coordinate to the
+target's ground layer coordinate if the temporary obstructions of spur
+searches are disregarded. Coordinates that cannot reach the target are
+not contained.)doc";
+
+static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_unreachable_distance =
+R"doc(A value that exceeds all distances in `target_distances`. It is used
+as the distance of coordinates that cannot reach the target.)doc";
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_yen_k_shortest_paths_impl = R"doc()doc";
 
@@ -11366,6 +12565,10 @@ scheme.
 If no valid clock number assignment exists for `lyt`, this function
 returns `false` and does not modify `lyt`.
 
+The layout is decomposed into connected components whose SAT instances
+are solved concurrently. To clock a layout repeatedly after local
+edits, `incremental_clocking` keeps its solver alive instead.
+
 This algorithm was proposed in \"Ending the Tyranny of the Clock: SAT-
 based Clock Number Assignment for Field-coupled Nanotechnologies\" by
 M. Walter, J. Drewniok, and R. Wille in IEEE NANO 2024
@@ -11389,12 +12592,24 @@ Returns:
 
 static const char *__doc_fiction_determine_clocking_params = R"doc(Parameters for the `determine_clocking` algorithm.)doc";
 
+static const char *__doc_fiction_determine_clocking_params_decompose_into_components =
+R"doc(Decompose the layout into connected components before solving. Tiles
+of different components do not share any clocking constraints. Hence,
+each component is clocked by a separate, smaller SAT instance.)doc";
+
+static const char *__doc_fiction_determine_clocking_params_num_threads =
+R"doc(Number of threads to solve the SAT instances of different components
+concurrently. By default, the number of threads is set to the number
+of available hardware threads.)doc";
+
 static const char *__doc_fiction_determine_clocking_params_sat_engine = R"doc(The SAT solver to use.)doc";
 
 static const char *__doc_fiction_determine_clocking_stats = R"doc(Statistics for the `determine_clocking` algorithm.)doc";
 
 static const char *__doc_fiction_determine_clocking_stats_duration = R"doc(Total runtime.)doc";
 
+static const char *__doc_fiction_determine_clocking_stats_num_components = R"doc(Number of independently solved components.)doc";
+
 static const char *__doc_fiction_determine_clocking_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -11415,7 +12630,9 @@ computation parameters. The number of displacements grows
 exponentially with the number of SiDBs. For small layouts, all
 displacements can be analyzed. For larger layouts, random sampling can
 be applied, controllable by the `analysis_mode` and
-`percentage_of_analyzed_displaced_layouts` in `params.
+`percentage_of_analyzed_displaced_layouts` in `params`. In
+`MONTE_CARLO` mode, displaced layouts are drawn on demand until the
+share of operational layouts is known to the requested precision.
 
 Template parameter ``Lyt``:
     The SiDB cell-level layout type.
@@ -11448,6 +12665,12 @@ SiDB layout for an originally given SiDB layout and a given
 fabrication error rate. A fabrication error rate of 0.0 or negative
 indicates that the SiDB layout is designed without displacement.
 
+In `MONTE_CARLO` mode, the probability is estimated from displaced
+layouts that are drawn on demand. Sampling stops once the confidence
+interval of the estimate, which is reported in `stats`, is narrow
+enough. This makes the function applicable to layouts for which the
+number of displaced layouts is far too large to be enumerated.
+
 Template parameter ``Lyt``:
     The SiDB cell-level layout type.
 
@@ -11467,6 +12690,9 @@ Parameter ``fabrication_error_rate``:
     The fabrication error rate. For example, 0.1 describes that 10% of
     all manufactured SiDBs have a slight displacement.
 
+Parameter ``stats``:
+    Statistics related to the displacement robustness computation.
+
 Returns:
     The probability of fabricating an operational SiDB layout.)doc";
 
@@ -11593,6 +12819,20 @@ R"doc(This parameter defines the mode of the displacement. If `EXHAUSTIVE`,
 all possible displacements are analyzed. Otherwise, a certain amount
 of all possible displacements is analyzed randomly.)doc";
 
+static const char *__doc_fiction_displacement_robustness_domain_params_batch_size =
+R"doc(Number of displaced layouts that are drawn and simulated between two
+checks of the confidence interval in `MONTE_CARLO` mode.)doc";
+
+static const char *__doc_fiction_displacement_robustness_domain_params_confidence_interval_width =
+R"doc(Target width of the confidence interval of the share of operational
+layouts in `MONTE_CARLO` mode. Sampling stops as soon as the interval
+is at most this wide.)doc";
+
+static const char *__doc_fiction_displacement_robustness_domain_params_confidence_level =
+R"doc(Confidence level of the interval in `MONTE_CARLO` mode. For example,
+0.95 means that the interval contains the true share of operational
+layouts with a probability of 95 %.)doc";
+
 static const char *__doc_fiction_displacement_robustness_domain_params_dimer_displacement_policy =
 R"doc(Specifies the allowed displacement range options for SiDB fabrication
 simulation.)doc";
@@ -11613,6 +12853,14 @@ static const char *__doc_fiction_displacement_robustness_domain_params_displacem
 
 static const char *__doc_fiction_displacement_robustness_domain_params_displacement_analysis_mode_EXHAUSTIVE = R"doc(All possible displacements are analyzed.)doc";
 
+static const char *__doc_fiction_displacement_robustness_domain_params_displacement_analysis_mode_MONTE_CARLO =
+R"doc(Displaced layouts are drawn at random on demand and simulated in
+parallel until the confidence interval of the estimated share of
+operational layouts is at most `confidence_interval_width` wide or
+`max_number_of_samples` layouts have been drawn. Displaced layouts are
+never enumerated up front, which makes this mode applicable to layouts
+with many SiDBs.)doc";
+
 static const char *__doc_fiction_displacement_robustness_domain_params_displacement_analysis_mode_RANDOM =
 R"doc(A certain amount of all possible displacements is analyzed randomly.
 Defined by `percentage_of_analyzed_displaced_layouts`.)doc";
@@ -11625,6 +12873,15 @@ displacement in the y-direction.)doc";
 
 static const char *__doc_fiction_displacement_robustness_domain_params_fixed_sidbs = R"doc(SiDBs in the given layout which shall not be affected by variations.)doc";
 
+static const char *__doc_fiction_displacement_robustness_domain_params_max_number_of_samples =
+R"doc(Maximum number of displaced layouts that are drawn in `MONTE_CARLO`
+mode. If it is 0, no layout is drawn and the probability of
+fabricating an operational gate is 0.0.)doc";
+
+static const char *__doc_fiction_displacement_robustness_domain_params_number_of_threads =
+R"doc(Number of threads to simulate displaced layouts with in `MONTE_CARLO`
+mode.)doc";
+
 static const char *__doc_fiction_displacement_robustness_domain_params_operational_params = R"doc(Parameters to check the operational status of the SiDB layout.)doc";
 
 static const char *__doc_fiction_displacement_robustness_domain_params_percentage_of_analyzed_displaced_layouts =
@@ -11632,8 +12889,24 @@ R"doc(This parameter defines the percentage of all possible displaced SiDB
 layouts that are analyzed. The default value is 1.0 (100 %), which
 means that all possible displacements are covered.)doc";
 
+static const char *__doc_fiction_displacement_robustness_domain_params_seed =
+R"doc(Seed for drawing displaced layouts in `MONTE_CARLO` mode. Each
+displaced layout is drawn with a random number generator derived from
+the seed and the index of the layout. Since the confidence interval is
+only checked between batches, results are reproducible and independent
+of the number of threads. If no seed is provided, a random one is
+used.)doc";
+
 static const char *__doc_fiction_displacement_robustness_domain_stats = R"doc(Statistics for the displacement robustness domain computation.)doc";
 
+static const char *__doc_fiction_displacement_robustness_domain_stats_confidence_interval_lower_bound =
+R"doc(Lower bound of the confidence interval of the share of operational
+layouts. Only determined in `MONTE_CARLO` mode.)doc";
+
+static const char *__doc_fiction_displacement_robustness_domain_stats_confidence_interval_upper_bound =
+R"doc(Upper bound of the confidence interval of the share of operational
+layouts. Only determined in `MONTE_CARLO` mode.)doc";
+
 static const char *__doc_fiction_displacement_robustness_domain_stats_duration =
 R"doc(Total runtime in seconds to determine the robustness of the passed
 SiDB layout.)doc";
@@ -11906,6 +13179,10 @@ clk_lyt layout = ...;
 auto all_paths = enumerate_all_paths<path>(static_cast<cartesian_layout<>>(layout), {source, target});
 ```
 
+The number of paths grows exponentially with the size of the layout.
+If not all of them are needed, consider generating them on demand via
+`all_paths_enumerator` instead.
+
 Template parameter ``Path``:
     Type of the returned individual paths.
 
@@ -11944,10 +13221,10 @@ R"doc(`Spec` and `Impl` are logically equivalent BUT `Impl` has a throughput
 of :math:`\frac{1}{x}` with :math:`x > 1`.)doc";
 
 static const char *__doc_fiction_equivalence_checking =
-R"doc(Performs SAT-based equivalence checking between a specification of
-type `Spec` and an implementation of type `Impl`. Both `Spec` and
-`Impl` need to be network types (that is, gate-level layouts can be
-utilized as well).
+R"doc(Performs equivalence checking between a specification of type `Spec`
+and an implementation of type `Impl`. Both `Spec` and `Impl` need to
+be network types (that is, gate-level layouts can be utilized as
+well).
 
 This implementation enables the comparison of two logic networks, a
 logic network and a gate-level layout or two gate-level layouts. Since
@@ -11967,6 +13244,14 @@ gate-level layouts with TP of :math:`\frac{1}{x}` and
 equivalence: Spec and Impl are logically equivalent and all involved
 gate-level layouts have TP of :math:`\frac{1}{1}`.
 
+Logical equivalence is decided in tiers. DRV checks of gate-level
+layouts run concurrently with a bit-parallel simulation of `spec` and
+`impl`. For few primary inputs, all input patterns are simulated,
+which decides equivalence without SAT. Otherwise, random input
+patterns are simulated to find counter examples quickly. Only if
+simulation is inconclusive, a miter is constructed and passed to a SAT
+solver.
+
 This approach was first proposed in \"Verification for Field-coupled
 Nanocomputing Circuits\" by M. Walter, R. Wille, F. Sill Torres, D.
 Große, and R. Drechsler in DAC 2020.
@@ -11983,12 +13268,56 @@ Parameter ``spec``:
 Parameter ``impl``:
     The implementation.
 
+Parameter ``ps``:
+    Parameters.
+
 Parameter ``pst``:
     Statistics.
 
 Returns:
     The equivalence type of `spec` and `impl`.)doc";
 
+static const char *__doc_fiction_equivalence_checking_2 =
+R"doc(Performs equivalence checking between a specification of type `Spec`
+and an implementation of type `Impl` with default parameters. See
+above for details.
+
+Template parameter ``Spec``:
+    Specification type.
+
+Template parameter ``Impl``:
+    Implementation type.
+
+Parameter ``spec``:
+    The specification.
+
+Parameter ``impl``:
+    The implementation.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    The equivalence type of `spec` and `impl`.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params =
+R"doc(Parameters for equivalence checking. Before a SAT solver is invoked,
+`Spec` and `Impl` are simulated bit-parallel on 64 input patterns per
+machine word. If there are few primary inputs, simulating all input
+patterns decides equivalence without SAT. Otherwise, random patterns
+are simulated to find counter examples quickly.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_max_exhaustive_simulation_pis =
+R"doc(Maximum number of primary inputs for which all :math:`2^n` input
+patterns are simulated instead of invoking a SAT solver.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_num_random_patterns =
+R"doc(Number of random input patterns to simulate before invoking a SAT
+solver. It is rounded up to a multiple of 64. Setting this to 0
+disables random simulation.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_seed = R"doc(Seed for the generation of random input patterns.)doc";
+
 static const char *__doc_fiction_equivalence_checking_stats = R"doc()doc";
 
 static const char *__doc_fiction_equivalence_checking_stats_counter_example = R"doc(Stores a possible counter example.)doc";
@@ -11999,6 +13328,12 @@ static const char *__doc_fiction_equivalence_checking_stats_eq = R"doc(Stores th
 
 static const char *__doc_fiction_equivalence_checking_stats_impl_drv_stats = R"doc()doc";
 
+static const char *__doc_fiction_equivalence_checking_stats_sat_solver_invoked =
+R"doc(Stores whether equivalence had to be decided by a SAT solver because
+simulation was inconclusive.)doc";
+
+static const char *__doc_fiction_equivalence_checking_stats_simulated_patterns = R"doc(Number of simulated input patterns.)doc";
+
 static const char *__doc_fiction_equivalence_checking_stats_spec_drv_stats = R"doc(Stores DRVs.)doc";
 
 static const char *__doc_fiction_equivalence_checking_stats_tp_diff = R"doc(Throughput values at which weak equivalence manifests.)doc";
@@ -12203,6 +13538,9 @@ minimized.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_num_threads =
 R"doc(Number of threads to use for exploring the possible aspect ratios.
+Worker threads share the area of the best layout found so far and
+abandon all aspect ratios that are dominated by it, including the ones
+whose SMT instances are currently being solved.
 
 @note This is an unstable beta feature.)doc";
 
@@ -12247,10 +13585,19 @@ static const char *__doc_fiction_exact_physical_design_stats_num_crossings = R"d
 
 static const char *__doc_fiction_exact_physical_design_stats_num_gates = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_num_symmetric_aspect_ratios =
+R"doc(Number of aspect ratios that were skipped because their transposed
+counterpart yields an identical SMT instance that has already been
+examined.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_num_wires = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_report = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_time_solver_per_thread =
+R"doc(Time spent in the SMT solver by each worker thread. Only populated if
+`num_threads > 1`.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_x_size = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_y_size = R"doc()doc";
@@ -12760,11 +14107,163 @@ Template parameter ``Fn``:
 Parameter ``ntk``:
     Network to iterate over.
 
-Parameter ``n``:
-    Node of `ntk` whose outgoing edges are to be considered.
+Parameter ``n``:
+    Node of `ntk` whose outgoing edges are to be considered.
+
+Parameter ``fn``:
+    Function object to apply to each outgoing edge of `n` in `ntk`.)doc";
+
+static const char *__doc_fiction_gate_design_cache =
+R"doc(A thread-safe memo table for gate implementations that are designed on the
+fly, e.g., by `sidb_on_the_fly_gate_library`. Designing a gate is
+expensive, yet many tiles of a layout require the same Boolean function
+with the same ports in the same (possibly defective) environment. This
+cache stores the result of each design task under a canonical key that
+encodes all of these requirements such that repeated tasks can be
+answered by a lookup. Besides successful designs, the cache also
+records tasks for which no gate implementation exists.
+
+A cache may be shared by multiple threads and by multiple runs as long
+as the key identifies all parameters that affect the design result. If
+a directory is provided, each design result is additionally stored in
+a file of that directory such that it persists across program
+executions and can be shared between concurrently running processes.
+Persistence requires `Gate` to be a two-dimensional `std::array` of
+integral or enumeration values, which is the case for `fcn_gate`.
+
+Template parameter ``Gate``:
+    Gate implementation type, e.g., `fcn_gate`.)doc";
+
+static const char *__doc_fiction_gate_design_cache_clear =
+R"doc(Removes all design results that are held in memory and resets the hit
+and miss counters. Files in the directory of a persistent cache are
+kept.)doc";
+
+static const char *__doc_fiction_gate_design_cache_directory = R"doc(Directory of a persistent cache.)doc";
+
+static const char *__doc_fiction_gate_design_cache_entries =
+R"doc(Stored design results by their canonical keys. Lookups in a persistent
+cache add results that are loaded from the directory.)doc";
+
+static const char *__doc_fiction_gate_design_cache_file_of =
+R"doc(Computes the path of the file that stores the design result of `key`.
+Keys are hashed via 64-bit FNV-1a, which, unlike `std::hash`, is stable
+across platforms and program executions.
+
+Parameter ``key``:
+    Canonical key of the design task.
+
+Returns:
+    Path of the file that belongs to `key`.)doc";
+
+static const char *__doc_fiction_gate_design_cache_find =
+R"doc(Looks up the design result that is stored under `key`.
+
+Parameter ``key``:
+    Canonical key of the design task.
+
+Returns:
+    `std::nullopt` if no result is stored under `key`. Otherwise, the
+    stored result, which is itself `std::nullopt` if the design task
+    was found to be impossible.)doc";
+
+static const char *__doc_fiction_gate_design_cache_format_header =
+R"doc(First line of each file. It identifies the file format and its version
+such that files of other formats are ignored. The version has to be
+incremented whenever the file format changes.)doc";
+
+static const char *__doc_fiction_gate_design_cache_gate_design_cache = R"doc(Standard constructor. Creates an empty in-memory cache.)doc";
+
+static const char *__doc_fiction_gate_design_cache_gate_design_cache_2 =
+R"doc(Constructor for a persistent cache. Design results that are stored in
+`dir` by previous runs are loaded on demand and new results are written
+to `dir`. The directory is created if it does not exist.
+
+Parameter ``dir``:
+    Directory to store the design results in.
+
+Throws:
+    std::filesystem::filesystem_error if `dir` cannot be created.)doc";
+
+static const char *__doc_fiction_gate_design_cache_gate_header = R"doc(File header of designed gates.)doc";
+
+static const char *__doc_fiction_gate_design_cache_get_directory =
+R"doc(Returns the directory in which design results are persisted.
+
+Returns:
+    Directory of a persistent cache or `std::nullopt` if the cache is
+    held in memory only.)doc";
+
+static const char *__doc_fiction_gate_design_cache_hits = R"doc(Number of cache hits.)doc";
+
+static const char *__doc_fiction_gate_design_cache_impossible_header = R"doc(File header of impossible design tasks.)doc";
+
+static const char *__doc_fiction_gate_design_cache_insert =
+R"doc(Stores the design result of a task under `key`. An existing result is
+kept, i.e., the first result that is stored for a key wins if multiple
+threads design the same gate concurrently. If the cache is persistent,
+new results are written to its directory as well. Failing to write a
+result does not affect the in-memory cache.
+
+Parameter ``key``:
+    Canonical key of the design task.
+
+Parameter ``gate``:
+    Designed gate implementation or `std::nullopt` if the design task
+    is impossible.)doc";
+
+static const char *__doc_fiction_gate_design_cache_is_cell_array = R"doc(Detects two-dimensional `std::array`s of integral or enumeration values.)doc";
+
+static const char *__doc_fiction_gate_design_cache_is_persistable = R"doc(Whether design results of type `Gate` can be written to and read from files.)doc";
+
+static const char *__doc_fiction_gate_design_cache_load =
+R"doc(Reads the design result of `key` from the directory. Each file starts
+with the format header, followed by the full key to detect hash
+collisions, a header, and the rows of the gate as space-separated cell
+values. Files of other formats or versions are ignored.
+
+Parameter ``key``:
+    Canonical key of the design task.
+
+Returns:
+    The stored design result or `std::nullopt` if there is no valid
+    file for `key`.)doc";
+
+static const char *__doc_fiction_gate_design_cache_misses = R"doc(Number of cache misses.)doc";
+
+static const char *__doc_fiction_gate_design_cache_mutex = R"doc(Mutex that protects `entries`.)doc";
+
+static const char *__doc_fiction_gate_design_cache_num_hits =
+R"doc(Returns the number of lookups that were answered by a stored result.
+
+Returns:
+    Number of cache hits.)doc";
+
+static const char *__doc_fiction_gate_design_cache_num_misses =
+R"doc(Returns the number of lookups that found no stored result.
+
+Returns:
+    Number of cache misses.)doc";
+
+static const char *__doc_fiction_gate_design_cache_size =
+R"doc(Returns the number of stored design results.
+
+Returns:
+    Number of stored design results.)doc";
+
+static const char *__doc_fiction_gate_design_cache_store =
+R"doc(Writes the design result of `key` to the directory. The file is
+written under a temporary name first and renamed afterward such that
+concurrent readers never observe partially written files. Temporary
+names carry a random suffix since multiple threads and processes may
+store the same result concurrently.
+
+Parameter ``key``:
+    Canonical key of the design task.
 
-Parameter ``fn``:
-    Function object to apply to each outgoing edge of `n` in `ntk`.)doc";
+Parameter ``gate``:
+    Designed gate implementation or `std::nullopt` if the design task
+    is impossible.)doc";
 
 static const char *__doc_fiction_gate_design_exception =
 R"doc(This exception is thrown when an error occurs during the design of an
@@ -12899,6 +14398,11 @@ static const char *__doc_fiction_gate_level_drv_params_missing_connections = R"d
 
 static const char *__doc_fiction_gate_level_drv_params_non_adjacent_connections = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_drv_params_num_threads =
+R"doc(Number of threads to check the tiles of large layouts concurrently.
+By default, the number of threads is set to the number of available
+hardware threads.)doc";
+
 static const char *__doc_fiction_gate_level_drv_params_out = R"doc(Stream to write the report into.)doc";
 
 static const char *__doc_fiction_gate_level_drv_params_placed_dead_nodes = R"doc(Check for placed but dead nodes.)doc";
@@ -13943,6 +15447,17 @@ static const char *__doc_fiction_gate_level_layout_pi_at = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_po_at = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_reserve =
+R"doc(Pre-allocates memory for the given number of nodes, including the two
+constants, such that bulk insertions, e.g., when remapping all gates of
+another layout, do not repeatedly grow and rehash the node storage and
+the mappings between tiles and nodes. Under
+`dense_coordinate_storage`, the tile grid is allocated to span the
+current layout bounds instead.
+
+Parameter ``num_nodes``:
+    Expected total number of nodes.)doc";
+
 static const char *__doc_fiction_gate_level_layout_revive_node = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_set_input_name = R"doc()doc";
@@ -14011,6 +15526,11 @@ static const char *__doc_fiction_generate_edge_intersection_graph_params_crossin
 R"doc(Allow crossings by not creating edges between paths that only share
 single-coordinate sub-paths.)doc";
 
+static const char *__doc_fiction_generate_edge_intersection_graph_params_num_threads =
+R"doc(Number of threads to use for the path enumeration. Paths of different
+objectives are enumerated concurrently. By default, the number of
+threads is set to the number of available hardware threads.)doc";
+
 static const char *__doc_fiction_generate_edge_intersection_graph_params_path_limit =
 R"doc(If a value is given, for each objective, only up to the `path_limit`
 shortest paths will be enumerated (using Yen's algorithm) instead of
@@ -14039,6 +15559,12 @@ R"doc(Generates multiple random layouts featuring a random arrangement of
 SiDBs. These randomly placed dots can be incorporated into an existing
 layout skeleton that may be optionally provided.
 
+The layouts are generated by `number_threads` threads in parallel,
+each of which uses its own random number generator. Uniqueness is
+determined via canonical layout hashes such that a newly generated
+layout only needs to be compared to previously generated layouts with
+the same hash value.
+
 Template parameter ``Lyt``:
     SiDB cell-level SiDB layout type.
 
@@ -14057,6 +15583,10 @@ R"doc(Generates a layout featuring a random arrangement of SiDBs. These
 randomly placed dots can be incorporated into an existing layout
 skeleton that may be optionally provided.
 
+If positive charges are forbidden, the local electrostatic potentials
+at all SiDBs are updated incrementally after each insertion, which
+takes :math:`\mathcal{O}(N)` time per insertion.
+
 Template parameter ``Lyt``:
     SiDB cell-level SiDB layout type.
 
@@ -14097,6 +15627,10 @@ static const char *__doc_fiction_generate_random_sidb_layout_params_number_of_si
 
 static const char *__doc_fiction_generate_random_sidb_layout_params_number_of_unique_generated_layouts = R"doc(The desired number of unique layouts to be generated.)doc";
 
+static const char *__doc_fiction_generate_random_sidb_layout_params_number_threads =
+R"doc(Number of threads to generate multiple layouts in parallel. Each
+thread draws from its own random number generator.)doc";
+
 static const char *__doc_fiction_generate_random_sidb_layout_params_positive_charges =
 R"doc(An enumeration of modes to use for the generation of random SiDB
 layouts to control control the appearance of positive charges.)doc";
@@ -14119,6 +15653,25 @@ closer than the minimal_spacing.)doc";
 
 static const char *__doc_fiction_generate_random_sidb_layout_params_simulation_parameters = R"doc(Simulation parameters.)doc";
 
+static const char *__doc_fiction_geometric_temperature_ladder =
+R"doc(Generates a temperature ladder for `parallel_tempering` whose
+temperatures increase geometrically from `min_temp` to `max_temp`,
+which results in similar exchange acceptance rates between all
+neighboring replicas if the heat capacity of the problem is roughly
+constant.
+
+Parameter ``min_temp``:
+    The lowest temperature.
+
+Parameter ``max_temp``:
+    The highest temperature.
+
+Parameter ``num_replicas``:
+    The number of temperatures.
+
+Returns:
+    The temperatures in ascending order.)doc";
+
 static const char *__doc_fiction_geometric_temperature_schedule =
 R"doc(A logarithmically decreasing temperature schedule. The temperature is
 altered by multiplying it with `0.99`.
@@ -14224,6 +15777,16 @@ static const char *__doc_fiction_graph_coloring_engine_MCS =
 R"doc(Optimal coloring for chordal graphs proposed in \"Register Allocation
 via Coloring of Chordal Graphs\" by Jens Palsberg in CATS 2007.)doc";
 
+static const char *__doc_fiction_graph_coloring_engine_PORTFOLIO =
+R"doc(Runs a portfolio of coloring heuristics and incremental SAT-based
+:math:`k`-coloring queries with different :math:`k` and SAT solvers
+concurrently. The heuristics provide upper bounds and the given
+cliques provide lower bounds for the chromatic number. Queries whose
+:math:`k` falls outside the remaining bounds are canceled as soon as
+the bounds are tightened. The portfolio terminates once the optimal
+:math:`k` has been proven. See
+`determine_vertex_coloring_portfolio_params` for its configuration.)doc";
+
 static const char *__doc_fiction_graph_coloring_engine_SAT = R"doc(Custom iterative SAT-based encoding that finds optimal colorings.)doc";
 
 static const char *__doc_fiction_graph_coloring_engine_TABUCOL =
@@ -15050,6 +16613,11 @@ static const char *__doc_fiction_heuristic_sidb_simulation_engine_QUICKSIM =
 R"doc(*QuickSim* is a heuristic simulation engine that only requires
 polynomial runtime.)doc";
 
+static const char *__doc_fiction_heuristic_sidb_simulation_engine_SIMANNEAL =
+R"doc(*SimAnneal* is a heuristic simulation engine based on simulated
+annealing over charge configurations that scales to layouts with more
+than a hundred SiDBs.)doc";
+
 static const char *__doc_fiction_hexagonal_layout =
 R"doc(A layout type that utilizes offset coordinates to represent a
 hexagonal grid. Its faces are organized in an offset coordinate system
@@ -15835,6 +17403,12 @@ rerouting (i.e., without crossings).)doc";
 
 static const char *__doc_fiction_hexagonalization_params_io_pin_extension_mode_NONE = R"doc(Do not extend primary inputs/outputs to the top/bottom row (default).)doc";
 
+static const char *__doc_fiction_hexagonalization_params_num_threads =
+R"doc(Number of threads to use for the coordinate transformation. Diagonals
+of the Cartesian layout are remapped concurrently while the nodes are
+inserted into the hexagonal layout sequentially. By default, the
+number of threads is set to the number of available hardware threads.)doc";
+
 static const char *__doc_fiction_hexagonalization_params_output_pin_extension = R"doc(Output extension mode. Defaults to none)doc";
 
 static const char *__doc_fiction_hexagonalization_stats = R"doc(This struct stores statistics about the hexagonalization process.)doc";
@@ -15867,6 +17441,148 @@ static const char *__doc_fiction_horizontal_shift_cartesian =
 R"doc(\verbatim +-------+ | | | | | | +---+---+---+ | | | | | | +-------+
 \endverbatim)doc";
 
+static const char *__doc_fiction_incremental_clocking =
+R"doc(An incremental variant of `determine_clocking` for layouts that are
+clocked repeatedly after local edits, e.g., during post-layout
+optimization. The solver instance is kept alive between calls such
+that clauses learned in previous runs remain available. The
+information flow and crossing constraints of each tile are guarded by
+an activation literal of that tile, which is passed to the solver as
+an assumption. When tiles are edited, their constraints and the
+constraints of their neighbors are retracted by permanently disabling
+the old activation literals and re-encoded for the current state of
+the layout. The constraints of all other tiles are left untouched.
+
+Symmetries are broken by assuming the first clock number for the first
+tile of each connected component.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Template parameter ``SolverType``:
+    The SAT solver to use.)doc";
+
+static const char *__doc_fiction_incremental_clocking_activation_variables = R"doc(Activation variable of the current constraints of each encoded tile.)doc";
+
+static const char *__doc_fiction_incremental_clocking_clock_variables = R"doc(Clock number variables of each tile that has ever been encoded.)doc";
+
+static const char *__doc_fiction_incremental_clocking_clock_variables_of =
+R"doc(Creates the clock number variables of the given tile together with the
+permanent constraints that enforce exactly one clock number. These
+constraints remain valid when the tile becomes empty because its
+variables are unconstrained otherwise.
+
+Parameter ``t``:
+    Tile to create variables for.
+
+Returns:
+    The clock number variables of `t`.)doc";
+
+static const char *__doc_fiction_incremental_clocking_dependents = R"doc(Tiles whose constraints refer to the key tile.)doc";
+
+static const char *__doc_fiction_incremental_clocking_determine_clocks =
+R"doc(Determines clock numbers for the current state of the layout and
+assigns them as in `determine_clocking`. All edits since the last call
+must have been reported via `update`.
+
+If no valid clock number assignment exists, this function returns
+`false` and does not modify the layout.
+
+Parameter ``stats``:
+    Statistics. The runtime of this call is stored in `time_total`.
+
+Returns:
+    `true` iff the layout could be successfully clocked via a valid
+    clock number assignment.)doc";
+
+static const char *__doc_fiction_incremental_clocking_encode_tile =
+R"doc(Retracts the constraints of the given tile and encodes them anew for
+the current state of the layout.
+
+Parameter ``t``:
+    Tile to encode.)doc";
+
+static const char *__doc_fiction_incremental_clocking_incremental_clocking =
+R"doc(Standard constructor. Encodes the constraints of all tiles of the
+given layout.
+
+Parameter ``lyt``:
+    The gate-level layout to assign clock numbers to. The reference
+    must remain valid for the lifetime of this object.)doc";
+
+static const char *__doc_fiction_incremental_clocking_layout = R"doc(The layout to clock.)doc";
+
+static const char *__doc_fiction_incremental_clocking_num_encoded_tiles =
+R"doc(Returns the number of tiles whose constraints are currently active.
+
+Returns:
+    Number of encoded tiles.)doc";
+
+static const char *__doc_fiction_incremental_clocking_number_of_clocks = R"doc(Number of clocks in layout's clocking scheme.)doc";
+
+static const char *__doc_fiction_incremental_clocking_solver = R"doc(The solver that is kept alive across calls.)doc";
+
+static const char *__doc_fiction_incremental_clocking_update =
+R"doc(Reports edits of the layout. The constraints of the given tiles, of
+their current fanout tiles, and of all tiles whose constraints
+referred to them are re-encoded. Tiles that became empty lose their
+constraints.
+
+Parameter ``changed_tiles``:
+    Tiles whose nodes or connections were added, removed, or modified
+    since the last update.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs =
+R"doc(Incremental design rule violation (DRV) checking for layouts that are
+checked repeatedly after local edits, e.g., inside post-layout
+optimization loops. The tile-local violations of all occupied tiles
+are determined once on construction. Afterward, only the tiles that
+are reported as edited via `update`, their neighbors, and the tiles
+whose violations refer to them are re-checked. The node- and
+I/O-related checks are cheap and performed in full by each call to
+`check`.
+
+For this class to work, `detail::gate_level_drvs_impl` need to be
+declared as a `friend class` to the layout type that is going to be
+examined.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_check =
+R"doc(Reports the DRVs and warnings of the current state of the layout
+exactly like `gate_level_drvs`. All edits since the last call must
+have been reported via `update`.
+
+Parameter ``pst``:
+    Statistics.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_incremental_gate_level_drvs =
+R"doc(Standard constructor. Checks all tiles of the given layout.
+
+Parameter ``lyt``:
+    The gate-level layout that is to be examined for DRVs and
+    warnings. The reference must remain valid for the lifetime of this
+    object.
+
+Parameter ``ps``:
+    Parameters.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_layout = R"doc(The gate-level layout to check.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_params = R"doc(Parameters.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_tile_violations = R"doc(Tile-local violations of all tiles that have any.)doc";
+
+static const char *__doc_fiction_incremental_gate_level_drvs_update =
+R"doc(Reports edits of the layout. The given tiles, their adjacent tiles on
+all layers, the fanin tiles of their current nodes, and all tiles
+whose violations refer to them are re-checked.
+
+Parameter ``changed_tiles``:
+    Tiles whose nodes, connections, or clock numbers were modified
+    since the last update.)doc";
+
 static const char *__doc_fiction_initialize_distance_map =
 R"doc(This function fully initializes a `distance_map` for a given layout
 and distance functor. It computes the distances between all pairs of
@@ -17410,6 +19126,10 @@ static const char *__doc_fiction_on_the_fly_circuit_design_on_defective_surface_
 
 static const char *__doc_fiction_on_the_fly_circuit_design_on_defective_surface_stats_gate_layout = R"doc(The gate-level layout after P&R.)doc";
 
+static const char *__doc_fiction_on_the_fly_circuit_design_on_defective_surface_stats_num_gate_design_cache_hits = R"doc(Number of gate design tasks that were answered by the gate design cache.)doc";
+
+static const char *__doc_fiction_on_the_fly_circuit_design_on_defective_surface_stats_num_gate_design_cache_misses = R"doc(Number of gate design tasks that required a gate design.)doc";
+
 static const char *__doc_fiction_on_the_fly_sidb_circuit_design =
 R"doc(This function implements an on-the-fly SiDB circuit design algorithm.
 
@@ -17499,7 +19219,12 @@ Template parameter ``CellLyt``:
 
 static const char *__doc_fiction_on_the_fly_sidb_circuit_design_on_defective_surface_params_exact_design_parameters = R"doc(Parameters for the *exact* placement and routing algorithm.)doc";
 
-static const char *__doc_fiction_on_the_fly_sidb_circuit_design_on_defective_surface_params_sidb_on_the_fly_gate_library_parameters = R"doc(Parameters for the SiDB on-the-fly gate library.)doc";
+static const char *__doc_fiction_on_the_fly_sidb_circuit_design_on_defective_surface_params_sidb_on_the_fly_gate_library_parameters =
+R"doc(Parameters for the SiDB on-the-fly gate library. If no gate design
+cache is provided, a cache is created that is shared by all placement
+and routing attempts of a single call. Providing a cache, e.g., a
+persistent one, shares the designed gates across calls and program
+executions.)doc";
 
 static const char *__doc_fiction_on_the_fly_sidb_circuit_design_params =
 R"doc(This struct stores the parameters to design an SiDB circuit.
@@ -18097,6 +19822,69 @@ Parameter ``e``:
 Parameter ``other``:
     Edge whose color is to be used to paint `e`.)doc";
 
+static const char *__doc_fiction_parallel_tempering =
+R"doc(Parallel tempering, also known as replica exchange Monte Carlo, runs
+one replica of the optimization problem at each temperature of a fixed
+temperature ladder. After every `cycles` Metropolis steps, which the
+replicas perform in parallel, neighboring replicas attempt to exchange
+their states with probability :math:`\min\left(1, e^{(1/T_i -
+1/T_j)(E_i - E_j)}\right)`. Thereby, good states found by hot
+replicas, which explore the search space freely, migrate to cold
+replicas, which refine them, while states trapped in local minima can
+escape via the hot replicas. In contrast to Simulated Annealing, no
+temperature schedule has to be tuned.
+
+The replicas are distributed among a pool of at most `ps.num_threads`
+threads that is kept alive for all exchange rounds. Each thread
+advances a fixed group of replicas and the threads synchronize at a
+barrier before and after each exchange round. Each replica uses its
+own random number generator that is derived from `ps.seed` and the
+replica index; exchanges are decided by an additional generator.
+Hence, the result is reproducible independent of the number of
+threads.
+
+@note The State type must be default constructible.
+
+Template parameter ``RandStateFunc``:
+    The random state generator function type (specifies the State type
+    via its return value). It may accept a
+    `simulated_annealing_generator&`.
+
+Template parameter ``CostFunc``:
+    The cost function type (specifies the cost value via its return
+    value).
+
+Template parameter ``NextFunc``:
+    The next state function type. It may accept a
+    `simulated_annealing_generator&` as second argument.
+
+Parameter ``temperatures``:
+    The temperature of each replica, preferably in ascending order.
+
+Parameter ``exchanges``:
+    The number of exchange rounds.
+
+Parameter ``cycles``:
+    The number of Metropolis steps of each replica between two
+    exchange rounds.
+
+Parameter ``rand_state``:
+    The random state generator function that creates the initial state
+    of each replica.
+
+Parameter ``cost``:
+    The cost function to minimize.
+
+Parameter ``next``:
+    The next state function that determines an adjacent state given a
+    current one.
+
+Parameter ``ps``:
+    Parameters.
+
+Returns:
+    A pair of the best state found by any replica and its cost value.)doc";
+
 static const char *__doc_fiction_parameter_point = R"doc(The parameter point holds parameter values in the x and y dimension.)doc";
 
 static const char *__doc_fiction_parameter_point_get =
@@ -19080,6 +20868,127 @@ Parameter ``crop_layout``:
 Parameter ``draw_lattice``:
     Flag to enable lattice background drawing.)doc";
 
+static const char *__doc_fiction_profiler =
+R"doc(A process-wide collector of instrumentation data, i.e., timers,
+counters, and histograms, that are recorded by the instrumentation
+macros in the hot paths of fiction's algorithms.
+
+Each thread records into its own buffer such that recording does not
+contend on a shared lock. The buffers are merged only when a summary
+or trace is exported. Profiling is disabled by default and has to be
+enabled via `enable`. While disabled, the instrumentation macros
+reduce to a single relaxed atomic load. Direct calls of
+`record_duration`, `increment`, and `record_value` record regardless
+of whether profiling is enabled.
+
+Names of timers, counters, and histograms have to be string literals
+or otherwise have static storage duration.)doc";
+
+static const char *__doc_fiction_profiler_chrome_trace =
+R"doc(Returns all recorded trace events in the Chrome trace event format,
+which can be loaded into `chrome://tracing` or Perfetto. Trace events
+are only recorded if profiling was enabled with
+`profiling_params::record_trace`.
+
+Returns:
+    Trace events as a JSON object.)doc";
+
+static const char *__doc_fiction_profiler_disable =
+R"doc(Stops the collection of instrumentation data. The collected data
+remains available for export.)doc";
+
+static const char *__doc_fiction_profiler_enable =
+R"doc(Starts the collection of instrumentation data. Data that was collected
+before is kept. Call `reset` to discard it.
+
+Parameter ``ps``:
+    Profiling parameters.)doc";
+
+static const char *__doc_fiction_profiler_increment =
+R"doc(Increments a counter.
+
+Parameter ``name``:
+    Name of the counter.
+
+Parameter ``value``:
+    Value to add to the counter.)doc";
+
+static const char *__doc_fiction_profiler_instance =
+R"doc(Returns the process-wide profiler instance.
+
+Returns:
+    The profiler.)doc";
+
+static const char *__doc_fiction_profiler_is_enabled =
+R"doc(Checks whether instrumentation data is being collected.
+
+Returns:
+    `true` iff profiling was compiled in and is enabled.)doc";
+
+static const char *__doc_fiction_profiler_record_duration =
+R"doc(Records the duration of a timed scope.
+
+Parameter ``name``:
+    Name of the scope.
+
+Parameter ``start``:
+    Point in time at which the scope was entered.
+
+Parameter ``end``:
+    Point in time at which the scope was left.)doc";
+
+static const char *__doc_fiction_profiler_record_value =
+R"doc(Adds a value to a histogram. Histograms use logarithmic buckets where
+bucket :math:`i > 0` holds all values in :math:`[2^{i-1}, 2^i)` and
+bucket :math:`0` holds all values smaller than :math:`1`. Infinite and
+NaN values are ignored.
+
+Parameter ``name``:
+    Name of the histogram.
+
+Parameter ``value``:
+    Value to add.)doc";
+
+static const char *__doc_fiction_profiler_reset = R"doc(Discards all collected data and restarts the trace clock.)doc";
+
+static const char *__doc_fiction_profiler_summary =
+R"doc(Returns the aggregated data of all threads as a JSON object with the
+keys `timers`, `counters`, and `histograms`. Each entry is keyed by
+its name.
+
+Returns:
+    Summary of the collected data.)doc";
+
+static const char *__doc_fiction_profiler_write_chrome_trace =
+R"doc(Writes the recorded trace events to a file in the Chrome trace event
+format.
+
+Parameter ``filename``:
+    Name of the file to write.
+
+Throws:
+    std::ofstream::failure if the file could not be opened.)doc";
+
+static const char *__doc_fiction_profiler_write_summary =
+R"doc(Writes the summary of the collected data to a JSON file.
+
+Parameter ``filename``:
+    Name of the file to write.
+
+Throws:
+    std::ofstream::failure if the file could not be opened.)doc";
+
+static const char *__doc_fiction_profiling_params = R"doc(Parameters for the `profiler`.)doc";
+
+static const char *__doc_fiction_profiling_params_max_trace_events =
+R"doc(Maximum number of trace events to record. Further events are dropped
+and counted to bound the memory consumption of long runs.)doc";
+
+static const char *__doc_fiction_profiling_params_record_trace =
+R"doc(Flag to indicate that, in addition to the aggregated statistics, every
+timed scope should be recorded as an individual event that can be
+exported in the Chrome trace event format.)doc";
+
 static const char *__doc_fiction_ptr =
 R"doc(Returns a smart pointer to the given scheme.
 
@@ -19292,6 +21201,14 @@ R"doc(If `ON`, *QuickExact* checks which base number is required for the
 simulation, i.e., whether 3-state is necessary or 2-state simulation
 is sufficient.)doc";
 
+static const char *__doc_fiction_quickexact_params_energy_window =
+R"doc(Only physically valid charge distributions whose electrostatic
+potential energy exceeds the one of the ground state by at most this
+value are returned (unit: eV). Charge distributions outside the window
+above the lowest energy found so far are discarded during the
+enumeration, i.e., before they are stored. By default, all physically
+valid charge distributions are returned.)doc";
+
 static const char *__doc_fiction_quickexact_params_global_potential =
 R"doc(Global external electrostatic potential. Value is applied on each cell
 in the layout.)doc";
@@ -19346,9 +21263,39 @@ static const char *__doc_fiction_quicksim_params_timeout = R"doc(Timeout limit (
 
 static const char *__doc_fiction_random_coordinate =
 R"doc(Generates a random coordinate within the region spanned by two given
+coordinates using the given random number generator. The two given
+coordinates form the top left corner and the bottom right corner of
+the spanned region.
+
+Template parameter ``CoordinateType``:
+    The coordinate implementation to be used.
+
+Template parameter ``RandomEngine``:
+    Type of the random number generator.
+
+Parameter ``coordinate1``:
+    Top left Coordinate.
+
+Parameter ``coordinate2``:
+    Bottom right Coordinate (coordinate order is not important,
+    automatically swapped if necessary).
+
+Parameter ``generator``:
+    Random number generator to draw from.
+
+Returns:
+    Randomly generated coordinate.)doc";
+
+static const char *__doc_fiction_random_coordinate_2 =
+R"doc(Generates a random coordinate within the region spanned by two given
 coordinates. The two given coordinates form the top left corner and
 the bottom right corner of the spanned region.
 
+@note This function draws from a random number generator that is
+shared by all threads. For concurrent use, call the overload that
+takes a random number generator with one generator per thread
+instead.
+
 Template parameter ``CoordinateType``:
     The coordinate implementation to be used.
 
@@ -19961,6 +21908,13 @@ Parameter ``time``:
 Returns:
     The `std::tm` representation of the given time.)doc";
 
+static const char *__doc_fiction_scoped_timer =
+R"doc(Measures the time between its construction and destruction and records
+it in the `profiler` under the given name. Use the
+`FICTION_PROFILE_SCOPE` macro instead of instantiating this class
+directly so that the measurement is compiled out if profiling is
+disabled.)doc";
+
 static const char *__doc_fiction_searchable_priority_queue =
 R"doc(An extension of `std::priority_queue` that allows searching the
 underlying container. The implementation is based on
@@ -20767,6 +22721,40 @@ Parameter ``cell_list``:
 Returns:
     The cell-level layout with assigned cell types.)doc";
 
+static const char *__doc_fiction_sidb_on_the_fly_gate_library_design_cache_key =
+R"doc(Computes a canonical key for a gate design task that identifies the
+expected Boolean function, the skeleton's cells, which encode the
+ports, the atomic defects in the skeleton's coordinates, and all
+design parameters that affect the result, including the simulation,
+BDL detection, and operational analysis parameters. Keys are prefixed
+with `design_cache_version`. Two tasks with the same key yield the
+same gate implementation.
+
+Template parameter ``LytSkeleton``:
+    The cell-level layout of the skeleton.
+
+Template parameter ``TT``:
+    Truth table type.
+
+Parameter ``skeleton``:
+    Skeleton with atomic defects if available.
+
+Parameter ``spec``:
+    Expected Boolean function of the layout given as a multi-output
+    truth table.
+
+Parameter ``parameters``:
+    Parameters for the SiDB gate design process.
+
+Returns:
+    Canonical key of the design task.)doc";
+
+static const char *__doc_fiction_sidb_on_the_fly_gate_library_design_cache_version =
+R"doc(Version of the gate design process that is part of each design cache
+key. It has to be incremented whenever a change to this library or to
+`design_sidb_gates` alters the designed gates such that results that
+were persisted by previous versions are no longer served.)doc";
+
 static const char *__doc_fiction_sidb_on_the_fly_gate_library_design_gate =
 R"doc(This function designs an SiDB gate for a given Boolean function at a
 given tile and a given rotation. If atomic defects exist, they are
@@ -20866,6 +22854,14 @@ static const char *__doc_fiction_sidb_on_the_fly_gate_library_params_complex_gat
 
 static const char *__doc_fiction_sidb_on_the_fly_gate_library_params_complex_gate_design_policy_USING_PREDEFINED = R"doc(Use predefined complex gates if possible.)doc";
 
+static const char *__doc_fiction_sidb_on_the_fly_gate_library_params_design_cache =
+R"doc(Optional cache of designed gates. If set, gate design tasks with
+identical Boolean functions, skeletons (i.e., ports), atomic defects
+relative to the tile, and design parameters are answered from the cache
+instead of being designed again. The cache can be shared between tiles,
+threads, and layouts. A cache that is constructed with a directory
+additionally persists the designed gates across program executions.)doc";
+
 static const char *__doc_fiction_sidb_on_the_fly_gate_library_params_design_gate_params = R"doc(This struct holds parameters to design SiDB gates.)doc";
 
 static const char *__doc_fiction_sidb_on_the_fly_gate_library_params_influence_radius_charged_defects =
@@ -20994,6 +22990,11 @@ static const char *__doc_fiction_sidb_simulation_engine_QUICKSIM =
 R"doc(*QuickSim* is a heuristic simulation engine that only requires
 polynomial runtime.)doc";
 
+static const char *__doc_fiction_sidb_simulation_engine_SIMANNEAL =
+R"doc(*SimAnneal* is a heuristic simulation engine based on simulated
+annealing over charge configurations that scales to layouts with more
+than a hundred SiDBs.)doc";
+
 static const char *__doc_fiction_sidb_simulation_engine_name =
 R"doc(Returns the name of the given simulation engine.
 
@@ -21081,6 +23082,15 @@ system energy.
 Returns:
     A vector of charge distributions with the minimal energy.)doc";
 
+static const char *__doc_fiction_sidb_simulation_result_restrict_to_energy_window =
+R"doc(Removes all charge distributions whose electrostatic potential energy
+exceeds the minimum energy of all charge distributions by more than
+the given energy window.
+
+Parameter ``energy_window``:
+    Maximum energy difference to the ground state that a charge
+    distribution may have to be kept (unit: eV).)doc";
+
 static const char *__doc_fiction_sidb_simulation_result_sidb_simulation_result =
 R"doc(Default constructor. It only exists to allow for the use of
 `static_assert` statements that restrict the type of `Lyt`.)doc";
@@ -21220,6 +23230,98 @@ Parameter ``sg``:
 Returns:
     sidb_charge_state representation of `sg`.)doc";
 
+static const char *__doc_fiction_sim_anneal =
+R"doc(*SimAnneal* is a heuristic physical simulation algorithm that
+determines the ground state of an SiDB layout via simulated annealing
+over charge configurations, similar to the ground state engine of
+SiQAD. It scales to layouts with more than a hundred SiDBs, where exact
+engines become infeasible.
+
+Multiple independent annealing chains are run concurrently, each
+starting from a random charge configuration. A chain minimizes the
+grand potential, i.e., the electrostatic potential energy plus the
+chemical potential per negatively charged SiDB, by proposing two kinds
+of transitions: flipping the charge state of a single SiDB between
+neutral and negative, and letting an electron hop from a negatively
+charged SiDB to a neutral one. The change in grand potential of each
+proposed transition is derived from the local electrostatic potentials
+in constant time, and accepted transitions update these potentials
+incrementally in linear time via
+`charge_distribution_surface::change_charge_state_by_index`.
+
+Physically valid charge distributions are local minima of the grand
+potential with chemical potential :math:`\mu_-`. The ground state is
+the one of minimal electrostatic potential energy among them, which
+often holds fewer electrons than the global minimum of the grand
+potential. Therefore, the chains anneal with chemical potentials that
+are spread between :math:`\mu_-` and a less favorable value. Each
+chain then descends greedily to a local minimum of the grand potential
+with :math:`\mu_-`. All distinct physically valid results are
+returned.
+
+Like any heuristic, *SimAnneal* is not guaranteed to find the ground
+state. Increasing the number of chains, the number of sweeps per
+temperature, or the cooling factor increases the probability of
+success.
+
+@note *SimAnneal* currently only supports two-state simulation
+(negative and neutral SiDBs) and does not support atomic defect
+simulation.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``ps``:
+    *SimAnneal* parameters.
+
+Returns:
+    `sidb_simulation_result` is returned if at least one physically
+    valid charge distribution was found, otherwise `std::nullopt`.)doc";
+
+static const char *__doc_fiction_sim_anneal_params = R"doc(This struct stores the parameters for the *SimAnneal* algorithm.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_chemical_potential_spread =
+R"doc(The ground state is the physically valid charge distribution of
+minimal electrostatic potential energy, which often holds fewer
+electrons than the minimum of the grand potential. Therefore, the
+chains anneal with chemical potentials that are spread evenly between
+:math:`\mu_-` and :math:`(1 - s) \cdot \mu_-`, where :math:`s` is
+this value, before they descend to a local minimum of the actual grand
+potential. Has to be in :math:`[0, 1]`.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_cooling_factor =
+R"doc(Factor by which the temperature is multiplied after each annealing
+step. Has to be in :math:`(0, 1)`.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_final_temperature = R"doc(Temperature at which each chain stops (unit: eV).)doc";
+
+static const char *__doc_fiction_sim_anneal_params_hop_probability =
+R"doc(Probability of proposing that an electron hops between two SiDBs
+instead of changing the charge state of a single SiDB.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_initial_temperature = R"doc(Temperature at which each chain starts (unit: eV).)doc";
+
+static const char *__doc_fiction_sim_anneal_params_number_of_chains =
+R"doc(Number of independent annealing chains. Each chain starts from a
+different random charge configuration.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_number_threads =
+R"doc(Number of threads to spawn. By default the number of threads is set to
+the number of available hardware threads.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_seed =
+R"doc(Seed for the random number generators. Each chain draws from its own
+random stream that is derived from this seed and its index. Hence,
+results are reproducible and independent of the number of threads. If
+no seed is given, a random one is used.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_simulation_parameters = R"doc(Simulation parameters for the simulation of the physical SiDB system.)doc";
+
+static const char *__doc_fiction_sim_anneal_params_sweeps_per_temperature = R"doc(Number of proposed charge transitions per SiDB at each temperature.)doc";
+
 static const char *__doc_fiction_simple_gate_layout_tile_drawer =
 R"doc(Base class for a simple gate-level layout DOT drawer.
 
@@ -21251,6 +23353,22 @@ static const char *__doc_fiction_simple_gate_layout_tile_drawer_tile_id = R"doc(
 
 static const char *__doc_fiction_simple_gate_layout_tile_drawer_tile_label = R"doc()doc";
 
+static const char *__doc_fiction_simulated_annealing_params = R"doc(Parameters for the Simulated Annealing algorithms in this header file.)doc";
+
+static const char *__doc_fiction_simulated_annealing_params_num_threads =
+R"doc(The maximum number of threads that run annealing instances or replicas
+concurrently. Instances are assigned to this bounded pool of threads
+dynamically. By default, the number of threads is set to the number of
+available hardware threads.)doc";
+
+static const char *__doc_fiction_simulated_annealing_params_seed =
+R"doc(Seed for the random number generators. Each annealing instance or
+replica draws from its own random stream that is derived from this seed
+and its index. Hence, results are reproducible and independent of the
+number of threads as long as the provided functions only use the passed
+generator as their source of randomness. If no seed is given, a random
+one is used.)doc";
+
 static const char *__doc_fiction_singleton_multiset_conf_to_charge_state =
 R"doc(Function to convert a singleton cluster charge state in its compressed
 form to a charge state.
@@ -22170,6 +24288,18 @@ static const char *__doc_fiction_technology_network_technology_network = R"doc()
 
 static const char *__doc_fiction_technology_network_technology_network_2 = R"doc()doc";
 
+static const char *__doc_fiction_thread_idle_recorder =
+R"doc(Records the idle time of the worker threads of a thread pool, i.e.,
+the time between a worker running out of work and all workers being
+joined. Each worker calls `worker_finished` as its last action and the
+spawning thread calls `threads_joined` after joining all workers. The
+idle time of each worker is added in milliseconds to the histogram of
+the given name and the sum of all idle times to the timer of the same
+name.
+
+All member functions are no-ops if profiling is not compiled in or not
+enabled.)doc";
+
 static const char *__doc_fiction_tile_based_layout =
 R"doc(This class provides a tile-based naming scheme for coordinate-based
 functions. It does not add any functionality, but it might be useful
@@ -22227,6 +24357,30 @@ Parameter ``ps``:
     Pointer to a struct where the results (time_to_solution, acc,
     single runtime) are stored.)doc";
 
+static const char *__doc_fiction_time_to_solution_2 =
+R"doc(This function determines the time-to-solution (TTS) and the accuracy
+(acc) of the *SimAnneal* algorithm. Runs that do not find any
+physically valid charge distribution count as failed attempts. If a
+seed is given in `sim_anneal_params`, the repetitions use consecutive
+seeds starting from it such that they are independent yet
+reproducible.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Parameter ``lyt``:
+    Layout that is used for the simulation.
+
+Parameter ``sim_anneal_params``:
+    Parameters required for the *SimAnneal* algorithm.
+
+Parameter ``tts_params``:
+    Parameters used for the time-to-solution calculation.
+
+Parameter ``ps``:
+    Pointer to a struct where the results (time_to_solution, acc,
+    single runtime) are stored.)doc";
+
 static const char *__doc_fiction_time_to_solution_for_given_simulation_results =
 R"doc(This function calculates the Time-to-Solution (TTS) by analyzing the
 simulation results of a heuristic algorithm in comparison to those of
@@ -22274,9 +24428,10 @@ precise to 1 %).)doc";
 
 static const char *__doc_fiction_time_to_solution_stats =
 R"doc(This struct stores the time-to-solution, the simulation accuracy and
-the average single simulation runtime of *QuickSim*, the single
-runtime of the exact simulator used, and the number of valid charge
-configurations found by the exact algorithm.)doc";
+the average single simulation runtime of the heuristic simulation
+algorithm (*QuickSim* or *SimAnneal*), the single runtime of the exact
+simulator used, and the number of valid charge configurations found by
+the exact algorithm.)doc";
 
 static const char *__doc_fiction_time_to_solution_stats_acc = R"doc(Accuracy of the simulation in %.)doc";
 
@@ -22886,6 +25041,27 @@ Parameter ``coord``:
 Returns:
     Volume of coord.)doc";
 
+static const char *__doc_fiction_wilson_score_interval =
+R"doc(Computes the Wilson score interval of a binomial proportion, i.e., a
+confidence interval for the success probability of a random experiment
+that succeeded `successes` times in `trials` independent trials. Unlike
+the normal approximation, the interval never exceeds :math:`[0, 1]`
+and remains reliable for probabilities close to 0 or 1.
+
+Parameter ``successes``:
+    Number of successful trials.
+
+Parameter ``trials``:
+    Total number of trials.
+
+Parameter ``confidence_level``:
+    Probability that the interval contains the true success
+    probability, e.g., 0.95.
+
+Returns:
+    Lower and upper bound of the confidence interval. If `trials` is
+    0, the interval is :math:`[0, 1]`.)doc";
+
 static const char *__doc_fiction_wiring_reduction =
 R"doc(A scalable wiring reduction algorithm for 2DDWave-clocked layouts
 based on A* path finding as originally proposed in \"Late Breaking
@@ -22903,10 +25079,12 @@ fragments. Given the complexity of identifying these cuts,
 obstructions are strategically inserted into the layout to safeguard
 against the inadvertent deletion of standard gates or wire segments
 essential for the layout's integrity. Leveraging the obstructed layout
-as a basis, A* Search is employed to systematically identify feasible
-cuts either from left to right or top to bottom. Subsequently, these
-identified cuts are removed from the layout to minimize not only the
-number of wire segments, but also the area and critical path length.
+as a basis, a maximal set of disjoint cuts either from left to right or
+top to bottom is identified in a single sweep, where both directions
+are searched concurrently. Subsequently, the identified cuts of one
+direction are removed from the layout in one batch to minimize not
+only the number of wire segments, but also the area and critical path
+length.
 
 Template parameter ``Lyt``:
     Cartesian gate-level layout type.
@@ -22922,6 +25100,8 @@ Parameter ``pst``:
 
 static const char *__doc_fiction_wiring_reduction_params = R"doc(Parameters for the wiring reduction algorithm.)doc";
 
+static const char *__doc_fiction_wiring_reduction_params_enable_multithreading = R"doc(Search for horizontal and vertical cuts concurrently on two threads.)doc";
+
 static const char *__doc_fiction_wiring_reduction_params_timeout =
 R"doc(Timeout limit (in ms). Specifies the maximum allowed time in
 milliseconds for the optimization process. For large layouts, the
@@ -23290,6 +25470,11 @@ static const char *__doc_fiction_write_qca_layout_params = R"doc(Parameters for
 
 static const char *__doc_fiction_write_qca_layout_params_create_inter_layer_via_cells = R"doc(Create via cells in between each layer.)doc";
 
+static const char *__doc_fiction_write_qca_layout_params_num_threads =
+R"doc(Number of threads to render the cells of large layouts concurrently. The
+output does not depend on this value. By default, the number of
+threads is set to the number of available hardware threads.)doc";
+
 static const char *__doc_fiction_write_qca_layout_svg =
 R"doc(Writes an SVG representation of a cell-level QCA layout into an output
 stream. Both tile- and cell-based layouts are supported. For tile-
@@ -23342,6 +25527,11 @@ Parameter ``ps``:
 
 static const char *__doc_fiction_write_qca_layout_svg_params = R"doc(Parameters for writing SVG QCA layouts.)doc";
 
+static const char *__doc_fiction_write_qca_layout_svg_params_num_threads =
+R"doc(Number of threads to render the tiles of large layouts concurrently. The
+output does not depend on this value. By default, the number of
+threads is set to the number of available hardware threads.)doc";
+
 static const char *__doc_fiction_write_qca_layout_svg_params_simple = R"doc(Limit details to create smaller file sizes.)doc";
 
 static const char *__doc_fiction_write_qcc_layout =
@@ -23432,6 +25622,44 @@ Parameter ``filename``:
 Parameter ``ps``:
     Parameters.)doc";
 
+static const char *__doc_fiction_write_rendered_in_order =
+R"doc(Renders the textual representations of the given items into an output
+stream while preserving their order. Items are processed in batches of
+`items_per_thread` items per thread. Each thread renders a contiguous
+slice of the current batch into a local buffer and the buffers are
+written to the stream in order before the next batch is rendered.
+Thus, the output is identical to a sequential rendering and the
+required memory is bounded by the batch size instead of the size of
+the entire output.
+
+Exceptions thrown by `render` are passed on to the caller. In this
+case, the items of all previous batches have already been written to
+`os`.
+
+Template parameter ``T``:
+    Item type.
+
+Template parameter ``RenderFn``:
+    Functor type that complies with the signature `void(const T&,
+    std::string&)`. It must be safe to call concurrently for different
+    items.
+
+Parameter ``os``:
+    The output stream to write into.
+
+Parameter ``items``:
+    The items to render in order.
+
+Parameter ``render``:
+    Functor that appends the representation of an item to a buffer.
+
+Parameter ``num_threads``:
+    Maximum number of threads to render with.
+
+Parameter ``items_per_thread``:
+    Number of items that each thread renders per batch. Fewer items
+    are rendered sequentially.)doc";
+
 static const char *__doc_fiction_write_sidb_layout_svg =
 R"doc(Writes an SVG representation of an SiDB cell-level SiDB layout into an
 output stream.
@@ -23482,6 +25710,12 @@ static const char *__doc_fiction_write_sidb_layout_svg_params_lattice_mode = R"d
 
 static const char *__doc_fiction_write_sidb_layout_svg_params_lattice_point_size = R"doc(Size of the H-Si lattice points in SVG units.)doc";
 
+static const char *__doc_fiction_write_sidb_layout_svg_params_num_threads =
+R"doc(Number of threads to render the lattice points and SiDBs of large
+layouts concurrently. The output does not depend on this value. By
+default, the number of threads is set to the number of available
+hardware threads.)doc";
+
 static const char *__doc_fiction_write_sidb_layout_svg_params_sidb_border_width = R"doc(Border width of the SiDB.)doc";
 
 static const char *__doc_fiction_write_sidb_layout_svg_params_sidb_lattice_mode =
@@ -23573,7 +25807,16 @@ than the number of possible paths from source to target, the size of
 the returned path collection will be smaller than :math:`k`.
 
 This implementation uses the A* algorithm with the Manhattan distance
-function internally.
+function to determine the initial shortest path. For all subsequent
+spur searches, the distances of all coordinates to the target are
+determined once via a reverse breadth-first search that disregards the
+temporary obstructions of Yen's algorithm. These distances serve as
+the heuristic for A*. Furthermore, spur paths that can follow
+decreasing distances to the target without running into an obstruction
+are taken as they are without any search. Temporary obstructions are
+layered on top of the layout instead of being written into it. Thus,
+the given layout is never modified and the spur searches of each
+iteration are conducted concurrently.
 
 This function automatically detects whether the given layout
 implements a clocking interface (see `clocked_layout`) and respects
@@ -23638,6 +25881,14 @@ static const char *__doc_fiction_yen_k_shortest_paths_params = R"doc(Parameters
 
 static const char *__doc_fiction_yen_k_shortest_paths_params_astar_params = R"doc(Parameters for the internal A* algorithm.)doc";
 
+static const char *__doc_fiction_yen_k_shortest_paths_params_num_threads =
+R"doc(Number of threads to use for the spur searches. The spur searches of
+each iteration are independent of each other and are distributed among
+the threads. Since the resulting candidate paths are collected in spur
+order, the returned paths do not depend on the number of threads. By
+default, the number of threads is set to the number of available
+hardware threads.)doc";
+
 static const char *__doc_fmt_formatter = R"doc()doc";
 
 static const char *__doc_fmt_formatter_2 = R"doc()doc";
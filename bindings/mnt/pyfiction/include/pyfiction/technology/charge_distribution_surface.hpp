@@ -6,6 +6,7 @@
 #define PYFICTION_CHARGE_DISTRIBUTION_SURFACE_HPP
 
 #include "pyfiction/documentation.hpp"
+#include "pyfiction/numpy_views.hpp"
 #include "pyfiction/types.hpp"
 
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
@@ -15,6 +16,7 @@
 #include <fiction/technology/sidb_defects.hpp>
 #include <fiction/traits.hpp>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -72,9 +74,20 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
         .def("erase_defect", &py_cds::erase_defect, py::arg("c"))
         .def("assign_charge_state_by_index", &py_cds::assign_charge_state_by_index, py::arg("index"), py::arg("cs"),
              py::arg("index_mode") = fiction::charge_index_mode::UPDATE_CHARGE_INDEX)
+        .def("move_sidb", &py_cds::move_sidb, py::arg("from"), py::arg("to"))
+        .def("apply_sidb_delta", &py_cds::apply_sidb_delta, py::arg("removed_sidbs"), py::arg("added_sidbs"),
+             py::arg("added_type"))
         .def("get_charge_state", &py_cds::get_charge_state, py::arg("c"))
         .def("get_charge_state_by_index", &py_cds::get_charge_state_by_index, py::arg("index"))
         .def("get_all_sidb_charges", &py_cds::get_all_sidb_charges)
+        .def(
+            "get_all_sidb_charges_array",
+            [](const py::object& self)
+            {
+                const auto& charges = self.cast<const py_cds&>().get_all_sidb_charges_ref();
+                return read_only_view<int8_t>(charges, {static_cast<py::ssize_t>(charges.size())}, self);
+            },
+            DOC(pyfiction_charge_distribution_surface_get_all_sidb_charges_array))
         .def("negative_sidb_detection", &py_cds::negative_sidb_detection)
         .def("get_nm_distance_between_sidbs", &py_cds::get_nm_distance_between_sidbs, py::arg("c1"), py::arg("c2"))
         .def("get_nm_distance_by_indices", &py_cds::get_nm_distance_by_indices, py::arg("index1"), py::arg("index2"))
@@ -133,6 +146,33 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
         .def("get_local_external_potential_map", &py_cds::get_local_external_potential_map)
         .def("reset_local_external_potential", &py_cds::reset_local_external_potentials)
         .def("get_local_defect_potentials", &py_cds::get_local_defect_potentials)
+        .def(
+            "get_local_internal_potentials",
+            [](const py::object& self)
+            {
+                const auto& potentials = self.cast<const py_cds&>().get_local_internal_potentials();
+                return read_only_view<double>(potentials, {static_cast<py::ssize_t>(potentials.size())}, self);
+            },
+            DOC(pyfiction_charge_distribution_surface_get_local_internal_potentials))
+        .def(
+            "get_local_external_potentials",
+            [](const py::object& self)
+            {
+                const auto& potentials = self.cast<const py_cds&>().get_local_external_potentials();
+                return read_only_view<double>(potentials, {static_cast<py::ssize_t>(potentials.size())}, self);
+            },
+            DOC(pyfiction_charge_distribution_surface_get_local_external_potentials))
+        .def(
+            "get_chargeless_potential_matrix",
+            [](const py::object& self)
+            {
+                const auto& lyt    = self.cast<const py_cds&>();
+                const auto& matrix = lyt.get_chargeless_potential_matrix();
+                const auto  n      = matrix.empty() ? py::ssize_t{0} : static_cast<py::ssize_t>(lyt.num_cells());
+
+                return read_only_view<double>(matrix, {n, n}, self);
+            },
+            DOC(pyfiction_charge_distribution_surface_get_chargeless_potential_matrix))
         .def("get_defects", &py_cds::get_defects)
         .def("update_charge_state_of_dependent_cell", &py_cds::update_charge_state_of_dependent_cell)
         .def("get_charge_index_of_sub_layout", &py_cds::get_charge_index_of_sub_layout)
@@ -54,7 +54,7 @@ void random_coordinate(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("random_coordinate", &fiction::random_coordinate<fiction::coordinate<Lyt>>, py::arg("coordinate1"),
-          py::arg("coordinate_2"), DOC(fiction_random_coordinate));
+          py::arg("coordinate_2"), DOC(fiction_random_coordinate_2));
 }
 
 }  // namespace detail
@@ -0,0 +1,66 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef PYFICTION_PROFILING_HPP
+#define PYFICTION_PROFILING_HPP
+
+#include "pyfiction/documentation.hpp"
+
+#include <fiction/utils/profiling.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include <string>
+
+namespace pyfiction
+{
+
+inline void profiling(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::class_<fiction::profiling_params>(m, "profiling_params", DOC(fiction_profiling_params))
+        .def(py::init<>())
+        .def_readwrite("record_trace", &fiction::profiling_params::record_trace,
+                       DOC(fiction_profiling_params_record_trace))
+        .def_readwrite("max_trace_events", &fiction::profiling_params::max_trace_events,
+                       DOC(fiction_profiling_params_max_trace_events))
+
+        ;
+
+    m.attr("PROFILING_COMPILED_IN") = fiction::profiling_compiled_in;
+
+    m.def(
+        "enable_profiling", [](const fiction::profiling_params& params)
+        { fiction::profiler::instance().enable(params); }, py::arg("params") = fiction::profiling_params{},
+        DOC(fiction_profiler_enable));
+    m.def(
+        "disable_profiling", [] { fiction::profiler::instance().disable(); }, DOC(fiction_profiler_disable));
+    m.def(
+        "is_profiling_enabled", [] { return fiction::profiler::instance().is_enabled(); },
+        DOC(fiction_profiler_is_enabled));
+    m.def(
+        "reset_profiling", [] { fiction::profiler::instance().reset(); }, DOC(fiction_profiler_reset));
+    m.def(
+        "profiling_summary",
+        []
+        {
+            const auto summary = fiction::profiler::instance().summary().dump();
+
+            return py::module_::import("json").attr("loads")(summary);
+        },
+        DOC(pyfiction_profiling_summary));
+    m.def(
+        "write_profiling_summary", [](const std::string& filename)
+        { fiction::profiler::instance().write_summary(filename); }, py::arg("filename"),
+        DOC(fiction_profiler_write_summary));
+    m.def(
+        "write_chrome_trace", [](const std::string& filename)
+        { fiction::profiler::instance().write_chrome_trace(filename); }, py::arg("filename"),
+        DOC(fiction_profiler_write_chrome_trace));
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_PROFILING_HPP
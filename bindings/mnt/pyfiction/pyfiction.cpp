@@ -52,6 +52,7 @@
 #include "pyfiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "pyfiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "pyfiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "pyfiction/algorithms/simulation/sidb/sim_anneal.hpp"
 #include "pyfiction/algorithms/simulation/sidb/time_to_solution.hpp"
 #include "pyfiction/algorithms/verification/design_rule_violations.hpp"
 #include "pyfiction/algorithms/verification/equivalence_checking.hpp"
@@ -90,6 +91,7 @@
 #include "pyfiction/utils/name_utils.hpp"
 #include "pyfiction/utils/network_utils.hpp"
 #include "pyfiction/utils/placement_utils.hpp"
+#include "pyfiction/utils/profiling.hpp"
 #include "pyfiction/utils/routing_utils.hpp"
 #include "pyfiction/utils/truth_table_utils.hpp"
 #include "pyfiction/utils/version_info.hpp"
@@ -140,6 +142,7 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
     pyfiction::exhaustive_ground_state_simulation(m);
     pyfiction::quicksim(m);
     pyfiction::quickexact(m);
+    pyfiction::sim_anneal(m);
     pyfiction::clustercomplete(m);
     pyfiction::is_ground_state(m);
     pyfiction::minimum_energy(m);
@@ -226,6 +229,7 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
     pyfiction::name_utils(m);
     pyfiction::network_utils(m);
     pyfiction::placement_utils(m);
+    pyfiction::profiling(m);
     pyfiction::truth_table_utils(m);
     pyfiction::version_info(m);
 }
@@ -1,6 +1,12 @@
 import unittest
 
-from mnt.pyfiction import bdl_input_iterator_100, sidb_100_lattice, sidb_technology
+from mnt.pyfiction import (
+    bdl_input_iterator_100,
+    bdl_input_iterator_params,
+    input_pattern_order,
+    sidb_100_lattice,
+    sidb_technology,
+)
 
 
 class TestBDLInputIterator(unittest.TestCase):
@@ -180,6 +186,52 @@ class TestBDLInputIterator(unittest.TestCase):
             else:
                 break
 
+    def test_siqad_and_gate_iteration_in_gray_code_order(self):
+        layout = sidb_100_lattice((20, 10), "AND gate")
+
+        layout.assign_cell_type((0, 0, 1), sidb_technology.cell_type.INPUT)
+        layout.assign_cell_type((2, 1, 1), sidb_technology.cell_type.INPUT)
+
+        layout.assign_cell_type((20, 0, 1), sidb_technology.cell_type.INPUT)
+        layout.assign_cell_type((18, 1, 1), sidb_technology.cell_type.INPUT)
+
+        layout.assign_cell_type((4, 2, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 3, 1), sidb_technology.cell_type.NORMAL)
+
+        layout.assign_cell_type((14, 3, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((16, 2, 1), sidb_technology.cell_type.NORMAL)
+
+        layout.assign_cell_type((10, 6, 0), sidb_technology.cell_type.OUTPUT)
+        layout.assign_cell_type((10, 7, 0), sidb_technology.cell_type.OUTPUT)
+
+        layout.assign_cell_type((10, 9, 1), sidb_technology.cell_type.NORMAL)
+
+        params = bdl_input_iterator_params()
+        params.input_order = input_pattern_order.GRAY_CODE
+
+        bii = bdl_input_iterator_100(layout, params)
+
+        self.assertEqual(bii.num_input_pairs(), 2)
+
+        for index, expected_pattern in enumerate([0, 1, 3, 2]):
+            self.assertEqual(bii, index)
+            self.assertEqual(bii.get_current_input_index(), expected_pattern)
+
+            if index > 0:
+                removed_sidbs, added_sidbs = bii.get_delta()
+
+                # consecutive input patterns differ in a single input
+                self.assertEqual(len(removed_sidbs), 1)
+                self.assertEqual(len(added_sidbs), 1)
+
+            bii += 1
+
+        # the input state that applies a given input pattern is its inverse Gray code
+        bii.set_input_pattern(2)
+        self.assertEqual(bii, 3)
+        self.assertEqual(bii.get_current_input_index(), 2)
+        self.assertEqual(bii.get_input_pattern_of_state(3), 2)
+
 
 if __name__ == "__main__":
     unittest.main()
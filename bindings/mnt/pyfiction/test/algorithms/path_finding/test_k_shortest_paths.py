@@ -12,6 +12,7 @@ from mnt.pyfiction import (
     shifted_cartesian_gate_layout,
     shifted_cartesian_layout,
     yen_k_shortest_paths,
+    yen_k_shortest_paths_params,
 )
 
 
@@ -47,6 +48,21 @@ class TestKShortestPaths(unittest.TestCase):
             self.assertIn([(0, 0), (0, 1), (1, 1)], paths)
             self.assertIn([(0, 0), (1, 0), (1, 1)], paths)
 
+    def test_yen_paths_with_multiple_threads(self):
+        lyt = clocked_cartesian_layout((9, 9), "USE")
+
+        params = yen_k_shortest_paths_params()
+        params.num_threads = 1
+
+        sequential_paths = yen_k_shortest_paths(lyt, offset_coordinate(0, 0), offset_coordinate(9, 9), 10, params)
+
+        params.num_threads = 4
+
+        parallel_paths = yen_k_shortest_paths(lyt, offset_coordinate(0, 0), offset_coordinate(9, 9), 10, params)
+
+        self.assertEqual(len(sequential_paths), 10)
+        self.assertListEqual(sequential_paths, parallel_paths)
+
 
 if __name__ == "__main__":
     unittest.main()
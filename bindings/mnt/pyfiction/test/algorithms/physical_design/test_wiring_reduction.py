@@ -38,6 +38,12 @@ class TestWiringReduction(unittest.TestCase):
 
         self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
 
+        params.enable_multithreading = False
+        self.assertFalse(params.enable_multithreading)
+        wiring_reduction(layout, params)
+
+        self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+
     def test_wiring_reduction_with_stats(self):
         network = read_technology_network(dir_path + "/../../resources/mux21.v")
 
@@ -66,6 +66,21 @@ class TestDisplacementRobustnessDomain(unittest.TestCase):
 
         self.assertEqual(stats.num_non_operational_sidb_displacements + stats.num_operational_sidb_displacements, 8)
 
+        # draw a fixed number of displaced layouts on demand
+        params.analysis_mode = displacement_analysis_mode.MONTE_CARLO
+        params.confidence_interval_width = 0.0
+        params.max_number_of_samples = 20
+        params.batch_size = 5
+        params.seed = 42
+
+        stats = displacement_robustness_domain_stats()
+
+        domain = determine_displacement_robustness_domain_100(layout, [create_and_tt()], params, stats)
+
+        self.assertEqual(len(domain.influence_information), 20)
+        self.assertEqual(stats.num_non_operational_sidb_displacements + stats.num_operational_sidb_displacements, 20)
+        self.assertLessEqual(stats.confidence_interval_lower_bound, stats.confidence_interval_upper_bound)
+
 
 if __name__ == "__main__":
     unittest.main()
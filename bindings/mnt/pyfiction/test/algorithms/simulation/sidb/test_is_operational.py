@@ -8,6 +8,7 @@ from mnt.pyfiction import (
     detect_bdl_wires_params,
     is_kink_induced_non_operational,
     is_operational,
+    is_operational_batch,
     is_operational_params,
     kink_induced_non_operational_input_patterns,
     operational_analysis_strategy,
@@ -83,6 +84,47 @@ class TestIsOperational(unittest.TestCase):
         )
         self.assertEqual(op_status, operational_status.NON_OPERATIONAL)
 
+    def test_is_operational_batch(self):
+        lyt = sidb_100_lattice()
+
+        lyt.assign_cell_type((0, 1), sidb_technology.cell_type.INPUT)
+        lyt.assign_cell_type((2, 3), sidb_technology.cell_type.INPUT)
+
+        lyt.assign_cell_type((20, 1), sidb_technology.cell_type.INPUT)
+        lyt.assign_cell_type((19, 3), sidb_technology.cell_type.INPUT)
+
+        lyt.assign_cell_type((4, 5), sidb_technology.cell_type.NORMAL)
+        lyt.assign_cell_type((6, 7), sidb_technology.cell_type.NORMAL)
+
+        lyt.assign_cell_type((14, 7), sidb_technology.cell_type.NORMAL)
+        lyt.assign_cell_type((16, 5), sidb_technology.cell_type.NORMAL)
+
+        lyt.assign_cell_type((10, 12, 0), sidb_technology.cell_type.OUTPUT)
+        lyt.assign_cell_type((10, 14, 0), sidb_technology.cell_type.OUTPUT)
+
+        lyt.assign_cell_type((10, 19), sidb_technology.cell_type.NORMAL)
+
+        operational_params = is_operational_params()
+        operational_params.simulation_parameters = sidb_simulation_parameters(2, -0.28)
+
+        non_operational_params = is_operational_params()
+        non_operational_params.simulation_parameters = sidb_simulation_parameters(2, -0.1)
+
+        # multiple parameter sets for one layout
+        results = is_operational_batch(lyt, [create_and_tt()], [operational_params, non_operational_params] * 2)
+
+        self.assertEqual(len(results), 4)
+        self.assertEqual(
+            [op_status for op_status, _ in results],
+            [operational_status.OPERATIONAL, operational_status.NON_OPERATIONAL] * 2,
+        )
+
+        # multiple layouts for one parameter set
+        results = is_operational_batch([lyt, lyt, lyt], [create_and_tt()], operational_params, num_threads=2)
+
+        self.assertEqual(len(results), 3)
+        self.assertTrue(all(op_status == operational_status.OPERATIONAL for op_status, _ in results))
+
     def test_and_gate_kinks(self):
         lyt = read_sqd_layout_100(dir_path + "/../../../resources/AND_mu_032_kinks.sqd")
 
@@ -225,6 +225,14 @@ class TestOperationalDomain(unittest.TestCase):
         # Test retrieving a value that doesn't exist using contains (should return None)
         self.assertNotIn(missing_key, temp_domain)
 
+        # to_numpy() should return the domain as columns
+        coordinates, operational, critical_temperatures = temp_domain.to_numpy()
+        self.assertEqual(coordinates.shape, (2, 2))
+        self.assertEqual(operational.dtype, bool)
+        rows = {tuple(coordinates[i]): (operational[i], critical_temperatures[i]) for i in range(2)}
+        self.assertEqual(rows[(1.0, 2.0)], (True, 0.1))
+        self.assertEqual(rows[(3.3, 4.4)], (False, 0.0))
+
         # Modify dimensions and verify
         self.assertEqual(temp_domain.get_dimension(0), sweep_parameter.EPSILON_R)
         self.assertEqual(temp_domain.get_dimension(1), sweep_parameter.LAMBDA_TF)
@@ -291,6 +299,13 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertIn((new_key, new_value), items_method)
         self.assertEqual(len(items_method), 2)
 
+        # to_numpy() should return the domain as columns
+        coordinates, operational = op_domain.to_numpy()
+        self.assertEqual(coordinates.shape, (2, 2))
+        self.assertEqual(operational.shape, (2,))
+        rows = {tuple(coordinates[i]): operational[i] for i in range(2)}
+        self.assertEqual(rows, {(10.0, 20.0): False, (1.1, 2.2): True})
+
     def test_operational_domain_two_bdl_pair_wire(self):
         bdl_wire = sidb_100_lattice()
 
@@ -327,6 +342,10 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertEqual(stats_grid.num_operational_parameter_combinations, 0)
         self.assertEqual(stats_grid.num_non_operational_parameter_combinations, 8281)
 
+        coordinates, operational = op_domain.to_numpy()
+        self.assertEqual(coordinates.shape, (8281, 2))
+        self.assertFalse(operational.any())
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -6,6 +6,7 @@ from mnt.pyfiction import (
     charge_distribution_surface_100,
     charge_distribution_surface_111,
     quickexact,
+    quickexact_batch,
     quickexact_params,
     read_sqd_layout_100,
     sidb_100_lattice,
@@ -133,6 +134,35 @@ class TestQuickExact(unittest.TestCase):
         and_gate.assign_cell_type((0, 0), sidb_technology.cell_type.INPUT)
         and_gate.assign_cell_type((26, 0), sidb_technology.cell_type.INPUT)
 
+    def test_batch(self):
+        layouts = []
+        for x in range(1, 4):
+            layout = sidb_100_lattice((x + 2, 1))
+            layout.assign_cell_type((0, 0), sidb_technology.cell_type.NORMAL)
+            layout.assign_cell_type((x, 0), sidb_technology.cell_type.NORMAL)
+            layout.assign_cell_type((x + 2, 0), sidb_technology.cell_type.NORMAL)
+            layouts.append(layout)
+
+        params = quickexact_params()
+        params.simulation_parameters.mu_minus = -0.25
+
+        results = quickexact_batch(layouts, params)
+
+        self.assertEqual(len(results), len(layouts))
+
+        for layout, result in zip(layouts, results):
+            self.assertEqual(result.algorithm_name, "QuickExact")
+            self.assertEqual(len(result.charge_distributions), len(quickexact(layout, params).charge_distributions))
+
+        other_params = quickexact_params()
+        other_params.simulation_parameters.mu_minus = -0.32
+
+        results = quickexact_batch(layouts[0], [params, other_params], num_threads=2)
+
+        self.assertEqual(len(results), 2)
+        self.assertEqual(results[0].simulation_parameters.mu_minus, -0.25)
+        self.assertEqual(results[1].simulation_parameters.mu_minus, -0.32)
+
 
 if __name__ == "__main__":
     unittest.main()
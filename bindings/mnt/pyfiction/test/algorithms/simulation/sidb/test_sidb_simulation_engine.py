@@ -14,12 +14,14 @@ class TestSiDBSimulationEngine(unittest.TestCase):
         self.assertEqual(sidb_simulation_engine_name(sidb_simulation_engine.QUICKSIM), "QuickSim")
         self.assertEqual(sidb_simulation_engine_name(sidb_simulation_engine.EXGS), "ExGS")
         self.assertEqual(sidb_simulation_engine_name(sidb_simulation_engine.CLUSTERCOMPLETE), "ClusterComplete")
+        self.assertEqual(sidb_simulation_engine_name(sidb_simulation_engine.SIMANNEAL), "SimAnneal")
 
         self.assertEqual(sidb_simulation_engine_name(exact_sidb_simulation_engine.QUICKEXACT), "QuickExact")
         self.assertEqual(sidb_simulation_engine_name(exact_sidb_simulation_engine.EXGS), "ExGS")
         self.assertEqual(sidb_simulation_engine_name(exact_sidb_simulation_engine.CLUSTERCOMPLETE), "ClusterComplete")
 
         self.assertEqual(sidb_simulation_engine_name(heuristic_sidb_simulation_engine.QUICKSIM), "QuickSim")
+        self.assertEqual(sidb_simulation_engine_name(heuristic_sidb_simulation_engine.SIMANNEAL), "SimAnneal")
 
     if __name__ == "__main__":
         unittest.main()
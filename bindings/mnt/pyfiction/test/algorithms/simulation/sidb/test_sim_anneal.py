@@ -0,0 +1,92 @@
+import unittest
+
+from mnt.pyfiction import (
+    sidb_100_lattice,
+    sidb_111_lattice,
+    sidb_charge_state,
+    sidb_simulation_parameters,
+    sidb_technology,
+    sim_anneal,
+    sim_anneal_params,
+    time_to_solution,
+    time_to_solution_params,
+    time_to_solution_stats,
+)
+
+
+class TestSimAnneal(unittest.TestCase):
+    def test_perturber_and_sidb_pair(self):
+        layout = sidb_100_lattice((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        params = sim_anneal_params()
+        params.simulation_parameters = sidb_simulation_parameters()
+        params.number_of_chains = 8
+        params.cooling_factor = 0.95
+        params.number_threads = 2
+        params.seed = 42
+        self.assertEqual(params.number_of_chains, 8)
+        self.assertEqual(params.cooling_factor, 0.95)
+        self.assertEqual(params.number_threads, 2)
+        self.assertEqual(params.seed, 42)
+
+        result = sim_anneal(layout, params)
+
+        self.assertEqual(result.algorithm_name, "SimAnneal")
+
+        groundstate = result.groundstates()[0]
+
+        self.assertEqual(groundstate.get_charge_state((0, 1)), sidb_charge_state.NEGATIVE)
+        self.assertEqual(groundstate.get_charge_state((4, 1)), sidb_charge_state.NEUTRAL)
+        self.assertEqual(groundstate.get_charge_state((6, 1)), sidb_charge_state.NEGATIVE)
+
+    def test_perturber_and_sidb_pair_111(self):
+        layout = sidb_111_lattice((4, 1))
+        layout.assign_cell_type((0, 0), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((1, 0), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((2, 0), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((3, 0), sidb_technology.cell_type.NORMAL)
+
+        params = sim_anneal_params()
+        params.simulation_parameters.mu_minus = -0.32
+        params.seed = 1
+
+        result = sim_anneal(layout, params)
+
+        self.assertEqual(result.algorithm_name, "SimAnneal")
+
+        groundstate = result.groundstates()
+
+        self.assertEqual(len(groundstate), 1)
+
+        self.assertEqual(groundstate[0].get_charge_state((0, 0)), sidb_charge_state.NEGATIVE)
+        self.assertEqual(groundstate[0].get_charge_state((1, 0)), sidb_charge_state.NEUTRAL)
+        self.assertEqual(groundstate[0].get_charge_state((2, 0)), sidb_charge_state.NEUTRAL)
+        self.assertEqual(groundstate[0].get_charge_state((3, 0)), sidb_charge_state.NEGATIVE)
+
+    def test_empty_layout(self):
+        self.assertIsNone(sim_anneal(sidb_100_lattice(), sim_anneal_params()))
+
+    def test_time_to_solution(self):
+        layout = sidb_100_lattice((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        params = sim_anneal_params()
+        params.simulation_parameters = sidb_simulation_parameters(2, -0.32)
+        params.seed = 3
+
+        tts_params = time_to_solution_params()
+        tts_params.repetitions = 10
+
+        stats = time_to_solution_stats()
+        time_to_solution(layout, params, tts_params, stats)
+
+        self.assertEqual(stats.acc, 100)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,6 +1,6 @@
 import unittest
 
-from mnt.pyfiction import cartesian_gate_layout, color_routing, gate_level_drvs
+from mnt.pyfiction import cartesian_gate_layout, color_routing, gate_level_drv_params, gate_level_drvs
 
 
 class TestDesignRuleViolations(unittest.TestCase):
@@ -60,6 +60,11 @@ class TestDesignRuleViolations(unittest.TestCase):
         self.assertEqual(0, warnings)
         self.assertEqual(0, drvs)
 
+        params = gate_level_drv_params()
+        params.num_threads = 1
+
+        self.assertEqual((0, 0), gate_level_drvs(layout, params))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -1,7 +1,13 @@
 import os
 import unittest
 
-from mnt.pyfiction import eq_type, equivalence_checking, equivalence_checking_stats, read_technology_network
+from mnt.pyfiction import (
+    eq_type,
+    equivalence_checking,
+    equivalence_checking_params,
+    equivalence_checking_stats,
+    read_technology_network,
+)
 
 dir_path = os.path.dirname(os.path.realpath(__file__))
 
@@ -14,9 +20,27 @@ class TestEquivalenceChecking(unittest.TestCase):
         stats = equivalence_checking_stats()
         self.assertEqual(stats.counter_example, [])
 
+        # simulation finds the first input pattern as a counter example
         eq = equivalence_checking(xor2_net, xnor2_net, stats)
         self.assertEqual(eq, eq_type.NO)
+        self.assertEqual(stats.counter_example, [False, False])
+        self.assertFalse(stats.sat_solver_invoked)
+
+    def test_non_eq_sat(self):
+        xor2_net = read_technology_network(dir_path + "/../../resources/xor2.v")
+        xnor2_net = read_technology_network(dir_path + "/../../resources/xnor2.v")
+
+        params = equivalence_checking_params()
+        params.max_exhaustive_simulation_pis = 0
+        params.num_random_patterns = 0
+
+        stats = equivalence_checking_stats()
+
+        eq = equivalence_checking(xor2_net, xnor2_net, stats, params)
+        self.assertEqual(eq, eq_type.NO)
         self.assertEqual(stats.counter_example, [True, False])
+        self.assertTrue(stats.sat_solver_invoked)
+        self.assertEqual(stats.simulated_patterns, 0)
 
 
 if __name__ == "__main__":
@@ -244,6 +244,10 @@ class TestWriteSvgLayout(unittest.TestCase):
         generated_svg_cds_light_mode = write_sidb_layout_svg_to_string(cds, params)
         self.assertEqual(normalize_svg(generated_svg_cds_light_mode), normalize_svg(cds_light_mode))
 
+        # the output does not depend on the number of threads
+        params.num_threads = 1
+        self.assertEqual(write_sidb_layout_svg_to_string(cds, params), generated_svg_cds_light_mode)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -48,6 +48,42 @@ class TestChargeDistributionSurface(unittest.TestCase):
 
         self.assertEqual(charge_lyt.get_electrostatic_potential_energy(), 0)
 
+    def test_numpy_views(self):
+        layout = sidb_layout((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        charge_lyt = charge_distribution_surface(layout)
+
+        charges = charge_lyt.get_all_sidb_charges_array()
+        local_potentials = charge_lyt.get_local_internal_potentials()
+        potential_matrix = charge_lyt.get_chargeless_potential_matrix()
+
+        self.assertEqual(charges.tolist(), [-1, -1, -1])
+        self.assertEqual(local_potentials.shape, (3,))
+        self.assertEqual(charge_lyt.get_local_external_potentials().tolist(), [0.0, 0.0, 0.0])
+        self.assertEqual(potential_matrix.shape, (3, 3))
+
+        for i in range(3):
+            self.assertEqual(local_potentials[i], charge_lyt.get_local_internal_potential_by_index(i))
+            for j in range(3):
+                self.assertEqual(potential_matrix[i, j], charge_lyt.get_chargeless_potential_by_indices(i, j))
+
+        # the views are read-only
+        with self.assertRaises(ValueError):
+            charges[0] = 0
+
+        # the views reflect changes of the charge distribution surface
+        charge_lyt.assign_charge_state((4, 1), sidb_charge_state.NEUTRAL)
+        charge_lyt.update_after_charge_change()
+        self.assertEqual(charges.tolist(), [-1, 0, -1])
+        self.assertEqual(local_potentials[0], charge_lyt.get_local_internal_potential_by_index(0))
+
+        # the views keep the charge distribution surface alive
+        del charge_lyt
+        self.assertEqual(charges.tolist(), [-1, 0, -1])
+
     def test_initialization_111_lattice(self):
         layout_one = sidb_111_lattice((10, 10))
         layout_one.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
@@ -94,5 +130,39 @@ class TestChargeDistributionSurface(unittest.TestCase):
         self.assertEqual(charge_lyt.num_positive_sidbs(), 1)
 
 
+    def test_move_sidb(self):
+        layout = sidb_layout((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        moved_layout = sidb_layout((10, 10))
+        moved_layout.assign_cell_type((2, 1), sidb_technology.cell_type.NORMAL)
+        moved_layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        moved_layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        charge_lyt = charge_distribution_surface(layout)
+        reference = charge_distribution_surface(moved_layout)
+
+        charge_lyt.move_sidb((0, 1), (2, 1))
+        charge_lyt.update_after_charge_change()
+
+        self.assertEqual(charge_lyt.get_cell_type((0, 1)), sidb_technology.cell_type.EMPTY)
+        self.assertEqual(charge_lyt.get_cell_type((2, 1)), sidb_technology.cell_type.NORMAL)
+        self.assertEqual(charge_lyt.get_charge_state((2, 1)), sidb_charge_state.NEGATIVE)
+        self.assertAlmostEqual(
+            charge_lyt.get_electrostatic_potential_energy(), reference.get_electrostatic_potential_energy()
+        )
+
+        charge_lyt.apply_sidb_delta([(2, 1)], [(0, 1)], sidb_technology.cell_type.NORMAL)
+        charge_lyt.update_after_charge_change()
+
+        self.assertEqual(charge_lyt.get_cell_type((0, 1)), sidb_technology.cell_type.NORMAL)
+        self.assertAlmostEqual(
+            charge_lyt.get_electrostatic_potential_energy(),
+            charge_distribution_surface(layout).get_electrostatic_potential_energy(),
+        )
+
+
 if __name__ == "__main__":
     unittest.main()
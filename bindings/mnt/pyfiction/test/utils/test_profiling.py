@@ -0,0 +1,82 @@
+import json
+import os
+import tempfile
+import unittest
+
+from mnt.pyfiction import (
+    PROFILING_COMPILED_IN,
+    a_star,
+    cartesian_gate_layout,
+    disable_profiling,
+    enable_profiling,
+    is_profiling_enabled,
+    profiling_params,
+    profiling_summary,
+    reset_profiling,
+    write_chrome_trace,
+    write_profiling_summary,
+)
+
+
+class TestProfiling(unittest.TestCase):
+    def tearDown(self):
+        disable_profiling()
+        reset_profiling()
+
+    def test_enable_and_disable(self):
+        enable_profiling()
+        self.assertEqual(is_profiling_enabled(), PROFILING_COMPILED_IN)
+
+        disable_profiling()
+        self.assertFalse(is_profiling_enabled())
+
+    def test_summary(self):
+        params = profiling_params()
+        params.record_trace = True
+
+        enable_profiling(params)
+
+        lyt = cartesian_gate_layout((4, 4, 0), "2DDWave")
+        self.assertEqual(len(a_star(lyt, (0, 0), (4, 4))), 9)
+
+        disable_profiling()
+
+        summary = profiling_summary()
+
+        self.assertIn("timers", summary)
+        self.assertIn("counters", summary)
+        self.assertIn("histograms", summary)
+
+        if PROFILING_COMPILED_IN:
+            self.assertEqual(summary["timers"]["a_star"]["count"], 1)
+        else:
+            self.assertEqual(summary["timers"], {})
+
+        # disabled profiling does not record anything
+        a_star(lyt, (0, 0), (4, 4))
+        self.assertEqual(profiling_summary()["timers"], summary["timers"])
+
+        reset_profiling()
+        self.assertEqual(profiling_summary()["timers"], {})
+
+    def test_write_files(self):
+        enable_profiling(profiling_params())
+
+        lyt = cartesian_gate_layout((2, 2, 0), "2DDWave")
+        a_star(lyt, (0, 0), (2, 2))
+
+        with tempfile.TemporaryDirectory() as tmp:
+            summary_file = os.path.join(tmp, "summary.json")
+            trace_file = os.path.join(tmp, "trace.json")
+
+            write_profiling_summary(summary_file)
+            write_chrome_trace(trace_file)
+
+            with open(summary_file) as f:
+                self.assertIn("timers", json.load(f))
+            with open(trace_file) as f:
+                self.assertIn("traceEvents", json.load(f))
+
+
+if __name__ == "__main__":
+    unittest.main()
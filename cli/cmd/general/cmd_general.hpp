@@ -6,7 +6,9 @@
 #define FICTION_CMD_GENERAL_HPP
 
 // NOLINTBEGIN(misc-include-cleaner)
+#include "include/batch.hpp"
 #include "include/clear.hpp"
+#include "include/profile.hpp"
 #include "include/version.hpp"
 // NOLINTEND(misc-include-cleaner)
 
@@ -16,7 +18,9 @@ namespace alice
 constexpr inline auto FICTION_CLI_CATEGORY_GENERAL = "General";
 
 // general commands
+ALICE_ADD_COMMAND(batch, FICTION_CLI_CATEGORY_GENERAL)
 ALICE_ADD_COMMAND(clear, FICTION_CLI_CATEGORY_GENERAL)
+ALICE_ADD_COMMAND(profile, FICTION_CLI_CATEGORY_GENERAL)
 ALICE_ADD_COMMAND(version, FICTION_CLI_CATEGORY_GENERAL)
 
 }  // namespace alice
@@ -0,0 +1,84 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_CMD_BATCH_HPP
+#define FICTION_CMD_BATCH_HPP
+
+#include <alice/alice.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace alice
+{
+
+/**
+ * Runs a pipeline of design steps on all logic network files in a directory. Files are processed independently and
+ * concurrently by a pool of worker threads, i.e., at most as many networks and their layouts are kept in memory as
+ * there are threads. Runtime and quality statistics of each stage are collected in a machine-readable summary.
+ *
+ * The stores are neither read nor modified by this command.
+ */
+class batch_command final : public command
+{
+  public:
+    /**
+     * Standard constructor. Adds descriptive information, options, and flags.
+     *
+     * @param e alice::environment that specifies stores etc.
+     */
+    explicit batch_command(const environment::ptr& e);
+
+  protected:
+    /**
+     * Function to perform the batch call. Processes all files in the given directory with the given pipeline.
+     */
+    void execute() override;
+
+    /**
+     * Logs the resulting information in a log file.
+     *
+     * @return JSON object containing the statistics of all pipeline stages for each processed file.
+     */
+    nlohmann::json log() const override;
+
+  private:
+    /**
+     * File or directory of logic networks to process.
+     */
+    std::string input{};
+    /**
+     * Comma-separated pipeline specification.
+     */
+    std::string pipeline{};
+    /**
+     * Logic network type to parse the files as.
+     */
+    std::string network_type{"aig"};
+    /**
+     * Directory to write layout files to.
+     */
+    std::string output_directory{"."};
+    /**
+     * File to write the JSON summary to.
+     */
+    std::string summary_file{};
+    /**
+     * Number of files to process concurrently. If `0`, the number of hardware threads is used.
+     */
+    uint32_t num_threads{0u};
+    /**
+     * Timeout for exact physical design in seconds.
+     */
+    uint32_t timeout{0u};
+    /**
+     * Summary of the last batch run.
+     */
+    nlohmann::json summary{};
+};
+
+}  // namespace alice
+
+#endif  // FICTION_CMD_BATCH_HPP
@@ -0,0 +1,61 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_CMD_PROFILE_HPP
+#define FICTION_CMD_PROFILE_HPP
+
+#include <alice/alice.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace alice
+{
+
+/**
+ * Controls the collection of instrumentation data in the hot paths of fiction's algorithms and exports it. Requires
+ * fiction to be built with the CMake option `FICTION_PROFILING`.
+ */
+class profile_command final : public command
+{
+  public:
+    /**
+     * Standard constructor. Adds descriptive information, options, and flags.
+     *
+     * @param e alice::environment that specifies stores etc.
+     */
+    explicit profile_command(const environment::ptr& e);
+
+  protected:
+    /**
+     * Function to perform the profile call. Enables, disables, resets, or exports the profiler's data.
+     */
+    void execute() override;
+
+    /**
+     * Logs the resulting information in a log file.
+     *
+     * @return JSON object containing the aggregated timers, counters, and histograms.
+     */
+    nlohmann::json log() const override;
+
+  private:
+    /**
+     * File to write the JSON summary to.
+     */
+    std::string summary_file{};
+    /**
+     * File to write the Chrome trace to.
+     */
+    std::string trace_file{};
+    /**
+     * Maximum number of trace events to record.
+     */
+    uint64_t max_trace_events{1'000'000ul};
+};
+
+}  // namespace alice
+
+#endif  // FICTION_CMD_PROFILE_HPP
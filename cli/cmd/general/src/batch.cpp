@@ -0,0 +1,663 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include "cmd/general/include/batch.hpp"
+
+#include "stores.hpp"  // NOLINT(misc-include-cleaner)
+
+#include <fiction/algorithms/network_transformation/network_balancing.hpp>
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/graph_oriented_layout_design.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/physical_design/post_layout_optimization.hpp>
+#include <fiction/io/network_reader.hpp>
+#include <fiction/io/write_fgl_layout.hpp>
+#include <fiction/io/write_fqca_layout.hpp>
+#include <fiction/io/write_qca_layout.hpp>
+#include <fiction/io/write_svg_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/name_utils.hpp>
+
+#if (FICTION_Z3_SOLVER)
+#include <fiction/algorithms/physical_design/exact.hpp>
+#endif
+
+#include <alice/alice.hpp>
+#include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace alice
+{
+
+namespace
+{
+
+/**
+ * A single stage of a batch pipeline, e.g., `ortho` or `write:fgl`.
+ */
+struct pipeline_stage
+{
+    /**
+     * Name of the stage.
+     */
+    std::string name{};
+    /**
+     * Optional argument of the stage that is given after a colon.
+     */
+    std::string argument{};
+};
+/**
+ * Exception thrown when a pipeline stage cannot be applied to a file.
+ */
+class pipeline_error : public std::runtime_error
+{
+  public:
+    explicit pipeline_error(const std::string& msg) : std::runtime_error(msg) {}
+};
+/**
+ * Settings that are shared by all worker threads of a batch run.
+ */
+struct batch_settings
+{
+    /**
+     * Pipeline stages to apply to each file.
+     */
+    std::vector<pipeline_stage> stages{};
+    /**
+     * Logic network type to parse the files as.
+     */
+    std::string network_type{};
+    /**
+     * Directory to write layout files to.
+     */
+    std::filesystem::path output_directory{};
+    /**
+     * Timeout for exact physical design in seconds.
+     */
+    uint32_t timeout{0u};
+};
+/**
+ * Design artifacts of a single file as it passes through the pipeline.
+ */
+struct pipeline_state
+{
+    /**
+     * Name of the design.
+     */
+    std::string name{};
+    /**
+     * Logic network.
+     */
+    fiction::logic_network_t network{};
+    /**
+     * Gate-level layout, if it has been generated.
+     */
+    fiction::cart_gate_clk_lyt_ptr gate_layout{nullptr};
+    /**
+     * Cell-level layout, if it has been generated.
+     */
+    fiction::qca_cell_clk_lyt_ptr cell_layout{nullptr};
+};
+/**
+ * Parses a comma-separated pipeline specification such as `balance,ortho,optimize,cell,write:fqca`.
+ *
+ * @param spec Pipeline specification.
+ * @return Parsed pipeline stages.
+ * @throws std::invalid_argument if the specification contains an unknown stage or an invalid stage argument.
+ */
+std::vector<pipeline_stage> parse_pipeline(const std::string& spec)
+{
+    static constexpr std::array<const char*, 4> write_formats{{"fgl", "fqca", "qca", "svg"}};
+
+    std::vector<pipeline_stage> stages{};
+
+    std::stringstream stream{spec};
+    std::string       token{};
+
+    while (std::getline(stream, token, ','))
+    {
+        token.erase(0, token.find_first_not_of(" \t"));
+        token.erase(token.find_last_not_of(" \t") + 1);
+
+        if (token.empty())
+        {
+            continue;
+        }
+
+        pipeline_stage stage{};
+
+        if (const auto colon = token.find(':'); colon != std::string::npos)
+        {
+            stage.name     = token.substr(0, colon);
+            stage.argument = token.substr(colon + 1);
+        }
+        else
+        {
+            stage.name = token;
+        }
+
+        if (stage.name == "write")
+        {
+            if (std::find(write_formats.cbegin(), write_formats.cend(), stage.argument) == write_formats.cend())
+            {
+                throw std::invalid_argument(
+                    "'write' requires one of the formats fgl, fqca, qca, or svg, e.g., 'write:fgl'");
+            }
+        }
+        else if (stage.name == "balance" || stage.name == "ortho" || stage.name == "gold" || stage.name == "optimize" ||
+                 stage.name == "cell"
+#if (FICTION_Z3_SOLVER)
+                 || stage.name == "exact"
+#endif
+        )
+        {
+            if (!stage.argument.empty())
+            {
+                throw std::invalid_argument(fmt::format("stage '{}' does not take an argument", stage.name));
+            }
+        }
+        else
+        {
+            throw std::invalid_argument(fmt::format("unknown pipeline stage '{}'", stage.name));
+        }
+
+        stages.push_back(stage);
+    }
+
+    if (stages.empty())
+    {
+        throw std::invalid_argument("the pipeline must contain at least one stage");
+    }
+
+    return stages;
+}
+/**
+ * Reads a single logic network file.
+ *
+ * @tparam NtkPtr Pointer type of the logic network to construct.
+ * @param path File to read.
+ * @return The read logic network.
+ * @throws pipeline_error if the file could not be parsed.
+ */
+template <typename NtkPtr>
+fiction::logic_network_t read_network(const std::string& path)
+{
+    std::stringstream messages{};
+
+    fiction::network_reader<NtkPtr> reader{path, messages};
+
+    const auto& networks = reader.get_networks();
+
+    if (networks.empty())
+    {
+        auto message = messages.str();
+        message.erase(message.find_last_not_of('\n') + 1);
+
+        throw pipeline_error(message.empty() ? "the file could not be parsed" : message);
+    }
+
+    return networks.front();
+}
+/**
+ * Returns the gate-level layout of the given state or throws if none has been generated yet.
+ */
+const fiction::cart_gate_clk_lyt& require_gate_layout(const pipeline_state& state, const pipeline_stage& stage)
+{
+    if (state.gate_layout == nullptr)
+    {
+        throw pipeline_error(fmt::format("'{}' requires a preceding physical design stage", stage.name));
+    }
+
+    return *state.gate_layout;
+}
+/**
+ * Returns the cell-level layout of the given state or throws if none has been generated yet.
+ */
+const fiction::qca_cell_clk_lyt& require_cell_layout(const pipeline_state& state, const pipeline_stage& stage)
+{
+    if (state.cell_layout == nullptr)
+    {
+        throw pipeline_error(fmt::format("'{}:{}' requires a preceding 'cell' stage", stage.name, stage.argument));
+    }
+
+    return *state.cell_layout;
+}
+/**
+ * Applies a single pipeline stage to the given state.
+ *
+ * @param stage Stage to apply.
+ * @param state Design artifacts of the current file.
+ * @param settings Settings of the batch run.
+ * @return Statistics of the design artifact produced by the stage.
+ * @throws pipeline_error if the stage could not be applied.
+ */
+nlohmann::json apply_stage(const pipeline_stage& stage, pipeline_state& state, const batch_settings& settings)
+{
+    if (stage.name == "balance")
+    {
+        state.network = std::visit(
+            [](auto&& ntk_ptr) -> fiction::logic_network_t
+            { return std::make_shared<fiction::tec_nt>(fiction::network_balancing<fiction::tec_nt>(*ntk_ptr)); },
+            state.network);
+
+        return log_statistics<fiction::logic_network_t>(state.network);
+    }
+    if (stage.name == "ortho")
+    {
+        state.gate_layout = std::visit(
+            [](auto&& ntk_ptr)
+            {
+                return std::make_shared<fiction::cart_gate_clk_lyt>(
+                    fiction::orthogonal<fiction::cart_gate_clk_lyt>(*ntk_ptr));
+            },
+            state.network);
+    }
+    else if (stage.name == "gold")
+    {
+        const auto layout =
+            std::visit([](auto&& ntk_ptr)
+                       { return fiction::graph_oriented_layout_design<fiction::cart_gate_clk_lyt>(*ntk_ptr); },
+                       state.network);
+
+        if (!layout.has_value())
+        {
+            throw pipeline_error("impossible to place and route the network within the given parameters");
+        }
+
+        state.gate_layout = std::make_shared<fiction::cart_gate_clk_lyt>(*layout);
+    }
+#if (FICTION_Z3_SOLVER)
+    else if (stage.name == "exact")
+    {
+        fiction::exact_physical_design_params ps{};
+        ps.crossings = true;
+
+        if (settings.timeout != 0u)
+        {
+            // convert timeout entered in seconds to milliseconds
+            ps.timeout = settings.timeout * 1000u;
+        }
+
+        const auto layout = std::visit([&ps](auto&& ntk_ptr)
+                                       { return fiction::exact<fiction::cart_gate_clk_lyt>(*ntk_ptr, ps); },
+                                       state.network);
+
+        if (!layout.has_value())
+        {
+            throw pipeline_error("no layout could be found within the given timeout");
+        }
+
+        state.gate_layout = std::make_shared<fiction::cart_gate_clk_lyt>(*layout);
+    }
+#endif
+    else if (stage.name == "optimize")
+    {
+        const auto& layout = require_gate_layout(state, stage);
+
+        if (!layout.is_clocking_scheme(fiction::clock_name::TWODDWAVE))
+        {
+            throw pipeline_error("'optimize' requires a 2DDWave-clocked layout");
+        }
+
+        auto layout_copy = layout.clone();
+        fiction::post_layout_optimization(layout_copy);
+        fiction::restore_names(layout, layout_copy);
+
+        state.gate_layout = std::make_shared<fiction::cart_gate_clk_lyt>(layout_copy);
+    }
+    else if (stage.name == "cell")
+    {
+        state.cell_layout = std::make_shared<fiction::qca_cell_clk_lyt>(
+            fiction::apply_gate_library<fiction::qca_cell_clk_lyt, fiction::qca_one_library>(
+                require_gate_layout(state, stage)));
+
+        return log_statistics<fiction::cell_layout_t>(state.cell_layout);
+    }
+    else if (stage.name == "write")
+    {
+        auto filename = settings.output_directory / state.name;
+        filename.replace_extension(stage.argument);
+
+        if (stage.argument == "fgl")
+        {
+            fiction::write_fgl_layout(require_gate_layout(state, stage), filename.string());
+        }
+        else if (stage.argument == "fqca")
+        {
+            fiction::write_fqca_layout(require_cell_layout(state, stage), filename.string());
+        }
+        else if (stage.argument == "qca")
+        {
+            fiction::write_qca_layout(require_cell_layout(state, stage), filename.string());
+        }
+        else  // svg
+        {
+            fiction::write_qca_layout_svg(require_cell_layout(state, stage), filename.string());
+        }
+
+        return nlohmann::json{{"file", filename.string()}};
+    }
+
+    return log_statistics<fiction::gate_layout_t>(state.gate_layout);
+}
+/**
+ * Reads a single file and passes it through all stages of the pipeline. Processing stops at the first stage that
+ * fails.
+ *
+ * @param path File to process.
+ * @param settings Settings of the batch run.
+ * @return JSON record of the runtime and the statistics of each executed stage.
+ */
+nlohmann::json process_file(const std::string& path, const batch_settings& settings)
+{
+    nlohmann::json record{{"file", path}, {"stages", nlohmann::json::array()}};
+
+    pipeline_state state{};
+    state.name = std::filesystem::path{path}.stem().string();
+
+    const auto run_stage = [&record](const std::string& name, auto&& fn) -> bool
+    {
+        mockturtle::stopwatch<>::duration time{0};
+        nlohmann::json                    stage_record{{"stage", name}};
+
+        try
+        {
+            nlohmann::json statistics{};
+            {
+                const mockturtle::stopwatch stop{time};
+
+                statistics = fn();
+            }
+
+            stage_record["runtime in seconds"] = mockturtle::to_seconds(time);
+            stage_record["statistics"]         = statistics;
+            record["stages"].push_back(stage_record);
+
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            record["error"] = fmt::format("{}: {}", name, e.what());
+        }
+        catch (...)
+        {
+            record["error"] = fmt::format("{}: unknown error", name);
+        }
+
+        return false;
+    };
+
+    const auto read = [&path, &state, &settings]
+    {
+        if (settings.network_type == "aig")
+        {
+            state.network = read_network<fiction::aig_ptr>(path);
+        }
+        else if (settings.network_type == "xag")
+        {
+            state.network = read_network<fiction::xag_ptr>(path);
+        }
+        else if (settings.network_type == "mig")
+        {
+            state.network = read_network<fiction::mig_ptr>(path);
+        }
+        else
+        {
+            state.network = read_network<fiction::tec_ptr>(path);
+        }
+
+        return log_statistics<fiction::logic_network_t>(state.network);
+    };
+
+    bool success = run_stage("read", read);
+
+    for (const auto& stage : settings.stages)
+    {
+        if (!success)
+        {
+            break;
+        }
+
+        const auto name = stage.argument.empty() ? stage.name : fmt::format("{}:{}", stage.name, stage.argument);
+
+        success = run_stage(name, [&stage, &state, &settings] { return apply_stage(stage, state, settings); });
+    }
+
+    record["success"] = success;
+
+    return record;
+}
+/**
+ * Collects all logic network files in the given file or directory, largest files first to balance the load of the
+ * worker threads.
+ *
+ * @param input File or directory.
+ * @return Paths of all logic network files.
+ */
+std::vector<std::string> collect_files(const std::string& input)
+{
+    static constexpr std::array<const char*, 3> extensions{{".v", ".aig", ".blif"}};
+
+    const auto is_network_file = [](const std::filesystem::path& p)
+    {
+        return std::filesystem::is_regular_file(p) &&
+               std::find(extensions.cbegin(), extensions.cend(), p.extension().string()) != extensions.cend();
+    };
+
+    std::vector<std::filesystem::path> paths{};
+
+    if (std::filesystem::is_directory(input))
+    {
+        for (const auto& entry : std::filesystem::directory_iterator(input))
+        {
+            if (is_network_file(entry.path()))
+            {
+                paths.push_back(entry.path());
+            }
+        }
+    }
+    else if (is_network_file(input))
+    {
+        paths.emplace_back(input);
+    }
+
+    std::sort(paths.begin(), paths.end(),
+              [](const auto& p1, const auto& p2)
+              { return std::filesystem::file_size(p1) > std::filesystem::file_size(p2); });
+
+    std::vector<std::string> files{};
+    files.reserve(paths.size());
+    std::transform(paths.cbegin(), paths.cend(), std::back_inserter(files), [](const auto& p) { return p.string(); });
+
+    return files;
+}
+
+}  // namespace
+
+batch_command::batch_command(const environment::ptr& e) :
+        command(e, "Processes all logic network files in a directory with a pipeline of design steps. Files are "
+                   "processed concurrently and independently of the stores. The pipeline is a comma-separated list "
+                   "of the stages 'balance', 'ortho', 'gold', "
+#if (FICTION_Z3_SOLVER)
+                   "'exact', "
+#endif
+                   "'optimize', 'cell' (QCA ONE), and 'write:<fgl|fqca|qca|svg>', e.g., "
+                   "'balance,ortho,optimize,cell,write:fqca'. Reading the files is always the first stage. Runtime "
+                   "and statistics of each stage are reported in a JSON summary.")
+{
+    add_option("input", input, "File or directory of logic networks ('.v', '.aig', '.blif')")->required();
+    add_option("--pipeline,-p", pipeline, "Comma-separated pipeline specification")->required();
+    add_option("--network_type,-n", network_type, "Logic network type to parse the files as {aig, xag, mig, tec}",
+               true);
+    add_option("--output,-o", output_directory, "Directory to write layout files to", true);
+    add_option("--summary,-s", summary_file, "JSON file to write the summary to");
+    add_option("--threads,-j", num_threads, "Number of files to process concurrently (0 = all hardware threads)",
+               true);
+    add_option("--timeout,-t", timeout, "Timeout for exact physical design in seconds");
+    add_flag("--verbose,-v", "Report the result of each file");
+}
+
+void batch_command::execute()
+{
+    const auto reset = [this]
+    {
+        network_type     = "aig";
+        output_directory = ".";
+        summary_file     = {};
+        num_threads      = 0u;
+        timeout          = 0u;
+    };
+
+    batch_settings settings{};
+
+    try
+    {
+        settings.stages = parse_pipeline(pipeline);
+    }
+    catch (const std::invalid_argument& e)
+    {
+        env->out() << fmt::format("[e] {}\n", e.what());
+        reset();
+        return;
+    }
+
+    if (network_type != "aig" && network_type != "xag" && network_type != "mig" && network_type != "tec")
+    {
+        env->out() << "[e] network type must be one of 'aig', 'xag', 'mig', or 'tec'\n";
+        reset();
+        return;
+    }
+
+    if (!std::filesystem::exists(input))
+    {
+        env->out() << "[e] given file name does not exist\n";
+        reset();
+        return;
+    }
+
+    settings.network_type     = network_type;
+    settings.output_directory = output_directory;
+    settings.timeout          = timeout;
+
+    if (std::any_of(settings.stages.cbegin(), settings.stages.cend(), [](const auto& s) { return s.name == "write"; }))
+    {
+        std::filesystem::create_directories(settings.output_directory);
+    }
+
+    const auto files = collect_files(input);
+
+    if (files.empty())
+    {
+        env->out() << "[w] no logic network files found\n";
+        reset();
+        return;
+    }
+
+    auto threads_to_use = num_threads == 0u ? std::max(std::thread::hardware_concurrency(), 1u) : num_threads;
+    threads_to_use      = std::min(threads_to_use, static_cast<uint32_t>(files.size()));
+
+    std::vector<nlohmann::json> records(files.size());
+
+    std::atomic<std::size_t> next_file{0};
+    std::mutex               out_mutex{};
+    std::size_t              num_finished{0};
+
+    const bool verbose = is_set("verbose");
+
+    mockturtle::stopwatch<>::duration time_total{0};
+    {
+        const mockturtle::stopwatch stop{time_total};
+
+        // each worker holds the design artifacts of at most one file at a time
+        const auto worker = [&]
+        {
+            for (auto i = next_file++; i < files.size(); i = next_file++)
+            {
+                records[i] = process_file(files[i], settings);
+
+                const std::lock_guard lock{out_mutex};
+                ++num_finished;
+
+                if (verbose || !records[i]["success"].get<bool>())
+                {
+                    env->out() << fmt::format("[{}] ({}/{}) {}{}\n", records[i]["success"].get<bool>() ? 'i' : 'e',
+                                              num_finished, files.size(), files[i],
+                                              records[i].contains("error") ?
+                                                  fmt::format(": {}", records[i]["error"].get<std::string>()) :
+                                                  "");
+                }
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(threads_to_use);
+
+        for (uint32_t i = 0; i < threads_to_use; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    const auto num_successful =
+        static_cast<std::size_t>(std::count_if(records.cbegin(), records.cend(),
+                                               [](const auto& r) { return r["success"].template get<bool>(); }));
+
+    summary = nlohmann::json{{"pipeline", pipeline},
+                             {"threads", threads_to_use},
+                             {"runtime in seconds", mockturtle::to_seconds(time_total)},
+                             {"files", records.size()},
+                             {"successful", num_successful},
+                             {"results", records}};
+
+    env->out() << fmt::format("[i] processed {} files ({} successful) in {:.2f} s using {} threads\n", records.size(),
+                              num_successful, mockturtle::to_seconds(time_total), threads_to_use);
+
+    if (!summary_file.empty())
+    {
+        std::ofstream summary_stream{summary_file};
+
+        if (summary_stream.is_open())
+        {
+            summary_stream << summary.dump(4) << '\n';
+        }
+        else
+        {
+            env->out() << fmt::format("[e] could not open '{}' for writing\n", summary_file);
+        }
+    }
+
+    reset();
+}
+
+nlohmann::json batch_command::log() const
+{
+    return summary;
+}
+
+}  // namespace alice
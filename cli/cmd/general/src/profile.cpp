@@ -0,0 +1,112 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include "cmd/general/include/profile.hpp"
+
+#include <fiction/utils/profiling.hpp>
+
+#include <alice/alice.hpp>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+
+namespace alice
+{
+
+profile_command::profile_command(const environment::ptr& e) :
+        command(e, "Controls the instrumentation of hot paths, e.g., potential matrix setup, validity checks, A* "
+                   "calls, SAT/SMT solving, and thread idle times. Without options, prints the aggregated runtimes of "
+                   "all timed scopes recorded so far. Requires fiction to be built with FICTION_PROFILING.")
+{
+    add_flag("--enable,-e", "Start recording instrumentation data");
+    add_flag("--trace,-t", "Additionally record every timed scope as a trace event (implies --enable)");
+    add_option("--max_trace_events", max_trace_events, "Maximum number of trace events to record", true);
+    add_flag("--disable,-d", "Stop recording instrumentation data");
+    add_flag("--reset,-r", "Discard all recorded data");
+    add_option("--summary,-s", summary_file, "Write the aggregated timers, counters, and histograms to a JSON file");
+    add_option("--chrome_trace,-c", trace_file,
+               "Write the recorded trace events to a JSON file in the Chrome trace event format");
+}
+
+void profile_command::execute()
+{
+    auto& profiler = fiction::profiler::instance();
+
+    if constexpr (!fiction::profiling_compiled_in)
+    {
+        env->out() << "[w] fiction was built without FICTION_PROFILING; no data is recorded\n";
+    }
+
+    if (is_set("reset"))
+    {
+        profiler.reset();
+    }
+
+    if (is_set("disable"))
+    {
+        profiler.disable();
+    }
+    else if (is_set("enable") || is_set("trace"))
+    {
+        fiction::profiling_params ps{};
+        ps.record_trace     = is_set("trace");
+        ps.max_trace_events = max_trace_events;
+
+        profiler.enable(ps);
+    }
+
+    const auto write = [this](const std::string& filename, const nlohmann::json& json)
+    {
+        std::ofstream os{filename};
+
+        if (!os.is_open())
+        {
+            env->out() << fmt::format("[e] could not open '{}' for writing\n", filename);
+            return;
+        }
+
+        os << json.dump(4) << '\n';
+    };
+
+    if (!summary_file.empty())
+    {
+        write(summary_file, profiler.summary());
+    }
+
+    if (!trace_file.empty())
+    {
+        write(trace_file, profiler.chrome_trace());
+    }
+
+    if (!is_set("enable") && !is_set("trace") && !is_set("disable") && !is_set("reset") && summary_file.empty() &&
+        trace_file.empty())
+    {
+        const auto summary = profiler.summary();
+
+        env->out() << fmt::format("[i] profiling is {}\n", profiler.is_enabled() ? "enabled" : "disabled");
+
+        for (const auto& [name, timer] : summary["timers"].items())
+        {
+            env->out() << fmt::format("[i] {:<60} {:>10} calls {:>12.6f} s\n", name,
+                                      timer["count"].get<uint64_t>(), timer["total in seconds"].get<double>());
+        }
+
+        for (const auto& [name, counter] : summary["counters"].items())
+        {
+            env->out() << fmt::format("[i] {:<60} {:>10}\n", name, counter.get<uint64_t>());
+        }
+    }
+
+    summary_file     = {};
+    trace_file       = {};
+    max_trace_events = 1'000'000ul;
+}
+
+nlohmann::json profile_command::log() const
+{
+    return fiction::profiler::instance().summary();
+}
+
+}  // namespace alice
@@ -14,6 +14,7 @@
 #include "include/opdom.hpp"
 #include "include/quickexact.hpp"
 #include "include/quicksim.hpp"
+#include "include/simanneal.hpp"
 #include "include/temp.hpp"
 // NOLINTEND(misc-include-cleaner)
 
@@ -29,6 +30,7 @@ ALICE_ADD_COMMAND(clustercomplete, FICTION_CLI_CATEGORY_SIMULATION)
 ALICE_ADD_COMMAND(opdom, FICTION_CLI_CATEGORY_SIMULATION)
 ALICE_ADD_COMMAND(quickexact, FICTION_CLI_CATEGORY_SIMULATION)
 ALICE_ADD_COMMAND(quicksim, FICTION_CLI_CATEGORY_SIMULATION)
+ALICE_ADD_COMMAND(simanneal, FICTION_CLI_CATEGORY_SIMULATION)
 ALICE_ADD_COMMAND(temp, FICTION_CLI_CATEGORY_SIMULATION)
 
 }  // namespace alice
@@ -0,0 +1,215 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include "cmd/simulation/include/simanneal.hpp"
+
+#include "stores.hpp"  // NOLINT(misc-include-cleaner)
+
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
+#include <fiction/algorithms/simulation/sidb/sim_anneal.hpp>
+#include <fiction/traits.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/name_utils.hpp>
+
+#include <alice/alice.hpp>
+#include <nlohmann/json.hpp>
+
+#include <any>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace alice
+{
+
+simanneal_command::simanneal_command(const environment::ptr& e) :
+        command(e, "The SimAnneal algorithm is a heuristic electrostatic ground state simulation algorithm for SiDB "
+                   "layouts that is based on simulated annealing. It runs multiple independent annealing chains in "
+                   "parallel and scales to layouts with more than a hundred SiDBs. The ground state is found with a "
+                   "certain probability that increases with the number of chains and sweeps.")
+{
+    add_option("--epsilon_r,-e", physical_params.epsilon_r, "Electric permittivity of the substrate (unit-less)", true);
+    add_option("--lambda_tf,-l", physical_params.lambda_tf, "Thomas-Fermi screening distance (unit: nm)", true);
+    add_option("--mu_minus,-m", physical_params.mu_minus, "Energy transition level (0/-) (unit: eV)", true);
+    add_option("--chains,-c", sa_params.number_of_chains, "Number of independent annealing chains", true);
+    add_option("--sweeps,-s", sa_params.sweeps_per_temperature,
+               "Number of proposed charge transitions per SiDB at each temperature", true);
+    add_option("--initial_temperature,-t", sa_params.initial_temperature,
+               "Temperature at which each chain starts (unit: eV)", true);
+    add_option("--cooling_factor,-f", sa_params.cooling_factor,
+               "Factor by which the temperature is multiplied after each annealing step", true);
+    add_option("--threads,-j", sa_params.number_threads, "Number of threads to run the annealing chains on", true);
+    add_option("--seed", seed, "Random seed for reproducible results");
+}
+
+void simanneal_command::execute()
+{
+    // reset sim result
+    sim_result = {};
+    min_energy = std::numeric_limits<double>::infinity();
+
+    if (physical_params.epsilon_r <= 0)
+    {
+        env->out() << "[e] epsilon_r must be positive\n";
+        reset_params();
+        return;
+    }
+    if (physical_params.lambda_tf <= 0)
+    {
+        env->out() << "[e] lambda_tf must be positive\n";
+        reset_params();
+        return;
+    }
+    if (sa_params.number_of_chains == 0)
+    {
+        env->out() << "[e] chains must be > 0\n";
+        reset_params();
+        return;
+    }
+    if (sa_params.initial_temperature <= sa_params.final_temperature)
+    {
+        env->out() << fmt::format("[e] initial_temperature must be greater than {}\n", sa_params.final_temperature);
+        reset_params();
+        return;
+    }
+    if (sa_params.cooling_factor <= 0 || sa_params.cooling_factor >= 1)
+    {
+        env->out() << "[e] cooling_factor must be in (0, 1)\n";
+        reset_params();
+        return;
+    }
+
+    if (is_set("seed"))
+    {
+        sa_params.seed = seed;
+    }
+
+    auto& s = store<fiction::cell_layout_t>();
+
+    // error case: empty cell layout store
+    if (s.empty())
+    {
+        env->out() << "[w] no cell layout in store\n";
+        reset_params();
+        return;
+    }
+
+    const auto get_name = [](auto&& lyt_ptr) -> std::string { return fiction::get_name(*lyt_ptr); };
+
+    const auto simanneal = [this, &get_name](auto&& lyt_ptr)
+    {
+        using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
+
+        if constexpr (!fiction::has_sidb_technology_v<Lyt>)
+        {
+            env->out() << fmt::format("[e] '{}' is not an SiDB layout\n", get_name(lyt_ptr));
+            return;
+        }
+
+        if constexpr (fiction::is_charge_distribution_surface_v<Lyt>)
+        {
+            env->out() << fmt::format("[w] '{}' already possesses a charge distribution; no simulation is conducted\n",
+                                      get_name(lyt_ptr));
+            return;
+        }
+
+        sa_params.simulation_parameters = physical_params;
+
+        // To aid the compiler
+        if constexpr (fiction::has_sidb_technology_v<Lyt> && !fiction::is_charge_distribution_surface_v<Lyt>)
+        {
+            if (const auto result = fiction::sim_anneal(*lyt_ptr, sa_params); result.has_value())
+            {
+                sim_result = *result;
+            }
+            else
+            {
+                env->out() << fmt::format("[e] no stable charge distribution could be determined for '{}'\n",
+                                          get_name(lyt_ptr));
+                return;
+            }
+
+            if constexpr (fiction::is_sidb_lattice_100_v<Lyt>)
+            {
+                const auto min_energy_distr =
+                    minimum_energy_distribution(std::get<sim_result_100>(sim_result).charge_distributions.cbegin(),
+                                                std::get<sim_result_100>(sim_result).charge_distributions.cend());
+
+                min_energy = min_energy_distr->get_electrostatic_potential_energy();
+                store<fiction::cell_layout_t>().extend() =
+                    std::make_shared<fiction::cds_sidb_100_cell_clk_lyt>(*min_energy_distr);
+            }
+            else if constexpr (fiction::is_sidb_lattice_111_v<Lyt>)
+            {
+                const auto min_energy_distr =
+                    minimum_energy_distribution(std::get<sim_result_111>(sim_result).charge_distributions.cbegin(),
+                                                std::get<sim_result_111>(sim_result).charge_distributions.cend());
+
+                min_energy = min_energy_distr->get_electrostatic_potential_energy();
+                store<fiction::cell_layout_t>().extend() =
+                    std::make_shared<fiction::cds_sidb_111_cell_clk_lyt>(*min_energy_distr);
+            }
+            else
+            {
+                env->out() << "[e] no valid lattice orientation\n";
+            }
+        }
+    };
+
+    // Dispatch on the layout currently in the store.
+    std::visit(simanneal, s.current());
+
+    reset_params();
+}
+
+nlohmann::json simanneal_command::log() const
+{
+    const auto to_json = [this](const auto& sim_res)
+    {
+        return nlohmann::json{
+            {"Algorithm name", sim_res.algorithm_name},
+            {"Simulation runtime", sim_res.simulation_runtime.count()},
+            {"Physical parameters",
+             {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
+              {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
+              {"mu_minus", sim_res.simulation_parameters.mu_minus}}},
+            {"Lowest state energy (eV)", min_energy},
+            {"Number of stable states", sim_res.charge_distributions.size()},
+            {"Number of chains",
+             std::any_cast<uint64_t>(sim_res.additional_simulation_parameters.at("number_of_chains"))},
+            {"Sweeps per temperature",
+             std::any_cast<uint64_t>(sim_res.additional_simulation_parameters.at("sweeps_per_temperature"))},
+            {"Initial temperature (eV)",
+             std::any_cast<double>(sim_res.additional_simulation_parameters.at("initial_temperature"))},
+            {"Cooling factor", std::any_cast<double>(sim_res.additional_simulation_parameters.at("cooling_factor"))}};
+    };
+
+    try
+    {
+        if (std::holds_alternative<sim_result_100>(sim_result))
+        {
+            return to_json(std::get<sim_result_100>(sim_result));
+        }
+
+        return to_json(std::get<sim_result_111>(sim_result));
+    }
+    catch (...)
+    {
+        // If something is off in the variant or additional parameters are missing, return empty JSON.
+        return nlohmann::json{};
+    }
+}
+
+void simanneal_command::reset_params()
+{
+    physical_params = fiction::sidb_simulation_parameters{2, -0.32, 5.6, 5.0};
+    sa_params       = {};
+    seed            = 0;
+}
+
+}  // namespace alice
@@ -53,7 +53,7 @@ temp_command::temp_command(const environment::ptr& e) :
                "(only ClusterComplete supports base-3 simulation)",
                true);
     add_option("--engine", sim_engine_str,
-               "The simulation engine to use {QuickExact [default], ClusterComplete, QuickSim}", true);
+               "The simulation engine to use {QuickExact [default], ClusterComplete, QuickSim, SimAnneal}", true);
 }
 
 void temp_command::execute()
@@ -38,7 +38,7 @@ int main()  // NOLINT
     using gate_lyt =
         fiction::gate_level_layout<fiction::clocked_layout<fiction::tile_based_layout<fiction::cartesian_layout<>>>>;
 
-    experiments::experiment<std::string, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, double, bool>
+    experiments::experiment<std::string, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, double, bool>
         clock_number_assignment_exp{"clock number assignment",
                                     "benchmark",
                                     "inputs",
@@ -46,6 +46,7 @@ int main()  // NOLINT
                                     "width [tiles]",
                                     "height [tiles]",
                                     "area [tiles]",
+                                    "components",
                                     "runtime clocking [s]",
                                     "equivalent"};
 
@@ -102,7 +103,8 @@ int main()  // NOLINT
 
         // log results
         clock_number_assignment_exp(network.get_network_name(), original_layout.num_pis(), original_layout.num_pos(),
-                                    width, height, area, mockturtle::to_seconds(stats.time_total), eq_result);
+                                    width, height, area, stats.num_components, mockturtle::to_seconds(stats.time_total),
+                                    eq_result);
 
         clock_number_assignment_exp.save();
         clock_number_assignment_exp.table();
@@ -9,15 +9,19 @@
 #include "fiction/algorithms/path_finding/k_shortest_paths.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
+#include "fiction/utils/profiling.hpp"
 #include "fiction/utils/routing_utils.hpp"
-#include "fiction/utils/stl_utils.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 #include <phmap.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <combinations.h>
@@ -50,6 +54,11 @@ struct generate_edge_intersection_graph_params
      * Yen's algorithm) instead of all paths.
      */
     std::optional<uint32_t> path_limit = std::nullopt;
+    /**
+     * Number of threads to use for the path enumeration. Paths of different objectives are enumerated concurrently. By
+     * default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 struct generate_edge_intersection_graph_stats
@@ -95,24 +104,13 @@ class generate_edge_intersection_graph_impl
         // measure runtime
         mockturtle::stopwatch stop{pst.time_total};
 
-        std::for_each(objectives.cbegin(), objectives.cend(),
-                      [this](const auto& obj)
-                      {
-                          path_collection<clk_path> obj_paths{};
-
-                          if (!ps.path_limit.has_value())
-                          {
-                              // enumerate all paths for the current objective
-                              obj_paths = enumerate_all_paths<clk_path>(obstruction_layout{layout},
-                                                                        {obj.source, obj.target}, {ps.crossings});
-                          }
-                          else
-                          {
-                              // enumerate k paths for the current objective
-                              obj_paths = yen_k_shortest_paths<clk_path>(
-                                  obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit, {ps.crossings});
-                          }
+        // enumerate the paths of all objectives independently of each other
+        auto objective_paths = enumerate_objective_paths();
 
+        // process the objectives in order to obtain deterministic node and edge IDs
+        std::for_each(objective_paths.begin(), objective_paths.end(),
+                      [this](auto& obj_paths)
+                      {
                           // assign a unique label to each path and create a corresponding node in the graph
                           initiate_objective_nodes(obj_paths);
 
@@ -130,8 +128,8 @@ class generate_edge_intersection_graph_impl
                           // for each previously stored path, create an edge if there is an intersection
                           create_intersection_edges(obj_paths);
 
-                          // add the collection to all paths gathered thus far
-                          all_paths.insert(all_paths.end(), obj_paths.cbegin(), obj_paths.cend());
+                          // add the collection to the index of all paths gathered thus far
+                          index_paths(obj_paths);
                       });
 
         // store size of the generated graph
@@ -167,71 +165,11 @@ class generate_edge_intersection_graph_impl
      */
     std::size_t node_id{0}, edge_id{0};
     /**
-     * Extends the layout_coordinate_path to additionally to the vector representation of the path also hold a set that
-     * allows fast lookup needed to find intersections (O(log n)). Additionally, a label is assigned to each path to
-     * identify it in the edge intersection graph.
+     * Extends the layout_coordinate_path by a label that identifies it in the edge intersection graph.
      */
-    class labeled_layout_coordinate_lookup_path : public layout_coordinate_path<Lyt>
+    class labeled_layout_coordinate_path : public layout_coordinate_path<Lyt>
     {
       public:
-        /**
-         * Overwrites the append function to additionally store the given coordinate in a set.
-         *
-         * @param c Coordinate to append to the path.
-         */
-        void append(const coordinate<Lyt>& c) noexcept
-        {
-            path_elements.insert(c);
-            layout_coordinate_path<Lyt>::append(c);
-        }
-        /**
-         * Given another path, this function checks if they are not disjoint, i.e., it looks for at least one coordinate
-         * that both paths share.
-         *
-         * If, at some point, the set approach is not to be used anymore, std::find_first_of offers the same
-         * functionality on any kind of range.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are not disjoint, i.e., share at least one coordinate.
-         */
-        template <typename Path>
-        bool has_intersection_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the remaining coordinates occur in the stored path
-            return std::any_of(std::cbegin(other) + 1, std::cend(other) - 1,
-                               [this](const auto& c) { return path_elements.count(c) > 0; });
-        }
-        /**
-         * Like has_intersection_with but allows paths to share crossings, i.e., single-tile intersections.
-         *
-         * Similar to has_intersection_with, this function also returns `true` if source and target are matching in both
-         * paths.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are overlapping, i.e., share at least one coordinate segment
-         * of size 2.
-         */
-        template <typename Path>
-        bool has_overlap_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the coordinates (including I/Os) form a shared segment in the stored path
-            return find_first_two_of(std::cbegin(other), std::cend(other), std::cbegin(*this), std::cend(*this)) !=
-                   std::cend(other);
-        }
         /**
          * Label to identify the path in the edge intersection graph.
          */
@@ -243,24 +181,118 @@ class generate_edge_intersection_graph_impl
       public:
         // make all inherited constructors available
         using base::base;
-
-      private:
-        /**
-         * Uniquely identify path elements in a set to make them searchable in O(1).
-         */
-        phmap::flat_hash_set<coordinate<Lyt>> path_elements{};
     };
     /**
      * Alias for the path type.
      */
-    using clk_path = labeled_layout_coordinate_lookup_path;
+    using clk_path = labeled_layout_coordinate_path;
+    /**
+     * Alias for a pair of coordinates, which is used to represent both path segments and source-target pairs.
+     */
+    using coordinate_pair = std::pair<coordinate<Lyt>, coordinate<Lyt>>;
+    /**
+     * Inverted index that maps each coordinate to the labels of all previously collected paths that contain it as an
+     * intermediate coordinate, i.e., excluding their source and target. Used to find intersections if crossings are
+     * disabled.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, std::vector<std::size_t>> coordinate_index{};
+    /**
+     * Inverted index that maps each 2-element path segment to the labels of all previously collected paths that contain
+     * it. Used to find overlaps if crossings are enabled.
+     */
+    phmap::flat_hash_map<coordinate_pair, std::vector<std::size_t>> segment_index{};
+    /**
+     * Maps each source-target pair to the labels of all previously collected paths that connect them. Paths with
+     * identical sources and targets are always considered intersecting.
+     */
+    phmap::flat_hash_map<coordinate_pair, std::vector<std::size_t>> objective_index{};
     /**
-     * Stores a collection of all annotated paths (labeled_layout_coordinate_lookup_path objects) computed thus far to
-     * find intersections with new ones. The edge intersection graph stores plain paths without the extra set and label.
-     * Therefore, after the generate_edge_intersection_graph function terminates, the extra memory overhead is being
-     * released again.
+     * Enumerates the paths of a single routing objective as specified in the parameters.
+     *
+     * @param obj Routing objective whose paths are to be enumerated.
+     * @return Collection of paths satisfying `obj`.
      */
-    path_collection<clk_path> all_paths{};
+    [[nodiscard]] path_collection<clk_path> enumerate_paths(const routing_objective<Lyt>& obj) const
+    {
+        if (!ps.path_limit.has_value())
+        {
+            // enumerate all paths for the current objective
+            return enumerate_all_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target}, {ps.crossings});
+        }
+
+        yen_k_shortest_paths_params yen_ps{};
+        yen_ps.astar_params.crossings = ps.crossings;
+        // objectives are already enumerated concurrently
+        yen_ps.num_threads = 1;
+
+        // enumerate k paths for the current objective
+        return yen_k_shortest_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit,
+                                              yen_ps);
+    }
+    /**
+     * Enumerates the paths of all routing objectives. Since the enumeration of each objective is independent of the
+     * others, the objectives are distributed over `ps.num_threads` threads.
+     *
+     * @return Path collections of all objectives in the order of `objectives`.
+     */
+    [[nodiscard]] std::vector<path_collection<clk_path>> enumerate_objective_paths() const
+    {
+        std::vector<path_collection<clk_path>> objective_paths(objectives.size());
+
+        const auto num_threads = std::min(std::max(ps.num_threads, std::size_t{1}), objectives.size());
+
+        if (num_threads <= 1)
+        {
+            std::transform(objectives.cbegin(), objectives.cend(), objective_paths.begin(),
+                           [this](const auto& obj) { return enumerate_paths(obj); });
+
+            return objective_paths;
+        }
+
+        // calculate the size of each slice
+        const auto slice_size = (objectives.size() + num_threads - 1) / num_threads;
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        thread_idle_recorder idle_recorder{"generate_edge_intersection_graph::thread_idle_time"};
+
+        // launch threads, each with its own slice of objectives
+        for (auto i = 0ul; i < num_threads; ++i)
+        {
+            const auto start = i * slice_size;
+            const auto end   = std::min(start + slice_size, objectives.size());
+
+            if (start >= end)
+            {
+                break;  // no more work to distribute
+            }
+
+            threads.emplace_back(
+                [this, start, end, &objective_paths, &idle_recorder]
+                {
+                    for (auto j = start; j < end; ++j)
+                    {
+                        objective_paths[j] = enumerate_paths(objectives[j]);
+                    }
+
+                    idle_recorder.worker_finished();
+                });
+        }
+
+        // wait for all threads to complete
+        for (auto& thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        idle_recorder.threads_joined();
+
+        return objective_paths;
+    }
     /**
      * Given a collection of paths belonging to the same objective, this function assigns them unique labels and
      * generates corresponding nodes in the edge intersection graph.
@@ -303,10 +335,53 @@ class generate_edge_intersection_graph_impl
                                                return false;  // keep looping
                                            });
     }
+    /**
+     * Collects the labels of all previously indexed paths that intersect with the given path.
+     *
+     * If crossings are disabled, two paths intersect if any coordinate of `p` is an intermediate coordinate of the
+     * other path. If crossings are enabled, two paths intersect if they share at least one 2-element segment. In both
+     * cases, paths with identical source and target intersect.
+     *
+     * @param p Path to find intersections for.
+     * @return Sorted labels of all intersecting paths without duplicates.
+     */
+    [[nodiscard]] std::vector<std::size_t> find_intersecting_paths(const clk_path& p) const noexcept
+    {
+        std::vector<std::size_t> labels{};
+
+        const auto collect = [&labels](const auto& index, const auto& key)
+        {
+            if (const auto it = index.find(key); it != index.cend())
+            {
+                labels.insert(labels.end(), it->second.cbegin(), it->second.cend());
+            }
+        };
+
+        collect(objective_index, coordinate_pair{p.source(), p.target()});
+
+        if (ps.crossings)
+        {
+            for (auto it = p.cbegin(); it + 1 < p.cend(); ++it)
+            {
+                collect(segment_index, coordinate_pair{*it, *(it + 1)});
+            }
+        }
+        else
+        {
+            std::for_each(p.cbegin(), p.cend(), [&collect, this](const auto& c) { collect(coordinate_index, c); });
+        }
+
+        // sort to create edges in label order
+        std::sort(labels.begin(), labels.end());
+        labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+        return labels;
+    }
     /**
      * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
      * graph between each corresponding node and all of the already existing nodes that represent paths that intersect
-     * with it, i.e., that share at least one coordinate.
+     * with it, i.e., that share at least one coordinate. Intersecting paths are looked up in the inverted indices
+     * instead of being compared pairwise.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
      */
@@ -315,15 +390,43 @@ class generate_edge_intersection_graph_impl
         std::for_each(objective_paths.cbegin(), objective_paths.cend(),
                       [this](const auto& obj_p)
                       {
-                          std::for_each(all_paths.cbegin(), all_paths.cend(),
-                                        [this, &obj_p](const auto& stored_p)
-                                        {
-                                            if (ps.crossings ? obj_p.has_overlap_with(stored_p) :
-                                                               obj_p.has_intersection_with(stored_p))
-                                            {
-                                                graph.insert_edge(obj_p.label, stored_p.label, edge_id++);
-                                            }
-                                        });
+                          for (const auto stored_label : find_intersecting_paths(obj_p))
+                          {
+                              graph.insert_edge(obj_p.label, stored_label, edge_id++);
+                          }
+                      });
+    }
+    /**
+     * Adds a collection of labeled paths to the inverted indices such that subsequently processed paths can find
+     * intersections with them.
+     *
+     * @param objective_paths Collection of paths belonging to the same objective.
+     */
+    void index_paths(const path_collection<clk_path>& objective_paths) noexcept
+    {
+        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
+                      [this](const auto& p)
+                      {
+                          if (p.empty())
+                          {
+                              return;
+                          }
+
+                          objective_index[coordinate_pair{p.source(), p.target()}].push_back(p.label);
+
+                          if (ps.crossings)
+                          {
+                              for (auto it = p.cbegin(); it + 1 < p.cend(); ++it)
+                              {
+                                  segment_index[coordinate_pair{*it, *(it + 1)}].push_back(p.label);
+                              }
+                          }
+                          else if (p.size() > 2)
+                          {
+                              // exclude source and target
+                              std::for_each(p.cbegin() + 1, p.cend() - 1,
+                                            [this, &p](const auto& c) { coordinate_index[c].push_back(p.label); });
+                          }
                       });
     }
 };
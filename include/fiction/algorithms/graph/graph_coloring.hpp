@@ -6,6 +6,7 @@
 #define FICTION_GRAPH_COLORING_HPP
 
 #include "fiction/utils/hash.hpp"
+#include "fiction/utils/profiling.hpp"
 
 #include <bill/sat/cardinality.hpp>
 #include <bill/sat/interface/common.hpp>
@@ -15,10 +16,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -76,7 +83,15 @@ enum class graph_coloring_engine
     /**
      * Custom iterative SAT-based encoding that finds optimal colorings.
      */
-    SAT
+    SAT,
+    /**
+     * Runs a portfolio of coloring heuristics and incremental SAT-based \f$k\f$-coloring queries with different
+     * \f$k\f$ and SAT solvers concurrently. The heuristics provide upper bounds and the given cliques provide lower
+     * bounds for the chromatic number. Queries whose \f$k\f$ falls outside the remaining bounds are canceled as soon as
+     * the bounds are tightened. The portfolio terminates once the optimal \f$k\f$ has been proven. See
+     * `determine_vertex_coloring_portfolio_params` for its configuration.
+     */
+    PORTFOLIO
 };
 /**
  * An enumeration of search tactics to use for the SAT-based graph coloring to determine a min-coloring.
@@ -137,6 +152,31 @@ struct determine_vertex_coloring_heuristic_params
      */
     std::size_t k_color_value = 0;
 };
+/**
+ * Parameters for the portfolio graph coloring.
+ */
+struct determine_vertex_coloring_portfolio_params
+{
+    /**
+     * The heuristic engines that are run to establish upper bounds for the chromatic number. Only engines that do not
+     * require a \f$k\f$-color value, i.e., MCS, DSATUR, and LMXRLF, are supported.
+     */
+    std::vector<graph_coloring_engine> heuristic_engines{graph_coloring_engine::MCS, graph_coloring_engine::DSATUR};
+    /**
+     * The SAT solvers to use. The SAT workers are assigned solvers from this list in a round-robin fashion.
+     */
+    std::vector<bill::solvers> sat_engines{bill::solvers::ghack, bill::solvers::glucose_41};
+    /**
+     * Number of threads to use. One thread runs the heuristics, all remaining ones (but at least one) run SAT
+     * \f$k\f$-coloring queries. By default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+    /**
+     * Number of conflicts a SAT solver may encounter before it checks whether its current query has become obsolete.
+     * Smaller values lead to faster cancellation at the cost of more solver restarts.
+     */
+    uint32_t conflict_limit = 10000u;
+};
 /**
  * Common parameters for the graph coloring algorithm.
  *
@@ -161,6 +201,10 @@ struct determine_vertex_coloring_params
      * Verify that the found coloring is valid.
      */
     bool verify_coloring_after_computation = false;
+    /**
+     * Parameters for `engine == PORTFOLIO`. Cliques and the color frequency constraint are taken from `sat_params`.
+     */
+    determine_vertex_coloring_portfolio_params portfolio_params{};
 };
 
 template <typename Color = std::size_t>
@@ -632,6 +676,8 @@ class sat_coloring_handler
 
     auto check_sat(const solver_instance_ptr& instance) const
     {
+        FICTION_PROFILE_SCOPE("graph_coloring::sat_solve");
+
         return instance->solver.solve();
     }
 
@@ -678,6 +724,669 @@ class sat_coloring_handler
     }
 };
 
+/**
+ * An incremental SAT-based \f$k\f$-coloring encoding that is shared across several values of \f$k\f$. Color variables
+ * are created on demand whenever a query requires more colors than encoded so far. All constraints that are independent
+ * of \f$k\f$ (at most one color per vertex, different colors for adjacent vertices, and symmetry breaking) are added
+ * permanently, whereas the constraints that depend on \f$k\f$ (at least one of the first \f$k\f$ colors per vertex and
+ * the optional color frequency) are guarded by an activation literal per query. This way, clauses learned by the solver
+ * remain valid across queries.
+ *
+ * @tparam Graph Type of the graph to color.
+ * @tparam Color Color type to use.
+ * @tparam SolverType The SAT solver to use.
+ */
+template <typename Graph, typename Color = std::size_t, bill::solvers SolverType = bill::solvers::ghack>
+class incremental_sat_coloring_instance
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param vs All vertices of the graph in a fixed order. Vertices are referred to by their index in this list.
+     * @param es All edges of the graph given as pairs of vertex indices.
+     * @param pre Pre-assigned colors given as pairs of vertex indices and colors for symmetry breaking.
+     * @param ord A vertex ordering (given as vertex indices) that starts with the pre-assigned vertices. It is used to
+     * enforce lexicographically minimal solutions.
+     * @param cl Cliques given as lists of vertex indices for the color frequency constraint. If empty, no color
+     * frequency constraint is added.
+     */
+    incremental_sat_coloring_instance(const std::vector<typename Graph::vertex_id_type>&     vs,
+                                      const std::vector<std::pair<std::size_t, std::size_t>>& es,
+                                      const std::vector<std::pair<std::size_t, std::size_t>>& pre,
+                                      const std::vector<std::size_t>&                         ord,
+                                      const std::vector<std::vector<std::size_t>>&            cl) :
+            vertices{vs},
+            edges{es},
+            pre_assignments{pre},
+            ordering{ord},
+            cliques{cl},
+            variables(vertices.size())
+    {}
+    /**
+     * Checks whether the graph is \f$k\f$-colorable. The solver is invoked repeatedly with a limited conflict budget.
+     * Between invocations, `is_obsolete` is queried and the check is aborted if it returns `true`.
+     *
+     * @param k Number of colors.
+     * @param conflict_limit Number of conflicts per solver invocation.
+     * @param is_obsolete Predicate that determines whether the query can be canceled.
+     * @return `satisfiable` or `unsatisfiable` if the query could be decided, `undefined` if it was canceled.
+     */
+    template <typename Predicate>
+    bill::result::states check_k_coloring(const std::size_t k, const uint32_t conflict_limit,
+                                          Predicate&& is_obsolete) noexcept
+    {
+        extend_colors(k);
+
+        const auto activation = solver.add_variable();
+        const auto guard      = bill::lit_type{activation, bill::negative_polarity};
+
+        // at least one of the first k colors per vertex
+        for (std::size_t v = 0; v < vertices.size(); ++v)
+        {
+            std::vector<bill::lit_type> clause{guard};
+            clause.reserve(k + 1);
+
+            for (std::size_t c = 0; c < k; ++c)
+            {
+                clause.emplace_back(variables[v][c], bill::positive_polarity);
+            }
+
+            solver.add_clause(clause);
+        }
+
+        // at least one of the first k colors occurs in each clique
+        if (!cliques.empty())
+        {
+            std::vector<bill::lit_type> clause{guard};
+            clause.insert(clause.end(), clique_colors.cbegin(), clique_colors.cbegin() + static_cast<int64_t>(k));
+
+            solver.add_clause(clause);
+        }
+
+        auto result = bill::result::states::undefined;
+
+        do {
+            if (is_obsolete())
+            {
+                break;
+            }
+
+            FICTION_PROFILE_SCOPE("graph_coloring::sat_solve");
+
+            result = solver.solve({bill::lit_type{activation, bill::positive_polarity}}, conflict_limit);
+
+        } while (result != bill::result::states::satisfiable && result != bill::result::states::unsatisfiable);
+
+        if (result == bill::result::states::satisfiable)
+        {
+            model = solver.get_model().model();
+        }
+
+        // permanently disable the constraints of this query
+        solver.add_clause(guard);
+
+        return result;
+    }
+    /**
+     * Extracts the vertex coloring from the model of the most recent satisfiable query.
+     *
+     * @return The vertex coloring.
+     */
+    [[nodiscard]] vertex_coloring<Graph, Color> extract_vertex_coloring() const noexcept
+    {
+        vertex_coloring<Graph, Color> coloring{};
+
+        for (std::size_t v = 0; v < vertices.size(); ++v)
+        {
+            for (std::size_t c = 0; c < variables[v].size(); ++c)
+            {
+                if (model.at(variables[v][c]) == bill::lbool_type::true_)
+                {
+                    coloring[vertices[v]] = static_cast<Color>(c);
+                    break;
+                }
+            }
+        }
+
+        return coloring;
+    }
+
+  private:
+    /**
+     * The vertices of the graph to color.
+     */
+    const std::vector<typename Graph::vertex_id_type>& vertices;
+    /**
+     * The edges of the graph to color as pairs of vertex indices.
+     */
+    const std::vector<std::pair<std::size_t, std::size_t>>& edges;
+    /**
+     * Pre-assigned vertex colors.
+     */
+    const std::vector<std::pair<std::size_t, std::size_t>>& pre_assignments;
+    /**
+     * Vertex ordering for the lexicographical symmetry breaking.
+     */
+    const std::vector<std::size_t>& ordering;
+    /**
+     * Cliques for the color frequency constraint.
+     */
+    const std::vector<std::vector<std::size_t>>& cliques;
+    /**
+     * SAT solver.
+     */
+    bill::solver<SolverType> solver{};
+    /**
+     * Variables indexed by vertex index and color.
+     */
+    std::vector<std::vector<bill::var_type>> variables;
+    /**
+     * For each color, a literal that is `true` iff the color occurs in each clique.
+     */
+    std::vector<bill::lit_type> clique_colors{};
+    /**
+     * The model of the most recent satisfiable query.
+     */
+    bill::result::model_type model{};
+    /**
+     * Creates variables and permanent constraints for all colors up to `k`.
+     *
+     * @param k Number of colors to encode.
+     */
+    void extend_colors(const std::size_t k) noexcept
+    {
+        for (auto c = num_colors(); c < k; ++c)
+        {
+            for (auto& vc : variables)
+            {
+                vc.push_back(solver.add_variable());
+            }
+
+            // at most one color per vertex
+            for (std::size_t v = 0; v < vertices.size(); ++v)
+            {
+                for (std::size_t c_prev = 0; c_prev < c; ++c_prev)
+                {
+                    solver.add_clause({{bill::lit_type{variables[v][c_prev], bill::negative_polarity},
+                                        bill::lit_type{variables[v][c], bill::negative_polarity}}});
+                }
+            }
+
+            // adjacent vertices receive different colors
+            for (const auto& [v1, v2] : edges)
+            {
+                solver.add_clause({{bill::lit_type{variables[v1][c], bill::negative_polarity},
+                                    bill::lit_type{variables[v2][c], bill::negative_polarity}}});
+            }
+
+            // symmetry breaking: pre-assign colors
+            for (const auto& [v, pre_c] : pre_assignments)
+            {
+                if (pre_c == c)
+                {
+                    solver.add_clause(bill::lit_type{variables[v][c], bill::positive_polarity});
+                }
+            }
+
+            // symmetry breaking: a vertex can only have color c if a vertex of lower order has color c - 1
+            if (c > 0)
+            {
+                for (std::size_t i = 0; i < ordering.size(); ++i)
+                {
+                    std::vector<bill::lit_type> clause{
+                        {bill::lit_type{variables[ordering[i]][c], bill::negative_polarity}}};
+                    clause.reserve(i + 1);
+
+                    for (std::size_t j = 0; j < i; ++j)
+                    {
+                        clause.emplace_back(variables[ordering[j]][c - 1], bill::positive_polarity);
+                    }
+
+                    solver.add_clause(clause);
+                }
+            }
+
+            // color c occurs in each clique
+            if (!cliques.empty())
+            {
+                std::vector<bill::lit_type> color_c_in_each_clique{};
+                color_c_in_each_clique.reserve(cliques.size());
+
+                for (const auto& clique : cliques)
+                {
+                    std::vector<bill::lit_type> vc{};
+                    vc.reserve(clique.size());
+
+                    for (const auto v : clique)
+                    {
+                        vc.emplace_back(variables[v][c], bill::positive_polarity);
+                    }
+
+                    color_c_in_each_clique.push_back(bill::add_tseytin_or(solver, vc));
+                }
+
+                clique_colors.push_back(bill::add_tseytin_and(solver, color_c_in_each_clique));
+            }
+        }
+    }
+    /**
+     * Returns the number of colors encoded thus far.
+     *
+     * @return Number of encoded colors.
+     */
+    [[nodiscard]] std::size_t num_colors() const noexcept
+    {
+        return variables.empty() ? 0 : variables.front().size();
+    }
+};
+
+// forward declaration
+template <typename Graph, typename Color>
+class graph_coloring_impl;
+
+/**
+ * Portfolio graph coloring that runs heuristics and incremental SAT-based \f$k\f$-coloring queries concurrently while
+ * sharing the bounds on the chromatic number among all workers.
+ *
+ * @tparam Graph Type of the graph to color.
+ * @tparam Color Color type to use.
+ */
+template <typename Graph, typename Color = std::size_t>
+class portfolio_coloring_handler
+{
+  public:
+    portfolio_coloring_handler(const Graph& g, const determine_vertex_coloring_params<Graph>& p) : graph{g}, ps{p}
+    {
+        std::unordered_map<typename Graph::vertex_id_type, std::size_t> index{};
+
+        std::for_each(graph.begin_vertices(), graph.end_vertices(),
+                      [this, &index](const auto& vp)
+                      {
+                          index[vp.first] = vertices.size();
+                          vertices.push_back(vp.first);
+                      });
+
+        std::for_each(graph.begin_edges(), graph.end_edges(),
+                      [this, &index](const auto& e)
+                      {
+                          const auto& [v1, v2] = e.first;
+                          edges.emplace_back(index.at(v1), index.at(v2));
+                      });
+
+        std::for_each(ps.sat_params.cliques.cbegin(), ps.sat_params.cliques.cend(),
+                      [this, &index](const auto& clique)
+                      {
+                          std::vector<std::size_t> indexed_clique{};
+                          indexed_clique.reserve(clique.size());
+
+                          std::for_each(clique.cbegin(), clique.cend(),
+                                        [&index, &indexed_clique](const auto& v)
+                                        { indexed_clique.push_back(index.at(v)); });
+
+                          cliques.push_back(indexed_clique);
+                      });
+
+        const auto largest_clique =
+            std::max_element(cliques.cbegin(), cliques.cend(),
+                             [](const auto& c1, const auto& c2) { return c1.size() < c2.size(); });
+
+        determine_symmetry_breaking(largest_clique);
+
+        // the largest clique size is a lower bound for the chromatic number
+        lower_bound = std::max(largest_clique == cliques.cend() ? std::size_t{1} : largest_clique->size(),
+                               edges.empty() ? std::size_t{1} : std::size_t{2});
+    }
+
+    std::optional<vertex_coloring<Graph, Color>> color()
+    {
+        if (vertices.empty())
+        {
+            return std::nullopt;
+        }
+
+        const auto num_sat_workers = std::max(ps.portfolio_params.num_threads, std::size_t{2}) - 1;
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_sat_workers + 1);
+
+        threads.emplace_back([this] { run_heuristics(); });
+
+        for (std::size_t i = 0; i < num_sat_workers; ++i)
+        {
+            const auto& engines = ps.portfolio_params.sat_engines;
+
+            const auto engine = engines.empty() ? bill::solvers::ghack : engines[i % engines.size()];
+
+            // alternate between workers that prove lower bounds and workers that tighten upper bounds
+            threads.emplace_back([this, engine, descending = i % 2 == 1] { run_sat_worker(engine, descending); });
+        }
+
+        // wait for all threads to complete
+        for (auto& thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        return best_coloring;
+    }
+
+  private:
+    /**
+     * A reference to the graph to be colored.
+     */
+    const Graph& graph;
+    /**
+     * Parameters.
+     */
+    const determine_vertex_coloring_params<Graph> ps;
+    /**
+     * All vertices in a fixed order.
+     */
+    std::vector<typename Graph::vertex_id_type> vertices{};
+    /**
+     * All edges as pairs of vertex indices.
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> edges{};
+    /**
+     * All cliques as lists of vertex indices.
+     */
+    std::vector<std::vector<std::size_t>> cliques{};
+    /**
+     * Pre-assigned colors as pairs of vertex indices and colors.
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> pre_assignments{};
+    /**
+     * Vertex ordering for the lexicographical symmetry breaking.
+     */
+    std::vector<std::size_t> ordering{};
+    /**
+     * Mutex to protect the shared bounds and the best coloring.
+     */
+    std::mutex bounds_mutex{};
+    /**
+     * All \f$k < \f$ `lower_bound` are proven to not be colorable.
+     */
+    std::size_t lower_bound;
+    /**
+     * The smallest \f$k\f$ for which a coloring has been found.
+     */
+    std::optional<std::size_t> upper_bound{std::nullopt};
+    /**
+     * The coloring corresponding to `upper_bound`.
+     */
+    std::optional<vertex_coloring<Graph, Color>> best_coloring{std::nullopt};
+    /**
+     * Values of \f$k\f$ that are currently being checked by SAT workers.
+     */
+    std::set<std::size_t> queries_in_progress{};
+    /**
+     * Determines the pre-assigned colors and the vertex ordering used for symmetry breaking. Each vertex of the largest
+     * clique is assigned a different color. Without clique information, the first vertex and one of its neighbors are
+     * pre-assigned.
+     *
+     * @param largest_clique Iterator to the largest clique in `cliques`.
+     */
+    void determine_symmetry_breaking(
+        const typename std::vector<std::vector<std::size_t>>::const_iterator& largest_clique) noexcept
+    {
+        if (largest_clique != cliques.cend() && !largest_clique->empty())
+        {
+            for (std::size_t c = 0; c < largest_clique->size(); ++c)
+            {
+                pre_assignments.emplace_back((*largest_clique)[c], c);
+                ordering.push_back((*largest_clique)[c]);
+            }
+        }
+        else if (!vertices.empty())
+        {
+            pre_assignments.emplace_back(0, 0);
+            ordering.push_back(0);
+
+            if (const auto it = std::find_if(edges.cbegin(), edges.cend(),
+                                             [](const auto& e) { return e.first == 0 || e.second == 0; });
+                it != edges.cend())
+            {
+                const auto adjacent = it->first == 0 ? it->second : it->first;
+
+                pre_assignments.emplace_back(adjacent, 1);
+                ordering.push_back(adjacent);
+            }
+        }
+
+        // add the missing vertices in an arbitrary order
+        std::vector<bool> ordered(vertices.size(), false);
+        std::for_each(ordering.cbegin(), ordering.cend(), [&ordered](const auto v) { ordered[v] = true; });
+
+        for (std::size_t v = 0; v < vertices.size(); ++v)
+        {
+            if (!ordered[v])
+            {
+                ordering.push_back(v);
+            }
+        }
+    }
+    /**
+     * Checks whether the given coloring satisfies the color frequency constraint, i.e., whether there exists a color
+     * that occurs in each clique.
+     *
+     * @param coloring Coloring to check.
+     * @return `true` iff the color frequency constraint is disabled or satisfied by `coloring`.
+     */
+    [[nodiscard]] bool satisfies_color_frequency(const vertex_coloring<Graph, Color>& coloring) const noexcept
+    {
+        if (!ps.sat_params.clique_size_color_frequency || cliques.empty())
+        {
+            return true;
+        }
+
+        std::set<Color> candidates{};
+
+        for (auto it = cliques.cbegin(); it != cliques.cend(); ++it)
+        {
+            std::set<Color> clique_colors{};
+            std::for_each(it->cbegin(), it->cend(), [this, &coloring, &clique_colors](const auto v)
+                          { clique_colors.insert(coloring.at(vertices[v])); });
+
+            if (it == cliques.cbegin())
+            {
+                candidates = clique_colors;
+            }
+            else
+            {
+                std::set<Color> intersection{};
+                std::set_intersection(candidates.cbegin(), candidates.cend(), clique_colors.cbegin(),
+                                      clique_colors.cend(), std::inserter(intersection, intersection.begin()));
+                candidates = intersection;
+            }
+
+            if (candidates.empty())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Offers a coloring with `k` colors. It is stored if it improves the upper bound.
+     *
+     * @param k Number of colors in `coloring`.
+     * @param coloring Coloring to offer.
+     */
+    void offer_coloring(const std::size_t k, vertex_coloring<Graph, Color>&& coloring) noexcept
+    {
+        const std::lock_guard lock{bounds_mutex};
+
+        if (!upper_bound.has_value() || k < *upper_bound)
+        {
+            upper_bound   = k;
+            best_coloring = std::move(coloring);
+        }
+    }
+    /**
+     * Checks whether the query for the given `k` has become obsolete because of tightened bounds.
+     *
+     * @param k Number of colors.
+     * @return `true` iff `k` is not within the bounds anymore.
+     */
+    [[nodiscard]] bool is_obsolete(const std::size_t k) noexcept
+    {
+        const std::lock_guard lock{bounds_mutex};
+
+        return k < lower_bound || (upper_bound.has_value() && k >= *upper_bound);
+    }
+    /**
+     * Claims the next \f$k\f$ to check that is not yet being checked by another worker.
+     *
+     * @param descending If `true` and an upper bound is known, the largest open \f$k\f$ is claimed. Otherwise, the
+     * smallest one.
+     * @return The claimed \f$k\f$ or `std::nullopt` if no open \f$k\f$ is left.
+     */
+    [[nodiscard]] std::optional<std::size_t> claim_query(const bool descending) noexcept
+    {
+        const std::lock_guard lock{bounds_mutex};
+
+        const auto max_k = upper_bound.has_value() ? *upper_bound - 1 : vertices.size();
+
+        if (lower_bound > max_k)
+        {
+            return std::nullopt;
+        }
+
+        if (descending && upper_bound.has_value())
+        {
+            for (auto k = max_k; k >= lower_bound; --k)
+            {
+                if (queries_in_progress.count(k) == 0)
+                {
+                    queries_in_progress.insert(k);
+                    return k;
+                }
+            }
+        }
+        else
+        {
+            for (auto k = lower_bound; k <= max_k; ++k)
+            {
+                if (queries_in_progress.count(k) == 0)
+                {
+                    queries_in_progress.insert(k);
+                    return k;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Runs all configured heuristics one after another and offers their colorings.
+     */
+    void run_heuristics() noexcept
+    {
+        for (const auto engine : ps.portfolio_params.heuristic_engines)
+        {
+            if (engine != graph_coloring_engine::MCS && engine != graph_coloring_engine::DSATUR &&
+                engine != graph_coloring_engine::LMXRLF)
+            {
+                continue;
+            }
+
+            determine_vertex_coloring_params<Graph> heuristic_ps{};
+            heuristic_ps.engine = engine;
+
+            determine_vertex_coloring_stats<Color> heuristic_st{};
+
+            auto coloring = graph_coloring_impl<Graph, Color>{graph, heuristic_ps, heuristic_st}.run();
+
+            if (satisfies_color_frequency(coloring))
+            {
+                offer_coloring(heuristic_st.chromatic_number, std::move(coloring));
+            }
+
+            // stop early if the heuristic coloring is proven optimal
+            if (const std::lock_guard lock{bounds_mutex};
+                upper_bound.has_value() && *upper_bound <= lower_bound)
+            {
+                return;
+            }
+        }
+    }
+    /**
+     * Runs a SAT worker with the given solver.
+     *
+     * @param engine The SAT solver to use.
+     * @param descending Determines which queries are claimed, see `claim_query`.
+     */
+    void run_sat_worker(const bill::solvers engine, const bool descending) noexcept
+    {
+        switch (engine)
+        {
+            case bill::solvers::glucose_41:
+            {
+                run_sat_worker<bill::solvers::glucose_41>(descending);
+                break;
+            }
+#if !defined(BILL_WINDOWS_PLATFORM)
+            case bill::solvers::maple:
+            {
+                run_sat_worker<bill::solvers::maple>(descending);
+                break;
+            }
+            case bill::solvers::bmcg:
+            {
+                run_sat_worker<bill::solvers::bmcg>(descending);
+                break;
+            }
+#endif
+            default:
+            {
+                run_sat_worker<bill::solvers::ghack>(descending);
+                break;
+            }
+        }
+    }
+    /**
+     * Repeatedly claims and checks values of \f$k\f$ on a single incremental solver instance until the chromatic number
+     * has been proven or no open \f$k\f$ is left.
+     *
+     * @tparam SolverType The SAT solver to use.
+     * @param descending Determines which queries are claimed, see `claim_query`.
+     */
+    template <bill::solvers SolverType>
+    void run_sat_worker(const bool descending) noexcept
+    {
+        const std::vector<std::vector<std::size_t>> no_cliques{};
+
+        incremental_sat_coloring_instance<Graph, Color, SolverType> instance{
+            vertices, edges, pre_assignments, ordering,
+            ps.sat_params.clique_size_color_frequency ? cliques : no_cliques};
+
+        while (const auto k = claim_query(descending))
+        {
+            const auto result = instance.check_k_coloring(*k, ps.portfolio_params.conflict_limit,
+                                                          [this, &k] { return is_obsolete(*k); });
+
+            if (result == bill::result::states::satisfiable)
+            {
+                offer_coloring(*k, instance.extract_vertex_coloring());
+            }
+
+            const std::lock_guard lock{bounds_mutex};
+
+            if (result == bill::result::states::unsatisfiable)
+            {
+                lower_bound = std::max(lower_bound, *k + 1);
+            }
+
+            queries_in_progress.erase(*k);
+        }
+    }
+};
+
 template <typename Graph, typename Color>
 class graph_coloring_impl
 {
@@ -749,6 +1458,19 @@ class graph_coloring_impl
                 ps.engine = graph_coloring_engine::MCS;
             }
         }
+        else if (ps.engine == graph_coloring_engine::PORTFOLIO)
+        {
+            coloring = portfolio_coloring_handler<Graph, Color>{graph, ps}.color();
+
+            if (coloring.has_value())
+            {
+                determine_color_statistics(*coloring);
+            }
+            else  // if the portfolio was not able to determine a coloring, try MCS
+            {
+                ps.engine = graph_coloring_engine::MCS;
+            }
+        }
 
         if (is_brian_crites_engine(ps.engine))
         {
@@ -905,6 +1627,30 @@ class graph_coloring_impl
         return v_coloring;
     }
 
+    /**
+     * Determines the chromatic number, the most frequent color, and its frequency of the given coloring and stores them
+     * in the statistics.
+     *
+     * @param v_coloring Vertex coloring to analyze.
+     */
+    void determine_color_statistics(const vertex_coloring<Graph, Color>& v_coloring) const noexcept
+    {
+        std::unordered_map<Color, std::size_t> color_frequency{};
+
+        std::for_each(v_coloring.cbegin(), v_coloring.cend(),
+                      [&color_frequency](const auto& vc) { color_frequency[vc.second]++; });
+
+        pst.chromatic_number = color_frequency.size();
+
+        if (const auto it = std::max_element(color_frequency.cbegin(), color_frequency.cend(),
+                                             [](const auto& cf1, const auto& cf2) { return cf1.second < cf2.second; });
+            it != color_frequency.cend())
+        {
+            pst.most_frequent_color = it->first;
+            pst.color_frequency     = it->second;
+        }
+    }
+
     [[nodiscard]] vertex_coloring<Graph, Color> run_brian_crites_engine() const noexcept
     {
         const auto translated_graph = translate_to_brian_crites_graph(graph);
@@ -46,6 +46,23 @@ struct bdl_input_iterator_params
          */
         PERTURBER_ABSENCE_ENCODED
     };
+    /**
+     * Orders in which the input patterns are enumerated.
+     */
+    enum class input_pattern_order : uint8_t
+    {
+        /**
+         * The \f$i\f$-th input state is the input pattern \f$i\f$, i.e., the patterns are enumerated in ascending
+         * binary order.
+         */
+        BINARY,
+        /**
+         * The \f$i\f$-th input state is the input pattern \f$i \oplus \lfloor i / 2 \rfloor\f$, i.e., the patterns are
+         * enumerated in Gray code order. Consecutive input states differ in a single input, which minimizes the number
+         * of SiDBs that change between them.
+         */
+        GRAY_CODE
+    };
     /**
      * Parameters to detect BDL wires.
      */
@@ -54,6 +71,28 @@ struct bdl_input_iterator_params
      * The `input_bdl_config` member allows selection between different modes for handling input BDLs.
      */
     input_bdl_configuration input_bdl_config{input_bdl_configuration::PERTURBER_DISTANCE_ENCODED};
+    /**
+     * The order in which the input patterns are enumerated.
+     */
+    input_pattern_order input_order{input_pattern_order::BINARY};
+};
+/**
+ * The SiDBs that changed between two input states of a `bdl_input_iterator`. If both vectors have the same size, the
+ * \f$i\f$-th removed SiDB and the \f$i\f$-th added SiDB belong to the same input BDL pair.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+struct bdl_input_delta
+{
+    /**
+     * Cells whose SiDBs were removed.
+     */
+    std::vector<cell<Lyt>> removed_sidbs{};
+    /**
+     * Cells to which SiDBs were added.
+     */
+    std::vector<cell<Lyt>> added_sidbs{};
 };
 
 /**
@@ -64,6 +103,12 @@ struct bdl_input_iterator_params
  * set. The iterator creates and stores a deep-copy of the given layout. The state enumeration wraps around, i.e., after
  * the last possible input state, the first input state is set again.
  *
+ * If `input_order` is set to `GRAY_CODE` in the parameters, the input states are enumerated in Gray code order, i.e.,
+ * the \f$i\f$-th input state applies the input pattern \f$i \oplus \lfloor i / 2 \rfloor\f$ and consecutive input
+ * states differ in a single input. The SiDBs that changed with the last state change can be obtained via `get_delta`.
+ * Together with `charge_distribution_surface::apply_sidb_delta`, this allows to update electrostatic properties
+ * incrementally instead of recomputing them for each input pattern.
+ *
  * The iterator satisfies the requirements of `LegacyRandomAccessIterator` and can be used in iterator-based `for`
  * loops.
  *
@@ -253,6 +298,28 @@ class bdl_input_iterator
 
         return *this;
     }
+    /**
+     * Sets the input state that applies the given input pattern. In `BINARY` order, this is equivalent to the
+     * assignment operator. In `GRAY_CODE` order, the input state is the inverse Gray code of the pattern.
+     *
+     * @param pattern The input pattern to apply.
+     */
+    bdl_input_iterator& set_input_pattern(const uint64_t pattern) noexcept
+    {
+        current_input_index = pattern;
+
+        if (params.input_order == bdl_input_iterator_params::input_pattern_order::GRAY_CODE)
+        {
+            for (auto shifted = pattern >> 1u; shifted != 0; shifted >>= 1u)
+            {
+                current_input_index ^= shifted;
+            }
+        }
+
+        set_all_inputs();
+
+        return *this;
+    }
     /**
      * Subscript operator. Computes the input state of the current iterator plus the given integer.
      *
@@ -343,13 +410,41 @@ class bdl_input_iterator
         return input_pairs.size();
     }
     /**
-     * Returns the current input index.
+     * Returns the input pattern of the current input state. In `BINARY` order, it is equal to the position of the
+     * iterator. In `GRAY_CODE` order, it is the Gray code of the position.
      *
      * @return The current input index.
      */
     [[nodiscard]] uint64_t get_current_input_index() const noexcept
     {
-        return current_input_index;
+        return get_input_pattern_of_state(current_input_index);
+    }
+    /**
+     * Returns the input pattern that is applied at the given input state. In `BINARY` order, it is equal to the input
+     * state. In `GRAY_CODE` order, it is the Gray code of the input state.
+     *
+     * @param state The input state, i.e., the position of the iterator.
+     * @return The input pattern that is applied at the given input state.
+     */
+    [[nodiscard]] uint64_t get_input_pattern_of_state(const uint64_t state) const noexcept
+    {
+        if (params.input_order == bdl_input_iterator_params::input_pattern_order::GRAY_CODE)
+        {
+            return state ^ (state >> 1u);
+        }
+
+        return state;
+    }
+    /**
+     * Returns the SiDBs that were removed and added by the last change of the input state. Input BDL dots that were set
+     * already are not reported. After construction, the delta holds the changes that were applied to the given layout
+     * to set the first input state.
+     *
+     * @return The SiDBs that changed with the last change of the input state.
+     */
+    [[nodiscard]] const bdl_input_delta<Lyt>& get_delta() const noexcept
+    {
+        return delta;
     }
 
   private:
@@ -381,6 +476,10 @@ class bdl_input_iterator
      * Parameters for the BDL input iterator.
      */
     const bdl_input_iterator_params params;
+    /**
+     * The SiDBs that changed with the last change of the input state.
+     */
+    bdl_input_delta<Lyt> delta{};
 
     /**
      * This function iterates through each wire in `input_bdl_wires`, identifies the first BDL pair
@@ -432,17 +531,22 @@ class bdl_input_iterator
      * Sets all input cells of the layout according to the current input index. The input index is interpreted as a
      * binary number, where the \f$i\f$-th bit represents the input state of the \f$i\f$-th input BDL pair. If the bit
      * is `1`, the lower BDL dot is set and the upper BDL dot removed. If the bit is `0`, the upper BDL dot is removed
-     * and the lower BDL dot set.
+     * and the lower BDL dot set. Cells whose type actually changes are recorded in `delta`.
      */
     void set_all_inputs() noexcept
     {
         assert(num_inputs == input_bdl_wires.size() && "number of inputs and number of wires don't match");
 
+        delta.removed_sidbs.clear();
+        delta.added_sidbs.clear();
+
+        const auto input_pattern = get_current_input_index();
+
         for (uint64_t i = num_inputs - 1; i < num_inputs; --i)
         {
             const auto& input_i = input_pairs[i];
 
-            if ((current_input_index & (uint64_t{1ull} << (num_inputs - 1 - i))) != 0ull)
+            if ((input_pattern & (uint64_t{1ull} << (num_inputs - 1 - i))) != 0ull)
             {
                 const auto distance_between_end_bdl_and_upper_input =
                     sidb_nm_distance(Lyt{}, input_i.upper, last_bdl_for_each_wire[i].upper);
@@ -451,14 +555,14 @@ class bdl_input_iterator
 
                 if (distance_between_end_bdl_and_upper_input < distance_between_end_bdl_and_lower_input)
                 {
-                    layout.assign_cell_type(input_i.lower, technology<Lyt>::cell_type::EMPTY);
-                    layout.assign_cell_type(input_i.upper, technology<Lyt>::cell_type::INPUT);
+                    assign_input_cell(input_i.lower, technology<Lyt>::cell_type::EMPTY);
+                    assign_input_cell(input_i.upper, technology<Lyt>::cell_type::INPUT);
                 }
 
                 else
                 {
-                    layout.assign_cell_type(input_i.lower, technology<Lyt>::cell_type::INPUT);
-                    layout.assign_cell_type(input_i.upper, technology<Lyt>::cell_type::EMPTY);
+                    assign_input_cell(input_i.lower, technology<Lyt>::cell_type::INPUT);
+                    assign_input_cell(input_i.upper, technology<Lyt>::cell_type::EMPTY);
                 }
             }
             else
@@ -473,25 +577,51 @@ class bdl_input_iterator
 
                     if (distance_between_end_bdl_and_upper_input < distance_between_end_bdl_and_lower_input)
                     {
-                        layout.assign_cell_type(input_i.lower, technology<Lyt>::cell_type::INPUT);
-                        layout.assign_cell_type(input_i.upper, technology<Lyt>::cell_type::EMPTY);
+                        assign_input_cell(input_i.lower, technology<Lyt>::cell_type::INPUT);
+                        assign_input_cell(input_i.upper, technology<Lyt>::cell_type::EMPTY);
                     }
 
                     else
                     {
-                        layout.assign_cell_type(input_i.lower, technology<Lyt>::cell_type::EMPTY);
-                        layout.assign_cell_type(input_i.upper, technology<Lyt>::cell_type::INPUT);
+                        assign_input_cell(input_i.lower, technology<Lyt>::cell_type::EMPTY);
+                        assign_input_cell(input_i.upper, technology<Lyt>::cell_type::INPUT);
                     }
                 }
                 else
                 {
                     // set input i to 0
-                    layout.assign_cell_type(input_i.upper, technology<Lyt>::cell_type::EMPTY);
-                    layout.assign_cell_type(input_i.lower, technology<Lyt>::cell_type::EMPTY);
+                    assign_input_cell(input_i.upper, technology<Lyt>::cell_type::EMPTY);
+                    assign_input_cell(input_i.lower, technology<Lyt>::cell_type::EMPTY);
                 }
             }
         }
     }
+    /**
+     * Assigns the given cell type to the given input cell and records the change in `delta`.
+     *
+     * @param c Input cell to assign.
+     * @param ct Cell type to assign.
+     */
+    void assign_input_cell(const cell<Lyt>& c, const typename technology<Lyt>::cell_type ct) noexcept
+    {
+        const auto was_empty = layout.is_empty_cell(c);
+
+        if (layout.get_cell_type(c) == ct)
+        {
+            return;
+        }
+
+        layout.assign_cell_type(c, ct);
+
+        if (was_empty && !technology<Lyt>::is_empty_cell(ct))
+        {
+            delta.added_sidbs.push_back(c);
+        }
+        else if (!was_empty && technology<Lyt>::is_empty_cell(ct))
+        {
+            delta.removed_sidbs.push_back(c);
+        }
+    }
 };
 
 }  // namespace fiction
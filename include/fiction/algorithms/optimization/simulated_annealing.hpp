@@ -11,8 +11,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <random>
 #include <thread>
 #include <type_traits>
@@ -42,6 +46,276 @@ constexpr auto geometric_temperature_schedule(const double t) noexcept
 {
     return t * 0.99;
 }
+/**
+ * Generates a temperature ladder for `parallel_tempering` whose temperatures increase geometrically from `min_temp` to
+ * `max_temp`, which results in similar exchange acceptance rates between all neighboring replicas if the heat capacity
+ * of the problem is roughly constant.
+ *
+ * @param min_temp The lowest temperature.
+ * @param max_temp The highest temperature.
+ * @param num_replicas The number of temperatures.
+ * @return The temperatures in ascending order.
+ */
+[[nodiscard]] inline std::vector<double> geometric_temperature_ladder(const double min_temp, const double max_temp,
+                                                                      const std::size_t num_replicas) noexcept
+{
+    assert(min_temp > 0.0 && max_temp >= min_temp && "temperatures must be positive and ordered");
+
+    if (num_replicas == 0)
+    {
+        return {};
+    }
+
+    if (num_replicas == 1)
+    {
+        return {min_temp};
+    }
+
+    std::vector<double> temperatures{};
+    temperatures.reserve(num_replicas);
+
+    const auto ratio = std::pow(max_temp / min_temp, 1.0 / static_cast<double>(num_replicas - 1));
+
+    for (std::size_t i = 0; i < num_replicas; ++i)
+    {
+        temperatures.push_back(min_temp * std::pow(ratio, static_cast<double>(i)));
+    }
+
+    return temperatures;
+}
+/**
+ * Random number generator that is used by the Simulated Annealing algorithms in this header file. State generators,
+ * next state functions, and move functions may accept a reference to it as their last argument to draw from the
+ * reproducible random stream of their annealing instance or replica.
+ */
+using simulated_annealing_generator = std::mt19937_64;
+/**
+ * Parameters for the Simulated Annealing algorithms in this header file.
+ */
+struct simulated_annealing_params
+{
+    /**
+     * The maximum number of threads that run annealing instances or replicas concurrently. Instances are assigned to
+     * this bounded pool of threads dynamically. By default, the number of threads is set to the number of available
+     * hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+    /**
+     * Seed for the random number generators. Each annealing instance or replica draws from its own random stream that
+     * is derived from this seed and its index. Hence, results are reproducible and independent of the number of
+     * threads as long as the provided functions only use the passed generator as their source of randomness. If no
+     * seed is given, a random one is used.
+     */
+    std::optional<uint64_t> seed = std::nullopt;
+};
+
+namespace detail
+{
+
+/**
+ * Invokes `f` with `args` and, if `f` accepts it as its last argument, with `generator`.
+ *
+ * @param f Function to invoke.
+ * @param generator Random number generator of the calling annealing instance.
+ * @param args Arguments to pass to `f`.
+ * @return The return value of `f`.
+ */
+template <typename Func, typename... Args>
+decltype(auto) invoke_with_generator(Func&& f, simulated_annealing_generator& generator, Args&&... args)
+{
+    if constexpr (std::is_invocable_v<Func, Args..., simulated_annealing_generator&>)
+    {
+        return std::invoke(std::forward<Func>(f), std::forward<Args>(args)..., generator);
+    }
+    else
+    {
+        return std::invoke(std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+}
+/**
+ * Whether `Func` is invocable with `Args`, optionally followed by a `simulated_annealing_generator` reference.
+ */
+template <typename Func, typename... Args>
+inline constexpr bool is_invocable_with_optional_generator_v =
+    std::is_invocable_v<Func, Args...> || std::is_invocable_v<Func, Args..., simulated_annealing_generator&>;
+/**
+ * The result type of `invoke_with_generator` for `Func` and `Args`.
+ */
+template <typename Func, typename... Args>
+using invoke_with_generator_result_t = decltype(invoke_with_generator(
+    std::declval<Func>(), std::declval<simulated_annealing_generator&>(), std::declval<Args>()...));
+/**
+ * A reusable barrier that blocks the calling threads until a fixed number of threads has arrived. Afterward, the
+ * barrier resets itself for the next phase.
+ */
+class thread_barrier
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param num_threads Number of threads that have to arrive to complete a phase.
+     */
+    explicit thread_barrier(const std::size_t num_threads) noexcept : threshold{num_threads}, remaining{num_threads} {}
+    /**
+     * Blocks the calling thread until all threads have arrived in the current phase.
+     */
+    void arrive_and_wait()
+    {
+        std::unique_lock lock{mutex};
+
+        const auto current_phase = phase;
+
+        if (--remaining == 0)
+        {
+            ++phase;
+            remaining = threshold;
+
+            lock.unlock();
+            phase_completed.notify_all();
+
+            return;
+        }
+
+        phase_completed.wait(lock, [this, current_phase] { return phase != current_phase; });
+    }
+
+  private:
+    /**
+     * Number of threads that have to arrive to complete a phase.
+     */
+    const std::size_t threshold;
+    /**
+     * Number of threads that have not arrived in the current phase yet.
+     */
+    std::size_t remaining;
+    /**
+     * Index of the current phase.
+     */
+    std::size_t phase{0};
+    /**
+     * Mutex that protects the counters.
+     */
+    std::mutex mutex{};
+    /**
+     * Notifies waiting threads about completed phases.
+     */
+    std::condition_variable phase_completed{};
+};
+/**
+ * Decides whether a transition with the given cost change is accepted at temperature `temp` according to the
+ * Metropolis criterion.
+ *
+ * @param cost_delta Cost change of the transition.
+ * @param temp Current temperature.
+ * @param generator Random number generator.
+ * @return `true` iff the transition is accepted.
+ */
+[[nodiscard]] inline bool metropolis_accept(const double cost_delta, const double temp,
+                                            simulated_annealing_generator& generator) noexcept
+{
+    // shortcut to skip the expensive std::exp call
+    if (cost_delta > 10.0 * temp)
+    {
+        return false;  // as std::exp(-10.0) is a very small number
+    }
+
+    // if the new state is worse, accept it with a probability of exp(-energy_delta/temp)
+    return cost_delta <= 0.0 || std::exp(-cost_delta / temp) > std::uniform_real_distribution<double>{0, 1}(generator);
+}
+/**
+ * Current and best state of an annealing instance or replica.
+ *
+ * @tparam State The state type.
+ * @tparam Cost The cost type.
+ */
+template <typename State, typename Cost>
+struct annealing_chain
+{
+    /**
+     * The current state.
+     */
+    State current_state;
+    /**
+     * The cost of the current state.
+     */
+    Cost current_cost;
+    /**
+     * The best state found so far.
+     */
+    State best_state;
+    /**
+     * The cost of the best state.
+     */
+    Cost best_cost;
+    /**
+     * The random number generator of the chain.
+     */
+    simulated_annealing_generator generator;
+};
+/**
+ * Performs `cycles` Metropolis steps at temperature `temp` in which each candidate state is generated by `next` and
+ * evaluated in full by `cost`.
+ *
+ * @param chain The annealing chain to advance.
+ * @param temp The temperature.
+ * @param cycles The number of steps.
+ * @param cost The cost function.
+ * @param next The next state function.
+ */
+template <typename State, typename Cost, typename CostFunc, typename NextFunc>
+void metropolis_steps(annealing_chain<State, Cost>& chain, const double temp, const std::size_t cycles,
+                      CostFunc& cost, NextFunc& next)
+{
+    for (std::size_t c = 0; c < cycles; ++c)
+    {
+        State new_state = invoke_with_generator(next, chain.generator, std::as_const(chain.current_state));
+        auto  new_cost  = cost(new_state);
+
+        if (new_cost < chain.best_cost)
+        {
+            chain.best_state    = new_state;
+            chain.best_cost     = new_cost;
+            chain.current_state = std::move(new_state);
+            chain.current_cost  = std::move(new_cost);
+
+            continue;
+        }
+
+        if (metropolis_accept(static_cast<double>(new_cost - chain.current_cost), temp, chain.generator))
+        {
+            chain.current_state = std::move(new_state);
+            chain.current_cost  = std::move(new_cost);
+        }
+    }
+}
+/**
+ * Runs Simulated Annealing on the given chain from `init_temp` down to `final_temp`.
+ *
+ * @param chain The annealing chain.
+ * @param init_temp The initial temperature.
+ * @param final_temp The final temperature.
+ * @param cycles The number of cycles for each temperature value.
+ * @param cost The cost function.
+ * @param schedule The temperature schedule.
+ * @param next The next state function.
+ */
+template <typename State, typename Cost, typename CostFunc, typename TempFunc, typename NextFunc>
+void anneal(annealing_chain<State, Cost>& chain, const double init_temp, const double final_temp,
+            const std::size_t cycles, CostFunc& cost, TempFunc& schedule, NextFunc& next)
+{
+    auto temp = init_temp;
+
+    while (temp > final_temp)
+    {
+        metropolis_steps(chain, temp, cycles, cost, next);
+
+        // update temperature
+        temp = std::clamp(schedule(temp), final_temp, init_temp);
+    }
+}
+
+}  // namespace detail
 
 /**
  * Simulated Annealing (SA) is a probabilistic optimization algorithm that is used to find a local minimum of a given
@@ -60,7 +334,7 @@ constexpr auto geometric_temperature_schedule(const double t) noexcept
  * @tparam State The state type.
  * @tparam CostFunc The cost function type (specifies the cost type via its return value).
  * @tparam TempFunc The temperature schedule function type.
- * @tparam NextFunc The next state function type.
+ * @tparam NextFunc The next state function type. It may accept a `simulated_annealing_generator&` as second argument.
  * @param init_state The initial state to optimize.
  * @param init_temp The initial temperature.
  * @param final_temp The final temperature.
@@ -68,30 +342,89 @@ constexpr auto geometric_temperature_schedule(const double t) noexcept
  * @param cost The cost function to minimize.
  * @param schedule The temperature schedule.
  * @param next The next state function that determines an adjacent state given a current one.
+ * @param ps Parameters. Only the seed is considered.
  * @return A pair of the optimized state and its cost value.
  */
 template <typename State, typename CostFunc, typename TempFunc, typename NextFunc>
 std::pair<State, std::invoke_result_t<CostFunc, State>>
 simulated_annealing(const State& init_state, const double init_temp, const double final_temp, const std::size_t cycles,
-                    CostFunc&& cost, TempFunc&& schedule, NextFunc&& next) noexcept
+                    CostFunc&& cost, TempFunc&& schedule, NextFunc&& next,
+                    const simulated_annealing_params& ps = {}) noexcept
 {
     static_assert(std::is_invocable_v<CostFunc, State>, "CostFunc must be invocable with objects of type State");
     static_assert(std::is_invocable_v<TempFunc, double>, "TempFunc must be invocable with double");
-    static_assert(std::is_invocable_v<NextFunc, State>, "NextFunc must be invocable with objects of type State");
+    static_assert(detail::is_invocable_with_optional_generator_v<NextFunc, const State&>,
+                  "NextFunc must be invocable with objects of type State");
     static_assert(std::is_signed_v<std::invoke_result_t<CostFunc, State>>, "CostFunc must return a signed value");
     static_assert(std::is_same_v<std::invoke_result_t<TempFunc, double>, double>, "TempFunc must return a double");
-    static_assert(std::is_same_v<State, std::invoke_result_t<NextFunc, State>>,
+    static_assert(std::is_same_v<State, detail::invoke_with_generator_result_t<NextFunc, const State&>>,
                   "NextFunc must return an object of type State");
 
     assert(std::isfinite(init_temp) && "init_temp must be a finite number");
     assert(std::isfinite(final_temp) && "final_temp must be a finite number");
 
-    static std::mt19937_64 generator{std::random_device{}()};
+    const auto init_cost = cost(init_state);
 
-    static std::uniform_real_distribution<double> random_functor(0, 1);
+    detail::annealing_chain<State, std::invoke_result_t<CostFunc, State>> chain{
+        init_state, init_cost, init_state, init_cost,
+        detail::make_stream_generator(detail::seed_or_random(ps.seed), 0)};
 
-    auto current_cost  = cost(init_state);
-    auto current_state = init_state;
+    detail::anneal(chain, init_temp, final_temp, cycles, cost, schedule, next);
+
+    return {std::move(chain.best_state), std::move(chain.best_cost)};
+}
+/**
+ * A variation of Simulated Annealing (SA) that modifies the state in place and evaluates moves incrementally. Instead
+ * of creating a new state and computing its cost from scratch, `move` applies a random modification to the current
+ * state and returns the resulting change in cost. If the move is rejected, `undo` reverts it. The full cost function
+ * is evaluated only once for the initial state. The state is copied only when a new best state is found.
+ *
+ * This variant is preferable over `simulated_annealing` if states are expensive to copy or if the cost change of a
+ * local modification can be computed much faster than the cost of the whole state.
+ *
+ * @tparam State The state type.
+ * @tparam CostFunc The cost function type (specifies the cost type via its return value).
+ * @tparam TempFunc The temperature schedule function type.
+ * @tparam MoveFunc The move function type. It is invoked with a `State&` and, optionally, a
+ * `simulated_annealing_generator&` and must return the cost change as the cost type.
+ * @tparam UndoFunc The undo function type. It is invoked with a `State&`.
+ * @param init_state The initial state to optimize.
+ * @param init_temp The initial temperature.
+ * @param final_temp The final temperature.
+ * @param cycles The number of cycles for each temperature value.
+ * @param cost The cost function to minimize.
+ * @param schedule The temperature schedule.
+ * @param move The move function that modifies the given state in place and returns the cost change.
+ * @param undo The undo function that reverts the most recent move on the given state.
+ * @param ps Parameters. Only the seed is considered.
+ * @return A pair of the optimized state and its cost value.
+ */
+template <typename State, typename CostFunc, typename TempFunc, typename MoveFunc, typename UndoFunc>
+std::pair<State, std::invoke_result_t<CostFunc, State>>
+delta_simulated_annealing(State init_state, const double init_temp, const double final_temp, const std::size_t cycles,
+                          CostFunc&& cost, TempFunc&& schedule, MoveFunc&& move, UndoFunc&& undo,
+                          const simulated_annealing_params& ps = {})
+{
+    using cost_t = std::invoke_result_t<CostFunc, State>;
+
+    static_assert(std::is_invocable_v<CostFunc, State>, "CostFunc must be invocable with objects of type State");
+    static_assert(std::is_invocable_v<TempFunc, double>, "TempFunc must be invocable with double");
+    static_assert(detail::is_invocable_with_optional_generator_v<MoveFunc, State&>,
+                  "MoveFunc must be invocable with references to objects of type State");
+    static_assert(std::is_invocable_v<UndoFunc, State&>,
+                  "UndoFunc must be invocable with references to objects of type State");
+    static_assert(std::is_signed_v<cost_t>, "CostFunc must return a signed value");
+    static_assert(std::is_same_v<std::invoke_result_t<TempFunc, double>, double>, "TempFunc must return a double");
+    static_assert(std::is_convertible_v<detail::invoke_with_generator_result_t<MoveFunc, State&>, cost_t>,
+                  "MoveFunc must return the cost change");
+
+    assert(std::isfinite(init_temp) && "init_temp must be a finite number");
+    assert(std::isfinite(final_temp) && "final_temp must be a finite number");
+
+    auto generator = detail::make_stream_generator(detail::seed_or_random(ps.seed), 0);
+
+    auto current_state = std::move(init_state);
+    auto current_cost  = cost(std::as_const(current_state));
 
     State best_state = current_state;
     auto  best_cost  = current_cost;
@@ -102,32 +435,25 @@ simulated_annealing(const State& init_state, const double init_temp, const doubl
     {
         for (std::size_t c = 0; c < cycles; ++c)
         {
-            State new_state = next(current_state);
-            auto  new_cost  = cost(new_state);
+            const cost_t cost_delta = detail::invoke_with_generator(move, generator, current_state);
+            const cost_t new_cost   = current_cost + cost_delta;
 
             if (new_cost < best_cost)
             {
-                best_state    = new_state;
-                best_cost     = new_cost;
-                current_state = std::move(new_state);
-                current_cost  = std::move(new_cost);
+                best_state   = current_state;
+                best_cost    = new_cost;
+                current_cost = new_cost;
 
                 continue;
             }
 
-            const auto cost_delta = static_cast<double>(new_cost - current_cost);
-
-            // shortcut to skip the expensive std::exp call
-            if (cost_delta > 10.0 * temp)
+            if (detail::metropolis_accept(static_cast<double>(cost_delta), temp, generator))
             {
-                continue;  // as std::exp(-10.0) is a very small number
+                current_cost = new_cost;
             }
-
-            // if the new state is worse, accept it with a probability of exp(-energy_delta/temp)
-            if (cost_delta <= 0.0 || std::exp(-cost_delta / temp) > random_functor(generator))
+            else
             {
-                current_state = std::move(new_state);
-                current_cost  = std::move(new_cost);
+                undo(current_state);
             }
         }
 
@@ -135,22 +461,23 @@ simulated_annealing(const State& init_state, const double init_temp, const doubl
         temp = std::clamp(schedule(temp), final_temp, init_temp);
     }
 
-    return {best_state, best_cost};
+    return {std::move(best_state), best_cost};
 }
 /**
  * This variation of Simulated Annealing (SA) does not start from just one provided initial state, but generates a
  * number of random initial states using a provided random state generator. SA as specified above is then run on all
  * these random initial states where the best result of all generated states is finally returned.
  *
- * @note If compiler support for C++17's execution policies is available, the algorithm is parallelized and/or
- * vectorized using `std::execution::par_unseq`.
+ * The instances are run on a bounded pool of `ps.num_threads` threads. Each instance uses its own random number
+ * generator that is derived from `ps.seed` and the instance index.
  *
  * @note The State type must be default constructible.
  *
- * @tparam RandStateFunc The random state generator function type (specifies the State type via its return value).
+ * @tparam RandStateFunc The random state generator function type (specifies the State type via its return value). It
+ * may accept a `simulated_annealing_generator&`.
  * @tparam CostFunc The cost function type (specifies the cost value via its return value).
  * @tparam TempFunc The temperature schedule function type.
- * @tparam NextFunc The next state function type.
+ * @tparam NextFunc The next state function type. It may accept a `simulated_annealing_generator&` as second argument.
  * @param init_temp The initial temperature.
  * @param final_temp The final temperature.
  * @param cycles The number of cycles for each temperature value.
@@ -159,18 +486,20 @@ simulated_annealing(const State& init_state, const double init_temp, const doubl
  * @param cost The cost function to minimize.
  * @param schedule The temperature schedule.
  * @param next The next state function that determines an adjacent state given a current one.
+ * @param ps Parameters.
  * @return A pair of the overall best optimized state and its cost value.
  */
 template <typename RandStateFunc, typename CostFunc, typename TempFunc, typename NextFunc>
-std::pair<std::invoke_result_t<RandStateFunc>, std::invoke_result_t<CostFunc, std::invoke_result_t<RandStateFunc>>>
+std::pair<detail::invoke_with_generator_result_t<RandStateFunc>,
+          std::invoke_result_t<CostFunc, detail::invoke_with_generator_result_t<RandStateFunc>>>
 multi_simulated_annealing(const double init_temp, const double final_temp, const std::size_t cycles,
                           const std::size_t instances, RandStateFunc&& rand_state, CostFunc&& cost, TempFunc&& schedule,
-                          NextFunc&& next) noexcept
+                          NextFunc&& next, const simulated_annealing_params& ps = {}) noexcept
 {
-    using state_t = std::invoke_result_t<RandStateFunc>;
+    using state_t = detail::invoke_with_generator_result_t<RandStateFunc>;
     using cost_t  = std::invoke_result_t<CostFunc, state_t>;
 
-    static_assert(std::is_invocable_v<RandStateFunc>, "RandStateFunc must be invocable");
+    static_assert(detail::is_invocable_with_optional_generator_v<RandStateFunc>, "RandStateFunc must be invocable");
     static_assert(std::is_invocable_v<CostFunc, state_t>, "CostFunc must be invocable with objects of type State");
     static_assert(std::is_default_constructible_v<state_t>, "State must be default-constructible");
 
@@ -178,30 +507,195 @@ multi_simulated_annealing(const double init_temp, const double final_temp, const
     assert(std::isfinite(final_temp) && "final_temp must be a finite number");
 
     std::vector<std::pair<state_t, cost_t>> results(instances);
-    std::vector<std::thread>                threads{};
-    threads.reserve(instances);
 
-    // Function to perform simulated annealing and store the result in the results vector
-    const auto perform_simulated_annealing =
-        [&results, &init_temp, &final_temp, &cycles, &rand_state, &cost, &schedule, &next](const std::size_t index)
-    { results[index] = simulated_annealing(rand_state(), init_temp, final_temp, cycles, cost, schedule, next); };
+    const auto seed = detail::seed_or_random(ps.seed);
 
-    // Start threads
-    for (std::size_t i = 0; i < instances; i++)
-    {
-        threads.emplace_back(perform_simulated_annealing, i);
-    }
+    // performs simulated annealing from a random initial state and stores the result in the results vector
+    detail::run_on_bounded_threads(
+        instances, ps.num_threads,
+        [&](const std::size_t index)
+        {
+            auto generator = detail::make_stream_generator(seed, index);
 
-    // Join threads (wait for all threads to finish)
-    for (auto& thread : threads)
-    {
-        thread.join();
-    }
+            auto       init_state = detail::invoke_with_generator(rand_state, generator);
+            const auto init_cost  = cost(init_state);
+
+            detail::annealing_chain<state_t, cost_t> chain{init_state, init_cost, init_state, init_cost,
+                                                           std::move(generator)};
+
+            detail::anneal(chain, init_temp, final_temp, cycles, cost, schedule, next);
+
+            results[index] = {std::move(chain.best_state), std::move(chain.best_cost)};
+        });
 
     // Find the minimum result
     return *std::min_element(FICTION_EXECUTION_POLICY_PAR_UNSEQ results.cbegin(), results.cend(),
                              [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
 }
+/**
+ * Parallel tempering, also known as replica exchange Monte Carlo, runs one replica of the optimization problem at each
+ * temperature of a fixed temperature ladder. After every `cycles` Metropolis steps, which the replicas perform in
+ * parallel, neighboring replicas attempt to exchange their states with probability \f$\min\left(1,
+ * e^{(1/T_i - 1/T_j)(E_i - E_j)}\right)\f$. Thereby, good states found by hot replicas, which explore the search space
+ * freely, migrate to cold replicas, which refine them, while states trapped in local minima can escape via the hot
+ * replicas. In contrast to Simulated Annealing, no temperature schedule has to be tuned.
+ *
+ * The replicas are distributed among a pool of at most `ps.num_threads` threads that is kept alive for all exchange
+ * rounds. Each thread advances a fixed group of replicas and the threads synchronize at a barrier before and after
+ * each exchange round. Each replica uses its own random number generator that is derived from `ps.seed` and the
+ * replica index; exchanges are decided by an additional generator. Hence, the result is reproducible independent of
+ * the number of threads.
+ *
+ * @note The State type must be default constructible.
+ *
+ * @tparam RandStateFunc The random state generator function type (specifies the State type via its return value). It
+ * may accept a `simulated_annealing_generator&`.
+ * @tparam CostFunc The cost function type (specifies the cost value via its return value).
+ * @tparam NextFunc The next state function type. It may accept a `simulated_annealing_generator&` as second argument.
+ * @param temperatures The temperature of each replica, preferably in ascending order.
+ * @param exchanges The number of exchange rounds.
+ * @param cycles The number of Metropolis steps of each replica between two exchange rounds.
+ * @param rand_state The random state generator function that creates the initial state of each replica.
+ * @param cost The cost function to minimize.
+ * @param next The next state function that determines an adjacent state given a current one.
+ * @param ps Parameters.
+ * @return A pair of the best state found by any replica and its cost value.
+ */
+template <typename RandStateFunc, typename CostFunc, typename NextFunc>
+std::pair<detail::invoke_with_generator_result_t<RandStateFunc>,
+          std::invoke_result_t<CostFunc, detail::invoke_with_generator_result_t<RandStateFunc>>>
+parallel_tempering(const std::vector<double>& temperatures, const std::size_t exchanges, const std::size_t cycles,
+                   RandStateFunc&& rand_state, CostFunc&& cost, NextFunc&& next,
+                   const simulated_annealing_params& ps = {})
+{
+    using state_t = detail::invoke_with_generator_result_t<RandStateFunc>;
+    using cost_t  = std::invoke_result_t<CostFunc, state_t>;
+
+    static_assert(detail::is_invocable_with_optional_generator_v<RandStateFunc>, "RandStateFunc must be invocable");
+    static_assert(std::is_invocable_v<CostFunc, state_t>, "CostFunc must be invocable with objects of type State");
+    static_assert(std::is_signed_v<cost_t>, "CostFunc must return a signed value");
+    static_assert(std::is_default_constructible_v<state_t>, "State must be default-constructible");
+    static_assert(detail::is_invocable_with_optional_generator_v<NextFunc, const state_t&>,
+                  "NextFunc must be invocable with objects of type State");
+
+    assert(!temperatures.empty() && "at least one temperature is required");
+    assert(std::all_of(temperatures.cbegin(), temperatures.cend(), [](const auto t) { return t > 0.0; }) &&
+           "temperatures must be positive");
+
+    const auto seed         = detail::seed_or_random(ps.seed);
+    const auto num_replicas = temperatures.size();
+
+    std::vector<detail::annealing_chain<state_t, cost_t>> replicas(num_replicas);
+
+    // creates the initial state of replica i
+    const auto initialize = [&](const std::size_t i)
+    {
+        auto& replica     = replicas[i];
+        replica.generator = detail::make_stream_generator(seed, i);
+
+        replica.current_state = detail::invoke_with_generator(rand_state, replica.generator);
+        replica.current_cost  = cost(replica.current_state);
+        replica.best_state    = replica.current_state;
+        replica.best_cost     = replica.current_cost;
+    };
+
+    // decides on the exchanges between neighboring replicas
+    auto exchange_generator = detail::make_stream_generator(seed, num_replicas);
+
+    // attempts the exchanges of the given round
+    const auto exchange = [&](const std::size_t round)
+    {
+        // alternate between even and odd pairs such that each pair is attempted every other round
+        for (auto i = round % 2; i + 1 < num_replicas; i += 2)
+        {
+            auto& lhs = replicas[i];
+            auto& rhs = replicas[i + 1];
+
+            const auto exponent = (1.0 / temperatures[i] - 1.0 / temperatures[i + 1]) *
+                                  static_cast<double>(lhs.current_cost - rhs.current_cost);
+
+            if (exponent >= 0.0 ||
+                std::exp(exponent) > std::uniform_real_distribution<double>{0, 1}(exchange_generator))
+            {
+                std::swap(lhs.current_state, rhs.current_state);
+                std::swap(lhs.current_cost, rhs.current_cost);
+            }
+        }
+    };
+
+    const auto num_workers = std::min(std::max(ps.num_threads, std::size_t{1}), num_replicas);
+
+    if (num_workers <= 1)
+    {
+        for (std::size_t i = 0; i < num_replicas; ++i)
+        {
+            initialize(i);
+        }
+
+        for (std::size_t round = 0; round < exchanges; ++round)
+        {
+            for (std::size_t i = 0; i < num_replicas; ++i)
+            {
+                detail::metropolis_steps(replicas[i], temperatures[i], cycles, cost, next);
+            }
+
+            exchange(round);
+        }
+    }
+    else
+    {
+        detail::thread_barrier barrier{num_workers};
+
+        // worker w advances the replicas w, w + num_workers, ... and worker 0 additionally conducts the exchanges
+        const auto worker = [&](const std::size_t w)
+        {
+            for (auto i = w; i < num_replicas; i += num_workers)
+            {
+                initialize(i);
+            }
+
+            for (std::size_t round = 0; round < exchanges; ++round)
+            {
+                for (auto i = w; i < num_replicas; i += num_workers)
+                {
+                    detail::metropolis_steps(replicas[i], temperatures[i], cycles, cost, next);
+                }
+
+                // all replicas have to finish their steps before states are exchanged
+                barrier.arrive_and_wait();
+
+                if (w == 0)
+                {
+                    exchange(round);
+                }
+
+                // no replica may continue before the exchanges are complete
+                barrier.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_workers - 1);
+
+        for (std::size_t w = 1; w < num_workers; ++w)
+        {
+            threads.emplace_back(worker, w);
+        }
+
+        // the calling thread acts as worker 0
+        worker(0);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    const auto best = std::min_element(replicas.cbegin(), replicas.cend(),
+                                       [](const auto& lhs, const auto& rhs) { return lhs.best_cost < rhs.best_cost; });
+
+    return {best->best_state, best->best_cost};
+}
 
 }  // namespace fiction
 
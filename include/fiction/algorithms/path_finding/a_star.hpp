@@ -8,6 +8,7 @@
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/profiling.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
 
@@ -403,6 +404,8 @@ template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost =
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
+    FICTION_PROFILE_SCOPE("a_star");
+
     return detail::a_star_impl<Path, Lyt, Dist, Cost>{layout, objective, dist_fn, cost_fn, params}.run();
 }
 /**
@@ -8,7 +8,10 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
-#include <phmap.h>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <vector>
 
 namespace fiction
 {
@@ -24,35 +27,88 @@ struct enumerate_all_paths_params
     bool crossings = false;
 };
 
-namespace detail
-{
-
+/**
+ * A lazy generator for all paths in a layout that start at a given source coordinate and lead to a given target
+ * coordinate. Paths are generated one at a time on demand via `next()` in the same order in which
+ * `enumerate_all_paths` returns them. Thus, callers that only require a subset of all paths, e.g., because they stop
+ * after a certain number of paths or after finding a path with a desired property, neither have to wait for nor store
+ * the remaining ones.
+ *
+ * The generator implements a depth-first search with an explicit stack instead of recursion. Thereby, its memory
+ * consumption is linear in the length of the longest path and independent of the number of paths. Coordinates along
+ * the current path are tracked in a `coordinate_set`, which is a bitset over the layout's coordinates if `Lyt` uses
+ * `offset::ucoord_t`.
+ *
+ * See `enumerate_all_paths` for a description of the generated paths. The layout must outlive the generator and must
+ * not be modified while paths are generated.
+ *
+ * @tparam Path Type of the generated paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ */
 template <typename Path, typename Lyt>
-class enumerate_all_paths_impl
+class all_paths_enumerator
 {
   public:
-    enumerate_all_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const enumerate_all_paths_params& p) :
-            layout{lyt},
-            objective{obj},
-            params{p}
-    {}
-
     /**
-     * Enumerate all possible paths in a layout that start at `objective.source` and lead to `objective.target`.
+     * Standard constructor.
      *
-     * @return A collection of all unique paths in `layout` from `objective.source` to `objective.target`.
+     * @param lyt The layout whose paths are to be enumerated.
+     * @param obj Source-target coordinate pair.
+     * @param p Parameters.
      */
-    [[nodiscard]] path_collection<Path> run() noexcept
+    all_paths_enumerator(const Lyt& lyt, const routing_objective<Lyt>& obj, const enumerate_all_paths_params& p = {}) :
+            layout{lyt},
+            objective{obj},
+            params{p},
+            visited{lyt}
     {
+        static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
         assert(!objective.source.is_dead() && !objective.target.is_dead() &&
                "Neither source nor target coordinate can be dead");
 
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
+    }
+    /**
+     * Generates the next path from `objective.source` to `objective.target`.
+     *
+     * @return The next path or `std::nullopt` if all paths have been generated already.
+     */
+    [[nodiscard]] std::optional<Path> next() noexcept
+    {
+        if (!started)
+        {
+            started = true;
+
+            if (push(objective.source))
+            {
+                return current_path;
+            }
+        }
+
+        while (!stack.empty())
+        {
+            auto& frame = stack.back();
+
+            // descend into the next successor that is not part of the current path yet
+            if (frame.next_successor < frame.successors.size())
+            {
+                // copy the successor since push invalidates the reference to frame
+                const auto successor = frame.successors[frame.next_successor++];
 
-        recursively_enumerate_all_paths(objective.source, objective.target, Path{});
+                if (!visited.contains(successor) && push(successor))
+                {
+                    return current_path;
+                }
+            }
+            else  // all successors have been explored
+            {
+                pop();
+            }
+        }
 
-        return collection;
+        return std::nullopt;
     }
 
   private:
@@ -69,141 +125,143 @@ class enumerate_all_paths_impl
      */
     const enumerate_all_paths_params params;
     /**
-     * Set of visited coordinates.
+     * A coordinate on the current path together with its successors and the index of the next one to explore.
      */
-    phmap::flat_hash_set<coordinate<Lyt>> visited{};
+    struct stack_frame
+    {
+        /**
+         * Coordinate on the current path.
+         */
+        coordinate<Lyt> coord;
+        /**
+         * Successors of `coord` that are neither obstructed nor reachable only via an obstructed connection.
+         */
+        std::vector<coordinate<Lyt>> successors;
+        /**
+         * Index of the next successor to explore.
+         */
+        std::size_t next_successor;
+    };
     /**
-     * Collection of all enumerated paths.
+     * Depth-first search stack that contains one frame for each coordinate of the current path.
      */
-    path_collection<Path> collection{};
+    std::vector<stack_frame> stack{};
     /**
-     * Mark a coordinate as visited.
-     *
-     * @param c Coordinate to mark as visited.
+     * The current path from `objective.source` to the coordinate on top of the stack.
      */
-    void mark_visited(const coordinate<Lyt>& c) noexcept
-    {
-        visited.insert(c);
-    }
+    Path current_path{};
+    /**
+     * Set of coordinates on the current path.
+     */
+    coordinate_set<Lyt> visited;
     /**
-     * Mark a coordinate as unvisited.
+     * Flag to indicate whether the source coordinate has been pushed already.
+     */
+    bool started{false};
+    /**
+     * Appends the given coordinate to the current path and pushes its successors onto the stack. If the coordinate is
+     * the target, the current path is complete and no successors are pushed.
      *
-     * @param c Coordinate to mark as unvisited.
+     * @param c Coordinate to append to the current path.
+     * @return `true` iff `c` is the target coordinate.
      */
-    void mark_unvisited(const coordinate<Lyt>& c) noexcept
+    bool push(const coordinate<Lyt>& c) noexcept
     {
-        visited.erase(c);
+        visited.insert(c);
+        current_path.append(c);
+
+        const auto is_target = c == objective.target;
+
+        stack.push_back({c, is_target ? std::vector<coordinate<Lyt>>{} : successors(c), 0ul});
+
+        return is_target;
     }
     /**
-     * Check if a coordinate has been visited.
-     *
-     * @param c Coordinate to check.
-     * @return `true` if the coordinate has been visited, `false` otherwise.
+     * Removes the top coordinate from the current path and the stack and marks it as unvisited to allow it in other
+     * paths.
      */
-    [[nodiscard]] bool is_visited(const coordinate<Lyt>& c) const noexcept
+    void pop() noexcept
     {
-        return visited.count(c) > 0;
+        visited.erase(stack.back().coord);
+        current_path.pop_back();
+        stack.pop_back();
     }
     /**
-     * Recursively enumerate all paths from `src` to `tgt` in the given layout. This function is called recursively
-     * until the target coordinate is reached. Along each path, each coordinate can occur at maximum once. This function
-     * does not generate duplicate or looping paths. If the given layout implements the obstruction interface (see
-     * `obstruction_layout`), paths will not be routed via obstructed coordinates or connections. If the given layout is
-     * a gate-level layout and implements the obstruction interface (see `obstruction_layout`), paths may contain wire
-     * crossings if specified in the parameters. Wire crossings are only allowed over other wires and only if the
-     * crossing layer is not obstructed. Furthermore, it is ensured that crossings do not run along another wire but
-     * cross only in a single point (orthogonal crossings + knock-knees/double wires).
+     * Collects the successors of coordinate `src` that paths can be extended by. If the given layout implements the
+     * obstruction interface (see `obstruction_layout`), obstructed coordinates and connections are skipped. If the
+     * given layout is a gate-level layout and implements the obstruction interface (see `obstruction_layout`),
+     * successors may be located in the crossing layer if specified in the parameters. Wire crossings are only allowed
+     * over other wires and only if the crossing layer is not obstructed. Furthermore, it is ensured that crossings do
+     * not run along another wire but cross only in a single point (orthogonal crossings + knock-knees/double wires).
      *
-     * @param src Source coordinate.
-     * @param tgt Target coordinate.
-     * @param p Current path to extend.
+     * @param src Coordinate whose successors are to be collected.
+     * @return All coordinates that paths ending in `src` can be extended by.
      */
-    void recursively_enumerate_all_paths(const coordinate<Lyt>& src, const coordinate<Lyt>& tgt, Path p) noexcept
+    [[nodiscard]] std::vector<coordinate<Lyt>> successors(const coordinate<Lyt>& src) const noexcept
     {
-        // mark source coordinate as visited and append it to the path
-        mark_visited(src);
-        p.append(src);
+        std::vector<coordinate<Lyt>> succ{};
 
-        // if source and target are identical, a path has been found
-        if (src == tgt)
+        const auto explore_successor = [this, &src, &succ](auto successor)  // make a copy
+            noexcept
         {
-            collection.add(p);
-        }
-        else  // destination is not reached yet
-        {
-            const auto explore_successor = [&, this](auto successor)  // make a copy
-                noexcept
-            {
-                // return to ground layer to avoid getting stuck in crossing layer
-                successor = layout.below(successor);
+            // return to ground layer to avoid getting stuck in crossing layer
+            successor = layout.below(successor);
 
-                // check if successor is obstructed
-                if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+            // check if successor is obstructed
+            if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+            {
+                if (layout.is_obstructed_coordinate(successor) && successor != objective.target)
                 {
-                    if (layout.is_obstructed_coordinate(successor) && successor != tgt)
+                    // if crossings are enabled, check if it is possible to switch to the crossing layer
+                    if (params.crossings && is_crossable_wire(layout, src, successor))
                     {
-                        // if crossings are enabled, check if it is possible to switch to the crossing layer
-                        if (params.crossings && is_crossable_wire(layout, src, successor))
+                        // if the crossing layer is not obstructed
+                        if (const auto above_successor = layout.above(successor);
+                            above_successor != successor && above_successor != objective.target &&
+                            !layout.is_obstructed_coordinate(above_successor))
                         {
-                            // if the crossing layer is not obstructed
-                            if (const auto above_successor = layout.above(successor);
-                                above_successor != successor && above_successor != tgt &&
-                                !layout.is_obstructed_coordinate(above_successor))
-                            {
-                                // allow exploring the crossing layer
-                                successor = above_successor;
-                            }
-                            else
-                            {
-                                return;  // skip the obstructed coordinate and keep looping
-                            }
+                            // allow exploring the crossing layer
+                            successor = above_successor;
                         }
                         else
                         {
                             return;  // skip the obstructed coordinate and keep looping
                         }
                     }
-                }
-
-                // check if the connection to the successor is obstructed
-                if constexpr (has_is_obstructed_connection_v<Lyt>)
-                {
-                    if (layout.is_obstructed_connection(src, successor))
+                    else
                     {
-                        return;  // skip the obstructed connection and keep looping
+                        return;  // skip the obstructed coordinate and keep looping
                     }
                 }
+            }
 
-                // if the successor has not yet been visited
-                if (!is_visited(successor))
+            // check if the connection to the successor is obstructed
+            if constexpr (has_is_obstructed_connection_v<Lyt>)
+            {
+                if (layout.is_obstructed_connection(src, successor))
                 {
-                    // recurse
-                    recursively_enumerate_all_paths(successor, tgt, p);
+                    return;  // skip the obstructed connection and keep looping
                 }
+            }
 
-                return;  // keep looping
-            };
+            succ.push_back(successor);
+        };
 
-            if constexpr (is_clocked_layout_v<Lyt>)
-            {
-                // recurse for all outgoing clock zones
-                layout.foreach_outgoing_clocked_zone(src, explore_successor);
-            }
-            else
-            {
-                // recurse for all adjacent coordinates
-                layout.foreach_adjacent_coordinate(src, explore_successor);
-            }
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            // explore all outgoing clock zones
+            layout.foreach_outgoing_clocked_zone(src, explore_successor);
+        }
+        else
+        {
+            // explore all adjacent coordinates
+            layout.foreach_adjacent_coordinate(src, explore_successor);
         }
 
-        // after recursion, remove current coordinate from path and mark it as unvisited to allow it in other paths
-        p.pop_back();
-        mark_unvisited(src);
+        return succ;
     }
 };
 
-}  // namespace detail
-
 /**
  * Enumerates all possible paths in a layout that start at a given source coordinate and lead to given target
  * coordinate. This function automatically detects whether the given layout implements a clocking interface (see
@@ -228,6 +286,9 @@ class enumerate_all_paths_impl
  * auto all_paths = enumerate_all_paths<path>(static_cast<cartesian_layout<>>(layout), {source, target});
  * @endcode
  *
+ * The number of paths grows exponentially with the size of the layout. If not all of them are needed, consider
+ * generating them on demand via `all_paths_enumerator` instead.
+ *
  * @tparam Path Type of the returned individual paths.
  * @tparam Lyt Type of the layout to perform path finding on.
  * @param layout The layout whose paths are to be enumerated.
@@ -241,7 +302,16 @@ template <typename Path, typename Lyt>
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::enumerate_all_paths_impl<Path, Lyt>{layout, objective, params}.run();
+    path_collection<Path> collection{};
+
+    all_paths_enumerator<Path, Lyt> enumerator{layout, objective, params};
+
+    while (auto p = enumerator.next())
+    {
+        collection.add(*p);
+    }
+
+    return collection;
 }
 
 }  // namespace fiction
@@ -9,12 +9,20 @@
 #include "fiction/algorithms/path_finding/distance.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
+#include <phmap.h>
+
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <future>
 #include <iterator>
+#include <optional>
+#include <queue>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -30,11 +38,83 @@ struct yen_k_shortest_paths_params
      * Parameters for the internal A* algorithm.
      */
     a_star_params astar_params{};
+    /**
+     * Number of threads to use for the spur searches. The spur searches of each iteration are independent of each other
+     * and are distributed among the threads. Since the resulting candidate paths are collected in spur order, the
+     * returned paths do not depend on the number of threads. By default, the number of threads is set to the number of
+     * available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 namespace detail
 {
 
+/**
+ * Layers the temporary obstructions of a single spur search on top of a layout that implements the obstruction
+ * interface. In contrast to obstructing coordinates and connections in the layout itself, the layout is not modified.
+ * Hence, multiple spur searches can be conducted concurrently on the same layout.
+ *
+ * @tparam Lyt Coordinate layout type that implements the obstruction interface.
+ */
+template <typename Lyt>
+class spur_obstruction_layout : public Lyt
+{
+  public:
+    /**
+     * Set of temporarily obstructed coordinates.
+     */
+    using coordinate_obstructions = phmap::flat_hash_set<coordinate<Lyt>>;
+    /**
+     * Set of temporarily obstructed connections.
+     */
+    using connection_obstructions = phmap::flat_hash_set<std::pair<coordinate<Lyt>, coordinate<Lyt>>>;
+    /**
+     * Standard constructor.
+     *
+     * @param lyt Layout to layer the temporary obstructions on top of.
+     * @param coords Temporarily obstructed coordinates. Must outlive this layout.
+     * @param conns Temporarily obstructed connections. Must outlive this layout.
+     */
+    spur_obstruction_layout(const Lyt& lyt, const coordinate_obstructions& coords,
+                            const connection_obstructions& conns) :
+            Lyt(lyt),
+            obstructed_coordinates{coords},
+            obstructed_connections{conns}
+    {}
+    /**
+     * Checks if the given coordinate is temporarily obstructed or obstructed in the underlying layout.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is obstructed.
+     */
+    [[nodiscard]] bool is_obstructed_coordinate(const coordinate<Lyt>& c) const noexcept
+    {
+        return obstructed_coordinates.count(c) > 0 || Lyt::is_obstructed_coordinate(c);
+    }
+    /**
+     * Checks if the given connection is temporarily obstructed or obstructed in the underlying layout.
+     *
+     * @param src Source coordinate.
+     * @param tgt Target coordinate.
+     * @return `true` iff the connection from `src` to `tgt` is obstructed.
+     */
+    [[nodiscard]] bool is_obstructed_connection(const coordinate<Lyt>& src, const coordinate<Lyt>& tgt) const noexcept
+    {
+        return obstructed_connections.count({src, tgt}) > 0 || Lyt::is_obstructed_connection(src, tgt);
+    }
+
+  private:
+    /**
+     * Temporarily obstructed coordinates.
+     */
+    const coordinate_obstructions& obstructed_coordinates;
+    /**
+     * Temporarily obstructed connections.
+     */
+    const connection_obstructions& obstructed_connections;
+};
+
 template <typename Path, typename Lyt>
 class yen_k_shortest_paths_impl
 {
@@ -71,70 +151,23 @@ class yen_k_shortest_paths_impl
             return {};
         }
 
+        // the distances to the target are shared by all spur searches
+        if (num_shortest_paths > 1)
+        {
+            compute_target_distances();
+        }
+
         // for the number of shortest paths k
         for (uint32_t k = 1; k < num_shortest_paths; ++k)
         {
-            const auto& latest_path = k_shortest_paths[k - 1];
-
-            // for all coordinates of the latest path except the last one
-            for (uint32_t i = 0; i < static_cast<int64_t>(latest_path.size()) - 1; ++i)
+            // determine the spur paths for all coordinates of the latest path except the last one
+            for (auto& spur_path : spur_paths(k_shortest_paths[k - 1]))
             {
-                // create a spur, which is the ith coordinate of the latest path
-                const auto spur = latest_path[i];
-
-                // the root path is the path from the source to the spur coordinate
-                Path root_path{latest_path.cbegin(), latest_path.cbegin() + i};
-
-                // for all previous paths
-                for (const auto& p : k_shortest_paths)
-                {
-                    // if the root path is equal to a previous partial path
-                    if (p.size() >= i && std::equal(root_path.cbegin(), root_path.cend(), p.cbegin(), p.cbegin() + i))
-                    {
-                        // block the connection that was already used in the previous shortest path
-                        layout.obstruct_connection(p[i], p[i + 1]);
-                        // store connection for later clearing
-                        temporarily_obstructed_connections.push_back({p[i], p[i + 1]});
-                    }
-                }
-
-                // for all coordinates in the root path...
-                for (const auto& root : root_path)
-                {
-                    // ... that are not the spur
-                    if (root != spur)
-                    {
-                        // block them from further exploration
-                        layout.obstruct_coordinate(root);
-                        // store coordinate for later clearing
-                        temporarily_obstructed_coordinates.push_back(root);
-                    }
-                }
-
-                // find an alternative path from the spur coordinate to the target and check that it is not empty
-                if (const auto spur_path =
-                        a_star<Path>(layout, {spur, objective.target},
-                                     manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
-                                     unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), params.astar_params);
-                    !spur_path.empty())
+                // if the candidates do not already contain the path, it is a potential k-shortest path
+                if (!spur_path.empty())  // NOTE a contains check needs to be added back in if no set is used here
                 {
-                    // the final path will be a concatenation of the root path and the spur path
-                    auto& final_path = root_path;
-                    // allocate more memory for the final path (prepare concatenation)
-                    final_path.reserve(root_path.size() + spur_path.size());
-                    // concatenate root path and spur path to get the final path
-                    final_path.insert(final_path.end(), std::make_move_iterator(spur_path.begin()),
-                                      std::make_move_iterator(spur_path.end()));
-
-                    // if the candidates do not already contain the path, it is a potential k-shortest path
-                    if (!final_path.empty())  // NOTE a contains check needs to be added back in if no set is used here
-                    {
-                        shortest_path_candidates.add(final_path);
-                    }
+                    shortest_path_candidates.add(spur_path);
                 }
-
-                // clear obstructions again (prepare for the next potential path)
-                reset_temporary_obstructions();
             }
 
             // if there were no spur paths or if all spur paths have been added to k_shortest_paths already
@@ -161,7 +194,11 @@ class yen_k_shortest_paths_impl
     /**
      * The layout in which k shortest paths are to be found extended by an obstruction functionality layer.
      */
-    obstruction_layout<Lyt> layout;
+    const obstruction_layout<Lyt> layout;
+    /**
+     * The layout type on which spur searches are conducted.
+     */
+    using spur_layout = spur_obstruction_layout<obstruction_layout<Lyt>>;
     /**
      * Source and target coordinates.
      */
@@ -183,13 +220,21 @@ class yen_k_shortest_paths_impl
      */
     path_set<Path> shortest_path_candidates{};
     /**
-     * A temporary storage for coordinates that are obstructed during the algorithm.
+     * Length of the shortest path from each ground layer coordinate to the target's ground layer coordinate if the
+     * temporary obstructions of spur searches are disregarded. Coordinates that cannot reach the target are not
+     * contained.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, uint64_t> target_distances{};
+    /**
+     * A value that exceeds all distances in `target_distances`. It is used as the distance of coordinates that cannot
+     * reach the target.
      */
-    std::vector<coordinate<Lyt>> temporarily_obstructed_coordinates{};
+    uint64_t unreachable_distance{0};
     /**
-     * A temporary storage for coordinates that are obstructed during the algorithm.
+     * Minimum number of spur searches per thread. Fewer spur searches are conducted sequentially since the overhead of
+     * launching threads would outweigh the benefits.
      */
-    std::vector<std::pair<coordinate<Lyt>, coordinate<Lyt>>> temporarily_obstructed_connections{};
+    static constexpr std::size_t min_spurs_per_thread = 8ul;
     /**
      * Computes the cost of a path. This function can be adjusted to fetch paths of differing costs.
      *
@@ -203,21 +248,276 @@ class yen_k_shortest_paths_impl
         return p.size();
     }
     /**
-     * Resets all temporary obstructions.
+     * Applies the given function to all coordinates that can be reached from `c` in a single step.
+     *
+     * @tparam SpurLyt Layout type.
+     * @tparam Fn Functor type.
+     * @param lyt Layout.
+     * @param c Coordinate whose successors are to be visited.
+     * @param fn Functor to apply to each successor.
+     */
+    template <typename SpurLyt, typename Fn>
+    static void foreach_successor(const SpurLyt& lyt, const coordinate<Lyt>& c, Fn&& fn) noexcept
+    {
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            lyt.foreach_outgoing_clocked_zone(c, std::forward<Fn>(fn));
+        }
+        else
+        {
+            lyt.foreach_adjacent_coordinate(c, std::forward<Fn>(fn));
+        }
+    }
+    /**
+     * Determines the distances of all ground layer coordinates to the target via a reverse breadth-first search from
+     * the target. If crossings are disabled, the search respects the obstructions of the layout. Obstructed coordinates
+     * are assigned a distance, since they can act as a spur, but paths are not extended through them. If crossings are
+     * enabled, obstructed coordinates might be crossed and, therefore, all obstructions are disregarded. Since the
+     * temporary obstructions of spur searches can only make paths longer, these distances are lower bounds for the
+     * lengths of all spur paths and, thus, an admissible and consistent heuristic for A*. Unlike the Manhattan
+     * distance, they respect the information flow imposed by the clocking scheme.
      */
-    void reset_temporary_obstructions() noexcept
+    void compute_target_distances() noexcept
     {
-        for (const auto& c : temporarily_obstructed_coordinates)
+        const auto target = layout.below(objective.target);
+
+        std::queue<coordinate<Lyt>> queue{};
+
+        target_distances[target] = 0;
+        queue.push(target);
+
+        while (!queue.empty())
         {
-            layout.clear_obstructed_coordinate(c);
+            const auto current  = queue.front();
+            const auto distance = target_distances.at(current);
+
+            queue.pop();
+
+            const auto explore_predecessor = [this, &queue, &current, distance](const auto& pred)
+            {
+                const auto predecessor = layout.below(pred);
+
+                if (!params.astar_params.crossings && layout.is_obstructed_connection(predecessor, current))
+                {
+                    return;  // skip the obstructed connection
+                }
+
+                if (const auto [it, inserted] = target_distances.try_emplace(predecessor, distance + 1);
+                    inserted && (params.astar_params.crossings || !layout.is_obstructed_coordinate(predecessor)))
+                {
+                    queue.push(it->first);
+                }
+            };
+
+            if constexpr (is_clocked_layout_v<Lyt>)
+            {
+                layout.foreach_incoming_clocked_zone(current, explore_predecessor);
+            }
+            else
+            {
+                layout.foreach_adjacent_coordinate(current, explore_predecessor);
+            }
+
+            unreachable_distance = std::max(unreachable_distance, distance + 1);
         }
-        for (const auto& c : temporarily_obstructed_connections)
+    }
+    /**
+     * Returns the distance of the given coordinate to the target as determined by `compute_target_distances`.
+     *
+     * @param c Coordinate whose distance to the target is desired.
+     * @return Lower bound for the length of a path from `c` to the target or `unreachable_distance` if there is none.
+     */
+    [[nodiscard]] uint64_t target_distance(const coordinate<Lyt>& c) const noexcept
+    {
+        if (const auto it = target_distances.find(layout.below(c)); it != target_distances.cend())
+        {
+            return it->second;
+        }
+
+        return unreachable_distance;
+    }
+    /**
+     * Attempts to construct a shortest path from `spur` to the target by following strictly decreasing distances to
+     * the target without searching. If the resulting path avoids all obstructions, it is a shortest path in `lyt`
+     * because its length equals the lower bound given by `target_distance`.
+     *
+     * @param lyt Layout with the temporary obstructions of the current spur.
+     * @param spur Spur coordinate.
+     * @return A shortest path from `spur` to the target or an empty path if the distances lead into an obstruction.
+     */
+    [[nodiscard]] Path follow_target_distances(const spur_layout& lyt, const coordinate<Lyt>& spur) const noexcept
+    {
+        // paths into the crossing layer require A*'s crossing rules
+        if (objective.target != layout.below(objective.target))
+        {
+            return {};
+        }
+
+        Path path{};
+        path.append(spur);
+
+        auto current = spur;
+
+        for (auto distance = target_distance(spur); distance > 0; --distance)
+        {
+            std::optional<coordinate<Lyt>> next{};
+
+            foreach_successor(lyt, current,
+                              [this, &lyt, &current, &next, distance](const auto& successor)
+                              {
+                                  const auto s = lyt.below(successor);
+
+                                  if (!next.has_value() && target_distance(s) == distance - 1 &&
+                                      (s == objective.target || !lyt.is_obstructed_coordinate(s)) &&
+                                      !lyt.is_obstructed_connection(current, s))
+                                  {
+                                      next = s;
+                                  }
+                              });
+
+            if (!next.has_value())
+            {
+                return {};
+            }
+
+            path.append(*next);
+            current = *next;
+        }
+
+        return current == objective.target ? path : Path{};
+    }
+    /**
+     * Determines the path that deviates from `latest_path` at its `i`th coordinate, the spur. That is, the returned
+     * path shares the first `i` coordinates (the root path) with `latest_path` but continues from the spur with a
+     * shortest path to the target that neither revisits the root path nor uses a connection from the spur that a
+     * previously found path with the same root path already used.
+     *
+     * This function does not modify any state and can, thus, be called concurrently.
+     *
+     * @param latest_path The most recently found shortest path.
+     * @param i Index of the spur coordinate in `latest_path`.
+     * @return The concatenation of the root path and the spur path or an empty path if no spur path exists.
+     */
+    [[nodiscard]] Path spur_path(const Path& latest_path, const std::size_t i) const noexcept
+    {
+        // create a spur, which is the ith coordinate of the latest path
+        const auto spur = latest_path[i];
+
+        // if the spur cannot reach the target even without obstructions, there is nothing to search for
+        if (target_distance(spur) == unreachable_distance)
+        {
+            return {};
+        }
+
+        // the root path is the path from the source to the spur coordinate
+        Path root_path{latest_path.cbegin(), latest_path.cbegin() + static_cast<std::ptrdiff_t>(i)};
+
+        typename spur_layout::coordinate_obstructions obstructed_coordinates{};
+        typename spur_layout::connection_obstructions obstructed_connections{};
+
+        // for all previous paths
+        for (const auto& p : k_shortest_paths)
+        {
+            // if the root path and the spur are equal to a previous partial path
+            if (p.size() > i + 1 && std::equal(root_path.cbegin(), root_path.cend(), p.cbegin()) && p[i] == spur)
+            {
+                // block the connection from the spur that was already used in the previous shortest path
+                obstructed_connections.insert({p[i], p[i + 1]});
+            }
+        }
+
+        // for all coordinates in the root path...
+        for (const auto& root : root_path)
+        {
+            // ... that are not the spur
+            if (root != spur)
+            {
+                // block them from further exploration
+                obstructed_coordinates.insert(root);
+            }
+        }
+
+        const spur_layout lyt{layout, obstructed_coordinates, obstructed_connections};
+
+        // reuse the distances to the target before resorting to A*
+        auto spur_path = follow_target_distances(lyt, spur);
+
+        if (spur_path.empty())
+        {
+            spur_path = a_star<Path>(
+                lyt, {spur, objective.target},
+                distance_functor<spur_layout, uint64_t>{[this](const spur_layout&, const coordinate<Lyt>& c,
+                                                               const coordinate<Lyt>&) { return target_distance(c); }},
+                unit_cost_functor<spur_layout, uint8_t>(), params.astar_params);
+        }
+
+        // find an alternative path from the spur coordinate to the target and check that it is not empty
+        if (spur_path.empty())
+        {
+            return {};
+        }
+
+        // the final path will be a concatenation of the root path and the spur path
+        auto& final_path = root_path;
+        // allocate more memory for the final path (prepare concatenation)
+        final_path.reserve(root_path.size() + spur_path.size());
+        // concatenate root path and spur path to get the final path
+        final_path.insert(final_path.end(), std::make_move_iterator(spur_path.begin()),
+                          std::make_move_iterator(spur_path.end()));
+
+        return final_path;
+    }
+    /**
+     * Determines the spur paths for all coordinates of `latest_path` except the last one. The spur searches are
+     * distributed among `params.num_threads` threads.
+     *
+     * @param latest_path The most recently found shortest path.
+     * @return The spur paths in the order of their spur coordinates in `latest_path`. Spurs without a path are
+     * represented by empty paths.
+     */
+    [[nodiscard]] std::vector<Path> spur_paths(const Path& latest_path) const noexcept
+    {
+        const auto num_spurs = latest_path.empty() ? std::size_t{0} : latest_path.size() - 1;
+
+        std::vector<Path> paths(num_spurs);
+
+        const auto num_threads = std::min(std::max(params.num_threads, std::size_t{1}),
+                                          std::max(num_spurs / min_spurs_per_thread, std::size_t{1}));
+
+        // determines the spur paths for the spurs in [start, end)
+        const auto determine_slice = [this, &latest_path, &paths](const std::size_t start, const std::size_t end)
+        {
+            for (auto i = start; i < end; ++i)
+            {
+                paths[i] = spur_path(latest_path, i);
+            }
+        };
+
+        if (num_threads <= 1)
+        {
+            determine_slice(0, num_spurs);
+
+            return paths;
+        }
+
+        // calculate the size of each slice
+        const auto slice_size = (num_spurs + num_threads - 1) / num_threads;
+
+        std::vector<std::future<void>> futures{};
+        futures.reserve(num_threads);
+
+        for (std::size_t start = 0; start < num_spurs; start += slice_size)
+        {
+            futures.emplace_back(
+                std::async(std::launch::async, determine_slice, start, std::min(start + slice_size, num_spurs)));
+        }
+
+        for (auto& f : futures)
         {
-            layout.clear_obstructed_connection(c.first, c.second);
+            f.get();
         }
 
-        temporarily_obstructed_coordinates.clear();
-        temporarily_obstructed_connections.clear();
+        return paths;
     }
 };
 
@@ -228,7 +528,13 @@ class yen_k_shortest_paths_impl
  * \f$k\f$ is larger than the number of possible paths from source to target, the size of the returned path collection
  * will be smaller than \f$k\f$.
  *
- * This implementation uses the A* algorithm with the Manhattan distance function internally.
+ * This implementation uses the A* algorithm with the Manhattan distance function to determine the initial shortest
+ * path. For all subsequent spur searches, the distances of all coordinates to the target are determined once via a
+ * reverse breadth-first search that disregards the temporary obstructions of Yen's algorithm. These distances serve as
+ * the heuristic for A*. Furthermore, spur paths that can follow decreasing distances to the target without running
+ * into an obstruction are taken as they are without any search. Temporary obstructions are layered on top of the
+ * layout instead of being written into it. Thus, the given layout is never modified and the spur searches of each
+ * iteration are conducted concurrently.
  *
  * This function automatically detects whether the given layout implements a clocking interface (see `clocked_layout`)
  * and respects the underlying information flow imposed by `layout`'s clocking scheme. This algorithm does neither
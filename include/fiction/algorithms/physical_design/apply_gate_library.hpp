@@ -9,18 +9,22 @@
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/name_utils.hpp"
 
-#include <optional>
-
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
-
-#include <cstdint>
 #endif
 #include <mockturtle/traits.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // data types cannot properly be converted to bit field types
 #pragma GCC diagnostic push
@@ -33,15 +37,40 @@
 namespace fiction
 {
 
+/**
+ * Parameters for `apply_gate_library`.
+ */
+struct apply_gate_library_params
+{
+    /**
+     * Number of threads to use for expanding tiles into cells. Each thread sets up the gate implementations of a
+     * contiguous range of tiles, and the resulting cells are inserted into the pre-allocated cell-level layout in tile
+     * order. By default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+};
+
 namespace detail
 {
 
+/**
+ * Detects whether the parameters of a parameterized gate library provide a `design_cache` member.
+ */
+template <typename Params, typename = void>
+struct has_design_cache : std::false_type
+{};
+
+template <typename Params>
+struct has_design_cache<Params, std::void_t<decltype(std::declval<Params>().design_cache)>> : std::true_type
+{};
+
 template <typename CellLyt, typename GateLibrary, typename GateLyt>
 class apply_gate_library_impl
 {
   public:
-    explicit apply_gate_library_impl(const GateLyt& lyt) :
+    explicit apply_gate_library_impl(const GateLyt& lyt, const apply_gate_library_params& p = {}) :
             gate_lyt{lyt},
+            ps{p},
             cell_lyt{determine_aspect_ratio_for_cell_level_layout(gate_lyt)}
     {
         cell_lyt.set_tile_size_x(GateLibrary::gate_x_size());
@@ -76,30 +105,70 @@ class apply_gate_library_impl
      */
     [[nodiscard]] CellLyt run_static_gate_library(const std::optional<CellLyt>& defect_surface = std::nullopt)
     {
-#if (PROGRESS_BARS)
-        // initialize a progress bar
-        mockturtle::progress_bar bar{static_cast<uint32_t>(gate_lyt.size()), "[i] applying gate library: |{0}|"};
-#endif
+        std::vector<mockturtle::node<GateLyt>> nodes{};
+        nodes.reserve(gate_lyt.size());
 
         gate_lyt.foreach_node(
-            [&, this](const auto& n, [[maybe_unused]] auto i)
+            [this, &nodes](const auto& n)
             {
                 if (!gate_lyt.is_constant(n))
                 {
-                    const auto t = gate_lyt.get_tile(n);
+                    nodes.push_back(n);
+                }
+            });
 
-                    // retrieve the top-leftmost cell in tile t
-                    const auto c =
-                        relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
-                                                           GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+        const auto num_threads = std::min(std::max(ps.num_threads, std::size_t{1}),
+                                          std::max(nodes.size() / min_nodes_per_thread, std::size_t{1}));
+
+        // calculate the size of each slice
+        const auto slice_size = (nodes.size() + num_threads - 1) / num_threads;
+
+        // expands the nodes in [start, end) into their cells; this only reads the gate-level layout
+        const auto expand_slice = [this, &nodes](const std::size_t start, const std::size_t end)
+        {
+            std::vector<placed_cell> cells{};
+
+            for (auto i = start; i < end; ++i)
+            {
+                const auto t = gate_lyt.get_tile(nodes[i]);
+
+                expand_gate(top_left_cell(t), GateLibrary::set_up_gate(gate_lyt, t), nodes[i], cells);
+            }
+
+            return cells;
+        };
 
-                    assign_gate(c, GateLibrary::set_up_gate(gate_lyt, t), n);
-                }
+#if (PROGRESS_BARS)
+        // initialize a progress bar
+        mockturtle::progress_bar bar{static_cast<uint32_t>(nodes.size()), "[i] applying gate library: |{0}|"};
+#endif
+
+        if (num_threads <= 1)
+        {
+            insert_cells(expand_slice(0, nodes.size()));
+        }
+        else
+        {
+            std::vector<std::future<std::vector<placed_cell>>> futures{};
+            futures.reserve(num_threads);
+
+            for (std::size_t start = 0; start < nodes.size(); start += slice_size)
+            {
+                futures.emplace_back(std::async(std::launch::async, expand_slice, start,
+                                                std::min(start + slice_size, nodes.size())));
+            }
+
+            // insert the cells in node order to obtain the same layout as a sequential expansion; exceptions thrown by
+            // the gate library are passed through here
+            for (std::size_t i = 0; i < futures.size(); ++i)
+            {
+                insert_cells(futures[i].get());
 #if (PROGRESS_BARS)
                 // update progress
-                bar(i);
+                bar(static_cast<uint32_t>(std::min((i + 1) * slice_size, nodes.size())));
 #endif
-            });
+            }
+        }
 
         // perform post-layout optimization if necessary
         if constexpr (has_post_layout_optimization_v<GateLibrary, CellLyt>)
@@ -157,6 +226,22 @@ class apply_gate_library_impl
             GateLibrary::post_layout_optimization(gate_lyt);
         }
 
+        // memoize designed gates for the duration of this run if no cache is provided such that tiles with identical
+        // requirements are designed only once
+        auto library_params = params;
+
+        if constexpr (has_design_cache<Params>::value)
+        {
+            if (library_params.design_cache == nullptr)
+            {
+                library_params.design_cache =
+                    std::make_shared<typename decltype(library_params.design_cache)::element_type>();
+            }
+        }
+
+        std::vector<placed_cell> cells{};
+
+        // gates are designed sequentially since the gate design itself is multithreaded
         gate_lyt.foreach_node(
             [&, this](const auto& n, [[maybe_unused]] auto i)
             {
@@ -164,15 +249,10 @@ class apply_gate_library_impl
                 {
                     const auto t = gate_lyt.get_tile(n);
 
-                    // retrieve the top-leftmost cell in tile t
-                    const auto c =
-                        relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
-                                                           GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
-
-                    assign_gate(c,
-                                GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(gate_lyt, t, params,
+                    expand_gate(top_left_cell(t),
+                                GateLibrary::template set_up_gate<GateLyt, CellLyt, Params>(gate_lyt, t, library_params,
                                                                                             defect_surface),
-                                n);
+                                n, cells);
                 }
 #if (PROGRESS_BARS)
                 // update progress
@@ -180,6 +260,8 @@ class apply_gate_library_impl
 #endif
             });
 
+        insert_cells(cells);
+
         // if available, recover layout name
         cell_lyt.set_layout_name(get_name(gate_lyt));
 
@@ -203,23 +285,62 @@ class apply_gate_library_impl
     }
 
   private:
+    /**
+     * Non-empty cell of a gate implementation.
+     */
+    struct placed_cell
+    {
+        /**
+         * Position of the cell in the cell-level layout.
+         */
+        cell<CellLyt> position;
+        /**
+         * Type of the cell.
+         */
+        typename technology<CellLyt>::cell_type type;
+        /**
+         * Node in the gate-level layout whose implementation contains the cell.
+         */
+        mockturtle::node<GateLyt> node;
+    };
+    /**
+     * Minimum number of nodes per thread. Smaller layouts are expanded sequentially as the overhead of spawning
+     * threads would outweigh the gains.
+     */
+    static constexpr std::size_t min_nodes_per_thread = 64;
     /**
      * Gate-level layout.
      */
     GateLyt gate_lyt;
+    /**
+     * Parameters.
+     */
+    const apply_gate_library_params ps;
     /**
      * Cell-level layout.
      */
     CellLyt cell_lyt;
     /**
-     * This function assigns a given FCN gate implementation to the total cell layout.
+     * Returns the top-leftmost cell of the given tile.
+     *
+     * @param t Tile in the gate-level layout.
+     * @return Top-leftmost cell of `t` in the cell-level layout.
+     */
+    [[nodiscard]] cell<CellLyt> top_left_cell(const tile<GateLyt>& t) const noexcept
+    {
+        return relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(), GateLyt,
+                                                  CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+    }
+    /**
+     * This function collects the non-empty cells of a given FCN gate implementation in their absolute positions.
      *
      * @param c Top-left cell of the tile where the gate is placed.
      * @param g Gate implementation.
      * @param n Corresponding node in the gate-level layout.
+     * @param cells Container to append the cells of `g` to.
      */
-    void assign_gate(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g,
-                     const mockturtle::node<GateLyt>& n)
+    static void expand_gate(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g,
+                            const mockturtle::node<GateLyt>& n, std::vector<placed_cell>& cells)
     {
         const auto start_x = c.x;
         const auto start_y = c.y;
@@ -229,19 +350,33 @@ class apply_gate_library_impl
         {
             for (auto x = 0ul; x < g[y].size(); ++x)
             {
-                const cell<CellLyt> pos{start_x + x, start_y + y, layer};
-                const auto          type{g[y][x]};
-
-                if (!technology<CellLyt>::is_empty_cell(type))
+                if (const auto type{g[y][x]}; !technology<CellLyt>::is_empty_cell(type))
                 {
-                    cell_lyt.assign_cell_type(pos, type);
+                    cells.push_back({cell<CellLyt>{start_x + x, start_y + y, layer}, type, n});
                 }
+            }
+        }
+    }
+    /**
+     * Inserts the given cells into the cell-level layout in bulk. Memory for all cells is allocated up front.
+     *
+     * @param cells Cells to insert in the order of insertion.
+     */
+    void insert_cells(const std::vector<placed_cell>& cells)
+    {
+        if constexpr (has_reserve_v<CellLyt>)
+        {
+            cell_lyt.reserve(cell_lyt.num_cells() + cells.size());
+        }
 
-                // set IO names
-                if (technology<CellLyt>::is_input_cell(type) || technology<CellLyt>::is_output_cell(type))
-                {
-                    cell_lyt.assign_cell_name(pos, gate_lyt.get_name(n));
-                }
+        for (const auto& [pos, type, n] : cells)
+        {
+            cell_lyt.assign_cell_type(pos, type);
+
+            // set IO names
+            if (technology<CellLyt>::is_input_cell(type) || technology<CellLyt>::is_output_cell(type))
+            {
+                cell_lyt.assign_cell_name(pos, gate_lyt.get_name(n));
             }
         }
     }
@@ -287,10 +422,11 @@ class apply_gate_library_impl
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
  * @param lyt The gate-level layout.
+ * @param params Parameters.
  * @return A cell-level layout that implements `lyt`'s gate types with building blocks defined in `GateLibrary`.
  */
 template <typename CellLyt, typename GateLibrary, typename GateLyt>
-[[nodiscard]] CellLyt apply_gate_library(const GateLyt& lyt)
+[[nodiscard]] CellLyt apply_gate_library(const GateLyt& lyt, const apply_gate_library_params& params = {})
 {
     static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
     static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
@@ -301,7 +437,7 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
     static_assert(std::is_same_v<technology<CellLyt>, technology<GateLibrary>>,
                   "CellLyt and GateLibrary must implement the same technology");
 
-    detail::apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> p{lyt};
+    detail::apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> p{lyt, params};
 
     return p.run_static_gate_library();
 }
@@ -319,10 +455,13 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
  * @param lyt The gate-level layout.
+ * @param defect_surface Defect surface whose defects are copied to the resulting layout.
+ * @param params Parameters.
  * @return A cell-level layout that implements `lyt`'s gate types with building blocks defined in `GateLibrary`.
  */
 template <typename DefectLyt, typename GateLibrary, typename GateLyt>
-[[nodiscard]] DefectLyt apply_gate_library_to_defective_surface(const GateLyt& lyt, const DefectLyt& defect_surface)
+[[nodiscard]] DefectLyt apply_gate_library_to_defective_surface(const GateLyt& lyt, const DefectLyt& defect_surface,
+                                                                const apply_gate_library_params& params = {})
 {
     static_assert(is_cell_level_layout_v<DefectLyt>, "DefectLyt is not a cell-level layout");
     static_assert(is_sidb_defect_surface_v<DefectLyt>, "DefectLyt is not an SiDB defect surface");
@@ -333,7 +472,7 @@ template <typename DefectLyt, typename GateLibrary, typename GateLyt>
     static_assert(std::is_same_v<technology<DefectLyt>, technology<GateLibrary>>,
                   "DefectLyt and GateLibrary must implement the same technology");
 
-    detail::apply_gate_library_impl<DefectLyt, GateLibrary, GateLyt> p{lyt};
+    detail::apply_gate_library_impl<DefectLyt, GateLibrary, GateLyt> p{lyt, params};
 
     return p.run_static_gate_library(defect_surface);
 }
@@ -6,6 +6,7 @@
 #define FICTION_DETERMINE_CLOCKING_HPP
 
 #include "fiction/traits.hpp"
+#include "fiction/utils/profiling.hpp"
 
 #include <bill/sat/cardinality.hpp>
 #include <bill/sat/interface/common.hpp>
@@ -17,10 +18,16 @@
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <numeric>
+#include <optional>
 #include <ostream>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -36,6 +43,16 @@ struct determine_clocking_params
      * The SAT solver to use.
      */
     bill::solvers sat_engine = bill::solvers::bsat2;
+    /**
+     * Decompose the layout into connected components before solving. Tiles of different components do not share any
+     * clocking constraints. Hence, each component is clocked by a separate, smaller SAT instance.
+     */
+    bool decompose_into_components = true;
+    /**
+     * Number of threads to solve the SAT instances of different components concurrently. By default, the number of
+     * threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 /**
  * Statistics for the `determine_clocking` algorithm.
@@ -46,6 +63,10 @@ struct determine_clocking_stats
      * Total runtime.
      */
     mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of independently solved components.
+     */
+    std::size_t num_components{0};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -54,44 +75,128 @@ struct determine_clocking_stats
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] components = {}\n", num_components);
     }
 };
 
 namespace detail
 {
 
+/**
+ * Partitions the tiles of all non-constant nodes of the given layout into connected components. Two tiles are connected
+ * if information flows between them or if one of them crosses the other. Clocking constraints only exist between
+ * connected tiles. Thus, the clock numbers of different components can be determined independently of each other.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt The gate-level layout whose tiles are to be partitioned.
+ * @return The tiles of each component in the order in which their nodes are visited by `foreach_node`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<std::vector<tile<Lyt>>> clocking_components(const Lyt& lyt) noexcept
+{
+    std::vector<tile<Lyt>>                     tiles{};
+    std::unordered_map<tile<Lyt>, std::size_t> tile_index{};
+
+    lyt.foreach_node(
+        [&lyt, &tiles, &tile_index](const auto& n)
+        {
+            if (lyt.is_constant(n))
+            {
+                return;
+            }
+
+            const auto t = lyt.get_tile(n);
+
+            tile_index.emplace(t, tiles.size());
+            tiles.push_back(t);
+        });
+
+    // union-find with path halving
+    std::vector<std::size_t> parent(tiles.size());
+    std::iota(parent.begin(), parent.end(), std::size_t{0});
+
+    const auto find = [&parent](std::size_t i) noexcept
+    {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i         = parent[i];
+        }
+
+        return i;
+    };
+
+    const auto unite = [&find, &parent, &tile_index](const std::size_t i, const tile<Lyt>& t) noexcept
+    {
+        if (const auto it = tile_index.find(t); it != tile_index.cend())
+        {
+            parent[find(i)] = find(it->second);
+        }
+    };
+
+    for (std::size_t i = 0; i < tiles.size(); ++i)
+    {
+        for (const auto& t : lyt.template incoming_data_flow<false>(tiles[i]))
+        {
+            unite(i, t);
+        }
+
+        if (!lyt.is_ground_layer(tiles[i]))
+        {
+            unite(i, lyt.below(tiles[i]));
+        }
+    }
+
+    std::vector<std::vector<tile<Lyt>>> components{};
+    std::vector<std::size_t>            component_of_root(tiles.size(), tiles.size());
+
+    for (std::size_t i = 0; i < tiles.size(); ++i)
+    {
+        const auto root = find(i);
+
+        if (component_of_root[root] == tiles.size())
+        {
+            component_of_root[root] = components.size();
+            components.emplace_back();
+        }
+
+        components[component_of_root[root]].push_back(tiles[i]);
+    }
+
+    return components;
+}
+
 template <typename Lyt, bill::solvers SolverType = bill::solvers::ghack>
 class sat_clocking_handler
 {
   public:
     /**
-     * Default constructor.
+     * Standard constructor. Creates the variables of the given tiles.
+     *
+     * @param lyt The layout to clock.
+     * @param ts Tiles of the non-constant nodes to clock. The tiles must form a union of connected components as
+     * determined by `clocking_components`.
      */
-    explicit sat_clocking_handler(Lyt& lyt) : layout{lyt}, number_of_clocks{layout.num_clocks()}
+    sat_clocking_handler(Lyt& lyt, std::vector<tile<Lyt>> ts) :
+            layout{lyt},
+            number_of_clocks{layout.num_clocks()},
+            tiles{std::move(ts)}
     {
         // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
+        for (const auto& t : tiles)
+        {
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
             {
-                // skip constants
-                if (layout.is_constant(n))
-                {
-                    return;
-                }
-
-                const auto t = layout.get_tile(n);
-
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    variables[{t, clk}] = solver.add_variable();
-                }
-            });
+                variables[{t, clk}] = solver.add_variable();
+            }
+        }
     }
     /**
-     * Determines clock numbers for the layout.
+     * Determines clock numbers for the tiles.
      *
-     * Constructs a SAT instance and passes it to a solver to find a valid clocking scheme.
+     * Constructs a SAT instance and passes it to a solver to find a valid clocking scheme. The layout is not modified.
+     * To apply the clock numbers, call `assign_clock_numbers`.
      *
      * @return `true` iff a valid clocking scheme could be found.
      */
@@ -103,17 +208,38 @@ class sat_clocking_handler
         ensure_same_clock_number_on_crossing_tiles();
         symmetry_breaking();
 
+        FICTION_PROFILE_SCOPE("determine_clocking::sat_solve");
+
         // pass to the solver
         if (const auto sat_result = solver.solve(); sat_result == bill::result::states::satisfiable)
         {
-            // extract model and assign clock numbers
-            assign_clock_numbers(solver.get_model().model());
+            model = solver.get_model().model();
             return true;
         }
 
         // SAT instance was not satisfiable
         return false;
     }
+    /**
+     * Assigns the clock numbers found by the last successful call of `determine_clocks` to the layout.
+     */
+    void assign_clock_numbers() noexcept
+    {
+        for (const auto& t : tiles)
+        {
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                // if tile t is clocked with clock number clk
+                if (model.at(variables.at({t, clk})) == bill::lbool_type::true_)
+                {
+                    layout.assign_clock_number(t, clk);
+                    layout.assign_clock_number(layout.above(t), clk);
+                    layout.assign_clock_number(layout.below(t), clk);
+                }
+            }
+        }
+    }
 
   private:
     /**
@@ -124,6 +250,10 @@ class sat_clocking_handler
      * Number of clocks in layout's clocking scheme.
      */
     const typename Lyt::clock_number_t number_of_clocks;
+    /**
+     * Tiles to clock.
+     */
+    const std::vector<tile<Lyt>> tiles;
     /**
      * The solver used to find a solution to the clocking problem.
      */
@@ -136,6 +266,10 @@ class sat_clocking_handler
      * Stores all variables.
      */
     std::unordered_map<tile_clock_number, bill::var_type> variables{};
+    /**
+     * The model of the last satisfiable SAT instance.
+     */
+    bill::result::model_type model{};
 
     /**
      * Adds constraints to the solver that enforce the assignment of at least one clock number per tile.
@@ -143,27 +277,19 @@ class sat_clocking_handler
     void at_least_one_clock_number_per_tile() noexcept
     {
         // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
-            {
-                if (layout.is_constant(n))
-                {
-                    return;
-                }
-
-                const auto t = layout.get_tile(n);
-
-                std::vector<bill::var_type> tc{};
-                tc.reserve(number_of_clocks);
+        for (const auto& t : tiles)
+        {
+            std::vector<bill::var_type> tc{};
+            tc.reserve(number_of_clocks);
 
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    tc.push_back(variables[{t, clk}]);
-                }
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                tc.push_back(variables[{t, clk}]);
+            }
 
-                bill::at_least_one(tc, solver);
-            });
+            bill::at_least_one(tc, solver);
+        }
     }
     /**
      * Adds constraints to the solver that enforce the assignment of at most one clock number per tile.
@@ -177,20 +303,12 @@ class sat_clocking_handler
             for (typename Lyt::clock_number_t c2 = c1 + 1; c2 < number_of_clocks; ++c2)
             {
                 // for each non-empty tile
-                layout.foreach_node(
-                    [this, &c1, &c2](const auto& n)
-                    {
-                        if (layout.is_constant(n))
-                        {
-                            return;
-                        }
-
-                        const auto t = layout.get_tile(n);
-
-                        // not tile has clock 1 OR not tile has clock 2
-                        solver.add_clause({{bill::lit_type{variables[{t, c1}], bill::negative_polarity},
-                                            bill::lit_type{variables[{t, c2}], bill::negative_polarity}}});
-                    });
+                for (const auto& t : tiles)
+                {
+                    // not tile has clock 1 OR not tile has clock 2
+                    solver.add_clause({{bill::lit_type{variables[{t, c1}], bill::negative_polarity},
+                                        bill::lit_type{variables[{t, c2}], bill::negative_polarity}}});
+                }
             }
         }
     }
@@ -200,39 +318,31 @@ class sat_clocking_handler
     void exclude_clock_assignments_that_violate_information_flow() noexcept
     {
         // for each non-empty tile
-        layout.foreach_node(
-            [this](const auto& n)
-            {
-                if (layout.is_constant(n))
+        for (const auto& t1 : tiles)
+        {
+            // for each of t's predecessors (disregarding clocking)
+            const auto incoming_tiles = layout.template incoming_data_flow<false>(t1);
+            std::for_each(
+                incoming_tiles.cbegin(), incoming_tiles.cend(),
+                [this, &t1](const auto& t2)
                 {
-                    return;
-                }
-
-                const auto t1 = layout.get_tile(n);
-
-                // for each of t's predecessors (disregarding clocking)
-                const auto incoming_tiles = layout.template incoming_data_flow<false>(t1);
-                std::for_each(
-                    incoming_tiles.cbegin(), incoming_tiles.cend(),
-                    [this, &t1](const auto& t2)
+                    // for each combination of possible clock numbers
+                    for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
                     {
-                        // for each combination of possible clock numbers
-                        for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
+                        for (typename Lyt::clock_number_t c2 = 0; c2 < number_of_clocks; ++c2)
                         {
-                            for (typename Lyt::clock_number_t c2 = 0; c2 < number_of_clocks; ++c2)
+                            // if c2 is not c1's incoming clock number
+                            if (!(static_cast<typename Lyt::clock_number_t>((c2 + typename Lyt::clock_number_t{1}) %
+                                                                            number_of_clocks) == c1))
                             {
-                                // if c2 is not c1's incoming clock number
-                                if (!(static_cast<typename Lyt::clock_number_t>((c2 + typename Lyt::clock_number_t{1}) %
-                                                                                number_of_clocks) == c1))
-                                {
-                                    // not tile t1 has clock c1 OR not tile t2 has clock c2
-                                    solver.add_clause({{bill::lit_type{variables[{t1, c1}], bill::negative_polarity},
-                                                        bill::lit_type{variables[{t2, c2}], bill::negative_polarity}}});
-                                }
+                                // not tile t1 has clock c1 OR not tile t2 has clock c2
+                                solver.add_clause({{bill::lit_type{variables[{t1, c1}], bill::negative_polarity},
+                                                    bill::lit_type{variables[{t2, c2}], bill::negative_polarity}}});
                             }
                         }
-                    });
-            });
+                    }
+                });
+        }
     }
     /**
      * Adds constraints to the solver that ensure the assignment of the same clock number to crossing tiles.
@@ -240,34 +350,36 @@ class sat_clocking_handler
     void ensure_same_clock_number_on_crossing_tiles() noexcept
     {
         // for each crossing wire
-        layout.foreach_wire(
-            [this](const auto& w)
+        for (const auto& t : tiles)
+        {
+            if (layout.is_ground_layer(t))
             {
-                const auto t = layout.get_tile(w);
-
-                if (layout.is_ground_layer(t))
-                {
-                    return;
-                }
+                continue;
+            }
 
-                // fetch corresponding tile in ground layer
-                const auto ground_t = layout.below(t);
+            // fetch corresponding tile in ground layer
+            const auto ground_t = layout.below(t);
 
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    // ensure that the clock number of both tiles is identical
-                    solver.add_clause(
-                        bill::add_tseytin_equals(solver, variables[{t, clk}], variables[{ground_t, clk}]));
-                }
-            });
+            // for each possible clock number
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                // ensure that the clock number of both tiles is identical
+                solver.add_clause(bill::add_tseytin_equals(solver, variables[{t, clk}], variables[{ground_t, clk}]));
+            }
+        }
     }
     /**
      * Adds constraints to the solver that help to speed up the solving process by breaking symmetries in the solution
-     * space.
+     * space. Since clock numbers can be shifted cyclically within a component, the clock numbers of a path that starts
+     * at the first PI of the tiles, or at the first tile if there is no PI, are fixed.
      */
     void symmetry_breaking() noexcept
     {
+        if (tiles.empty())
+        {
+            return;
+        }
+
         const std::function<void(const mockturtle::node<Lyt>& n)> recurse =
             [this, &recurse, clk = 0](const auto& n) mutable
         {
@@ -285,45 +397,11 @@ class sat_clocking_handler
                                   });
         };
 
-        // only for the first PI
-        layout.foreach_pi(
-            [&recurse](const auto& pi)
-            {
-                recurse(pi);
-
-                return false;  // terminate after one iteration
-            });
-    }
-    /**
-     * Assigns clock numbers to the layout based on the provided model.
-     *
-     * @param model The model to extract the clocking scheme from.
-     */
-    void assign_clock_numbers(const bill::result::model_type& model) noexcept
-    {
-        // for each non-empty tile
-        layout.foreach_node(
-            [this, &model](const auto& n)
-            {
-                if (layout.is_constant(n))
-                {
-                    return;
-                }
-
-                const auto t = layout.get_tile(n);
+        const auto first_pi =
+            std::find_if(tiles.cbegin(), tiles.cend(), [this](const auto& t) { return layout.is_pi_tile(t); });
 
-                // for each possible clock number
-                for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
-                {
-                    // if tile t is clocked with clock number clk
-                    if (model.at(variables.at({t, clk})) == bill::lbool_type::true_)
-                    {
-                        layout.assign_clock_number(t, clk);
-                        layout.assign_clock_number(layout.above(t), clk);
-                        layout.assign_clock_number(layout.below(t), clk);
-                    }
-                }
-            });
+        // only for the first PI
+        recurse(layout.get_node(first_pi != tiles.cend() ? *first_pi : tiles.front()));
     }
 };
 
@@ -351,29 +429,29 @@ class determine_clocking_impl
         {
             case bill::solvers::ghack:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::ghack>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::ghack>();
             }
             case bill::solvers::glucose_41:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::glucose_41>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::glucose_41>();
             }
             case bill::solvers::bsat2:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::bsat2>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::bsat2>();
             }
 #if !defined(BILL_WINDOWS_PLATFORM)
             case bill::solvers::maple:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::maple>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::maple>();
             }
             case bill::solvers::bmcg:
             {
-                return sat_clocking_handler<Lyt, bill::solvers::bmcg>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::bmcg>();
             }
 #endif
             default:
             {
-                return sat_clocking_handler<Lyt>{layout}.determine_clocks();
+                return determine_clocks<bill::solvers::ghack>();
             }
         }
     }
@@ -391,6 +469,118 @@ class determine_clocking_impl
      * Statistics.
      */
     determine_clocking_stats& stats;
+    /**
+     * Determines clock numbers for all components of the layout, each with a separate solver instance. The components
+     * are solved concurrently and the layout is only modified if all of them could be clocked.
+     *
+     * @tparam SolverType The SAT solver to use.
+     * @return `true` iff a valid clocking scheme could be found.
+     */
+    template <bill::solvers SolverType>
+    bool determine_clocks()
+    {
+        std::vector<std::vector<tile<Lyt>>> components{};
+
+        if (params.decompose_into_components)
+        {
+            components = clocking_components(layout);
+        }
+        else
+        {
+            std::vector<tile<Lyt>> all_tiles{};
+
+            layout.foreach_node(
+                [this, &all_tiles](const auto& n)
+                {
+                    if (!layout.is_constant(n))
+                    {
+                        all_tiles.push_back(layout.get_tile(n));
+                    }
+                });
+
+            components.push_back(std::move(all_tiles));
+        }
+
+        stats.num_components = components.size();
+
+        std::vector<std::optional<sat_clocking_handler<Lyt, SolverType>>> handlers(components.size());
+
+        std::atomic<bool> clockable{true};
+
+        const auto solve_component = [this, &components, &handlers, &clockable](const std::size_t i)
+        {
+            // another component is not clockable already
+            if (!clockable)
+            {
+                return;
+            }
+
+            handlers[i].emplace(layout, std::move(components[i]));
+
+            if (!handlers[i]->determine_clocks())
+            {
+                clockable = false;
+            }
+        };
+
+        const auto num_threads =
+            std::min(std::max(params.num_threads, std::size_t{1}), static_cast<std::size_t>(components.size()));
+
+        if (num_threads <= 1)
+        {
+            for (std::size_t i = 0; i < components.size(); ++i)
+            {
+                solve_component(i);
+            }
+        }
+        else
+        {
+            std::atomic<std::size_t> next_component{0};
+
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            thread_idle_recorder idle_recorder{"determine_clocking::thread_idle_time"};
+
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(
+                    [&next_component, &solve_component, &idle_recorder, num_components = components.size()]
+                    {
+                        for (auto c = next_component++; c < num_components; c = next_component++)
+                        {
+                            solve_component(c);
+                        }
+
+                        idle_recorder.worker_finished();
+                    });
+            }
+
+            // wait for all threads to complete
+            for (auto& thread : threads)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+
+            idle_recorder.threads_joined();
+        }
+
+        if (!clockable)
+        {
+            return false;
+        }
+
+        // assign the clock numbers of all components sequentially
+        for (auto& handler : handlers)
+        {
+            handler->assign_clock_numbers();
+        }
+
+        return true;
+    }
 };
 
 }  // namespace detail
@@ -403,6 +593,9 @@ class determine_clocking_impl
  *
  * If no valid clock number assignment exists for `lyt`, this function returns `false` and does not modify `lyt`.
  *
+ * The layout is decomposed into connected components whose SAT instances are solved concurrently. To clock a layout
+ * repeatedly after local edits, `incremental_clocking` keeps its solver alive instead.
+ *
  * This algorithm was proposed in \"Ending the Tyranny of the Clock: SAT-based Clock Number Assignment for Field-coupled
  * Nanotechnologies\" by M. Walter, J. Drewniok, and R. Wille in IEEE NANO 2024
  * (https://ieeexplore.ieee.org/abstract/document/10628908).
@@ -432,6 +625,289 @@ bool determine_clocking(Lyt& lyt, const determine_clocking_params& params = {},
     return result;
 }
 
+/**
+ * An incremental variant of `determine_clocking` for layouts that are clocked repeatedly after local edits, e.g., during
+ * post-layout optimization. The solver instance is kept alive between calls such that clauses learned in previous runs
+ * remain available. The information flow and crossing constraints of each tile are guarded by an activation literal of
+ * that tile, which is passed to the solver as an assumption. When tiles are edited, their constraints and the
+ * constraints of their neighbors are retracted by permanently disabling the old activation literals and re-encoded for
+ * the current state of the layout. The constraints of all other tiles are left untouched.
+ *
+ * Symmetries are broken by assuming the first clock number for the first tile of each connected component.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @tparam SolverType The SAT solver to use.
+ */
+template <typename Lyt, bill::solvers SolverType = bill::solvers::bsat2>
+class incremental_clocking
+{
+  public:
+    /**
+     * Standard constructor. Encodes the constraints of all tiles of the given layout.
+     *
+     * @param lyt The gate-level layout to assign clock numbers to. The reference must remain valid for the lifetime of
+     * this object.
+     */
+    explicit incremental_clocking(Lyt& lyt) : layout{lyt}, number_of_clocks{layout.num_clocks()}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+        layout.foreach_node(
+            [this](const auto& n)
+            {
+                if (!layout.is_constant(n))
+                {
+                    encode_tile(layout.get_tile(n));
+                }
+            });
+    }
+    /**
+     * Determines clock numbers for the current state of the layout and assigns them as in `determine_clocking`. All
+     * edits since the last call must have been reported via `update`.
+     *
+     * If no valid clock number assignment exists, this function returns `false` and does not modify the layout.
+     *
+     * @param stats Statistics. The runtime of this call is stored in `time_total`.
+     * @return `true` iff the layout could be successfully clocked via a valid clock number assignment.
+     */
+    bool determine_clocks(determine_clocking_stats* stats = nullptr)
+    {
+        determine_clocking_stats st{};
+
+        const auto result = [this, &st]
+        {
+            mockturtle::stopwatch stop{st.time_total};
+
+            std::vector<bill::lit_type> assumptions{};
+            assumptions.reserve(activation_variables.size());
+
+            for (const auto& [t, act] : activation_variables)
+            {
+                assumptions.emplace_back(act, bill::positive_polarity);
+            }
+
+            // break the cyclic symmetry of the clock numbers in each component
+            const auto components = detail::clocking_components(layout);
+
+            st.num_components = components.size();
+
+            for (const auto& component : components)
+            {
+                if (const auto it = clock_variables.find(component.front()); it != clock_variables.cend())
+                {
+                    assumptions.emplace_back(it->second.front(), bill::positive_polarity);
+                }
+            }
+
+            FICTION_PROFILE_SCOPE("determine_clocking::sat_solve");
+
+            if (solver.solve(assumptions) != bill::result::states::satisfiable)
+            {
+                return false;
+            }
+
+            const auto model = solver.get_model().model();
+
+            for (const auto& component : components)
+            {
+                for (const auto& t : component)
+                {
+                    const auto& vars = clock_variables.at(t);
+
+                    for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+                    {
+                        if (model.at(vars[clk]) == bill::lbool_type::true_)
+                        {
+                            layout.assign_clock_number(t, clk);
+                            layout.assign_clock_number(layout.above(t), clk);
+                            layout.assign_clock_number(layout.below(t), clk);
+                        }
+                    }
+                }
+            }
+
+            return true;
+        }();
+
+        if (stats)
+        {
+            *stats = st;
+        }
+
+        return result;
+    }
+    /**
+     * Reports edits of the layout. The constraints of the given tiles, of their current fanout tiles, and of all tiles
+     * whose constraints referred to them are re-encoded. Tiles that became empty lose their constraints.
+     *
+     * @param changed_tiles Tiles whose nodes or connections were added, removed, or modified since the last update.
+     */
+    void update(const std::vector<tile<Lyt>>& changed_tiles)
+    {
+        std::unordered_set<tile<Lyt>> to_encode{};
+
+        for (const auto& t : changed_tiles)
+        {
+            to_encode.insert(t);
+
+            if (const auto it = dependents.find(t); it != dependents.cend())
+            {
+                to_encode.insert(it->second.cbegin(), it->second.cend());
+                dependents.erase(it);
+            }
+
+            if (!layout.is_empty_tile(t))
+            {
+                for (const auto& fanout : layout.template outgoing_data_flow<false>(t))
+                {
+                    to_encode.insert(fanout);
+                }
+            }
+        }
+
+        for (const auto& t : to_encode)
+        {
+            encode_tile(t);
+        }
+    }
+    /**
+     * Returns the number of tiles whose constraints are currently active.
+     *
+     * @return Number of encoded tiles.
+     */
+    [[nodiscard]] std::size_t num_encoded_tiles() const noexcept
+    {
+        return activation_variables.size();
+    }
+
+  private:
+    /**
+     * The layout to clock.
+     */
+    Lyt& layout;
+    /**
+     * Number of clocks in layout's clocking scheme.
+     */
+    const typename Lyt::clock_number_t number_of_clocks;
+    /**
+     * The solver that is kept alive across calls.
+     */
+    bill::solver<SolverType> solver{};
+    /**
+     * Clock number variables of each tile that has ever been encoded.
+     */
+    std::unordered_map<tile<Lyt>, std::vector<bill::var_type>> clock_variables{};
+    /**
+     * Activation variable of the current constraints of each encoded tile.
+     */
+    std::unordered_map<tile<Lyt>, bill::var_type> activation_variables{};
+    /**
+     * Tiles whose constraints refer to the key tile.
+     */
+    std::unordered_map<tile<Lyt>, std::unordered_set<tile<Lyt>>> dependents{};
+    /**
+     * Creates the clock number variables of the given tile together with the permanent constraints that enforce exactly
+     * one clock number. These constraints remain valid when the tile becomes empty because its variables are
+     * unconstrained otherwise.
+     *
+     * @param t Tile to create variables for.
+     * @return The clock number variables of `t`.
+     */
+    const std::vector<bill::var_type>& clock_variables_of(const tile<Lyt>& t)
+    {
+        if (const auto it = clock_variables.find(t); it != clock_variables.cend())
+        {
+            return it->second;
+        }
+
+        std::vector<bill::var_type> vars{};
+        vars.reserve(number_of_clocks);
+
+        for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+        {
+            vars.push_back(solver.add_variable());
+        }
+
+        bill::at_least_one(vars, solver);
+
+        for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
+        {
+            for (typename Lyt::clock_number_t c2 = c1 + 1; c2 < number_of_clocks; ++c2)
+            {
+                solver.add_clause({{bill::lit_type{vars[c1], bill::negative_polarity},
+                                    bill::lit_type{vars[c2], bill::negative_polarity}}});
+            }
+        }
+
+        return clock_variables.emplace(t, std::move(vars)).first->second;
+    }
+    /**
+     * Retracts the constraints of the given tile and encodes them anew for the current state of the layout.
+     *
+     * @param t Tile to encode.
+     */
+    void encode_tile(const tile<Lyt>& t)
+    {
+        if (const auto it = activation_variables.find(t); it != activation_variables.cend())
+        {
+            // permanently disable the previous constraints of t
+            solver.add_clause(bill::lit_type{it->second, bill::negative_polarity});
+            activation_variables.erase(it);
+        }
+
+        if (layout.is_empty_tile(t))
+        {
+            return;
+        }
+
+        // variables are copied because creating the variables of further tiles may rehash the map
+        const auto t_vars = clock_variables_of(t);
+
+        const auto act   = solver.add_variable();
+        const auto guard = bill::lit_type{act, bill::negative_polarity};
+
+        activation_variables[t] = act;
+
+        // for each of t's predecessors (disregarding clocking)
+        for (const auto& fanin : layout.template incoming_data_flow<false>(t))
+        {
+            const auto fanin_vars = clock_variables_of(fanin);
+
+            dependents[fanin].insert(t);
+
+            for (typename Lyt::clock_number_t c1 = 0; c1 < number_of_clocks; ++c1)
+            {
+                for (typename Lyt::clock_number_t c2 = 0; c2 < number_of_clocks; ++c2)
+                {
+                    // if c2 is not c1's incoming clock number
+                    if (static_cast<typename Lyt::clock_number_t>((c2 + typename Lyt::clock_number_t{1}) %
+                                                                  number_of_clocks) != c1)
+                    {
+                        solver.add_clause({{guard, bill::lit_type{t_vars[c1], bill::negative_polarity},
+                                            bill::lit_type{fanin_vars[c2], bill::negative_polarity}}});
+                    }
+                }
+            }
+        }
+
+        // crossing tiles receive the clock number of the tile below
+        if (const auto ground_t = layout.below(t); !layout.is_ground_layer(t) && !layout.is_empty_tile(ground_t))
+        {
+            const auto ground_vars = clock_variables_of(ground_t);
+
+            dependents[ground_t].insert(t);
+
+            for (typename Lyt::clock_number_t clk = 0; clk < number_of_clocks; ++clk)
+            {
+                solver.add_clause({{guard, bill::lit_type{t_vars[clk], bill::negative_polarity},
+                                    bill::lit_type{ground_vars[clk], bill::positive_polarity}}});
+                solver.add_clause({{guard, bill::lit_type{t_vars[clk], bill::positive_polarity},
+                                    bill::lit_type{ground_vars[clk], bill::negative_polarity}}});
+            }
+        }
+    }
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_DETERMINE_CLOCKING_HPP
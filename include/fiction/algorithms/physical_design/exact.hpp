@@ -17,6 +17,7 @@
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
 #include "fiction/utils/placement_utils.hpp"
+#include "fiction/utils/profiling.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
 
 #include <fmt/format.h>
@@ -103,7 +104,9 @@ struct exact_physical_design_params
      */
     bool fixed_size = false;
     /**
-     * Number of threads to use for exploring the possible aspect ratios.
+     * Number of threads to use for exploring the possible aspect ratios. Worker threads share the area of the best
+     * layout found so far and abandon all aspect ratios that are dominated by it, including the ones whose SMT
+     * instances are currently being solved.
      *
      * @note This is an unstable beta feature.
      */
@@ -160,10 +163,24 @@ struct exact_physical_design_stats
     uint64_t num_gates{0ull}, num_wires{0ull}, num_crossings{0ull};
 
     uint32_t num_aspect_ratios{0ul};
+    /**
+     * Number of aspect ratios that were skipped because their transposed counterpart yields an identical SMT instance
+     * that has already been examined.
+     */
+    uint32_t num_symmetric_aspect_ratios{0ul};
+    /**
+     * Time spent in the SMT solver by each worker thread. Only populated if `num_threads > 1`.
+     */
+    std::vector<mockturtle::stopwatch<>::duration> time_solver_per_thread{};
 
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time      = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        for (auto i = 0ul; i < time_solver_per_thread.size(); ++i)
+        {
+            out << fmt::format("[i] thread {:<2} time  = {:.2f} secs\n", i,
+                               mockturtle::to_seconds(time_solver_per_thread[i]));
+        }
         out << fmt::format("[i] layout size     = {} × {}\n", x_size, y_size);
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
@@ -248,7 +265,15 @@ class exact_impl
      */
     std::optional<typename Lyt::aspect_ratio> result_aspect_ratio;
     /**
-     * Restricts access to the aspect_ratio_iterator and the result_aspect_ratio.
+     * Canonical (i.e., `x <= y`) representations of aspect ratios whose SMT instances are identical to the ones of
+     * their transposes and that have already been claimed for examination. A transposed aspect ratio whose canonical
+     * representation is contained in this set does not need to be explored again because it is either UNSAT or
+     * currently being solved by another thread.
+     */
+    std::unordered_set<typename Lyt::aspect_ratio> claimed_symmetric_aspect_ratios{};
+    /**
+     * Restricts access to the aspect_ratio_iterator and the result_aspect_ratio. The latter also guards
+     * claimed_symmetric_aspect_ratios as well as the thread_info list shared by the worker threads.
      */
     std::mutex ari_mutex{}, rar_mutex{};
 
@@ -377,11 +402,20 @@ class exact_impl
         {
             generate_smt_instance();
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            const auto z3_result = [this]
+            {
+                FICTION_PROFILE_SCOPE("exact::smt_solve");
+
+                return solver->check(check_point->assumptions);
+            }();
+
+            if (z3_result == z3::sat)
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
                 {
+                    FICTION_PROFILE_SCOPE("exact::smt_optimize");
+
                     opt->check();
                     assign_layout(opt->get_model());
                 }
@@ -2804,6 +2838,73 @@ class exact_impl
         }
     };
 
+    /**
+     * Checks whether the SMT instance of the given aspect ratio is identical to the one of its transpose, i.e., whether
+     * mirroring the layout along its main diagonal maps the instance onto itself. This is the case for Cartesian
+     * layouts without a surface black list or technology-specific constraints whose clocking scheme assigns the same
+     * clock number to each tile and its mirrored counterpart, e.g., 2DDWave.
+     *
+     * @param ar Aspect ratio to evaluate.
+     * @return `true` iff the instances of ar and its transpose are identical.
+     */
+    [[nodiscard]] bool has_symmetric_transpose(const typename Lyt::aspect_ratio& ar) const noexcept
+    {
+        if constexpr (is_cartesian_layout_v<Lyt>)
+        {
+            if (ar.x == ar.y || !scheme.is_regular() || !black_list.empty() ||
+                ps.technology_specifics != technology_constraints::NONE)
+            {
+                return false;
+            }
+
+            const auto max_dim = std::max(ar.x, ar.y);
+
+            for (decltype(ar.x) x = 0; x <= max_dim; ++x)
+            {
+                for (auto y = x + 1; y <= max_dim; ++y)
+                {
+                    if (scheme(tile<Lyt>{x, y}) != scheme(tile<Lyt>{y, x}))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /**
+     * Claims the SMT instance of the given aspect ratio for examination. If the instance is identical to the one of
+     * the aspect ratio's transpose and the latter has already been claimed, there is no need to solve it again. Its
+     * result is either UNSAT or will be found by the thread that claimed the transpose.
+     *
+     * The caller is responsible for holding rar_mutex if multiple threads are involved.
+     *
+     * @param ar Aspect ratio to claim.
+     * @return `true` iff ar needs to be examined.
+     */
+    [[nodiscard]] bool claim_instance(const typename Lyt::aspect_ratio& ar)
+    {
+        if (!has_symmetric_transpose(ar))
+        {
+            return true;
+        }
+
+        const typename Lyt::aspect_ratio canonical{std::min(ar.x, ar.y), std::max(ar.x, ar.y)};
+
+        if (claimed_symmetric_aspect_ratios.insert(canonical).second)
+        {
+            return true;
+        }
+
+        pst.num_symmetric_aspect_ratios++;
+
+        return false;
+    }
     /**
      * Calculates the time left for solving by subtracting the time passed from the configured timeout and updates
      * Z3's timeout accordingly.
@@ -2843,8 +2944,10 @@ class exact_impl
     /**
      * Thread function for the asynchronous solving strategy. It registers its own context in the given list of
      * thread_info objects and starts exploring the search space. It fetches the next aspect ratio to work on from the
-     * global aspect ratio iterator which is protected by a mutex. When a result is found, other threads that are
-     * currently working on larger layout aspect ratios are interrupted while smaller ones may finish running.
+     * global aspect ratio iterator which is protected by a mutex. Before solving, the aspect ratio's area is compared
+     * against the best one found so far by any thread and aspect ratios whose transposes yield identical instances
+     * that have already been claimed are skipped. When a result is found, other threads that are currently working on
+     * larger or equally sized layout aspect ratios are interrupted while smaller ones may finish running.
      *
      * @param t_num Thread's identifier.
      * @param ti_list Pointer to a list of shared thread info that the threads use for communication.
@@ -2858,7 +2961,16 @@ class exact_impl
         Lyt layout{{}, scheme};
 
         smt_handler handler{ctx, layout, *ntk, ps, black_list};
-        (*ti_list)[t_num].ctx = ctx;
+
+        // register the context so that other threads can interrupt it
+        {
+            std::lock_guard<std::mutex> guard(rar_mutex);
+
+            (*ti_list)[t_num].ctx = ctx;
+        }
+
+        // each thread exclusively writes to its own entry; the vector has been sized before the threads were launched
+        auto& solver_time = pst.time_solver_per_thread[t_num];
 
         while (true)
         {
@@ -2885,57 +2997,52 @@ class exact_impl
                 continue;
             }
 
-            // mutually exclusive access to the result aspect ratio
+            // mutually exclusive access to the result aspect ratio and the shared thread information
             {
                 std::lock_guard<std::mutex> guard(rar_mutex);
 
-                // a result is available already
-                if (result_aspect_ratio)
+                // a result is available already; stop working if its area is smaller or equal to the one at hand
+                if (result_aspect_ratio && area(*result_aspect_ratio) <= area(ar))
                 {
-                    // stop working if its area is smaller or equal to the one currently at hand
-                    if (area(*result_aspect_ratio) <= area(ar))
-                    {
-                        return std::nullopt;
-                    }
+                    return std::nullopt;
+                }
+
+                // the transposed instance has been claimed already
+                if (!claim_instance(ar))
+                {
+                    continue;
                 }
+
+                // registering the aspect ratio under the same lock guarantees that a result found from now on
+                // interrupts this thread if it is dominated
+                (*ti_list)[t_num].worker_aspect_ratio = ar;
             }
 
-            // update aspect ratio in the thread_info list and the handler
-            (*ti_list)[t_num].worker_aspect_ratio = ar;
             handler.update(ar);
 
             try
             {
-                mockturtle::stopwatch stop{pst.time_total};
+                const auto sat =
+                    mockturtle::call_with_stopwatch(solver_time, [&handler] { return handler.is_satisfiable(); });
 
-                if (handler.is_satisfiable())  // found a layout
+                if (sat)  // found a layout
                 {
-                    // mutually exclusive access to the result_aspect_ratio
-                    {
-                        std::lock_guard<std::mutex> guard(rar_mutex);
+                    // mutually exclusive access to the result_aspect_ratio and the shared thread information
+                    std::lock_guard<std::mutex> guard(rar_mutex);
 
-                        // update the result_aspect_ratio if there is none
-                        if (!result_aspect_ratio)
-                        {
-                            result_aspect_ratio = ar;
-                        }
-                        else  // or if the own one is smaller
-                        {
-                            if (area(*result_aspect_ratio) > area(ar))
-                            {
-                                result_aspect_ratio = ar;
-                            }
-                            else
-                            {
-                                return std::nullopt;
-                            }
-                        }
+                    // another thread found an at least equally small layout in the meantime
+                    if (result_aspect_ratio && area(*result_aspect_ratio) <= area(ar))
+                    {
+                        return std::nullopt;
                     }
 
-                    // interrupt other threads that are working on higher aspect ratios
-                    for (const auto& ti : *ti_list)
+                    result_aspect_ratio = ar;
+
+                    // interrupt other threads that are working on dominated aspect ratios
+                    for (auto i = 0u; i < ti_list->size(); ++i)
                     {
-                        if (area(ar) <= area(ti.worker_aspect_ratio))
+                        if (const auto& ti = (*ti_list)[i];
+                            i != t_num && ti.ctx != nullptr && area(ar) <= area(ti.worker_aspect_ratio))
                         {
                             ti.ctx->interrupt();
                         }
@@ -2950,13 +3057,13 @@ class exact_impl
                 // state could be stored that could positively influence performance of later SMT calls
 
                 handler.store_solver_state(ar);
+
+                update_timeout(handler, solver_time);
             }
             catch (const z3::exception&)  // timed out or interrupted
             {
                 return std::nullopt;
             }
-
-            update_timeout(handler, pst.time_total);
         }
 
         // unreachable code, but compiler complains if it's not there
@@ -2981,6 +3088,8 @@ class exact_impl
 
             const auto ti_list = std::make_shared<std::vector<thread_info>>(ps.num_threads);
 
+            pst.time_solver_per_thread.assign(ps.num_threads, mockturtle::stopwatch<>::duration{0});
+
 #if (PROGRESS_BARS)
             mockturtle::progress_bar thread_bar("[i] examining layout aspect ratios using {} threads");
             thread_bar(ps.num_threads);
@@ -3076,7 +3185,7 @@ class exact_impl
             // log the examination of a new aspect ratio
             pst.num_aspect_ratios++;
 
-            if (handler.skippable(ar))
+            if (handler.skippable(ar) || !claim_instance(ar))
             {
                 continue;
             }
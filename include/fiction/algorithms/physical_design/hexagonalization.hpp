@@ -13,6 +13,7 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/placement_utils.hpp"
+#include "fiction/utils/profiling.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
 #include <fmt/format.h>
@@ -20,13 +21,17 @@
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -82,6 +87,12 @@ struct hexagonalization_params
      * Output extension mode. Defaults to none
      */
     io_pin_extension_mode output_pin_extension = io_pin_extension_mode::NONE;
+    /**
+     * Number of threads to use for the coordinate transformation. Diagonals of the Cartesian layout are remapped
+     * concurrently while the nodes are inserted into the hexagonal layout sequentially. By default, the number of
+     * threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 /**
@@ -536,86 +547,46 @@ class hexagonalization_impl
                 }
             }
 
-            // process internal nodes by iterating diagonally over the Cartesian layout
-            for (uint64_t k = 0; k < layout_width + layout_height - 1; ++k)
+            // pre-allocate the node storage of the hexagonal layout to avoid rehashing during the bulk insertion
+            if constexpr (has_reserve_v<HexLyt>)
             {
-                for (uint64_t x = 0; x <= k; ++x)
-                {
-                    const auto y = k - x;
-
-                    // ensure coordinate is within layout bounds
-                    if (y < layout_height && x < layout_width)
-                    {
-                        // iterate through all layers
-                        for (uint64_t z = 0; z <= hex_depth; ++z)
-                        {
-                            // define the current Cartesian tile
-                            tile<CartLyt> old_tile{x, y, z};
-
-                            // skip processing if tile is empty
-                            if (layout.is_empty_tile(old_tile))
-                            {
-                                continue;
-                            }
-
-                            // retrieve node associated with the current tile
-                            const auto node = layout.get_node(old_tile);
-
-                            // skip if node is a primary input
-                            if (layout.is_pi(node))
-                            {
-                                continue;
-                            }
-
-                            // convert the Cartesian tile to a hexagonal tile and adjust x-coordinate
-                            auto hex_tile = detail::to_hex<CartLyt, HexLyt>(old_tile, layout_height);
-                            hex_tile.x += offset_to_add - offset_to_subtract;
-
-                            x_max = std::max(static_cast<uint64_t>(hex_tile.x), x_max);
-                            y_max = std::max(static_cast<uint64_t>(hex_tile.y), y_max);
-
-                            // get incoming data flow signals for the tile
-                            const auto signals = layout.incoming_data_flow(old_tile);
-
-                            // process single input signals (buffer or inverter)
-                            if (signals.size() == 1)
-                            {
-                                const auto hex_source = [&signals, layout_height, offset_to_add, offset_to_subtract]
-                                {
-                                    auto t = detail::to_hex<CartLyt, HexLyt>(signals[0], layout_height);
-                                    t.x += offset_to_add - offset_to_subtract;
-                                    return t;
-                                }();
-
-                                // create a hex signal from the source
-                                const auto hex_signal = hex_layout.make_signal(hex_layout.get_node(hex_source));
+                hex_layout.reserve(layout.size());
+            }
 
-                                // create appropriate gate in hex layout based on node type
-                                if (!layout.is_po(node))
-                                {
-                                    [[maybe_unused]] const auto s =
-                                        place(hex_layout, hex_tile, layout, node, hex_signal);
-                                }
-                            }
-                            else if (signals.size() == 2)
-                            {
-                                // process two-input gates
-                                auto hex_tile_a = detail::to_hex<CartLyt, HexLyt>(signals[0], layout_height);
-                                auto hex_tile_b = detail::to_hex<CartLyt, HexLyt>(signals[1], layout_height);
+            // remap all internal nodes; this only reads the Cartesian layout and is therefore done in parallel
+            const auto remapped_diagonals =
+                remap_diagonals(layout_width, layout_height, hex_depth, offset_to_add - offset_to_subtract);
 
-                                // adjust coordinates for offset
-                                hex_tile_a.x += offset_to_add - offset_to_subtract;
-                                hex_tile_b.x += offset_to_add - offset_to_subtract;
+            // insert the remapped nodes diagonal by diagonal such that all fanins exist before their fanouts
+            for (const auto& diagonal : remapped_diagonals)
+            {
+                for (const auto& gate : diagonal)
+                {
+                    x_max = std::max(static_cast<uint64_t>(gate.hex_tile.x), x_max);
+                    y_max = std::max(static_cast<uint64_t>(gate.hex_tile.y), y_max);
 
-                                // create signals for both inputs
-                                const auto hex_signal_a = hex_layout.make_signal(hex_layout.get_node(hex_tile_a));
-                                const auto hex_signal_b = hex_layout.make_signal(hex_layout.get_node(hex_tile_b));
+                    // process single input signals (buffer or inverter)
+                    if (gate.num_fanins == 1)
+                    {
+                        // create a hex signal from the source
+                        const auto hex_signal = hex_layout.make_signal(hex_layout.get_node(gate.hex_fanins[0]));
 
-                                [[maybe_unused]] const auto s =
-                                    place(hex_layout, hex_tile, layout, node, hex_signal_a, hex_signal_b);
-                            }
+                        // create appropriate gate in hex layout based on node type
+                        if (!layout.is_po(gate.node))
+                        {
+                            [[maybe_unused]] const auto s =
+                                place(hex_layout, gate.hex_tile, layout, gate.node, hex_signal);
                         }
                     }
+                    else if (gate.num_fanins == 2)
+                    {
+                        // create signals for both inputs
+                        const auto hex_signal_a = hex_layout.make_signal(hex_layout.get_node(gate.hex_fanins[0]));
+                        const auto hex_signal_b = hex_layout.make_signal(hex_layout.get_node(gate.hex_fanins[1]));
+
+                        [[maybe_unused]] const auto s =
+                            place(hex_layout, gate.hex_tile, layout, gate.node, hex_signal_a, hex_signal_b);
+                    }
                 }
             }
 
@@ -997,6 +968,158 @@ class hexagonalization_impl
     }
 
   private:
+    /**
+     * Node of the Cartesian layout together with its tile and the tiles of its incoming signals in the hexagonal
+     * layout.
+     */
+    struct remapped_gate
+    {
+        /**
+         * Node in the Cartesian layout.
+         */
+        mockturtle::node<CartLyt> node;
+        /**
+         * Tile of the node in the hexagonal layout.
+         */
+        tile<HexLyt> hex_tile;
+        /**
+         * Tiles of the node's incoming signals in the hexagonal layout.
+         */
+        std::array<tile<HexLyt>, 2> hex_fanins{};
+        /**
+         * Number of incoming signals of the node.
+         */
+        std::size_t num_fanins{0};
+    };
+    /**
+     * Minimum number of Cartesian diagonals per thread. Smaller layouts are remapped sequentially as the overhead of
+     * spawning threads would outweigh the gains.
+     */
+    static constexpr uint64_t min_diagonals_per_thread = 32;
+    /**
+     * Converts the tiles of all internal nodes, i.e., all non-PI nodes, and of their incoming signals to hexagonal
+     * coordinates. Since the Cartesian layout is only read, diagonals are processed concurrently with each thread
+     * claiming the next unprocessed one. The result is grouped by diagonal. As the layout is 2DDWave-clocked, all
+     * fanins of a node are located on preceding diagonals.
+     *
+     * @param layout_width Width of the Cartesian layout.
+     * @param layout_height Height of the Cartesian layout.
+     * @param hex_depth Depth of the hexagonal layout.
+     * @param x_offset Offset to add to the x-coordinate of each hexagonal tile.
+     * @return Remapped nodes of each diagonal in the order of their x-coordinates and layers.
+     */
+    [[nodiscard]] std::vector<std::vector<remapped_gate>> remap_diagonals(const uint64_t layout_width,
+                                                                        const uint64_t layout_height,
+                                                                        const uint64_t hex_depth,
+                                                                        const uint64_t x_offset) const
+    {
+        FICTION_PROFILE_SCOPE("hexagonalization::remap_diagonals");
+
+        const auto num_diagonals = layout_width + layout_height - 1;
+
+        std::vector<std::vector<remapped_gate>> remapped(num_diagonals);
+
+        const auto to_shifted_hex = [layout_height, x_offset](const tile<CartLyt>& t)
+        {
+            auto hex_tile = detail::to_hex<CartLyt, HexLyt>(t, layout_height);
+            hex_tile.x += x_offset;
+
+            return hex_tile;
+        };
+
+        const auto remap_diagonal = [this, &remapped, &to_shifted_hex, layout_width, layout_height,
+                                     hex_depth](const uint64_t k)
+        {
+            auto& gates = remapped[k];
+
+            // restrict x such that y = k - x lies within the layout bounds
+            const auto x_begin = k >= layout_height ? k - layout_height + 1 : uint64_t{0};
+            const auto x_end   = std::min(k, layout_width - 1);
+
+            for (auto x = x_begin; x <= x_end; ++x)
+            {
+                // iterate through all layers
+                for (uint64_t z = 0; z <= hex_depth; ++z)
+                {
+                    const tile<CartLyt> old_tile{x, k - x, z};
+
+                    // skip empty tiles and primary inputs, which are handled separately
+                    if (layout.is_empty_tile(old_tile))
+                    {
+                        continue;
+                    }
+
+                    const auto node = layout.get_node(old_tile);
+
+                    if (layout.is_pi(node))
+                    {
+                        continue;
+                    }
+
+                    remapped_gate gate{node, to_shifted_hex(old_tile)};
+
+                    // get incoming data flow signals for the tile
+                    const auto signals = layout.incoming_data_flow(old_tile);
+
+                    gate.num_fanins = signals.size();
+
+                    for (std::size_t i = 0; i < std::min(signals.size(), gate.hex_fanins.size()); ++i)
+                    {
+                        gate.hex_fanins[i] = to_shifted_hex(signals[i]);
+                    }
+
+                    gates.push_back(gate);
+                }
+            }
+        };
+
+        const auto num_threads = std::min(std::max(ps.num_threads, std::size_t{1}),
+                                          static_cast<std::size_t>(num_diagonals / min_diagonals_per_thread));
+
+        if (num_threads <= 1)
+        {
+            for (uint64_t k = 0; k < num_diagonals; ++k)
+            {
+                remap_diagonal(k);
+            }
+
+            return remapped;
+        }
+
+        std::atomic<uint64_t> next_diagonal{0};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        thread_idle_recorder idle_recorder{"hexagonalization::thread_idle_time"};
+
+        for (std::size_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back(
+                [&next_diagonal, &remap_diagonal, &idle_recorder, num_diagonals]
+                {
+                    for (auto k = next_diagonal++; k < num_diagonals; k = next_diagonal++)
+                    {
+                        remap_diagonal(k);
+                    }
+
+                    idle_recorder.worker_finished();
+                });
+        }
+
+        // wait for all threads to complete
+        for (auto& thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        idle_recorder.threads_joined();
+
+        return remapped;
+    }
     /**
      * The 2DDWave-clocked layout to hexagonalize.
      */
@@ -17,7 +17,9 @@
 
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
@@ -66,7 +68,9 @@ template <typename CellLyt>
 struct on_the_fly_sidb_circuit_design_on_defective_surface_params
 {
     /**
-     * Parameters for the SiDB on-the-fly gate library.
+     * Parameters for the SiDB on-the-fly gate library. If no gate design cache is provided, a cache is created that is
+     * shared by all placement and routing attempts of a single call. Providing a cache, e.g., a persistent one, shares
+     * the designed gates across calls and program executions.
      */
     sidb_on_the_fly_gate_library_params<CellLyt> sidb_on_the_fly_gate_library_parameters = {};
     /**
@@ -109,6 +113,14 @@ struct on_the_fly_circuit_design_on_defective_surface_stats
      * The gate-level layout after P&R.
      */
     std::optional<GateLyt> gate_layout{};
+    /**
+     * Number of gate design tasks that were answered by the gate design cache.
+     */
+    uint64_t num_gate_design_cache_hits{0};
+    /**
+     * Number of gate design tasks that required a gate design.
+     */
+    uint64_t num_gate_design_cache_misses{0};
 };
 
 /**
@@ -163,6 +175,18 @@ template <typename Ntk, typename CellLyt, typename GateLyt>
 
         CellLyt lyt{};
 
+        // designed gates are reused across P&R attempts since tiles that are not affected by a blacklist update
+        // usually keep their requirements
+        auto library_params = params.sidb_on_the_fly_gate_library_parameters;
+
+        if (library_params.design_cache == nullptr)
+        {
+            library_params.design_cache = std::make_shared<sidb_gate_design_cache>();
+        }
+
+        const auto initial_hits   = library_params.design_cache->num_hits();
+        const auto initial_misses = library_params.design_cache->num_misses();
+
         // generating the blacklist based on neutral defects. The long-range electrostatic influence of charged defects
         // is not considered as gates are designed on-the-fly.
         auto black_list = sidb_surface_analysis<sidb_skeleton_bestagon_library, GateLyt, CellLyt>(
@@ -184,7 +208,7 @@ template <typename Ntk, typename CellLyt, typename GateLyt>
                     lyt = apply_parameterized_gate_library_to_defective_surface<
                         CellLyt, sidb_on_the_fly_gate_library, GateLyt,
                         sidb_on_the_fly_gate_library_params<cell<CellLyt>>>(
-                        *gate_level_layout, params.sidb_on_the_fly_gate_library_parameters, defective_surface);
+                        *gate_level_layout, library_params, defective_surface);
                 }
 
                 // on-the-fly gate design was unsuccessful at a certain tile. Hence, this tile-gate pair is added to the
@@ -216,6 +240,9 @@ template <typename Ntk, typename CellLyt, typename GateLyt>
         }
 
         result = lyt;
+
+        st.num_gate_design_cache_hits   = library_params.design_cache->num_hits() - initial_hits;
+        st.num_gate_design_cache_misses = library_params.design_cache->num_misses() - initial_misses;
     }
 
     if (stats)
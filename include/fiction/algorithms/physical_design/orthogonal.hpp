@@ -20,6 +20,7 @@
 #include <mockturtle/utils/stopwatch.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/topo_view.hpp>
+#include <phmap.h>
 
 #include <algorithm>
 #include <cstdint>
@@ -379,7 +380,7 @@ template <typename Ntk, typename Lyt>
 void place_outputs(Lyt& layout, const coloring_container<Ntk>& ctn, uint32_t po_counter,
                    const mockturtle::node_map<mockturtle::signal<Lyt>, decltype(ctn.color_ntk)>& node2pos)
 {
-    std::vector<mockturtle::node<Ntk>> output_nodes{};
+    phmap::flat_hash_set<mockturtle::node<Ntk>> output_nodes{};
 
     ctn.color_ntk.foreach_po(
         [&po_counter, &output_nodes, &node2pos, &ctn, &layout](const auto& po)
@@ -389,8 +390,7 @@ void place_outputs(Lyt& layout, const coloring_container<Ntk>& ctn, uint32_t po_
                 const auto n_s     = node2pos[po];
                 auto       po_tile = static_cast<tile<Lyt>>(n_s);
 
-                const auto multi_output_node =
-                    std::find(output_nodes.cbegin(), output_nodes.cend(), po) != output_nodes.cend();
+                const auto multi_output_node = output_nodes.count(po) > 0;
 
                 // determine PO orientation
                 if (!is_eastern_po_orientation_available(ctn, po) || multi_output_node)
@@ -422,7 +422,7 @@ void place_outputs(Lyt& layout, const coloring_container<Ntk>& ctn, uint32_t po_
                                      po_tile);
                 }
 
-                output_nodes.push_back(po);
+                output_nodes.insert(po);
             }
         });
 }
@@ -447,26 +447,30 @@ class orthogonal_impl
         mockturtle::node_map<mockturtle::signal<Lyt>, decltype(ctn.color_ntk)> node2pos{ctn.color_ntk};
 
         // find multi-output nodes
-        std::vector<mockturtle::node<decltype(ntk)>> output_nodes{};
-        std::vector<mockturtle::node<decltype(ntk)>> multi_output_nodes{};
-        uint32_t                                     num_multi_output_nodes{0};
+        phmap::flat_hash_set<mockturtle::node<decltype(ntk)>> output_nodes{};
+        phmap::flat_hash_set<mockturtle::node<decltype(ntk)>> multi_output_nodes{};
+        uint32_t                                              num_multi_output_nodes{0};
 
         ctn.color_ntk.foreach_po(
             [&](const auto& po)
             {
-                if (std::find(output_nodes.cbegin(), output_nodes.cend(), po) != output_nodes.cend())
+                if (!output_nodes.insert(po).second)
                 {
-                    multi_output_nodes.push_back(po);
+                    multi_output_nodes.insert(po);
                     ++num_multi_output_nodes;
                 }
-
-                output_nodes.push_back(po);
             });
 
         // instantiate the layout
         Lyt layout{determine_layout_size<Lyt>(ctn, num_multi_output_nodes),
                    twoddwave_clocking<Lyt>(ps.number_of_clock_phases)};
 
+        // each network node occupies at least one tile; pre-allocating avoids rehashing while placing large networks
+        if constexpr (has_reserve_v<Lyt>)
+        {
+            layout.reserve(ctn.color_ntk.size());
+        }
+
         // reserve PI nodes without positions
         auto pi2node = reserve_input_nodes(layout, ctn.color_ntk);
 
@@ -600,9 +604,8 @@ class orthogonal_impl
                         node2pos[n] = connect_and_place(layout, t, ctn.color_ntk, n, pre1_t, pre2_t, fc.constant_fanin);
                     }
 
-                    if (ctn.color_ntk.is_po(n) && (!is_eastern_po_orientation_available(ctn, n) ||
-                                                   std::find(multi_output_nodes.cbegin(), multi_output_nodes.cend(),
-                                                             n) != multi_output_nodes.cend()))
+                    if (ctn.color_ntk.is_po(n) &&
+                        (!is_eastern_po_orientation_available(ctn, n) || multi_output_nodes.count(n) > 0))
                     {
                         ++latest_pos.y;
                     }
@@ -19,10 +19,13 @@
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <ostream>
@@ -43,6 +46,10 @@ struct wiring_reduction_params
      * at every algorithm step and the functional correctness has to be ensured by completing essential algorithm steps.
      */
     uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    /**
+     * Search for horizontal and vertical cuts concurrently on two threads.
+     */
+    bool enable_multithreading = true;
 };
 
 /**
@@ -717,6 +724,119 @@ void update_to_delete_list(WiringReductionLyt& lyt, const layout_coordinate_path
         }
     }
 }
+/**
+ * Collects a maximal set of disjoint cuts through a `wiring_reduction_layout` in a single sweep and adds their
+ * coordinates to the to-delete list.
+ *
+ * Repeatedly searching for a cut via A* and obstructing it afterward explores the whole layout once per cut. Instead,
+ * this function performs a depth-first search from the upper left to the lower right corner that prefers the
+ * uppermost (leftmost) successors. Whenever a cut is found, it is obstructed via `update_to_delete_list` and the search
+ * restarts. Coordinates from which the lower right corner turned out to be unreachable are remembered across restarts
+ * because obstructions are only ever added. Since all cuts are monotone, the search graph is acyclic and each
+ * coordinate is discarded at most once, which results in a total runtime of \f$\mathcal{O}(w \cdot h + k \cdot
+ * (w + h))\f$ for \f$k\f$ cuts on a \f$w \times h\f$ layout.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+ * @param lyt The `wiring_reduction_layout` to search and obstruct.
+ * @param to_delete Reference to the to-delete list to be updated with the coordinates of all cuts.
+ * @return The number of cuts found.
+ */
+template <typename Lyt, typename WiringReductionLyt>
+uint64_t collect_cuts(WiringReductionLyt& lyt, layout_coordinate_path<WiringReductionLyt>& to_delete) noexcept
+{
+    using coord_t = coordinate<WiringReductionLyt>;
+
+    /**
+     * A coordinate on the current search path together with its successors that are still to be explored.
+     */
+    struct frame
+    {
+        coord_t                c;
+        std::array<coord_t, 4> successors;
+        uint8_t                num_successors;
+        uint8_t                next_successor;
+    };
+
+    const coord_t source{0, 0};
+    const coord_t target{lyt.x(), lyt.y()};
+
+    const auto index = [&lyt](const coord_t& c) noexcept
+    { return static_cast<std::size_t>(c.y) * static_cast<std::size_t>(lyt.x() + 1) + static_cast<std::size_t>(c.x); };
+
+    // coordinates from which the target is known to be unreachable
+    std::vector<bool> dead(static_cast<std::size_t>(lyt.x() + 1) * static_cast<std::size_t>(lyt.y() + 1), false);
+
+    std::vector<frame> stack{};
+    stack.reserve(static_cast<std::size_t>(lyt.x() + lyt.y() + 1));
+
+    const auto push = [&lyt, &stack](const coord_t& c) noexcept
+    {
+        frame f{c, {}, 0, 0};
+
+        lyt.foreach_adjacent_coordinate(c,
+                                        [&f](const auto& successor) noexcept
+                                        {
+                                            if (f.num_successors < f.successors.size())
+                                            {
+                                                f.successors[f.num_successors++] = successor;
+                                            }
+                                        });
+
+        stack.push_back(f);
+    };
+
+    uint64_t num_cuts = 0;
+
+    while (!dead[index(source)])
+    {
+        stack.clear();
+        push(source);
+
+        while (!stack.empty() && stack.back().c != target)
+        {
+            auto& top = stack.back();
+
+            // all successors are exhausted
+            if (top.next_successor == top.num_successors)
+            {
+                dead[index(top.c)] = true;
+                stack.pop_back();
+
+                continue;
+            }
+
+            const auto current   = top.c;
+            const auto successor = top.successors[top.next_successor++];
+
+            if (dead[index(successor)] || (lyt.is_obstructed_coordinate(successor) && successor != target) ||
+                lyt.is_obstructed_connection(current, successor))
+            {
+                continue;
+            }
+
+            push(successor);
+        }
+
+        if (stack.empty())
+        {
+            break;
+        }
+
+        layout_coordinate_path<WiringReductionLyt> cut{};
+
+        for (const auto& f : stack)
+        {
+            cut.append(f.c);
+        }
+
+        update_to_delete_list<Lyt, WiringReductionLyt>(lyt, cut, to_delete);
+
+        ++num_cuts;
+    }
+
+    return num_cuts;
+}
 /**
  * Offset matrix type alias.
  */
@@ -728,7 +848,8 @@ using offset_matrix = std::vector<std::vector<uint64_t>>;
  * coordinate when searching from left to right.
  * When searching from top to bottom, the offset matrix represents the number of deletable coordinates in the same row
  * but to the left of each specific coordinate.
- * The matrix is initialized with zeros and updated by incrementing the values for each deletable coordinate.
+ * The matrix is computed in \f$\mathcal{O}(w \cdot h)\f$ time by marking the coordinate below (right of) each
+ * deletable coordinate and accumulating these marks along the columns (rows).
  *
  * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
  * @param lyt The `wiring_reduction_layout` for which the offset matrix is calculated.
@@ -743,24 +864,43 @@ calculate_offset_matrix(const WiringReductionLyt&                         lyt,
     // initialize matrix with zeros
     offset_matrix matrix(lyt.y() + 1, std::vector<uint64_t>(lyt.x() + 1, 0));
 
-    // update matrix based on coordinates
+    // mark the deletable coordinates
     for (const auto& coord : to_delete)
     {
-        const auto x = coord.x;
-        const auto y = coord.y;
-
         if (lyt.get_search_direction() == search_direction::HORIZONTAL)
         {
-            for (uint64_t i = lyt.y(); i > y; --i)
+            if (coord.y < lyt.y())
             {
-                matrix[i][x] += 1;
+                matrix[coord.y + 1][coord.x] += 1;
             }
         }
         else
         {
-            for (uint64_t i = lyt.x(); i > x; --i)
+            if (coord.x < lyt.x())
+            {
+                matrix[coord.y][coord.x + 1] += 1;
+            }
+        }
+    }
+
+    // accumulate the marks along the columns (rows) to obtain the offsets in O(width * height)
+    for (uint64_t y = 0; y <= lyt.y(); ++y)
+    {
+        for (uint64_t x = 0; x <= lyt.x(); ++x)
+        {
+            if (lyt.get_search_direction() == search_direction::HORIZONTAL)
+            {
+                if (y > 0)
+                {
+                    matrix[y][x] += matrix[y - 1][x];
+                }
+            }
+            else
             {
-                matrix[y][i] += 1;
+                if (x > 0)
+                {
+                    matrix[y][x] += matrix[y][x - 1];
+                }
             }
         }
     }
@@ -1082,10 +1222,25 @@ class wiring_reduction_impl
         // create an obstruction layout based on the original layout
         auto layout = obstruction_layout<Lyt>(plyt);
 
-        // initialize the list of wires to delete
-        layout_coordinate_path<wiring_reduction_layout_type<coordinate<Lyt>>> to_delete = {};
+        using wiring_reduction_lyt_type = wiring_reduction_layout_type<coordinate<Lyt>>;
+
+        // the cuts found in one search direction
+        struct cut_search_result
+        {
+            wiring_reduction_lyt_type                         wiring_reduction_lyt;
+            layout_coordinate_path<wiring_reduction_lyt_type> to_delete;
+        };
+
+        // searches the current layout for a maximal set of disjoint cuts in the given direction
+        const auto search_cuts = [&layout](const search_direction direction) noexcept
+        {
+            cut_search_result result{create_wiring_reduction_layout<Lyt>(layout, 1, 1, direction), {}};
+            add_obstructions(result.wiring_reduction_lyt);
+
+            collect_cuts<Lyt, wiring_reduction_lyt_type>(result.wiring_reduction_lyt, result.to_delete);
 
-        bool found_wires = true;
+            return result;
+        };
 
         // lambda to update the timeout status and calculate remaining time
         const auto update_timeout = [start_time = this->start, &params = this->ps,
@@ -1098,63 +1253,44 @@ class wiring_reduction_impl
         };
 
         // perform wiring reduction iteratively until no further wires can be deleted
-        while (found_wires && !timeout_limit_reached)
+        while (!timeout_limit_reached)
         {
-            found_wires = false;
+            // update the remaining timeout
+            update_timeout();
 
-            for (const auto direction : {search_direction::HORIZONTAL, search_direction::VERTICAL})
+            if (timeout_limit_reached)
             {
-                // update the remaining timeout
-                update_timeout();
-
-                if (timeout_limit_reached)
-                {
-                    break;
-                }
-
-                // create wiring reduction layout for the current direction
-                auto wiring_reduction_lyt = create_wiring_reduction_layout<Lyt>(layout, 1, 1, direction);
-                add_obstructions(wiring_reduction_lyt);
-
-                // update the remaining timeout
-                update_timeout();
-
-                if (timeout_limit_reached)
-                {
-                    break;
-                }
-
-                // reset the list of wires to delete
-                to_delete.clear();
+                break;
+            }
 
-                // get the initial possible path for wire deletion
-                auto possible_path =
-                    get_path(wiring_reduction_lyt, {0, 0}, {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
+            // both directions only read the current layout and can therefore be searched concurrently
+            auto vertical_search = std::async(ps.enable_multithreading ? std::launch::async : std::launch::deferred,
+                                              search_cuts, search_direction::VERTICAL);
 
-                // iterate while there is a possible path and timeout not reached
-                while (!possible_path.empty() && !timeout_limit_reached)
-                {
-                    // update the list of wires to delete based on the current path
-                    update_to_delete_list<Lyt, wiring_reduction_layout_type<coordinate<Lyt>>>(wiring_reduction_lyt,
-                                                                                              possible_path, to_delete);
+            auto horizontal = search_cuts(search_direction::HORIZONTAL);
+            auto vertical   = vertical_search.get();
 
-                    // update the remaining timeout after processing the path
-                    update_timeout();
+            // update the remaining timeout
+            update_timeout();
 
-                    if (!timeout_limit_reached)
-                    {
-                        // get the next possible path for wire deletion
-                        possible_path = get_path(wiring_reduction_lyt, {0, 0},
-                                                 {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
-                    }
-                }
+            if (timeout_limit_reached)
+            {
+                break;
+            }
 
-                if (!to_delete.empty())
-                {
-                    // delete the identified wires from the layout
-                    delete_wires(layout, wiring_reduction_lyt, to_delete);
-                    found_wires = true;
-                }
+            // the vertical cuts refer to the layout before any deletion and are thus only applicable if no horizontal
+            // cuts were found; otherwise, they are searched for again on the updated layout in the next iteration
+            if (!horizontal.to_delete.empty())
+            {
+                delete_wires(layout, horizontal.wiring_reduction_lyt, horizontal.to_delete);
+            }
+            else if (!vertical.to_delete.empty())
+            {
+                delete_wires(layout, vertical.wiring_reduction_lyt, vertical.to_delete);
+            }
+            else
+            {
+                break;
             }
         }
 
@@ -1221,9 +1357,10 @@ class wiring_reduction_impl
  * upon the ability to restore functional correctness by realigning the remaining layout fragments. Given the complexity
  * of identifying these cuts, obstructions are strategically inserted into the layout to safeguard against the
  * inadvertent deletion of standard gates or wire segments essential for the layout's integrity. Leveraging the
- * obstructed layout as a basis, A* Search is employed to systematically identify feasible cuts either from left to
- * right or top to bottom. Subsequently, these identified cuts are removed from the layout to minimize not only the
- * number of wire segments, but also the area and critical path length.
+ * obstructed layout as a basis, a maximal set of disjoint cuts either from left to right or top to bottom is
+ * identified in a single sweep, where both directions are searched concurrently. Subsequently, the identified cuts of
+ * one direction are removed from the layout in one batch to minimize not only the number of wire segments, but also the
+ * area and critical path length.
  *
  * @tparam Lyt Cartesian gate-level layout type.
  * @param lyt The 2DDWave-clocked layout whose wiring is to be reduced.
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -99,6 +100,13 @@ struct clustercomplete_params
      * option is disabled.
      */
     ground_state_space_reporting report_gss_stats = ground_state_space_reporting::OFF;
+    /**
+     * Only physically valid charge distributions whose electrostatic potential energy exceeds the one of the ground
+     * state by at most this value are returned (unit: eV). Charge distributions outside the window above the lowest
+     * energy found so far are discarded during the unfolding stage. By default, all physically valid charge
+     * distributions are returned.
+     */
+    double energy_window = std::numeric_limits<double>::infinity();
 };
 
 namespace detail
@@ -116,6 +124,7 @@ class clustercomplete_impl
      */
     clustercomplete_impl(const Lyt& lyt, const clustercomplete_params<cell<Lyt>>& params) noexcept :
             available_threads{std::max(uint64_t{1}, params.available_threads)},
+            energy_window{params.energy_window},
             charge_layout{initialize_charge_layout(lyt, params)},
             mu_bounds_with_error{constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
                                  -constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
@@ -211,6 +220,9 @@ class clustercomplete_impl
             }
         }
 
+        // charge distributions that were stored before the final ground state was found may lie outside the window
+        result.restrict_to_energy_window(energy_window);
+
         // The ClusterComplete runtime includes the runtime for the Ground State Space procedure
         result.simulation_runtime = time_counter + gss_stats.runtime;
 
@@ -230,6 +242,15 @@ class clustercomplete_impl
      * Number of available threads.
      */
     const uint64_t available_threads;
+    /**
+     * Maximum energy above the ground state of the charge distributions to return (unit: eV).
+     */
+    const double energy_window;
+    /**
+     * Lowest electrostatic potential energy of all charge distributions found so far (unit: eV). It is protected by
+     * `mutex_to_protect_the_simulation_results`.
+     */
+    double lowest_energy_found{std::numeric_limits<double>::infinity()};
     /**
      * Vector containing all workers.
      */
@@ -440,6 +461,15 @@ class clustercomplete_impl
         {
             const std::lock_guard lock{mutex_to_protect_the_simulation_results};
 
+            const auto energy = charge_layout_copy.get_electrostatic_potential_energy();
+
+            lowest_energy_found = std::min(lowest_energy_found, energy);
+
+            if (energy > lowest_energy_found + energy_window + constants::ERROR_MARGIN)
+            {
+                return;
+            }
+
             result.charge_distributions.emplace_back(charge_layout_copy);
         }
     }
@@ -18,20 +18,26 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/algorithms/simulation/sidb/sim_anneal.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/constants.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/profiling.hpp"
 
 #include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -65,6 +71,34 @@ struct critical_temperature_params
      * Alpha parameter for the *QuickSim* algorithm (only applicable if engine == QUICKSIM).
      */
     double alpha{0.7};
+    /**
+     * Modes to restrict gate-based simulations to the charge distributions that are relevant for the critical
+     * temperature.
+     */
+    enum class energy_window_restriction : uint8_t
+    {
+        /**
+         * Charge distributions whose energy above the ground state is too large to be noticeably populated at
+         * `max_temperature` for the given `confidence_level` are discarded. The exact simulation engines prune them
+         * already during the enumeration.
+         */
+        ON,
+        /**
+         * All physically valid charge distributions are considered.
+         */
+        OFF
+    };
+    /**
+     * Restriction of gate-based simulations to an energy window above the ground state. If `ON`, the
+     * `energy_between_ground_state_and_first_erroneous` statistic is only determined for erroneous states within the
+     * window and `num_valid_lyt` only counts charge distributions within the window. By default, the restriction is
+     * disabled.
+     */
+    energy_window_restriction energy_window = energy_window_restriction::OFF;
+    /**
+     * Number of threads to simulate the input patterns of gate-based simulations in parallel.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
 };
 
 /**
@@ -125,7 +159,6 @@ class critical_temperature_impl
             layout{lyt},
             params{ps},
             stats{st},
-            bii(bdl_input_iterator<Lyt>{layout, params.operational_params.input_bdl_iterator_params}),
             critical_temperature{ps.max_temperature}
     {
         stats.simulation_parameters = params.operational_params.simulation_parameters;
@@ -153,70 +186,104 @@ class critical_temperature_impl
 
         if (layout.num_cells() > 1)
         {
-            const auto output_bdl_pairs =
-                detect_bdl_pairs(layout, sidb_technology::cell_type::OUTPUT,
-                                 params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params);
+            const auto& iterator_params = params.operational_params.input_bdl_iterator_params;
+
+            const auto output_bdl_pairs = detect_bdl_pairs(layout, sidb_technology::cell_type::OUTPUT,
+                                                           iterator_params.bdl_wire_params.bdl_pairs_params);
+
+            const auto input_bdl_wires =
+                detect_bdl_wires(layout, iterator_params.bdl_wire_params, bdl_wire_selection::INPUT);
 
-            auto input_bdl_wires  = std::vector<bdl_wire<Lyt>>{};
             auto output_bdl_wires = std::vector<bdl_wire<Lyt>>{};
 
             if (params.operational_params.op_condition == is_operational_params::operational_condition::REJECT_KINKS)
             {
-                input_bdl_wires =
-                    detect_bdl_wires(layout, params.operational_params.input_bdl_iterator_params.bdl_wire_params,
-                                     bdl_wire_selection::INPUT);
                 output_bdl_wires =
-                    detect_bdl_wires(layout, params.operational_params.input_bdl_iterator_params.bdl_wire_params,
-                                     bdl_wire_selection::OUTPUT);
+                    detect_bdl_wires(layout, iterator_params.bdl_wire_params, bdl_wire_selection::OUTPUT);
             }
 
             // number of different input combinations
-            for (auto i = 0u; i < spec.front().num_bits(); ++i, ++bii)
+            const uint64_t num_input_patterns = spec.front().num_bits();
+
+            const auto energy_window = relevant_energy_window();
+
+            std::vector<std::optional<input_pattern_result>> pattern_results(num_input_patterns);
+
+            // the results of all input patterns after the first non-operational one are irrelevant
+            std::atomic<uint64_t> first_non_operational_pattern{num_input_patterns};
+            std::atomic<uint64_t> next_pattern{0};
+
+            thread_idle_recorder idle_recorder{"critical_temperature::thread_idle_time"};
+
+            const auto simulate_input_patterns = [&]
             {
-                // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
-                if (can_positive_charges_occur(*bii, params.operational_params.simulation_parameters))
+                // each thread works on its own deep copy of the layout
+                bdl_input_iterator<Lyt> bii{layout, iterator_params, input_bdl_wires};
+
+                for (auto i = next_pattern++; i < num_input_patterns; i = next_pattern++)
                 {
-                    critical_temperature = 0.0;
-                    return;
+                    if (i > first_non_operational_pattern.load())
+                    {
+                        continue;
+                    }
+
+                    bii = i;
+
+                    pattern_results[i] =
+                        simulate_input_pattern(*bii, spec, bii.get_current_input_index(), energy_window,
+                                               output_bdl_pairs, input_bdl_wires, output_bdl_wires);
+
+                    if (!pattern_results[i].has_value())
+                    {
+                        auto current = first_non_operational_pattern.load();
+                        while (i < current && !first_non_operational_pattern.compare_exchange_weak(current, i)) {}
+                    }
                 }
 
-                // performs physical simulation of a given SiDB layout at a given input combination
-                const auto sim_result = physical_simulation_of_bdl_iterator(bii);
+                idle_recorder.worker_finished();
+            };
+
+            const auto num_threads = std::max(uint64_t{1}, std::min(params.number_threads, num_input_patterns));
+
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads - 1);
+
+            for (uint64_t t = 1; t < num_threads; ++t)
+            {
+                threads.emplace_back(simulate_input_patterns);
+            }
+
+            simulate_input_patterns();
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            idle_recorder.threads_joined();
 
-                if (sim_result.charge_distributions.empty())
+            // merge the results in order of the input patterns
+            for (const auto& pattern_result : pattern_results)
+            {
+                // if positively charged SiDBs can occur or no physically valid charge distribution exists, the SiDB
+                // layout is considered as non-operational
+                if (!pattern_result.has_value())
                 {
                     critical_temperature = 0.0;
                     return;
                 }
-                stats.num_valid_lyt = sim_result.charge_distributions.size();
-                // The energy distribution of the physically valid charge configurations for the given layout is
-                // determined.
-                const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
 
-                sidb_energy_and_state_type energy_state_type{};
+                stats.num_valid_lyt = pattern_result->num_valid_lyt;
 
-                if (params.operational_params.op_condition ==
-                    is_operational_params::operational_condition::REJECT_KINKS)
-                {
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_rejected<Lyt>(
-                        distribution, sim_result.charge_distributions, spec, i, input_bdl_wires, output_bdl_wires);
-                }
-                else
+                if (pattern_result->energy_to_first_erroneous < stats.energy_between_ground_state_and_first_erroneous)
                 {
-                    // A label that indicates whether the state still fulfills the logic.
-                    energy_state_type = calculate_energy_and_state_type_with_kinks_accepted<Lyt>(
-                        distribution, sim_result.charge_distributions, output_bdl_pairs, spec, i);
+                    stats.energy_between_ground_state_and_first_erroneous = pattern_result->energy_to_first_erroneous;
                 }
 
-                const auto min_energy = energy_state_type.cbegin()->first;
-
-                auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
-
-                if (ground_state_is_transparent)
+                if (pattern_result->ground_state_is_transparent)
                 {
-                    this->determine_critical_temperature(energy_state_type);
+                    critical_temperature = std::min(critical_temperature, pattern_result->critical_temperature);
                 }
-
                 else
                 {
                     critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
@@ -270,6 +337,22 @@ class critical_temperature_impl
                 return;
             }
         }
+        else if (params.operational_params.sim_engine == sidb_simulation_engine::SIMANNEAL)
+        {
+            sim_anneal_params sa_params{};
+            sa_params.simulation_parameters = params.operational_params.simulation_parameters;
+
+            // Physically valid charge configurations are determined for the given layout (probabilistic ground state
+            // simulation is used).
+            if (const auto result = sim_anneal(layout, sa_params); result.has_value())
+            {
+                simulation_results = result.value();
+            }
+            else
+            {
+                return;
+            }
+        }
         else
         {
             assert(false && "unsupported simulation engine");
@@ -339,20 +422,116 @@ class critical_temperature_impl
 
   private:
     /**
-     * The energy difference between the ground state and the first erroneous state is determined. Additionally, the
-     * state type of the ground state is determined and returned.
+     * Probability mass that the charge distributions outside the energy window may carry at most at `max_temperature`,
+     * relative to the threshold `1 - confidence_level`.
+     */
+    static constexpr double ENERGY_WINDOW_TOLERANCE = 1e-6;
+    /**
+     * Result of the simulation of a single input pattern.
+     */
+    struct input_pattern_result
+    {
+        /**
+         * Number of physically valid charge configurations within the energy window.
+         */
+        uint64_t num_valid_lyt{0};
+        /**
+         * `true` iff at least one ground state fulfills the logic.
+         */
+        bool ground_state_is_transparent{false};
+        /**
+         * Energy difference between the ground state and the first erroneous state (unit: meV).
+         */
+        double energy_to_first_erroneous{std::numeric_limits<double>::infinity()};
+        /**
+         * Critical temperature for this input pattern alone (unit: K).
+         */
+        double critical_temperature{0.0};
+    };
+    /**
+     * Determines the energy window above the ground state that contains all charge distributions that are relevant for
+     * the critical temperature. The Boltzmann factor of a charge distribution with energy \f$\Delta E\f$ above the
+     * ground state is at most \f$e^{-\Delta E / k_B T_{max}}\f$ for all considered temperatures. With at most
+     * \f$b^N\f$ charge distributions for \f$N\f$ SiDBs and base number \f$b\f$, the occupation probability of all
+     * charge distributions outside the window is bounded by `ENERGY_WINDOW_TOLERANCE` \f$\cdot (1 - \eta)\f$. Hence,
+     * pruning them cannot change the critical temperature beyond that tolerance.
      *
-     * @param energy_and_state_type All energies of all physically valid charge distributions with the corresponding
-     * state type (i.e. transparent, erroneous).
-     * @param min_energy Minimal energy of all physically valid charge distributions of a given layout (unit: eV).
-     * @return State type (i.e. transparent, erroneous) of the ground state is returned.
+     * @return Energy window above the ground state (unit: eV).
+     */
+    [[nodiscard]] double relevant_energy_window() const noexcept
+    {
+        if (params.energy_window == critical_temperature_params::energy_window_restriction::OFF ||
+            params.confidence_level >= 1.0)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        const auto thermal_energy = constants::physical::BOLTZMANN_CONSTANT * params.max_temperature /
+                                    constants::physical::EV_TO_JOULE;  // unit: eV
+
+        const auto log_num_charge_distributions =
+            static_cast<double>(layout.num_cells()) *
+            std::log(static_cast<double>(params.operational_params.simulation_parameters.base));
+
+        return thermal_energy *
+               (log_num_charge_distributions - std::log(ENERGY_WINDOW_TOLERANCE * (1.0 - params.confidence_level)));
+    }
+    /**
+     * Simulates the layout at a single input pattern and determines the critical temperature for this pattern alone.
+     * This function does not alter the state of this object and can, thus, be called concurrently.
+     *
+     * @tparam TT Type of the truth table.
+     * @param lyt Layout with the input pattern applied.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param input_pattern Index of the input pattern.
+     * @param energy_window Energy window above the ground state that is relevant (unit: eV).
+     * @param output_bdl_pairs Output BDL pairs.
+     * @param input_bdl_wires Input BDL wires.
+     * @param output_bdl_wires Output BDL wires.
+     * @return Result of the input pattern or `std::nullopt` if the layout is non-operational at this pattern because
+     * positively charged SiDBs can occur or no physically valid charge distribution exists.
      */
-    [[nodiscard]] bool is_ground_state_transparent(const sidb_energy_and_state_type& energy_and_state_type,
-                                                   const double                      min_energy) const noexcept
+    template <typename TT>
+    [[nodiscard]] std::optional<input_pattern_result>
+    simulate_input_pattern(const Lyt& lyt, const std::vector<TT>& spec, const uint64_t input_pattern,
+                           const double energy_window, const std::vector<bdl_pair<cell<Lyt>>>& output_bdl_pairs,
+                           const std::vector<bdl_wire<Lyt>>& input_bdl_wires,
+                           const std::vector<bdl_wire<Lyt>>& output_bdl_wires) const noexcept
     {
-        bool ground_state_is_transparent = false;
+        FICTION_PROFILE_SCOPE("critical_temperature::simulate_input_pattern");
+
+        // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
+        if (can_positive_charges_occur(lyt, params.operational_params.simulation_parameters))
+        {
+            return std::nullopt;
+        }
+
+        // performs physical simulation of a given SiDB layout at a given input combination
+        const auto sim_result = physical_simulation(lyt, energy_window);
+
+        if (sim_result.charge_distributions.empty())
+        {
+            return std::nullopt;
+        }
+
+        input_pattern_result pattern_result{};
+        pattern_result.num_valid_lyt = sim_result.charge_distributions.size();
+
+        // The energy distribution of the physically valid charge configurations for the given layout is determined.
+        const auto distribution = calculate_energy_distribution(sim_result.charge_distributions);
 
-        for (const auto& [energy, state_type] : energy_and_state_type)
+        const auto energy_state_type =
+            params.operational_params.op_condition == is_operational_params::operational_condition::REJECT_KINKS ?
+                calculate_energy_and_state_type_with_kinks_rejected<Lyt>(distribution, sim_result.charge_distributions,
+                                                                         spec, input_pattern, input_bdl_wires,
+                                                                         output_bdl_wires) :
+                // A label that indicates whether the state still fulfills the logic.
+                calculate_energy_and_state_type_with_kinks_accepted<Lyt>(distribution, sim_result.charge_distributions,
+                                                                         output_bdl_pairs, spec, input_pattern);
+
+        const auto min_energy = energy_state_type.cbegin()->first;
+
+        for (const auto& [energy, state_type] : energy_state_type)
         {
             // Check if there is at least one ground state that satisfies the logic (transparent). Round the energy
             // value of the given valid_layout to six decimal places to overcome possible rounding errors and for
@@ -361,52 +540,53 @@ class critical_temperature_impl
                     constants::ERROR_MARGIN &&
                 state_type == state_type::ACCEPTED)
             {
-                ground_state_is_transparent = true;
+                pattern_result.ground_state_is_transparent = true;
             }
 
-            if ((state_type == state_type::REJECTED) && (energy > min_energy) && ground_state_is_transparent &&
-                (((energy - min_energy) * 1000) < stats.energy_between_ground_state_and_first_erroneous))
+            if ((state_type == state_type::REJECTED) && (energy > min_energy) &&
+                pattern_result.ground_state_is_transparent)
             {
                 // The energy difference is stored in meV.
-                stats.energy_between_ground_state_and_first_erroneous = (energy - min_energy) * 1000;
+                pattern_result.energy_to_first_erroneous = (energy - min_energy) * 1000;
                 break;
             }
         }
-        return ground_state_is_transparent;
-    };
+
+        if (pattern_result.ground_state_is_transparent)
+        {
+            pattern_result.critical_temperature = determine_critical_temperature(energy_state_type);
+        }
+
+        return pattern_result;
+    }
     /**
      * The *Critical Temperature* is determined.
      *
      * @param energy_state_type All energies of all physically valid charge distributions with the corresponding
      * state type (i.e. transparent, erroneous).
+     * @return The lowest temperature at which the occupation probability of erroneous states exceeds the threshold, or
+     * `max_temperature` if there is none (unit: K).
      */
-    void determine_critical_temperature(const sidb_energy_and_state_type& energy_state_type) noexcept
+    [[nodiscard]] double
+    determine_critical_temperature(const sidb_energy_and_state_type& energy_state_type) const noexcept
     {
-        // Vector with temperature values from 0.01 to max_temperature * 100 K in 0.01 K steps is generated.
-        std::vector<double> temp_values{};
-        temp_values.reserve(static_cast<uint64_t>(params.max_temperature * 100));
+        const auto num_temperature_steps = static_cast<uint64_t>(params.max_temperature * 100);
 
-        for (uint64_t i = 1; i <= static_cast<uint64_t>(params.max_temperature * 100); i++)
-        {
-            temp_values.emplace_back(static_cast<double>(i) / 100.0);
-        }
-        // This function determines the Critical Temperature for a given confidence level.
-        for (const auto& temp : temp_values)
+        // Temperature values from 0.01 to max_temperature K in 0.01 K steps are examined.
+        for (uint64_t i = 1; i <= num_temperature_steps; i++)
         {
+            const auto temp = static_cast<double>(i) / 100.0;
+
             // If the occupation probability of erroneous states exceeds the given threshold...
-            if (occupation_probability_gate_based(energy_state_type, temp) > (1 - params.confidence_level) &&
-                (temp < critical_temperature))
-            {
-                // The current temperature is stored as Critical Temperature.
-                critical_temperature = temp;
-                break;
-            }
-            if (std::abs(temp - params.max_temperature) < 0.001 && (temp < critical_temperature))
+            if (occupation_probability_gate_based(energy_state_type, temp) > (1 - params.confidence_level))
             {
-                // Maximal temperature is stored as Critical Temperature.
-                critical_temperature = params.max_temperature;
+                // The current temperature is the Critical Temperature.
+                return temp;
             }
         }
+
+        // Maximal temperature is the Critical Temperature.
+        return params.max_temperature;
     }
 
     /**
@@ -421,44 +601,47 @@ class critical_temperature_impl
      * Statistics.
      */
     critical_temperature_stats& stats;
-    /**
-     * Iterator that iterates over all possible input states.
-     */
-    bdl_input_iterator<Lyt> bii;
     /**
      * Critical temperature [K].
      */
     double critical_temperature;
     /**
      * This function conducts physical simulation of the given layout (gate layout with certain input combination).
-     * The simulation results are stored in the `sim_result_100` variable.
      *
-     * @param bdl_iterator A reference to a BDL input iterator representing the gate layout at a given input
-     * combination. The simulation is performed based on the configuration represented by the iterator.
+     * @param lyt The gate layout at a given input combination.
+     * @param energy_window Only charge distributions within this energy window above the ground state are returned
+     * (unit: eV). The exact simulators discard the remaining ones already during their enumeration.
      * @return Simulation results.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt>
-    physical_simulation_of_bdl_iterator(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
+    [[nodiscard]] sidb_simulation_result<Lyt> physical_simulation(const Lyt&   lyt,
+                                                                  const double energy_window) const noexcept
     {
         if (params.operational_params.sim_engine == sidb_simulation_engine::EXGS)
         {
             // perform exhaustive ground state simulation
-            return exhaustive_ground_state_simulation(*bdl_iterator, params.operational_params.simulation_parameters);
+            auto result = exhaustive_ground_state_simulation(lyt, params.operational_params.simulation_parameters);
+            result.restrict_to_energy_window(energy_window);
+
+            return result;
         }
         if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKEXACT)
         {
             // perform QuickExact exact simulation
-            const quickexact_params<cell<Lyt>> qe_params{
+            quickexact_params<cell<Lyt>> qe_params{
                 params.operational_params.simulation_parameters,
                 fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-            return quickexact(*bdl_iterator, qe_params);
+            qe_params.energy_window = energy_window;
+
+            return quickexact(lyt, qe_params);
         }
 #if (FICTION_ALGLIB_ENABLED)
         if (params.operational_params.sim_engine == sidb_simulation_engine::CLUSTERCOMPLETE)
         {
             // perform ClusterComplete exact simulation
-            const clustercomplete_params<cell<Lyt>> cc_params{params.operational_params.simulation_parameters};
-            return clustercomplete(*bdl_iterator, cc_params);
+            clustercomplete_params<cell<Lyt>> cc_params{params.operational_params.simulation_parameters};
+            cc_params.energy_window = energy_window;
+
+            return clustercomplete(lyt, cc_params);
         }
 #endif  // FICTION_ALGLIB_ENABLED
         if (params.operational_params.sim_engine == sidb_simulation_engine::QUICKSIM)
@@ -469,9 +652,27 @@ class critical_temperature_impl
             const quicksim_params qs_params{params.operational_params.simulation_parameters, params.iteration_steps,
                                             params.alpha};
 
-            if (const auto result = quicksim<Lyt>(*bdl_iterator, qs_params))
+            if (auto result = quicksim<Lyt>(lyt, qs_params))
+            {
+                result->restrict_to_energy_window(energy_window);
+
+                return *result;
+            }
+            return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
+        }
+        if (params.operational_params.sim_engine == sidb_simulation_engine::SIMANNEAL)
+        {
+            assert(params.operational_params.simulation_parameters.base == 2 &&
+                   "SimAnneal does not support base-3 simulation");
+
+            sim_anneal_params sa_params{};
+            sa_params.simulation_parameters = params.operational_params.simulation_parameters;
+
+            if (auto result = sim_anneal<Lyt>(lyt, sa_params))
             {
-                return result.value();
+                result->restrict_to_energy_window(energy_window);
+
+                return *result;
             }
             return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
         }
@@ -8,6 +8,7 @@
 #include "fiction/algorithms/simulation/sidb/is_operational.hpp"
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/execution_utils.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/math_utils.hpp"
 
@@ -15,13 +16,17 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <random>
 #include <set>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -69,6 +74,13 @@ struct displacement_robustness_domain_params
          * `percentage_of_analyzed_displaced_layouts`.
          */
         RANDOM,
+        /**
+         * Displaced layouts are drawn at random on demand and simulated in parallel until the confidence interval of
+         * the estimated share of operational layouts is at most `confidence_interval_width` wide or
+         * `max_number_of_samples` layouts have been drawn. Displaced layouts are never enumerated up front, which makes
+         * this mode applicable to layouts with many SiDBs.
+         */
+        MONTE_CARLO
     };
     /**
      * Specifies the allowed displacement range options for SiDB fabrication simulation.
@@ -114,6 +126,37 @@ struct displacement_robustness_domain_params
      * This flag controls whether the displacement in the y-direction can lead to changes in the Si dimer.
      */
     dimer_displacement_policy dimer_policy{dimer_displacement_policy::STAY_ON_ORIGINAL_DIMER};
+    /**
+     * Target width of the confidence interval of the share of operational layouts in `MONTE_CARLO` mode. Sampling stops
+     * as soon as the interval is at most this wide.
+     */
+    double confidence_interval_width{0.05};
+    /**
+     * Confidence level of the interval in `MONTE_CARLO` mode. For example, 0.95 means that the interval contains the
+     * true share of operational layouts with a probability of 95 %.
+     */
+    double confidence_level{0.95};
+    /**
+     * Maximum number of displaced layouts that are drawn in `MONTE_CARLO` mode. If it is 0, no layout is drawn and the
+     * probability of fabricating an operational gate is 0.0.
+     */
+    uint64_t max_number_of_samples{10000};
+    /**
+     * Number of displaced layouts that are drawn and simulated between two checks of the confidence interval in
+     * `MONTE_CARLO` mode.
+     */
+    uint64_t batch_size{64};
+    /**
+     * Number of threads to simulate displaced layouts with in `MONTE_CARLO` mode.
+     */
+    uint64_t number_of_threads{std::thread::hardware_concurrency()};
+    /**
+     * Seed for drawing displaced layouts in `MONTE_CARLO` mode. Each displaced layout is drawn with a random number
+     * generator derived from the seed and the index of the layout. Since the confidence interval is only checked
+     * between batches, results are reproducible and independent of the number of threads. If no seed is provided, a
+     * random one is used.
+     */
+    std::optional<uint64_t> seed{std::nullopt};
 };
 
 /**
@@ -133,6 +176,16 @@ struct displacement_robustness_domain_stats
      * The number of non-operational SiDB layouts resulting from the given layout by displacements.
      */
     std::size_t num_non_operational_sidb_displacements{0};
+    /**
+     * Lower bound of the confidence interval of the share of operational layouts. Only determined in `MONTE_CARLO`
+     * mode.
+     */
+    double confidence_interval_lower_bound{0.0};
+    /**
+     * Upper bound of the confidence interval of the share of operational layouts. Only determined in `MONTE_CARLO`
+     * mode.
+     */
+    double confidence_interval_upper_bound{1.0};
 };
 
 namespace detail
@@ -184,6 +237,28 @@ class displacement_robustness_domain_impl
 
         all_possible_sidb_displacements = calculate_all_possible_displacements_for_each_sidb();
 
+        if (params.analysis_mode ==
+            displacement_robustness_domain_params<cell<Lyt>>::displacement_analysis_mode::MONTE_CARLO)
+        {
+            // all SiDBs that are not fixed are displaced within their respective displacement range
+            std::vector<std::size_t> displaceable_sidbs{};
+            displaceable_sidbs.reserve(sidbs_of_the_original_layout.size());
+
+            for (std::size_t i = 0; i < sidbs_of_the_original_layout.size(); ++i)
+            {
+                if (params.fixed_sidbs.count(sidbs_of_the_original_layout[i]) == 0)
+                {
+                    displaceable_sidbs.push_back(i);
+                }
+            }
+
+            displacement_robustness_domain<Lyt> domain{};
+
+            sample_displaced_layouts(displaceable_sidbs, displaceable_sidbs.size(), &domain);
+
+            return domain;
+        }
+
         auto layouts = generate_valid_displaced_sidb_layouts();
 
         if (layouts.empty())
@@ -281,6 +356,31 @@ class displacement_robustness_domain_impl
             return 1.0;
         }
 
+        if (params.analysis_mode ==
+            displacement_robustness_domain_params<cell<Lyt>>::displacement_analysis_mode::MONTE_CARLO)
+        {
+            mockturtle::stopwatch stop{stats.time_total};
+
+            // each SiDB may be among the displaced ones
+            params.fixed_sidbs.clear();
+            all_possible_sidb_displacements = calculate_all_possible_displacements_for_each_sidb();
+
+            std::vector<std::size_t> all_sidbs(sidbs_of_the_original_layout.size());
+            std::iota(all_sidbs.begin(), all_sidbs.end(), std::size_t{0});
+
+            sample_displaced_layouts(all_sidbs, number_of_displaced_sidbs, nullptr);
+
+            // no layout was drawn if the maximum number of samples is 0
+            if (stats.num_operational_sidb_displacements + stats.num_non_operational_sidb_displacements == 0)
+            {
+                return 0.0;
+            }
+
+            return static_cast<double>(stats.num_operational_sidb_displacements) /
+                   static_cast<double>(stats.num_non_operational_sidb_displacements +
+                                       stats.num_operational_sidb_displacements);
+        }
+
         const auto all_combinations_of_fabricating_misplaced_sidbs =
             determine_all_combinations_of_distributing_k_entities_on_n_positions(number_of_displaced_sidbs,
                                                                                  sidbs_of_the_original_layout.size());
@@ -542,6 +642,171 @@ class displacement_robustness_domain_impl
 
         return layouts;
     }
+    /**
+     * Draws a displaced layout at random. First, `num_displaced` SiDBs are chosen uniformly from `displaceable_sidbs`.
+     * Afterward, each chosen SiDB is moved to a position drawn uniformly from its permitted displacements, which
+     * include its original position. Displaced layouts are derived from the original layout by moving only the
+     * displaced SiDBs instead of building them from scratch. Draws in which two SiDBs end up on the same position are
+     * rejected and repeated.
+     *
+     * @param displaceable_sidbs Indices of the SiDBs that may be displaced.
+     * @param num_displaced Number of SiDBs to displace.
+     * @param generator Random number generator to draw with.
+     * @return The displaced layout or `std::nullopt` if no SiDB left its original position.
+     */
+    [[nodiscard]] std::optional<Lyt> draw_displaced_sidb_layout(const std::vector<std::size_t>& displaceable_sidbs,
+                                                                const std::size_t               num_displaced,
+                                                                std::mt19937_64&                generator) const
+    {
+        assert(num_displaced <= displaceable_sidbs.size() && "more SiDBs to displace than displaceable SiDBs");
+
+        auto chosen_sidbs = displaceable_sidbs;
+
+        while (true)
+        {
+            // choose the displaced SiDBs via a partial Fisher-Yates shuffle
+            for (std::size_t i = 0; i < num_displaced; ++i)
+            {
+                std::uniform_int_distribution<std::size_t> dist{i, chosen_sidbs.size() - 1};
+                std::swap(chosen_sidbs[i], chosen_sidbs[dist(generator)]);
+            }
+
+            std::vector<std::pair<std::size_t, cell<Lyt>>> moves{};
+
+            for (std::size_t i = 0; i < num_displaced; ++i)
+            {
+                const auto& positions = all_possible_sidb_displacements[chosen_sidbs[i]];
+
+                std::uniform_int_distribution<std::size_t> dist{0, positions.size() - 1};
+
+                if (const auto& new_pos = positions[dist(generator)];
+                    new_pos != sidbs_of_the_original_layout[chosen_sidbs[i]])
+                {
+                    moves.emplace_back(chosen_sidbs[i], new_pos);
+                }
+            }
+
+            if (moves.empty())
+            {
+                return std::nullopt;
+            }
+
+            Lyt displaced_lyt{layout.clone()};
+
+            // vacate all original positions first such that SiDBs may move to positions left by others
+            for (const auto& [i, _] : moves)
+            {
+                displaced_lyt.assign_cell_type(sidbs_of_the_original_layout[i], technology<Lyt>::cell_type::EMPTY);
+            }
+
+            const auto collision_free = std::all_of(
+                moves.cbegin(), moves.cend(),
+                [this, &displaced_lyt](const auto& move)
+                {
+                    if (!displaced_lyt.is_empty_cell(move.second))
+                    {
+                        return false;
+                    }
+
+                    displaced_lyt.assign_cell_type(move.second,
+                                                   layout.get_cell_type(sidbs_of_the_original_layout[move.first]));
+
+                    return true;
+                });
+
+            if (collision_free)
+            {
+                return displaced_lyt;
+            }
+        }
+    }
+    /**
+     * Draws displaced layouts on demand and determines their operational status in parallel until the confidence
+     * interval of the share of operational layouts is at most `confidence_interval_width` wide or
+     * `max_number_of_samples` layouts have been drawn. Layouts in which no SiDB left its original position share the
+     * operational status of the original layout and are not simulated again. The operational and non-operational
+     * counts as well as the confidence interval are stored in the statistics.
+     *
+     * @param displaceable_sidbs Indices of the SiDBs that may be displaced.
+     * @param num_displaced Number of SiDBs to displace in each layout.
+     * @param domain Displacement robustness domain to add the drawn layouts to. May be `nullptr`.
+     */
+    void sample_displaced_layouts(const std::vector<std::size_t>& displaceable_sidbs, const std::size_t num_displaced,
+                                  displacement_robustness_domain<Lyt>* domain)
+    {
+        assert(params.confidence_level > 0.0 && params.confidence_level < 1.0 &&
+               "confidence_level must be between 0.0 and 1.0");
+
+        const auto seed = seed_or_random(params.seed);
+
+        const auto original_status = is_operational(layout, truth_table, params.operational_params).first;
+
+        const auto batch_size = std::max(params.batch_size, uint64_t{1});
+
+        uint64_t num_samples = 0;
+
+        while (num_samples < params.max_number_of_samples)
+        {
+            const auto current_batch_size = std::min(batch_size, params.max_number_of_samples - num_samples);
+
+            std::vector<std::optional<Lyt>> batch_layouts(current_batch_size);
+            std::vector<operational_status> batch_status(current_batch_size, original_status);
+
+            run_on_bounded_threads(static_cast<std::size_t>(current_batch_size),
+                                   static_cast<std::size_t>(params.number_of_threads),
+                                   [&](const std::size_t i)
+                                   {
+                                       auto generator = make_stream_generator(seed, num_samples + i);
+
+                                       batch_layouts[i] =
+                                           draw_displaced_sidb_layout(displaceable_sidbs, num_displaced, generator);
+
+                                       // the displaced layout is not derived from a charge distribution surface
+                                       // of the original one via move_sidb since is_operational detects the BDL
+                                       // wires anew and each simulation engine constructs its own surface
+                                       if (batch_layouts[i].has_value())
+                                       {
+                                           batch_status[i] =
+                                               is_operational(*batch_layouts[i], truth_table, params.operational_params)
+                                                   .first;
+                                       }
+                                   });
+
+            // results are processed in the order they were drawn to be independent of the number of threads
+            for (std::size_t i = 0; i < current_batch_size; ++i)
+            {
+                if (batch_status[i] == operational_status::OPERATIONAL)
+                {
+                    stats.num_operational_sidb_displacements++;
+                }
+                else
+                {
+                    stats.num_non_operational_sidb_displacements++;
+                }
+
+                if (domain != nullptr)
+                {
+                    domain->operational_values.emplace_back(
+                        batch_layouts[i].has_value() ? std::move(*batch_layouts[i]) : Lyt{layout.clone()},
+                        batch_status[i]);
+                }
+            }
+
+            num_samples += current_batch_size;
+
+            std::tie(stats.confidence_interval_lower_bound, stats.confidence_interval_upper_bound) =
+                wilson_score_interval(stats.num_operational_sidb_displacements,
+                                      stats.num_operational_sidb_displacements +
+                                          stats.num_non_operational_sidb_displacements,
+                                      params.confidence_level);
+
+            if (stats.confidence_interval_upper_bound - stats.confidence_interval_lower_bound <=
+                params.confidence_interval_width)
+            {
+                break;
+            }
+        }
+    }
     /**
      * This function adds the provided layout and its corresponding operational status to the list of
      * operational values in the displacement robustness domain. Depending on the operational status,
@@ -580,7 +845,8 @@ class displacement_robustness_domain_impl
  * based on the provided truth table specification and displacement robustness computation parameters.
  * The number of displacements grows exponentially with the number of SiDBs. For small layouts, all displacements
  * can be analyzed. For larger layouts, random sampling can be applied, controllable by the `analysis_mode` and
- * `percentage_of_analyzed_displaced_layouts` in `params.
+ * `percentage_of_analyzed_displaced_layouts` in `params`. In `MONTE_CARLO` mode, displaced layouts are drawn on demand
+ * until the share of operational layouts is known to the requested precision.
  *
  * @tparam Lyt The SiDB cell-level layout type.
  * @tparam TT Truth table type.
@@ -620,6 +886,10 @@ determine_displacement_robustness_domain(const Lyt& layout, const std::vector<TT
  * fabricating an operational SiDB layout for an originally given SiDB layout and a given fabrication error rate. A
  * fabrication error rate of 0.0 or negative indicates that the SiDB layout is designed without displacement.
  *
+ * In `MONTE_CARLO` mode, the probability is estimated from displaced layouts that are drawn on demand. Sampling
+ * stops once the confidence interval of the estimate, which is reported in `stats`, is narrow enough. This makes the
+ * function applicable to layouts for which the number of displaced layouts is far too large to be enumerated.
+ *
  * @tparam Lyt The SiDB cell-level layout type.
  * @tparam TT The type of the truth table.
  * @param layout The SiDB cell-level layout which is analyzed.
@@ -627,12 +897,13 @@ determine_displacement_robustness_domain(const Lyt& layout, const std::vector<TT
  * @param params Parameters for the displacement robustness computation.
  * @param fabrication_error_rate The fabrication error rate. For example, 0.1 describes that 10% of all manufactured
  *        SiDBs have a slight displacement.
+ * @param stats Statistics related to the displacement robustness computation.
  * @return The probability of fabricating an operational SiDB layout.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] double determine_probability_of_fabricating_operational_gate(
     const Lyt& layout, const std::vector<TT>& spec, const displacement_robustness_domain_params<cell<Lyt>>& params = {},
-    const double fabrication_error_rate = 1.0)
+    const double fabrication_error_rate = 1.0, displacement_robustness_domain_stats* stats = nullptr)
 {
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
@@ -640,7 +911,14 @@ template <typename Lyt, typename TT>
     displacement_robustness_domain_stats                 st{};
     detail::displacement_robustness_domain_impl<Lyt, TT> p{layout, spec, params, st};
 
-    return p.determine_probability_of_fabricating_operational_gate(fabrication_error_rate);
+    const auto result = p.determine_probability_of_fabricating_operational_gate(fabrication_error_rate);
+
+    if (stats)
+    {
+        *stats = st;
+    }
+
+    return result;
 }
 
 }  // namespace fiction
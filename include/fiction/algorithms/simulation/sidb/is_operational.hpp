@@ -16,6 +16,7 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/algorithms/simulation/sidb/sim_anneal.hpp"
 #include "fiction/technology/cell_ports.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
@@ -304,33 +305,28 @@ class is_operational_impl
      * do not satisfy physical model constraints under the I/O pin conditions required for the desired Boolean function,
      * and (3) detecting I/O signal instability.
      *
-     * @param input_pattern The current input pattern.
+     * @param input_pattern The current input pattern, i.e., the row of the truth table.
      * @return A `layout_invalidity_reason` object indicating why the layout is non-operational; or `std::nullopt` if it
      * could not certainly be determined to be in fact non-operational.
      */
     [[nodiscard]] std::optional<layout_invalidity_reason> is_layout_invalid(const uint64_t input_pattern) noexcept
     {
-        bii = input_pattern;
+        set_input_pattern(input_pattern);
 
-        charge_distribution_surface<Lyt> cds_layout{*bii};
-        cds_layout.assign_all_charge_states(sidb_charge_state::NEGATIVE);
-        cds_layout.assign_physical_parameters(parameters.simulation_parameters);
+        auto& cds_layout = *input_cds;
 
-        if ((parameters.simulation_parameters.base == 2) &&
-            (can_positive_charges_occur(*bii, parameters.simulation_parameters)))
+        if ((parameters.simulation_parameters.base == 2) && can_positive_charges_occur_in_input_cds())
         {
             return layout_invalidity_reason::POTENTIAL_POSITIVE_CHARGES;
         }
 
-        const auto input_index = bii.get_current_input_index();
-
-        set_charge_distribution_of_input_pins(cds_layout, bii.get_current_input_index());
-        set_charge_distribution_of_output_pins(cds_layout, evaluate_output(truth_table, input_index));
+        set_charge_distribution_of_input_pins(cds_layout, input_pattern);
+        set_charge_distribution_of_output_pins(cds_layout, evaluate_output(truth_table, input_pattern));
 
         if (const auto physical_validity = is_physical_validity_feasible(cds_layout); physical_validity.has_value())
         {
-            if (const auto output_index = evaluate_output(truth_table, input_index); is_io_signal_unstable(
-                    cds_layout, truth_table.front().num_bits(), input_index, output_index, physical_validity.value()))
+            if (const auto output_index = evaluate_output(truth_table, input_pattern); is_io_signal_unstable(
+                    cds_layout, truth_table.front().num_bits(), input_pattern, output_index, physical_validity.value()))
             {
                 return layout_invalidity_reason::IO_INSTABILITY;
             };
@@ -362,9 +358,10 @@ class is_operational_impl
                  parameters.op_condition == is_operational_params::operational_condition::REJECT_KINKS))
             {
                 // number of different input combinations
-                for (auto i = 0u; i < truth_table.front().num_bits(); ++i, ++bii)
+                // the input patterns are set by is_layout_invalid, which reuses the SiDBs of the previous pattern
+                for (auto i = 0u; i < truth_table.front().num_bits(); ++i)
                 {
-                    if (is_layout_invalid(bii.get_current_input_index()))
+                    if (is_layout_invalid(bii.get_input_pattern_of_state(i)))
                     {
                         return {operational_status::NON_OPERATIONAL, non_operationality_reason::LOGIC_MISMATCH};
                     }
@@ -386,13 +383,15 @@ class is_operational_impl
                 is_operational_params::operational_analysis_strategy::FILTER_THEN_SIMULATION ||
             canvas_lyt.is_empty())
         {
-            bii = 0;
             // number of different input combinations
-            for (auto i = 0u; i < truth_table.front().num_bits(); ++i, ++bii)
+            for (auto i = 0u; i < truth_table.front().num_bits(); ++i)
             {
+                const auto input_pattern = bii.get_input_pattern_of_state(i);
+
+                set_input_pattern(input_pattern);
+
                 // if positively charged SiDBs can occur, the SiDB layout is considered non-operational
-                if ((parameters.simulation_parameters.base == 2) &&
-                    (can_positive_charges_occur(*bii, parameters.simulation_parameters)))
+                if ((parameters.simulation_parameters.base == 2) && can_positive_charges_occur_in_input_cds())
                 {
                     return {operational_status::NON_OPERATIONAL, non_operationality_reason::POTENTIAL_POSITIVE_CHARGES};
                 }
@@ -411,7 +410,7 @@ class is_operational_impl
 
                 for (const auto& gs : ground_states)
                 {
-                    const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, i);
+                    const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, input_pattern);
                     if (op_status == operational_status::NON_OPERATIONAL &&
                         non_op_reason == non_operationality_reason::LOGIC_MISMATCH)
                     {
@@ -532,16 +531,19 @@ class is_operational_impl
             non_operational_input_pattern_and_non_operationality_reason{};
 
         // number of different input combinations
-        for (auto i = 0u; i < truth_table.front().num_bits(); ++i, ++bii)
+        for (auto i = 0u; i < truth_table.front().num_bits(); ++i)
         {
             ++simulator_invocations;
 
+            const auto input_pattern = bii.get_input_pattern_of_state(i);
+
+            set_input_pattern(input_pattern);
+
             // if positively charged SiDBs can occur, the SiDB layout is considered non-operational
-            if ((parameters.simulation_parameters.base == 2) &&
-                (can_positive_charges_occur(*bii, parameters.simulation_parameters)))
+            if ((parameters.simulation_parameters.base == 2) && can_positive_charges_occur_in_input_cds())
             {
                 non_operational_input_pattern_and_non_operationality_reason.emplace_back(
-                    i, non_operationality_reason::POTENTIAL_POSITIVE_CHARGES);
+                    input_pattern, non_operationality_reason::POTENTIAL_POSITIVE_CHARGES);
                 continue;
             }
 
@@ -558,10 +560,11 @@ class is_operational_impl
 
             for (const auto& gs : ground_states)
             {
-                const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, i);
+                const auto [op_status, non_op_reason] = verify_logic_match_of_cds(gs, input_pattern);
                 if (op_status == operational_status::NON_OPERATIONAL)
                 {
-                    non_operational_input_pattern_and_non_operationality_reason.emplace_back(i, non_op_reason);
+                    non_operational_input_pattern_and_non_operationality_reason.emplace_back(input_pattern,
+                                                                                             non_op_reason);
                 }
             }
         }
@@ -908,7 +911,81 @@ class is_operational_impl
      * Layout consisting of all canvas SiDBs.
      */
     Lyt canvas_lyt{};
+    /**
+     * Charge distribution surface of the layout under the input pattern `input_cds_index`. It is reused by
+     * `set_input_pattern` to update only the SiDBs that change between consecutive input patterns.
+     */
+    std::optional<charge_distribution_surface<Lyt>> input_cds{};
+    /**
+     * Input pattern that `input_cds` represents.
+     */
+    uint64_t input_cds_index{0};
 
+    /**
+     * Sets the BDL input iterator to the state that applies the given input pattern and updates `input_cds`
+     * accordingly. If `input_cds` represents the previous input pattern of the iterator, only the SiDBs that changed
+     * are moved instead of constructing a new charge distribution surface. Afterward, all SiDBs of `input_cds` are
+     * negatively charged. To this end, only the SiDBs that were assigned a different charge state, e.g., the I/O pins
+     * and canvas SiDBs set by `is_layout_invalid`, are updated in \f$\mathcal{O}(N)\f$ time each.
+     *
+     * @param input_pattern The input pattern to set, i.e., the row of the truth table.
+     */
+    void set_input_pattern(const uint64_t input_pattern) noexcept
+    {
+        const auto previous_input_index = bii.get_current_input_index();
+
+        bii.set_input_pattern(input_pattern);
+
+        if (input_cds.has_value() && input_cds_index == previous_input_index)
+        {
+            // only the SiDBs that changed between both input patterns are updated
+            const auto& delta = bii.get_delta();
+            input_cds->apply_sidb_delta(delta.removed_sidbs, delta.added_sidbs, technology<Lyt>::cell_type::INPUT);
+
+            // the local electrostatic potentials are consistent with the charge states, hence, only the SiDBs that are
+            // not negatively charged need to be updated
+            for (uint64_t i = 0; i < input_cds->num_cells(); ++i)
+            {
+                if (input_cds->get_charge_state_by_index(i) != sidb_charge_state::NEGATIVE)
+                {
+                    input_cds->change_charge_state_by_index(i, sidb_charge_state::NEGATIVE);
+                }
+            }
+        }
+        else
+        {
+            // a new charge distribution surface is negatively charged
+            input_cds.emplace(Lyt{(*bii).clone()});
+            input_cds->assign_physical_parameters(parameters.simulation_parameters);
+        }
+
+        input_cds_index = bii.get_current_input_index();
+    }
+    /**
+     * Determines if positively charged SiDBs can occur under the current input pattern. In contrast to
+     * `can_positive_charges_occur`, the local electrostatic potentials of `input_cds` are reused instead of
+     * constructing a new charge distribution surface. Hence, `set_input_pattern` has to be called before.
+     *
+     * @return `true` iff positively charged SiDBs can occur.
+     */
+    [[nodiscard]] bool can_positive_charges_occur_in_input_cds() const noexcept
+    {
+        assert(input_cds.has_value() && "set_input_pattern has to be called first");
+
+        // since all SiDBs are negatively charged, the local electrostatic potentials are maximal
+        for (uint64_t i = 0; i < input_cds->num_cells(); ++i)
+        {
+            // access does not need to be checked since 0 <= i < num_cells()
+            if (-*input_cds->get_local_internal_potential_by_index(i) >
+                input_cds->get_effective_charge_transition_thresholds(
+                    i)[static_cast<std::size_t>(charge_transition_threshold_bounds::POSITIVE_LOWER_BOUND)])
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
     /**
      * This function conducts physical simulation of the given SiDB layout.
      * The simulation results are stored in the `sim_result` variable.
@@ -956,6 +1033,20 @@ class is_operational_impl
                 }
                 return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
             }
+            if (parameters.sim_engine == sidb_simulation_engine::SIMANNEAL)
+            {
+                assert(parameters.simulation_parameters.base == 2 && "SimAnneal does not support base-3 simulation");
+
+                // perform SimAnneal heuristic simulation
+                sim_anneal_params sa_params{};
+                sa_params.simulation_parameters = parameters.simulation_parameters;
+
+                if (const auto sa_result = sim_anneal(*bdl_iterator, sa_params); sa_result.has_value())
+                {
+                    return sa_result.value();
+                }
+                return sidb_simulation_result<Lyt>{};  // return empty result if no valid charge distribution was found
+            }
         }
 
         assert(false && "unsupported simulation engine");
@@ -16,11 +16,13 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/algorithms/simulation/sidb/sim_anneal.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/constants.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/hash.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/profiling.hpp"
 
 #include <btree.h>
 #include <fmt/format.h>
@@ -817,6 +819,8 @@ class operational_domain_impl
         std::vector<std::thread> threads{};
         threads.reserve(num_threads);
 
+        thread_idle_recorder idle_recorder{"operational_domain::thread_idle_time"};
+
         // launch threads, each with its own slice of random step points
         for (auto i = 0ul; i < num_threads; ++i)
         {
@@ -829,13 +833,15 @@ class operational_domain_impl
             }
 
             threads.emplace_back(
-                [this, &lyt, start, end, &all_index_combinations]
+                [this, &lyt, start, end, &all_index_combinations, &idle_recorder]
                 {
                     for (auto it = all_index_combinations.cbegin() + static_cast<int64_t>(start);
                          it != all_index_combinations.cbegin() + static_cast<int64_t>(end); ++it)
                     {
                         is_step_point_suitable(lyt, step_point{*it});  // construct a step_point
                     }
+
+                    idle_recorder.worker_finished();
                 });
         }
 
@@ -848,6 +854,8 @@ class operational_domain_impl
             }
         }
 
+        idle_recorder.threads_joined();
+
         sidb_simulation_parameters simulation_parameters = params.operational_params.simulation_parameters;
 
         op_domain.for_each(
@@ -894,6 +902,21 @@ class operational_domain_impl
                             return;
                         }
                     }
+                    else if (params.operational_params.sim_engine == sidb_simulation_engine::SIMANNEAL)
+                    {
+                        // perform a heuristic simulation
+                        sim_anneal_params sa_params{};
+                        sa_params.simulation_parameters = simulation_parameters;
+
+                        if (const auto result = sim_anneal(lyt, sa_params); result.has_value())
+                        {
+                            sim_results = result.value();
+                        }
+                        else
+                        {
+                            return;
+                        }
+                    }
                     else
                     {
                         assert(false && "unsupported simulation engine");
@@ -1145,6 +1168,8 @@ class operational_domain_impl
      */
     operational_status is_step_point_operational(const step_point& sp) noexcept
     {
+        FICTION_PROFILE_SCOPE("operational_domain::is_step_point_operational");
+
         if (const auto op_value = op_domain.contains(to_parameter_point(sp)); op_value.has_value())
         {
             return std::get<0>(*op_value);
@@ -1225,6 +1250,8 @@ class operational_domain_impl
      */
     operational_status is_step_point_suitable(Lyt lyt, const step_point& sp) noexcept
     {
+        FICTION_PROFILE_SCOPE("operational_domain::is_step_point_suitable");
+
         // if the point has already been sampled, return the stored operational status
         if (const auto op_value = op_domain.contains(to_parameter_point(sp)); op_value.has_value())
         {
@@ -1343,6 +1370,8 @@ class operational_domain_impl
         std::vector<std::thread> threads{};
         threads.reserve(num_threads);
 
+        thread_idle_recorder idle_recorder{"operational_domain::thread_idle_time"};
+
         // launch threads, each with its own slice of random step points
         for (auto i = 0ul; i < num_threads; ++i)
         {
@@ -1355,13 +1384,15 @@ class operational_domain_impl
             }
 
             threads.emplace_back(
-                [this, start, end, &step_points]
+                [this, start, end, &step_points, &idle_recorder]
                 {
                     for (auto it = step_points.cbegin() + static_cast<int64_t>(start);
                          it != step_points.cbegin() + static_cast<int64_t>(end); ++it)
                     {
                         is_step_point_operational(*it);
                     }
+
+                    idle_recorder.worker_finished();
                 });
         }
 
@@ -1373,6 +1404,8 @@ class operational_domain_impl
                 thread.join();
             }
         }
+
+        idle_recorder.threads_joined();
     }
     /**
      * Performs random sampling to find any operational parameter combination. This function is useful if a single
@@ -11,6 +11,7 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
@@ -19,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -65,6 +67,13 @@ struct quickexact_params
      * Global external electrostatic potential. Value is applied on each cell in the layout.
      */
     double global_potential = 0;
+    /**
+     * Only physically valid charge distributions whose electrostatic potential energy exceeds the one of the ground
+     * state by at most this value are returned (unit: eV). Charge distributions outside the window above the lowest
+     * energy found so far are discarded during the enumeration, i.e., before they are stored. By default, all
+     * physically valid charge distributions are returned.
+     */
+    double energy_window = std::numeric_limits<double>::infinity();
 };
 
 namespace detail
@@ -163,6 +172,9 @@ class quickexact_impl
             {
                 layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
             }
+
+            // charge distributions that were stored before the final ground state was found may lie outside the window
+            result.restrict_to_energy_window(params.energy_window);
         }
 
         result.simulation_runtime = time_counter;
@@ -203,6 +215,11 @@ class quickexact_impl
      * Simulation results.
      */
     sidb_simulation_result<Lyt> result{};
+    /**
+     * Lowest electrostatic potential energy of all physically valid charge distributions enumerated so far. It is only
+     * determined up to an offset that is identical for all charge distributions (unit: eV).
+     */
+    double lowest_energy_found{std::numeric_limits<double>::infinity()};
     /**
      * Base number required for the correct physical simulation.
      */
@@ -316,7 +333,7 @@ class quickexact_impl
 
             previous_charge_index = *gci;
 
-            if (charge_layout.is_physically_valid())
+            if (charge_layout.is_physically_valid() && is_within_energy_window(charge_layout))
             {
                 charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
@@ -363,7 +380,7 @@ class quickexact_impl
         {
             while (charge_layout.get_charge_index_of_sub_layout() < charge_layout.get_max_charge_index_sub_layout())
             {
-                if (charge_layout.is_physically_valid())
+                if (charge_layout.is_physically_valid() && is_within_energy_window(charge_layout))
                 {
                     charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
@@ -386,7 +403,7 @@ class quickexact_impl
                                                              // changed based on the new charge distribution.
             }
 
-            if (charge_layout.is_physically_valid())
+            if (charge_layout.is_physically_valid() && is_within_energy_window(charge_layout))
             {
                 charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
@@ -417,7 +434,7 @@ class quickexact_impl
         // charge configurations of the sublayout are iterated
         while (charge_layout.get_charge_index_of_sub_layout() < charge_layout.get_max_charge_index_sub_layout())
         {
-            if (charge_layout.is_physically_valid())
+            if (charge_layout.is_physically_valid() && is_within_energy_window(charge_layout))
             {
                 charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
@@ -438,7 +455,7 @@ class quickexact_impl
                                                                      charge_distribution_history::CONSIDER);
         }
 
-        if (charge_layout.is_physically_valid())
+        if (charge_layout.is_physically_valid() && is_within_energy_window(charge_layout))
         {
             charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
@@ -459,6 +476,42 @@ class quickexact_impl
             layout.assign_cell_type(cell, Lyt::cell_type::NORMAL);
         }
     }
+    /**
+     * Checks whether the given physically valid charge distribution lies within the energy window above the lowest
+     * energy found so far. Since the local potentials are up-to-date during the enumeration, the electrostatic
+     * potential energy is obtained in \f$\mathcal{O}(N)\f$ without copying the charge distribution. The pre-assigned
+     * negatively charged SiDBs are treated as defects in `charge_layout`, which shifts all energies by the same
+     * constant offset.
+     *
+     * @tparam ChargeLyt Type of the charge distribution surface.
+     * @param charge_layout Physically valid charge distribution.
+     * @return `true` iff the charge distribution is to be stored.
+     */
+    template <typename ChargeLyt>
+    [[nodiscard]] bool is_within_energy_window(const ChargeLyt& charge_layout) noexcept
+    {
+        if (params.energy_window == std::numeric_limits<double>::infinity())
+        {
+            return true;
+        }
+
+        double energy = 0.0;
+
+        for (uint64_t i = 0; i < charge_layout.num_cells(); ++i)
+        {
+            const auto charge = static_cast<double>(charge_state_to_sign(charge_layout.get_charge_state_by_index(i)));
+
+            // the potential caused by defects is part of the internal potential; it is added once more to count the
+            // interaction between SiDBs and defects in full while the mutual SiDB interactions are counted half
+            energy += charge * (*charge_layout.get_local_external_potential_by_index(i) +
+                                0.5 * (*charge_layout.get_local_internal_potential_by_index(i) +
+                                       *charge_layout.get_local_potential_caused_by_defects_by_index(i)));
+        }
+
+        lowest_energy_found = std::min(lowest_energy_found, energy);
+
+        return energy <= lowest_energy_found + params.energy_window + constants::ERROR_MARGIN;
+    }
     /**
      * This function is responsible for preparing the charge layout and relevant data structures for the simulation.
      *
@@ -5,15 +5,22 @@
 #ifndef FICTION_RANDOM_SIDB_LAYOUT_GENERATOR_HPP
 #define FICTION_RANDOM_SIDB_LAYOUT_GENERATOR_HPP
 
-#include "fiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/constants.hpp"
 #include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
-#include "fiction/utils/execution_utils.hpp"
 #include "fiction/utils/layout_utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <optional>
+#include <random>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -80,36 +87,219 @@ struct generate_random_sidb_layout_params
      * parameter sets a limit for the maximum number of tries.
      */
     uint64_t maximal_attempts_for_multiple_layouts = 1'000'000;
+    /**
+     * Number of threads to generate multiple layouts in parallel. Each thread draws from its own random number
+     * generator.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
 };
 
+namespace detail
+{
+
 /**
- * Generates a layout featuring a random arrangement of SiDBs. These randomly placed dots can be incorporated into an
- * existing layout skeleton that may be optionally provided.
+ * This class keeps track of the local electrostatic potentials at all SiDBs of a layout under the assumption that all
+ * SiDBs are negatively charged. In this extreme case, the local potentials are maximal, which is why
+ * `can_positive_charges_occur` evaluates them to decide whether positively charged SiDBs can occur. Instead of setting
+ * up a `charge_distribution_surface` with all pairwise potentials after each insertion, adding an SiDB only adds one
+ * term to each local potential. Hence, checking and inserting an SiDB requires \f$\mathcal{O}(N)\f$ time.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+class positive_charge_tracker
+{
+  public:
+    /**
+     * Standard constructor. Registers all SiDBs and charged defects of the given layout.
+     *
+     * @param lyt Layout whose SiDBs are tracked. SiDBs that are added later have to be registered via `add_sidb` or
+     * `add_sidb_if_no_positive_charges_can_occur`.
+     * @param params Physical parameters used to determine whether positively charged SiDBs can occur.
+     */
+    positive_charge_tracker(const Lyt& lyt, const sidb_simulation_parameters& params) noexcept :
+            layout{lyt},
+            simulation_parameters{params},
+            // same threshold as the lower bound to validate DB+ in `charge_distribution_surface`
+            positive_charge_threshold{-params.mu_plus() - constants::ERROR_MARGIN}
+    {
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            layout.foreach_sidb_defect(
+                [this](const auto& cd)
+                {
+                    // defects on SiDB positions are neglected by `charge_distribution_surface` as well
+                    if (is_charged_defect_type(cd.second) && layout.is_empty_cell(cd.first))
+                    {
+                        charged_defects.emplace_back(sidb_nm_position<Lyt>(layout, cd.first), cd.second);
+                    }
+                });
+        }
+
+        layout.foreach_cell([this](const auto& c) { add_sidb(c); });
+    }
+    /**
+     * Checks whether positively charged SiDBs can occur among all registered SiDBs.
+     *
+     * @return `true` iff positively charged SiDBs can occur.
+     */
+    [[nodiscard]] bool can_positive_charges_occur() const noexcept
+    {
+        return std::any_of(local_potentials.cbegin(), local_potentials.cend(),
+                           [this](const double pot) { return pot > positive_charge_threshold; });
+    }
+    /**
+     * Registers an SiDB at the given cell.
+     *
+     * @param c Cell of the SiDB.
+     */
+    void add_sidb(const cell<Lyt>& c) noexcept
+    {
+        const auto potential = compute_potentials_to(c);
+
+        for (std::size_t i = 0; i < local_potentials.size(); ++i)
+        {
+            local_potentials[i] += potentials_to_new_sidb[i];
+        }
+
+        positions.push_back(sidb_nm_position<Lyt>(layout, c));
+        local_potentials.push_back(potential);
+    }
+    /**
+     * Registers an SiDB at the given cell unless positively charged SiDBs could occur afterward.
+     *
+     * @param c Cell of the SiDB.
+     * @return `true` iff the SiDB was registered.
+     */
+    [[nodiscard]] bool add_sidb_if_no_positive_charges_can_occur(const cell<Lyt>& c) noexcept
+    {
+        const auto potential = compute_potentials_to(c);
+
+        if (potential > positive_charge_threshold)
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < local_potentials.size(); ++i)
+        {
+            if (local_potentials[i] + potentials_to_new_sidb[i] > positive_charge_threshold)
+            {
+                return false;
+            }
+        }
+
+        for (std::size_t i = 0; i < local_potentials.size(); ++i)
+        {
+            local_potentials[i] += potentials_to_new_sidb[i];
+        }
+
+        positions.push_back(sidb_nm_position<Lyt>(layout, c));
+        local_potentials.push_back(potential);
+
+        return true;
+    }
+
+  private:
+    /**
+     * Layout whose SiDBs are tracked.
+     */
+    const Lyt& layout;
+    /**
+     * Physical parameters.
+     */
+    const sidb_simulation_parameters simulation_parameters;
+    /**
+     * Local potential that needs to be exceeded for positively charged SiDBs to occur (unit: V).
+     */
+    const double positive_charge_threshold;
+    /**
+     * Positions of all registered SiDBs (unit: nm).
+     */
+    std::vector<std::pair<double, double>> positions{};
+    /**
+     * Negated local electrostatic potentials at all registered SiDBs if all SiDBs are negatively charged (unit: V).
+     */
+    std::vector<double> local_potentials{};
+    /**
+     * Positions (unit: nm) and properties of all charged defects.
+     */
+    std::vector<std::pair<std::pair<double, double>, sidb_defect>> charged_defects{};
+    /**
+     * Chargeless potentials between all registered SiDBs and the SiDB that is to be added (unit: V).
+     */
+    std::vector<double> potentials_to_new_sidb{};
+    /**
+     * Computes the chargeless potentials between all registered SiDBs and an SiDB at the given cell and stores them in
+     * `potentials_to_new_sidb`.
+     *
+     * @param c Cell of the SiDB that is to be added.
+     * @return Negated local electrostatic potential at `c` if all SiDBs are negatively charged (unit: V).
+     */
+    [[nodiscard]] double compute_potentials_to(const cell<Lyt>& c) noexcept
+    {
+        const auto [x, y] = sidb_nm_position<Lyt>(layout, c);
+
+        potentials_to_new_sidb.resize(positions.size());
+
+        double potential = 0.0;
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto distance = std::hypot(positions[i].first - x, positions[i].second - y);
+
+            // identical to `charge_distribution_surface::calculate_chargeless_potential_between_sidbs_by_index`
+            potentials_to_new_sidb[i] = distance == 0.0 ? 0.0 :
+                                                          simulation_parameters.k() / (distance * 1E-9) *
+                                                              std::exp(-distance / simulation_parameters.lambda_tf) *
+                                                              constants::physical::ELEMENTARY_CHARGE;
+
+            potential += potentials_to_new_sidb[i];
+        }
+
+        for (const auto& [position, defect] : charged_defects)
+        {
+            const auto distance = std::hypot(position.first - x, position.second - y);
+
+            // identical to `charge_distribution_surface::chargeless_potential_generated_by_defect_at_given_distance`
+            if (distance != 0.0)
+            {
+                potential -= simulation_parameters.k() * simulation_parameters.epsilon_r / defect.epsilon_r /
+                             (distance * 1e-9) * std::exp(-distance / defect.lambda_tf) *
+                             constants::physical::ELEMENTARY_CHARGE * static_cast<double>(defect.charge);
+            }
+        }
+
+        return potential;
+    }
+};
+/**
+ * Generates a layout featuring a random arrangement of SiDBs using the given random number generator.
  *
  * @tparam Lyt SiDB cell-level SiDB layout type.
+ * @tparam RandomEngine Type of the random number generator.
  * @param params The parameters for generating the random layout.
  * @param skeleton Optional layout to which random dots are added.
+ * @param generator Random number generator to draw the SiDB positions from.
  * @return A randomly generated SiDB layout, or `std::nullopt` if the process failed due to conflicting
  * parameters.
  */
-template <typename Lyt>
+template <typename Lyt, typename RandomEngine>
 [[nodiscard]] std::optional<Lyt>
 generate_random_sidb_layout(const generate_random_sidb_layout_params<coordinate<Lyt>>& params,
-                            const std::optional<Lyt>&                                  skeleton = std::nullopt) noexcept
+                            const std::optional<Lyt>& skeleton, RandomEngine& generator) noexcept
 {
-    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
-    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    using positive_charges = typename generate_random_sidb_layout_params<coordinate<Lyt>>::positive_charges;
 
     std::unordered_set<typename Lyt::coordinate> sidbs_affected_by_defects = {};
 
     uint64_t number_of_sidbs_of_final_layout = params.number_of_sidbs;
 
-    Lyt lyt{};
+    const auto cell_type =
+        skeleton.has_value() ? technology<Lyt>::cell_type::LOGIC : technology<Lyt>::cell_type::NORMAL;
 
     if (skeleton.has_value())
     {
-        lyt = skeleton.value().clone();
-        number_of_sidbs_of_final_layout += lyt.num_cells();
+        number_of_sidbs_of_final_layout += skeleton.value().num_cells();
 
         if constexpr (is_sidb_defect_surface_v<Lyt>)
         {
@@ -117,70 +307,113 @@ generate_random_sidb_layout(const generate_random_sidb_layout_params<coordinate<
         }
     }
 
-    // counts the attempts to place the given number of SiDBs
-    uint64_t attempt_counter = 0;
-
-    // stops if either all SiDBs are placed or the maximum number of attempts was performed
-    while (lyt.num_cells() < number_of_sidbs_of_final_layout && attempt_counter < params.maximal_attempts)
+    // generate new layouts until positive charges can occur if this is required
+    while (true)
     {
-        // random coordinate within the area specified by two coordinates
-        const auto random_coord = random_coordinate(params.coordinate_pair.first, params.coordinate_pair.second);
-        bool       next_to_neutral_defect = false;
+        Lyt lyt = skeleton.has_value() ? skeleton.value().clone() : Lyt{};
 
-        if (sidbs_affected_by_defects.count(random_coord) > 0)
-        {
-            next_to_neutral_defect = true;
-        }
+        // the local potentials are only tracked if positive charges need to be checked
+        std::optional<positive_charge_tracker<Lyt>> tracker{};
 
-        bool random_cell_is_identical_wih_defect = false;
-        // check if a defect does not yet occupy random coordinate.
-        if constexpr (has_get_sidb_defect_v<Lyt>)
+        if (params.positive_sidbs != positive_charges::ALLOWED)
         {
-            random_cell_is_identical_wih_defect = (lyt.get_sidb_defect(random_coord).type != sidb_defect_type::NONE);
+            tracker.emplace(lyt, params.simulation_parameters);
         }
 
-        // if the constraints that no positive SiDBs occur and the cell is not yet occupied by a defect are satisfied,
-        // the SiDB is added to the layout
-        if (!random_cell_is_identical_wih_defect && !next_to_neutral_defect)
+        // counts the attempts to place the given number of SiDBs
+        uint64_t attempt_counter = 0;
+
+        // stops if either all SiDBs are placed or the maximum number of attempts was performed
+        while (lyt.num_cells() < number_of_sidbs_of_final_layout && attempt_counter < params.maximal_attempts)
         {
-            if (skeleton.has_value())
+            ++attempt_counter;
+
+            // random coordinate within the area specified by two coordinates
+            const auto random_coord =
+                random_coordinate(params.coordinate_pair.first, params.coordinate_pair.second, generator);
+
+            // the cell must neither be occupied by an SiDB nor be affected by a neutral defect
+            if (!lyt.is_empty_cell(random_coord) || sidbs_affected_by_defects.count(random_coord) > 0)
             {
-                lyt.assign_cell_type(random_coord, technology<Lyt>::cell_type::LOGIC);
+                continue;
             }
-            else
+
+            // check if a defect does not yet occupy random coordinate.
+            if constexpr (has_get_sidb_defect_v<Lyt>)
             {
-                lyt.assign_cell_type(random_coord, technology<Lyt>::cell_type::NORMAL);
+                if (lyt.get_sidb_defect(random_coord).type != sidb_defect_type::NONE)
+                {
+                    continue;
+                }
             }
 
-            if (params.positive_sidbs ==
-                    generate_random_sidb_layout_params<coordinate<Lyt>>::positive_charges::FORBIDDEN &&
-                can_positive_charges_occur(lyt, params.simulation_parameters))
+            if (params.positive_sidbs == positive_charges::FORBIDDEN)
             {
-                lyt.assign_cell_type(random_coord, technology<Lyt>::cell_type::EMPTY);
+                // the SiDB is only added if no positive charges can occur afterward
+                if (!tracker->add_sidb_if_no_positive_charges_can_occur(random_coord))
+                {
+                    continue;
+                }
             }
+            else if (tracker.has_value())
+            {
+                tracker->add_sidb(random_coord);
+            }
+
+            lyt.assign_cell_type(random_coord, cell_type);
         }
-        attempt_counter += 1;
-    }
 
-    if (params.positive_sidbs == generate_random_sidb_layout_params<coordinate<Lyt>>::positive_charges::MAY_OCCUR &&
-        !can_positive_charges_occur(lyt, params.simulation_parameters))
-    {
-        return generate_random_sidb_layout(params, skeleton);
-    }
+        if (params.positive_sidbs == positive_charges::MAY_OCCUR && !tracker->can_positive_charges_occur())
+        {
+            continue;
+        }
 
-    if (lyt.num_cells() == number_of_sidbs_of_final_layout)
-    {
-        return lyt;
+        if (lyt.num_cells() == number_of_sidbs_of_final_layout)
+        {
+            return lyt;
+        }
+
+        // in case some SiDBs could not be placed, return std::nullopt
+        return std::nullopt;
     }
+}
+
+}  // namespace detail
+
+/**
+ * Generates a layout featuring a random arrangement of SiDBs. These randomly placed dots can be incorporated into an
+ * existing layout skeleton that may be optionally provided.
+ *
+ * If positive charges are forbidden, the local electrostatic potentials at all SiDBs are updated incrementally after
+ * each insertion, which takes \f$\mathcal{O}(N)\f$ time per insertion.
+ *
+ * @tparam Lyt SiDB cell-level SiDB layout type.
+ * @param params The parameters for generating the random layout.
+ * @param skeleton Optional layout to which random dots are added.
+ * @return A randomly generated SiDB layout, or `std::nullopt` if the process failed due to conflicting
+ * parameters.
+ */
+template <typename Lyt>
+[[nodiscard]] std::optional<Lyt>
+generate_random_sidb_layout(const generate_random_sidb_layout_params<coordinate<Lyt>>& params,
+                            const std::optional<Lyt>&                                  skeleton = std::nullopt) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    thread_local std::mt19937_64 generator{std::random_device{}()};
 
-    // in case some SiDBs could not be placed, return std::nullopt
-    return std::nullopt;
+    return detail::generate_random_sidb_layout(params, skeleton, generator);
 }
 
 /**
  * Generates multiple random layouts featuring a random arrangement of SiDBs. These randomly placed dots can be
  * incorporated into an existing layout skeleton that may be optionally provided.
  *
+ * The layouts are generated by `number_threads` threads in parallel, each of which uses its own random number
+ * generator. Uniqueness is determined via canonical layout hashes such that a newly generated layout only needs to be
+ * compared to previously generated layouts with the same hash value.
+ *
  * @tparam Lyt SiDB cell-level SiDB layout type.
  * @param params The parameters for generating the random SiDB layouts.
  * @param skeleton Optional layout to which random dots are added.
@@ -198,27 +431,88 @@ generate_multiple_random_sidb_layouts(const generate_random_sidb_layout_params<c
     std::vector<Lyt> unique_lyts{};
     unique_lyts.reserve(params.number_of_unique_generated_layouts);
 
+    // maps canonical layout hashes to the indices of the unique layouts that have them
+    std::unordered_multimap<std::size_t, std::size_t> unique_lyt_hashes{};
+
     // counter for unsuccessful generation attempts
     uint64_t unsuccessful_generation_attempt_counter = 0;
 
-    while (unique_lyts.size() < params.number_of_unique_generated_layouts &&
-           unsuccessful_generation_attempt_counter < params.maximal_attempts_for_multiple_layouts)
+    // protects the unique layouts, their hashes, and the attempt counter
+    std::mutex mutex{};
+
+    const auto is_done = [&]() noexcept
+    {
+        return unique_lyts.size() >= params.number_of_unique_generated_layouts ||
+               unsuccessful_generation_attempt_counter >= params.maximal_attempts_for_multiple_layouts;
+    };
+
+    const auto generate_layouts = [&]() noexcept
     {
-        if (auto random_lyt = generate_random_sidb_layout(params, skeleton); random_lyt.has_value())
+        std::mt19937_64 generator{std::random_device{}()};
+
+        while (true)
         {
-            // check if the layout is unique
-            const auto is_identical = std::any_of(FICTION_EXECUTION_POLICY_PAR_UNSEQ unique_lyts.cbegin(),
-                                                  unique_lyts.cend(), [&](const auto& old_lyt)
-                                                  { return are_cell_layouts_identical(random_lyt.value(), old_lyt); });
+            {
+                const std::lock_guard lock{mutex};
+
+                if (is_done())
+                {
+                    return;
+                }
+            }
 
-            // add layout if unique
-            if (!is_identical)
+            auto random_lyt = detail::generate_random_sidb_layout(params, skeleton, generator);
+
+            // hashing is done outside the critical section
+            const auto hash = random_lyt.has_value() ? canonical_cell_layout_hash(random_lyt.value()) : 0;
+
+            const std::lock_guard lock{mutex};
+
+            if (is_done())
             {
-                unique_lyts.emplace_back(std::move(random_lyt.value()));
-                continue;
+                return;
+            }
+
+            if (random_lyt.has_value())
+            {
+                // check if the layout is unique
+                const auto [first, last] = unique_lyt_hashes.equal_range(hash);
+
+                const auto is_identical =
+                    std::any_of(first, last,
+                                [&](const auto& entry)
+                                { return are_cell_layouts_identical(random_lyt.value(), unique_lyts[entry.second]); });
+
+                // add layout if unique
+                if (!is_identical)
+                {
+                    unique_lyt_hashes.emplace(hash, unique_lyts.size());
+                    unique_lyts.emplace_back(std::move(random_lyt.value()));
+                    continue;
+                }
             }
+
+            ++unsuccessful_generation_attempt_counter;
         }
-        ++unsuccessful_generation_attempt_counter;
+    };
+
+    const auto num_threads =
+        std::max(uint64_t{1}, std::min(params.number_threads, params.number_of_unique_generated_layouts));
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads - 1);
+
+    for (uint64_t i = 1; i < num_threads; ++i)
+    {
+        threads.emplace_back(generate_layouts);
+    }
+
+    // the calling thread participates as well
+    generate_layouts();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
     }
 
     // return std::nullopt if no layouts were generated
@@ -43,8 +43,13 @@ enum class sidb_simulation_engine : uint8_t
      * were previously considered astronomical in size. Inherent to the simulation methodology that does not depend on
      * the simulation base, it simulates very effectively for either base number (2 or 3).
      */
-    CLUSTERCOMPLETE
+    CLUSTERCOMPLETE,
 #endif  // FICTION_ALGLIB_ENABLED
+    /**
+     * *SimAnneal* is a heuristic simulation engine based on simulated annealing over charge configurations that scales
+     * to layouts with more than a hundred SiDBs.
+     */
+    SIMANNEAL
 };
 /**
  * Selector exclusively for exact SiDB simulation engines.
@@ -78,7 +83,12 @@ enum class heuristic_sidb_simulation_engine : uint8_t
     /**
      * *QuickSim* is a heuristic simulation engine that only requires polynomial runtime.
      */
-    QUICKSIM
+    QUICKSIM,
+    /**
+     * *SimAnneal* is a heuristic simulation engine based on simulated annealing over charge configurations that scales
+     * to layouts with more than a hundred SiDBs.
+     */
+    SIMANNEAL
 };
 /**
  * Returns the name of the given simulation engine.
@@ -118,6 +128,10 @@ template <typename EngineType>
             {
                 return "QuickSim";
             }
+            case EngineType::SIMANNEAL:
+            {
+                return "SimAnneal";
+            }
             default:
             {
                 return "unsupported simulation engine";
@@ -160,6 +174,10 @@ template <typename EngineType>
             {
                 return "QuickSim";
             }
+            case EngineType::SIMANNEAL:
+            {
+                return "SimAnneal";
+            }
             default:
             {
                 return "unsupported simulation engine";
@@ -183,7 +201,8 @@ get_sidb_simulation_engine(const std::string_view& name) noexcept
 #if (FICTION_ALGLIB_ENABLED)
         {"CLUSTERCOMPLETE", sidb_simulation_engine::CLUSTERCOMPLETE},
 #endif  // FICTION_ALGLIB_ENABLED
-        {"QUICKSIM", sidb_simulation_engine::QUICKSIM}};
+        {"QUICKSIM", sidb_simulation_engine::QUICKSIM},
+        {"SIMANNEAL", sidb_simulation_engine::SIMANNEAL}};
 
     std::string upper_name = name.data();
     std::transform(upper_name.begin(), upper_name.end(), upper_name.begin(), ::toupper);
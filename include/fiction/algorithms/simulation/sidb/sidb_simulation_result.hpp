@@ -10,6 +10,7 @@
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/constants.hpp"
 
+#include <algorithm>
 #include <any>
 #include <chrono>
 #include <cstdint>
@@ -110,6 +111,29 @@ struct sidb_simulation_result
 
         return groundstate_charge_distributions;
     }
+    /**
+     * Removes all charge distributions whose electrostatic potential energy exceeds the minimum energy of all charge
+     * distributions by more than the given energy window.
+     *
+     * @param energy_window Maximum energy difference to the ground state that a charge distribution may have to be kept
+     * (unit: eV).
+     */
+    void restrict_to_energy_window(const double energy_window) noexcept
+    {
+        if (charge_distributions.empty() || energy_window == std::numeric_limits<double>::infinity())
+        {
+            return;
+        }
+
+        const auto max_energy =
+            minimum_energy(charge_distributions.cbegin(), charge_distributions.cend()) + energy_window;
+
+        charge_distributions.erase(
+            std::remove_if(charge_distributions.begin(), charge_distributions.end(),
+                           [max_energy](const auto& cds)
+                           { return cds.get_electrostatic_potential_energy() > max_energy + constants::ERROR_MARGIN; }),
+            charge_distributions.end());
+    }
 };
 
 }  // namespace fiction
@@ -0,0 +1,480 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_SIM_ANNEAL_HPP
+#define FICTION_SIM_ANNEAL_HPP
+
+#include "fiction/algorithms/optimization/simulated_annealing.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/execution_utils.hpp"
+#include "fiction/utils/profiling.hpp"
+
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the *SimAnneal* algorithm.
+ */
+struct sim_anneal_params
+{
+    /**
+     * Simulation parameters for the simulation of the physical SiDB system.
+     */
+    sidb_simulation_parameters simulation_parameters{};
+    /**
+     * Number of independent annealing chains. Each chain starts from a different random charge configuration.
+     */
+    uint64_t number_of_chains{16};
+    /**
+     * Temperature at which each chain starts (unit: eV).
+     */
+    double initial_temperature{0.1};
+    /**
+     * Temperature at which each chain stops (unit: eV).
+     */
+    double final_temperature{0.001};
+    /**
+     * Factor by which the temperature is multiplied after each annealing step. Has to be in \f$(0, 1)\f$.
+     */
+    double cooling_factor{0.9};
+    /**
+     * Number of proposed charge transitions per SiDB at each temperature.
+     */
+    uint64_t sweeps_per_temperature{10};
+    /**
+     * Probability of proposing that an electron hops between two SiDBs instead of changing the charge state of a single
+     * SiDB.
+     */
+    double hop_probability{0.5};
+    /**
+     * The ground state is the physically valid charge distribution of minimal electrostatic potential energy, which
+     * often holds fewer electrons than the minimum of the grand potential. Therefore, the chains anneal with chemical
+     * potentials that are spread evenly between \f$\mu_-\f$ and \f$(1 - s) \cdot \mu_-\f$, where \f$s\f$ is this
+     * value, before they descend to a local minimum of the actual grand potential. Has to be in \f$[0, 1]\f$.
+     */
+    double chemical_potential_spread{0.8};
+    /**
+     * Number of threads to spawn. By default the number of threads is set to the number of available hardware threads.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
+    /**
+     * Seed for the random number generators. Each chain draws from its own random stream that is derived from this
+     * seed and its index. Hence, results are reproducible and independent of the number of threads. If no seed is
+     * given, a random one is used.
+     */
+    std::optional<uint64_t> seed = std::nullopt;
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class sim_anneal_impl
+{
+  public:
+    sim_anneal_impl(const Lyt& lyt, const sim_anneal_params& parameter) :
+            charge_lyt{lyt},
+            params{parameter},
+            mu_minus{parameter.simulation_parameters.mu_minus},
+            number_of_sidbs{charge_lyt.num_cells()}
+    {
+        charge_lyt.set_sidb_simulation_engine(sidb_simulation_engine::SIMANNEAL);
+        charge_lyt.assign_physical_parameters(parameter.simulation_parameters);
+        charge_lyt.assign_base_number(2);
+        charge_lyt.assign_all_charge_states(sidb_charge_state::NEUTRAL);
+        charge_lyt.update_after_charge_change();
+    }
+
+    std::optional<sidb_simulation_result<Lyt>> run() noexcept
+    {
+        FICTION_PROFILE_SCOPE("sim_anneal");
+
+        sidb_simulation_result<Lyt> st{};
+        st.algorithm_name = "SimAnneal";
+        st.additional_simulation_parameters.emplace("number_of_chains", params.number_of_chains);
+        st.additional_simulation_parameters.emplace("initial_temperature", params.initial_temperature);
+        st.additional_simulation_parameters.emplace("final_temperature", params.final_temperature);
+        st.additional_simulation_parameters.emplace("cooling_factor", params.cooling_factor);
+        st.additional_simulation_parameters.emplace("sweeps_per_temperature", params.sweeps_per_temperature);
+        st.additional_simulation_parameters.emplace("hop_probability", params.hop_probability);
+        st.additional_simulation_parameters.emplace("chemical_potential_spread", params.chemical_potential_spread);
+        st.simulation_parameters = params.simulation_parameters;
+
+        mockturtle::stopwatch<>::duration time_counter{};
+
+        // measure run time (artificial scope)
+        {
+            const mockturtle::stopwatch stop{time_counter};
+
+            const auto seed = seed_or_random(params.seed);
+
+            st.additional_simulation_parameters.emplace("seed", seed);
+
+            // each chain writes to its own slot such that the results do not depend on the thread scheduling
+            std::vector<std::optional<charge_distribution_surface<Lyt>>> chain_results(
+                static_cast<std::size_t>(params.number_of_chains));
+
+            run_on_bounded_threads(static_cast<std::size_t>(params.number_of_chains),
+                                   static_cast<std::size_t>(params.number_threads),
+                                   [&](const std::size_t chain_index)
+                                   {
+                                       auto generator = make_stream_generator(seed, chain_index);
+
+                                       auto chain_lyt = run_chain(generator, chain_index);
+
+                                       if (chain_lyt.is_physically_valid())
+                                       {
+                                           chain_lyt.charge_distribution_to_index();
+
+                                           chain_results[chain_index] = std::move(chain_lyt);
+                                       }
+                                   });
+
+            std::set<std::vector<sidb_charge_state>> found_configurations{};
+
+            for (auto& chain_lyt : chain_results)
+            {
+                if (chain_lyt.has_value() && found_configurations.insert(chain_lyt->get_all_sidb_charges()).second)
+                {
+                    st.charge_distributions.emplace_back(std::move(*chain_lyt));
+                }
+            }
+        }
+
+        st.simulation_runtime = time_counter;
+
+        if (st.charge_distributions.empty())
+        {
+            return std::nullopt;
+        }
+
+        return st;
+    }
+
+  private:
+    /**
+     * Charge distribution surface of the layout to simulate. It is copied by each chain.
+     */
+    charge_distribution_surface<Lyt> charge_lyt;
+    /**
+     * Parameters of the simulation.
+     */
+    const sim_anneal_params& params;
+    /**
+     * Energy transition level (0/-) (unit: eV).
+     */
+    const double mu_minus;
+    /**
+     * Number of SiDBs in the layout.
+     */
+    const uint64_t number_of_sidbs;
+    /**
+     * Change of the grand potential (unit: eV) if the charge state of the SiDB with the given index is flipped between
+     * neutral and negative. The grand potential is the electrostatic potential energy plus the chemical potential per
+     * negatively charged SiDB.
+     *
+     * @param lyt Current charge distribution.
+     * @param i Index of the SiDB.
+     * @param mu Chemical potential (unit: eV).
+     * @return Grand potential change of the flip.
+     */
+    [[nodiscard]] static double flip_delta(const charge_distribution_surface<Lyt>& lyt, const uint64_t i,
+                                           const double mu) noexcept
+    {
+        const auto charge_diff = lyt.get_charge_state_by_index(i) == sidb_charge_state::NEGATIVE ? 1.0 : -1.0;
+        const auto local_pot   = lyt.get_local_internal_potentials()[i] + lyt.get_local_external_potentials()[i];
+
+        return charge_diff * (local_pot - mu);
+    }
+    /**
+     * Change of the grand potential (unit: eV) if an electron hops from the negatively charged SiDB with index `i` to
+     * the neutrally charged SiDB with index `j`. Hops preserve the number of negatively charged SiDBs.
+     *
+     * @param lyt Current charge distribution.
+     * @param i Index of the negatively charged SiDB.
+     * @param j Index of the neutrally charged SiDB.
+     * @return Grand potential change of the hop.
+     */
+    [[nodiscard]] static double hop_delta(const charge_distribution_surface<Lyt>& lyt, const uint64_t i,
+                                          const uint64_t j) noexcept
+    {
+        const auto& int_pot = lyt.get_local_internal_potentials();
+        const auto& ext_pot = lyt.get_local_external_potentials();
+
+        return int_pot[i] + ext_pot[i] - int_pot[j] - ext_pot[j] - lyt.get_chargeless_potential_by_indices(i, j);
+    }
+    /**
+     * Flips the charge state of the SiDB with the given index between neutral and negative.
+     *
+     * @param lyt Charge distribution to change.
+     * @param i Index of the SiDB.
+     */
+    static void flip(charge_distribution_surface<Lyt>& lyt, const uint64_t i) noexcept
+    {
+        lyt.change_charge_state_by_index(i, lyt.get_charge_state_by_index(i) == sidb_charge_state::NEGATIVE ?
+                                                sidb_charge_state::NEUTRAL :
+                                                sidb_charge_state::NEGATIVE);
+    }
+    /**
+     * Lets an electron hop from the SiDB with index `i` to the SiDB with index `j`.
+     *
+     * @param lyt Charge distribution to change.
+     * @param i Index of the negatively charged SiDB.
+     * @param j Index of the neutrally charged SiDB.
+     */
+    static void hop(charge_distribution_surface<Lyt>& lyt, const uint64_t i, const uint64_t j) noexcept
+    {
+        lyt.change_charge_state_by_index(i, sidb_charge_state::NEUTRAL);
+        lyt.change_charge_state_by_index(j, sidb_charge_state::NEGATIVE);
+    }
+    /**
+     * Runs a single annealing chain from a random charge configuration. The chemical potential with which the chain
+     * anneals is determined by its index and `chemical_potential_spread`.
+     *
+     * @param generator Random number generator of the chain.
+     * @param chain_index Index of the chain.
+     * @return The final charge distribution of the chain.
+     */
+    [[nodiscard]] charge_distribution_surface<Lyt> run_chain(simulated_annealing_generator& generator,
+                                                             const std::size_t chain_index) const noexcept
+    {
+        auto lyt = charge_lyt;
+
+        std::bernoulli_distribution coin{0.5};
+
+        for (uint64_t i = 0; i < number_of_sidbs; ++i)
+        {
+            lyt.assign_charge_state_by_index(
+                i, coin(generator) ? sidb_charge_state::NEGATIVE : sidb_charge_state::NEUTRAL,
+                charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        lyt.update_after_charge_change();
+
+        const auto offset = params.number_of_chains > 1 ?
+                                params.chemical_potential_spread * static_cast<double>(chain_index) /
+                                    static_cast<double>(params.number_of_chains - 1) :
+                                0.0;
+
+        anneal(lyt, generator, mu_minus * (1.0 - offset));
+
+        return lyt;
+    }
+    /**
+     * Anneals the given charge distribution according to the temperature schedule in `params`, restores the lowest
+     * grand potential configuration that was encountered, and refines it by a greedy descent. Proposed transitions are
+     * evaluated from the local potentials in constant time. Only accepted transitions update the local potentials,
+     * which takes linear time. Afterward, all potentials are recomputed from scratch to avoid accumulated rounding
+     * errors, and the physical validity is determined.
+     *
+     * @param lyt Charge distribution to anneal.
+     * @param generator Random number generator of the chain.
+     * @param mu Chemical potential with which the charge distribution is annealed (unit: eV). The greedy descent uses
+     * \f$\mu_-\f$ regardless.
+     */
+    void anneal(charge_distribution_surface<Lyt>& lyt, simulated_annealing_generator& generator,
+                const double mu) const noexcept
+    {
+        // the grand potential is tracked relative to the initial configuration
+        double current_potential = 0.0;
+        double best_potential    = 0.0;
+        auto   best_charges      = lyt.get_all_sidb_charges();
+
+        std::uniform_int_distribution<uint64_t> sidb_dist{0, number_of_sidbs - 1};
+        std::bernoulli_distribution             hop_coin{params.hop_probability};
+
+        const auto moves_per_temperature = params.sweeps_per_temperature * number_of_sidbs;
+
+        for (auto temp = params.initial_temperature; temp > params.final_temperature; temp *= params.cooling_factor)
+        {
+            for (uint64_t m = 0; m < moves_per_temperature; ++m)
+            {
+                const auto i = sidb_dist(generator);
+
+                // pick a second SiDB that differs from the first one if a hop is proposed
+                auto j = i;
+
+                if (number_of_sidbs > 1 && hop_coin(generator))
+                {
+                    while (j == i)
+                    {
+                        j = sidb_dist(generator);
+                    }
+                }
+
+                if (j != i && lyt.get_charge_state_by_index(i) != lyt.get_charge_state_by_index(j))
+                {
+                    const auto [from, to] = lyt.get_charge_state_by_index(i) == sidb_charge_state::NEGATIVE ?
+                                                std::pair{i, j} :
+                                                std::pair{j, i};
+
+                    if (const auto delta = hop_delta(lyt, from, to); metropolis_accept(delta, temp, generator))
+                    {
+                        hop(lyt, from, to);
+                        current_potential += delta;
+                    }
+                }
+                // if both SiDBs are in the same charge state, a flip is proposed instead
+                else if (const auto delta = flip_delta(lyt, i, mu); metropolis_accept(delta, temp, generator))
+                {
+                    flip(lyt, i);
+                    current_potential += delta;
+                }
+
+                if (current_potential < best_potential - constants::ERROR_MARGIN)
+                {
+                    best_potential = current_potential;
+                    best_charges   = lyt.get_all_sidb_charges_ref();
+                }
+            }
+        }
+
+        // restore the best configuration
+        for (uint64_t i = 0; i < number_of_sidbs; ++i)
+        {
+            lyt.change_charge_state_by_index(i, best_charges[i]);
+        }
+
+        greedy_descent(lyt);
+
+        lyt.update_after_charge_change();
+    }
+    /**
+     * Applies the transition that decreases the grand potential the most until no such transition remains, i.e., until
+     * a local minimum is reached.
+     *
+     * @param lyt Charge distribution to refine.
+     */
+    void greedy_descent(charge_distribution_surface<Lyt>& lyt) const noexcept
+    {
+        while (true)
+        {
+            double   best_delta = -constants::ERROR_MARGIN;
+            uint64_t best_i     = number_of_sidbs;
+            uint64_t best_j     = number_of_sidbs;
+
+            for (uint64_t i = 0; i < number_of_sidbs; ++i)
+            {
+                if (const auto delta = flip_delta(lyt, i, mu_minus); delta < best_delta)
+                {
+                    best_delta = delta;
+                    best_i     = i;
+                    best_j     = number_of_sidbs;
+                }
+
+                if (lyt.get_charge_state_by_index(i) != sidb_charge_state::NEGATIVE)
+                {
+                    continue;
+                }
+
+                for (uint64_t j = 0; j < number_of_sidbs; ++j)
+                {
+                    if (lyt.get_charge_state_by_index(j) != sidb_charge_state::NEUTRAL)
+                    {
+                        continue;
+                    }
+
+                    if (const auto delta = hop_delta(lyt, i, j); delta < best_delta)
+                    {
+                        best_delta = delta;
+                        best_i     = i;
+                        best_j     = j;
+                    }
+                }
+            }
+
+            if (best_i == number_of_sidbs)
+            {
+                return;
+            }
+
+            if (best_j == number_of_sidbs)
+            {
+                flip(lyt, best_i);
+            }
+            else
+            {
+                hop(lyt, best_i, best_j);
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * *SimAnneal* is a heuristic electrostatic ground state simulation algorithm for SiDB layouts that is based on
+ * simulated annealing over charge configurations, similar to the ground state engine of SiQAD. It scales to layouts
+ * with more than a hundred SiDBs, where exact engines become infeasible.
+ *
+ * Multiple independent annealing chains are run concurrently, each starting from a random charge configuration. A
+ * chain minimizes the grand potential, i.e., the electrostatic potential energy plus the chemical potential per
+ * negatively charged SiDB, by proposing two kinds of transitions: flipping the charge state of a single SiDB between
+ * neutral and negative, and letting an electron hop from a negatively charged SiDB to a neutral one. The change in
+ * grand potential of each proposed transition is derived from the local electrostatic potentials in constant time,
+ * and accepted transitions update these potentials incrementally in linear time via
+ * `charge_distribution_surface::change_charge_state_by_index`.
+ *
+ * Physically valid charge distributions are local minima of the grand potential with chemical potential \f$\mu_-\f$.
+ * The ground state is the one of minimal electrostatic potential energy among them, which often holds fewer electrons
+ * than the global minimum of the grand potential. Therefore, the chains anneal with chemical potentials that are spread
+ * between \f$\mu_-\f$ and a less favorable value. Each chain then descends greedily to a local minimum of the grand
+ * potential with \f$\mu_-\f$. All distinct physically valid results are returned.
+ *
+ * Like any heuristic, *SimAnneal* is not guaranteed to find the ground state. Increasing the number of chains, the
+ * number of sweeps per temperature, or the cooling factor increases the probability of success.
+ *
+ * @note *SimAnneal* currently only supports two-state simulation (negative and neutral SiDBs) and does not support
+ * atomic defect simulation.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param ps *SimAnneal* parameters.
+ * @return `sidb_simulation_result` is returned if at least one physically valid charge distribution was found,
+ * otherwise `std::nullopt`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::optional<sidb_simulation_result<Lyt>> sim_anneal(const Lyt&               lyt,
+                                                                    const sim_anneal_params& ps = {}) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt must be an SiDB layout");
+    static_assert(!is_sidb_defect_surface_v<Lyt>,
+                  "Lyt cannot be an SiDB defect surface, defects are not supported by the SimAnneal algorithm");
+
+    assert(ps.cooling_factor > 0.0 && ps.cooling_factor < 1.0 && "cooling_factor must be in (0, 1)");
+    assert(ps.final_temperature > 0.0 && "final_temperature must be positive");
+
+    if (lyt.num_cells() == 0 || ps.number_of_chains == 0)
+    {
+        return std::nullopt;
+    }
+
+    detail::sim_anneal_impl<Lyt> p{lyt, ps};
+
+    return p.run();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_SIM_ANNEAL_HPP
@@ -11,7 +11,9 @@
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/algorithms/simulation/sidb/sim_anneal.hpp"
 #include "fiction/traits.hpp"
 
 #include <fmt/format.h>
@@ -48,9 +50,9 @@ struct time_to_solution_params
 };
 
 /**
- * This struct stores the time-to-solution, the simulation accuracy and the average single simulation runtime of
- * *QuickSim*, the single runtime of the exact simulator used, and the number of valid charge
- * configurations found by the exact algorithm.
+ * This struct stores the time-to-solution, the simulation accuracy and the average single simulation runtime of a
+ * heuristic simulation algorithm (*QuickSim* or *SimAnneal*), the single runtime of the exact simulator used, and the
+ * number of valid charge configurations found by the exact algorithm.
  */
 struct time_to_solution_stats
 {
@@ -85,6 +87,65 @@ struct time_to_solution_stats
                            time_to_solution, acc, mean_single_runtime, single_runtime_exact, algorithm);
     }
 };
+namespace detail
+{
+
+/**
+ * Simulates the given layout with the exact simulation engine that is selected in `tts_params` to obtain the reference
+ * ground state for the time-to-solution calculation. The name of the engine is stored in `st`.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param simulation_parameters Physical simulation parameters.
+ * @param tts_params Parameters used for the time-to-solution calculation.
+ * @param st Statistics in which the name of the exact simulation engine is stored.
+ * @return Simulation results of the exact simulation engine.
+ */
+template <typename Lyt>
+[[nodiscard]] sidb_simulation_result<Lyt>
+exact_reference_simulation(const Lyt& lyt, const sidb_simulation_parameters& simulation_parameters,
+                           const time_to_solution_params& tts_params, time_to_solution_stats& st) noexcept
+{
+    if (tts_params.engine == exact_sidb_simulation_engine::QUICKEXACT)
+    {
+        const quickexact_params<cell<Lyt>> params{simulation_parameters,
+                                                  quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
+        st.algorithm = sidb_simulation_engine_name(exact_sidb_simulation_engine::QUICKEXACT);
+        return quickexact(lyt, params);
+    }
+#if (FICTION_ALGLIB_ENABLED)
+    if (tts_params.engine == exact_sidb_simulation_engine::CLUSTERCOMPLETE)
+    {
+        const clustercomplete_params<cell<Lyt>> params{simulation_parameters};
+        st.algorithm = sidb_simulation_engine_name(exact_sidb_simulation_engine::CLUSTERCOMPLETE);
+        return clustercomplete(lyt, params);
+    }
+#endif  // FICTION_ALGLIB_ENABLED
+
+    st.algorithm = sidb_simulation_engine_name(exact_sidb_simulation_engine::EXGS);
+    return exhaustive_ground_state_simulation(lyt, simulation_parameters);
+}
+/**
+ * Returns the statistics of a time-to-solution calculation for an empty layout.
+ *
+ * @param tts_params Parameters used for the time-to-solution calculation.
+ * @return Statistics of an empty layout.
+ */
+[[nodiscard]] inline time_to_solution_stats empty_layout_time_to_solution(const time_to_solution_params& tts_params)
+{
+    time_to_solution_stats st{};
+
+    st.single_runtime_exact = 0.0;
+    st.time_to_solution     = std::numeric_limits<double>::max();
+    st.acc                  = 0.0;
+    st.mean_single_runtime  = 0.0;
+    st.algorithm            = sidb_simulation_engine_name(tts_params.engine);
+
+    return st;
+}
+
+}  // namespace detail
+
 /**
  * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm.
  *
@@ -101,44 +162,19 @@ void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
-    time_to_solution_stats st{};
-
     if (lyt.num_cells() == 0)
     {
-        st.single_runtime_exact = 0.0;
-        st.time_to_solution     = std::numeric_limits<double>::max();
-        st.acc                  = 0.0;
-        st.mean_single_runtime  = 0.0;
-        st.algorithm            = sidb_simulation_engine_name(tts_params.engine);
-
         if (ps)
         {
-            *ps = st;
+            *ps = detail::empty_layout_time_to_solution(tts_params);
         }
         return;
     }
 
-    sidb_simulation_result<Lyt> simulation_result{};
-    if (tts_params.engine == exact_sidb_simulation_engine::QUICKEXACT)
-    {
-        const quickexact_params<cell<Lyt>> params{quicksim_params.simulation_parameters,
-                                                  quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-        st.algorithm      = sidb_simulation_engine_name(exact_sidb_simulation_engine::QUICKEXACT);
-        simulation_result = quickexact(lyt, params);
-    }
-#if (FICTION_ALGLIB_ENABLED)
-    else if (tts_params.engine == exact_sidb_simulation_engine::CLUSTERCOMPLETE)
-    {
-        const clustercomplete_params<cell<Lyt>> params{quicksim_params.simulation_parameters};
-        st.algorithm      = sidb_simulation_engine_name(exact_sidb_simulation_engine::CLUSTERCOMPLETE);
-        simulation_result = clustercomplete(lyt, params);
-    }
-#endif  // FICTION_ALGLIB_ENABLED
-    else
-    {
-        st.algorithm      = sidb_simulation_engine_name(exact_sidb_simulation_engine::EXGS);
-        simulation_result = exhaustive_ground_state_simulation(lyt, quicksim_params.simulation_parameters);
-    }
+    time_to_solution_stats st{};
+
+    const auto simulation_result =
+        detail::exact_reference_simulation(lyt, quicksim_params.simulation_parameters, tts_params, st);
 
     std::vector<sidb_simulation_result<Lyt>> simulation_results_quicksim{};
     simulation_results_quicksim.reserve(tts_params.repetitions);
@@ -166,6 +202,69 @@ void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
         *ps = st;
     }
 }
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *SimAnneal* algorithm. Runs that
+ * do not find any physically valid charge distribution count as failed attempts. If a seed is given in
+ * `sim_anneal_params`, the repetitions use consecutive seeds starting from it such that they are independent yet
+ * reproducible.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param sim_anneal_params Parameters required for the *SimAnneal* algorithm.
+ * @param tts_params Parameters used for the time-to-solution calculation.
+ * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
+ */
+template <typename Lyt>
+void time_to_solution(const Lyt& lyt, const sim_anneal_params& sim_anneal_params,
+                      const time_to_solution_params& tts_params = {}, time_to_solution_stats* ps = nullptr) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    if (lyt.num_cells() == 0)
+    {
+        if (ps)
+        {
+            *ps = detail::empty_layout_time_to_solution(tts_params);
+        }
+        return;
+    }
+
+    time_to_solution_stats st{};
+
+    const auto simulation_result =
+        detail::exact_reference_simulation(lyt, sim_anneal_params.simulation_parameters, tts_params, st);
+
+    std::vector<sidb_simulation_result<Lyt>> simulation_results_sim_anneal{};
+    simulation_results_sim_anneal.reserve(tts_params.repetitions);
+
+    auto repetition_params = sim_anneal_params;
+
+    for (auto i = 0u; i < tts_params.repetitions; ++i)
+    {
+        if (sim_anneal_params.seed.has_value())
+        {
+            repetition_params.seed = *sim_anneal_params.seed + i;
+        }
+
+        if (const auto result = sim_anneal<Lyt>(lyt, repetition_params); result.has_value())
+        {
+            simulation_results_sim_anneal.push_back(*result);
+        }
+        else
+        {
+            simulation_results_sim_anneal.push_back(sidb_simulation_result<Lyt>{});
+        }
+    }
+
+    time_to_solution_for_given_simulation_results(simulation_result, simulation_results_sim_anneal,
+                                                  tts_params.confidence_level, &st);
+
+    if (ps)
+    {
+        *ps = st;
+    }
+}
 
 /**
  * This function calculates the Time-to-Solution (TTS) by analyzing the simulation results of a heuristic algorithm
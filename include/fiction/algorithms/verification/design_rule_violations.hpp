@@ -12,10 +12,16 @@
 #include <fmt/ranges.h>
 #include <mockturtle/traits.hpp>
 #include <nlohmann/json.hpp>
+#include <phmap.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -75,6 +81,14 @@ struct gate_level_drv_params
      */
     bool border_io = true;
 
+    // Execution
+
+    /**
+     * Number of threads to check the tiles of large layouts concurrently. By default, the number of threads is set to
+     * the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+
     /**
      * Stream to write the report into.
      */
@@ -100,6 +114,53 @@ struct gate_level_drv_stats
 namespace detail
 {
 
+/**
+ * Design rule violations and warnings that are local to a single occupied tile.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+struct tile_drvs
+{
+    /**
+     * The node on the tile is dead.
+     */
+    bool placed_dead_node{false};
+    /**
+     * Fanin tiles that are not adjacent to the tile.
+     */
+    std::vector<tile<Lyt>> non_adjacent_fanins{};
+    /**
+     * The tile has no predecessors but is no PI or no successors but is no PO.
+     */
+    bool missing_connection{false};
+    /**
+     * The tile hosts a wire that crosses a non-wire tile.
+     */
+    bool crossing_gate{false};
+    /**
+     * Fanin tiles that do not feed the tile according to the clocking scheme.
+     */
+    std::vector<tile<Lyt>> improperly_clocked_fanins{};
+    /**
+     * Checks whether the tile has no violations.
+     *
+     * @return `true` iff no violation or warning was found on the tile.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return !placed_dead_node && non_adjacent_fanins.empty() && !missing_connection && !crossing_gate &&
+               improperly_clocked_fanins.empty();
+    }
+};
+/**
+ * Maps all tiles with violations or warnings to their violations.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+using tile_drv_map = phmap::flat_hash_map<tile<Lyt>, tile_drvs<Lyt>>;
+
 template <typename Lyt>
 class gate_level_drvs_impl
 {
@@ -110,12 +171,178 @@ class gate_level_drvs_impl
      * @param lyt Gate layout to check for design rule flaws.
      * @param p Parameters.
      * @param st Statistics.
+     * @param tile_violations Tile-local violations of `lyt` that have been determined beforehand via
+     * `collect_tile_drvs`. If `nullptr`, they are determined by `run`.
      */
-    explicit gate_level_drvs_impl(const Lyt& src, const gate_level_drv_params& p, gate_level_drv_stats& st) :
+    explicit gate_level_drvs_impl(const Lyt& src, const gate_level_drv_params& p, gate_level_drv_stats& st,
+                                  const tile_drv_map<Lyt>* tile_violations = nullptr) :
             lyt{src},
             ps{p},
-            pst{st}
+            pst{st},
+            cached_tile_drvs{tile_violations}
     {}
+    /**
+     * Checks a single tile for all enabled tile-local design rule violations and warnings. This function only reads
+     * from the layout and can thus be called concurrently for different tiles.
+     *
+     * @param lyt Gate layout to check.
+     * @param ps Parameters.
+     * @param t Tile to check.
+     * @return Violations and warnings of `t`.
+     */
+    [[nodiscard]] static tile_drvs<Lyt> check_tile(const Lyt& lyt, const gate_level_drv_params& ps,
+                                                   const tile<Lyt>& t) noexcept
+    {
+        tile_drvs<Lyt> drvs{};
+
+        if (lyt.is_empty_tile(t))
+        {
+            return drvs;
+        }
+
+        const auto n = lyt.get_node(t);
+
+        // if the node is dead but placed
+        if (ps.placed_dead_nodes && lyt.is_dead(n))
+        {
+            drvs.placed_dead_node = true;
+        }
+
+        if (ps.non_adjacent_connections || ps.clocked_data_flow)
+        {
+            for (const auto& child : lyt.strg->nodes[n].children)
+            {
+                const auto ct = lyt.get_tile(lyt.get_node(child.index));
+
+                if (ps.non_adjacent_connections && !lyt.is_adjacent_elevation_of(t, ct))
+                {
+                    drvs.non_adjacent_fanins.push_back(ct);
+                }
+                if (ps.clocked_data_flow && !lyt.is_incoming_clocked(t, ct))
+                {
+                    drvs.improperly_clocked_fanins.push_back(ct);
+                }
+            }
+        }
+
+        if (ps.missing_connections)
+        {
+            const bool dangling_inp_connection = lyt.fanin_size(n) == 0 && !lyt.is_pi_tile(t);
+            const bool dangling_out_connection = lyt.fanout_size(n) == 0 && !lyt.is_po_tile(t);
+
+            drvs.missing_connection = dangling_out_connection || dangling_inp_connection;
+        }
+
+        // if a wire crosses anything but another wire
+        if (ps.crossing_gates && !lyt.is_dead(n) && lyt.is_wire(n) && lyt.is_crossing_layer(t))
+        {
+            drvs.crossing_gate = !lyt.is_wire_tile(lyt.below(t));
+        }
+
+        return drvs;
+    }
+    /**
+     * Returns the tiles that the fanin signals of the node on the given tile point to, including the ones that are not
+     * adjacent, not properly clocked, or not even occupied.
+     *
+     * @param lyt Gate layout.
+     * @param t Tile whose fanins are desired.
+     * @return Fanin signal tiles of the node on `t` or an empty vector if `t` is empty.
+     */
+    [[nodiscard]] static std::vector<tile<Lyt>> fanin_tiles(const Lyt& lyt, const tile<Lyt>& t) noexcept
+    {
+        std::vector<tile<Lyt>> fanins{};
+
+        if (!lyt.is_empty_tile(t))
+        {
+            for (const auto& child : lyt.strg->nodes[lyt.get_node(t)].children)
+            {
+                fanins.push_back(static_cast<tile<Lyt>>(child.index));
+            }
+        }
+
+        return fanins;
+    }
+    /**
+     * Determines the tile-local design rule violations and warnings of all occupied tiles. Instead of visiting every
+     * tile within the layout bounds, only the tiles that are stored in the tile-to-node mapping are checked. For large
+     * layouts, these tiles are partitioned into contiguous chunks that are checked concurrently, each thread collecting
+     * its violations in a local buffer that is merged afterward.
+     *
+     * @param lyt Gate layout to check.
+     * @param ps Parameters.
+     * @return Violations and warnings of all tiles that have any.
+     */
+    [[nodiscard]] static tile_drv_map<Lyt> collect_tile_drvs(const Lyt& lyt, const gate_level_drv_params& ps)
+    {
+        tile_drv_map<Lyt> tile_violations{};
+
+        if (lyt.is_empty())
+        {
+            return tile_violations;
+        }
+
+        std::vector<tile<Lyt>> tiles{};
+        tiles.reserve(lyt.strg->data.tile_node_map.size());
+
+        for (const auto& [s, n] : lyt.strg->data.tile_node_map)
+        {
+            // skip the constants' tiles and tiles outside the layout bounds
+            if (const auto t = static_cast<tile<Lyt>>(s); !t.is_dead() && lyt.is_within_bounds(t))
+            {
+                tiles.push_back(t);
+            }
+        }
+
+        const auto num_threads =
+            std::clamp(tiles.size() / min_tiles_per_thread, std::size_t{1}, std::max(ps.num_threads, std::size_t{1}));
+        const auto chunk_size = (tiles.size() + num_threads - 1) / num_threads;
+
+        std::vector<std::vector<std::pair<tile<Lyt>, tile_drvs<Lyt>>>> buffers(num_threads);
+
+        const auto check_chunk = [&lyt, &ps, &tiles, &buffers, chunk_size](const std::size_t i)
+        {
+            const auto end = std::min(tiles.size(), (i + 1) * chunk_size);
+
+            for (auto j = i * chunk_size; j < end; ++j)
+            {
+                if (auto drvs = check_tile(lyt, ps, tiles[j]); !drvs.empty())
+                {
+                    buffers[i].emplace_back(tiles[j], std::move(drvs));
+                }
+            }
+        };
+
+        if (num_threads == 1)
+        {
+            check_chunk(0);
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(check_chunk, i);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        for (auto& buffer : buffers)
+        {
+            for (auto& [t, drvs] : buffer)
+            {
+                tile_violations.emplace(t, std::move(drvs));
+            }
+        }
+
+        return tile_violations;
+    }
     /**
      * Performs design rule checks on the stored gate layout. The following properties are checked.
      *
@@ -133,6 +360,24 @@ class gate_level_drvs_impl
      */
     void run()
     {
+        if (cached_tile_drvs == nullptr)
+        {
+            tile_violations  = collect_tile_drvs(lyt, ps);
+            cached_tile_drvs = &tile_violations;
+        }
+
+        // report in coordinate order instead of the hash map's iteration order
+        ordered_tile_drvs.clear();
+        ordered_tile_drvs.reserve(cached_tile_drvs->size());
+
+        for (const auto& [t, drvs] : *cached_tile_drvs)
+        {
+            ordered_tile_drvs.emplace_back(t, &drvs);
+        }
+
+        std::sort(ordered_tile_drvs.begin(), ordered_tile_drvs.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
         *ps.out << "[i] Topology:\n";
         if (ps.unplaced_nodes)
         {
@@ -205,6 +450,23 @@ class gate_level_drvs_impl
      * Statistics.
      */
     gate_level_drv_stats& pst;
+    /**
+     * Tile-local violations that are reported by the checks.
+     */
+    const tile_drv_map<Lyt>* cached_tile_drvs;
+    /**
+     * Tile-local violations that were determined by `run` if none were provided.
+     */
+    tile_drv_map<Lyt> tile_violations{};
+    /**
+     * Tiles of `cached_tile_drvs` in the order in which the layout iterates its tiles, each paired with its violations.
+     */
+    std::vector<std::pair<tile<Lyt>, const tile_drvs<Lyt>*>> ordered_tile_drvs{};
+    /**
+     * Minimum number of occupied tiles per thread. Smaller layouts are checked on fewer threads because spawning a
+     * thread costs more than checking a few hundred tiles.
+     */
+    static constexpr std::size_t min_tiles_per_thread = 1024ul;
 
     /**
      * Escape color sequence for passed checks followed by a check mark.
@@ -327,25 +589,14 @@ class gate_level_drvs_impl
 
         auto all_alive = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, drvs] : ordered_tile_drvs)
         {
-            lyt.foreach_tile(
-                [&placed_dead_report, &all_alive, this](const auto& t)
-                {
-                    // skip empty tiles
-                    if (!lyt.is_empty_tile(t))
-                    {
-                        const auto n = lyt.get_node(t);
-
-                        // if the node is dead but placed
-                        if (lyt.is_dead(n))
-                        {
-                            all_alive = false;
-                            log_tile(t, placed_dead_report);
-                            ++pst.warnings;
-                        }
-                    }
-                });
+            if (drvs->placed_dead_node)
+            {
+                all_alive = false;
+                log_tile(t, placed_dead_report);
+                ++pst.warnings;
+            }
         }
 
         pst.report["Dead placed nodes"] = placed_dead_report;
@@ -363,31 +614,15 @@ class gate_level_drvs_impl
 
         auto adjacencies_respected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, drvs] : ordered_tile_drvs)
         {
-            lyt.foreach_tile(
-                [this, &non_adjacency_report, &adjacencies_respected](const auto& t)
-                {
-                    // skip empty tiles
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    for (const auto& child : lyt.strg->nodes[n].children)
-                    {
-                        const auto ct = lyt.get_tile(lyt.get_node(child.index));
-                        if (!lyt.is_adjacent_elevation_of(t, ct))
-                        {
-                            adjacencies_respected = false;
-                            log_tile(ct, non_adjacency_report);
-                            log_tile(t, non_adjacency_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            for (const auto& ct : drvs->non_adjacent_fanins)
+            {
+                adjacencies_respected = false;
+                log_tile(ct, non_adjacency_report);
+                log_tile(t, non_adjacency_report);
+                ++pst.drvs;
+            }
         }
 
         pst.report["Non adjacent connections"] = non_adjacency_report;
@@ -405,28 +640,14 @@ class gate_level_drvs_impl
 
         auto all_connected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, drvs] : ordered_tile_drvs)
         {
-            lyt.foreach_tile(
-                [this, &connections_report, &all_connected](const auto& t)
-                {
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    const bool dangling_inp_connection = lyt.fanin_size(n) == 0 && !lyt.is_pi_tile(t);
-                    const bool dangling_out_connection = lyt.fanout_size(n) == 0 && !lyt.is_po_tile(t);
-
-                    if (dangling_out_connection || dangling_inp_connection)
-                    {
-                        all_connected = false;
-                        log_tile(t, connections_report);
-                        ++pst.drvs;
-                    }
-                });
+            if (drvs->missing_connection)
+            {
+                all_connected = false;
+                log_tile(t, connections_report);
+                ++pst.drvs;
+            }
         }
 
         pst.report["Missing connections"] = connections_report;
@@ -444,21 +665,14 @@ class gate_level_drvs_impl
 
         auto all_wire_crossings = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, drvs] : ordered_tile_drvs)
         {
-            lyt.foreach_wire(
-                [this, &crossing_report, &all_wire_crossings](const auto& w)
-                {
-                    if (const auto t = lyt.get_tile(w); lyt.is_crossing_layer(t))
-                    {
-                        if (!lyt.is_wire_tile(lyt.below(t)))
-                        {
-                            all_wire_crossings = false;
-                            log_tile(t, crossing_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            if (drvs->crossing_gate)
+            {
+                all_wire_crossings = false;
+                log_tile(t, crossing_report);
+                ++pst.drvs;
+            }
         }
 
         pst.report["Wires crossing gates"] = crossing_report;
@@ -476,30 +690,15 @@ class gate_level_drvs_impl
 
         auto data_flow_respected = true;
 
-        if (!lyt.is_empty())
+        for (const auto& [t, drvs] : ordered_tile_drvs)
         {
-            lyt.foreach_tile(
-                [this, &data_flow_report, &data_flow_respected](const auto& t)
-                {
-                    if (lyt.is_empty_tile(t))
-                    {
-                        return;
-                    }
-
-                    const auto n = lyt.get_node(t);
-
-                    for (const auto& child : lyt.strg->nodes[n].children)
-                    {
-                        const auto ct = lyt.get_tile(lyt.get_node(child.index));
-                        if (!lyt.is_incoming_clocked(t, ct))
-                        {
-                            data_flow_respected = false;
-                            log_tile(ct, data_flow_report);
-                            log_tile(t, data_flow_report);
-                            ++pst.drvs;
-                        }
-                    }
-                });
+            for (const auto& ct : drvs->improperly_clocked_fanins)
+            {
+                data_flow_respected = false;
+                log_tile(ct, data_flow_report);
+                log_tile(t, data_flow_report);
+                ++pst.drvs;
+            }
         }
 
         pst.report["Improperly clocked tiles"] = data_flow_report;
@@ -685,6 +884,145 @@ void gate_level_drvs(const Lyt& lyt, const gate_level_drv_params& ps = {}, gate_
         *pst = st;
     }
 }
+/**
+ * Incremental design rule violation (DRV) checking for layouts that are checked repeatedly after local edits, e.g.,
+ * inside post-layout optimization loops. The tile-local violations of all occupied tiles are determined once on
+ * construction. Afterward, only the tiles that are reported as edited via `update`, their neighbors, and the tiles
+ * whose violations refer to them are re-checked. The node- and I/O-related checks are cheap and performed in full by
+ * each call to `check`.
+ *
+ * For this class to work, `detail::gate_level_drvs_impl` need to be declared as a `friend class` to the layout type
+ * that is going to be examined.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+class incremental_gate_level_drvs
+{
+  public:
+    /**
+     * Standard constructor. Checks all tiles of the given layout.
+     *
+     * @param lyt The gate-level layout that is to be examined for DRVs and warnings. The reference must remain valid
+     * for the lifetime of this object.
+     * @param ps Parameters.
+     */
+    explicit incremental_gate_level_drvs(const Lyt& lyt, const gate_level_drv_params& ps = {}) :
+            layout{lyt},
+            params{ps},
+            tile_violations{detail::gate_level_drvs_impl<Lyt>::collect_tile_drvs(layout, params)}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    }
+    /**
+     * Reports edits of the layout. The given tiles, their adjacent tiles on all layers, the fanin tiles of their
+     * current nodes, and all tiles whose violations refer to them are re-checked.
+     *
+     * @param changed_tiles Tiles whose nodes, connections, or clock numbers were modified since the last update.
+     */
+    void update(const std::vector<tile<Lyt>>& changed_tiles)
+    {
+        std::unordered_set<tile<Lyt>> changed{};
+
+        for (const auto& t : changed_tiles)
+        {
+            for (const auto& e : {t, layout.above(t), layout.below(t)})
+            {
+                changed.insert(e);
+            }
+        }
+
+        std::unordered_set<tile<Lyt>> to_check{changed};
+
+        const auto add_with_elevations = [this, &to_check](const tile<Lyt>& t)
+        {
+            to_check.insert(t);
+            to_check.insert(layout.above(t));
+            to_check.insert(layout.below(t));
+        };
+
+        for (const auto& t : changed)
+        {
+            layout.foreach_adjacent_tile(t, add_with_elevations);
+
+            // the fanout counts of the current fanins may have changed, even if they are not adjacent
+            for (const auto& ft : detail::gate_level_drvs_impl<Lyt>::fanin_tiles(layout, t))
+            {
+                add_with_elevations(ft);
+            }
+        }
+
+        // fanin signals may point to changed tiles that are not adjacent or that were empty when last checked
+        const auto has_changed_fanin = [this, &changed](const tile<Lyt>& t)
+        {
+            const auto fanins = detail::gate_level_drvs_impl<Lyt>::fanin_tiles(layout, t);
+
+            return std::any_of(fanins.cbegin(), fanins.cend(),
+                               [&changed](const auto& ft) { return changed.count(ft) > 0; });
+        };
+
+        for (const auto& [t, drvs] : tile_violations)
+        {
+            if (changed.count(t) > 0)
+            {
+                // previous fanins of changed tiles may have lost a fanout
+                to_check.insert(drvs.non_adjacent_fanins.cbegin(), drvs.non_adjacent_fanins.cend());
+                to_check.insert(drvs.improperly_clocked_fanins.cbegin(), drvs.improperly_clocked_fanins.cend());
+            }
+            else if (has_changed_fanin(t))
+            {
+                to_check.insert(t);
+            }
+        }
+
+        for (const auto& t : to_check)
+        {
+            tile_violations.erase(t);
+
+            if (t.is_dead() || !layout.is_within_bounds(t))
+            {
+                continue;
+            }
+
+            if (auto drvs = detail::gate_level_drvs_impl<Lyt>::check_tile(layout, params, t); !drvs.empty())
+            {
+                tile_violations.emplace(t, std::move(drvs));
+            }
+        }
+    }
+    /**
+     * Reports the DRVs and warnings of the current state of the layout exactly like `gate_level_drvs`. All edits since
+     * the last call must have been reported via `update`.
+     *
+     * @param pst Statistics.
+     */
+    void check(gate_level_drv_stats* pst = nullptr) const
+    {
+        gate_level_drv_stats              st{};
+        detail::gate_level_drvs_impl<Lyt> p{layout, params, st, &tile_violations};
+
+        p.run();
+
+        if (pst)
+        {
+            *pst = st;
+        }
+    }
+
+  private:
+    /**
+     * The gate-level layout to check.
+     */
+    const Lyt& layout;
+    /**
+     * Parameters.
+     */
+    const gate_level_drv_params params;
+    /**
+     * Tile-local violations of all tiles that have any.
+     */
+    detail::tile_drv_map<Lyt> tile_violations;
+};
 
 }  // namespace fiction
 
@@ -11,14 +11,25 @@
 #include "fiction/utils/name_utils.hpp"
 
 #include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
+#include <kitty/dynamic_truth_table.hpp>
 #include <mockturtle/algorithms/equivalence_checking.hpp>
 #include <mockturtle/algorithms/miter.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
 #include <sstream>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -42,6 +53,29 @@ enum class eq_type
     STRONG
 };
 
+/**
+ * Parameters for equivalence checking. Before a SAT solver is invoked, `Spec` and `Impl` are simulated bit-parallel on
+ * 64 input patterns per machine word. If there are few primary inputs, simulating all input patterns decides
+ * equivalence without SAT. Otherwise, random patterns are simulated to find counter examples quickly.
+ */
+struct equivalence_checking_params
+{
+    /**
+     * Maximum number of primary inputs for which all \f$2^n\f$ input patterns are simulated instead of invoking a SAT
+     * solver.
+     */
+    uint32_t max_exhaustive_simulation_pis = 16u;
+    /**
+     * Number of random input patterns to simulate before invoking a SAT solver. It is rounded up to a multiple of 64.
+     * Setting this to 0 disables random simulation.
+     */
+    uint64_t num_random_patterns = 1024ull;
+    /**
+     * Seed for the generation of random input patterns.
+     */
+    uint64_t seed = 0ull;
+};
+
 struct equivalence_checking_stats
 {
     /**
@@ -64,11 +98,297 @@ struct equivalence_checking_stats
      * Stores DRVs.
      */
     fiction::gate_level_drv_stats spec_drv_stats{}, impl_drv_stats{};
+    /**
+     * Number of simulated input patterns.
+     */
+    uint64_t simulated_patterns = 0ull;
+    /**
+     * Stores whether equivalence had to be decided by a SAT solver because simulation was inconclusive.
+     */
+    bool sat_solver_invoked = false;
 };
 
 namespace detail
 {
 
+/**
+ * Simulates a logic network or a gate-level layout bit-parallel on 64 input patterns per machine word. Each node is
+ * evaluated word-wise as a sum of products over either the on-set or the off-set of its function, whichever is
+ * smaller. Only nodes in the transitive fanin of the primary outputs are simulated.
+ *
+ * @tparam Ntk Logic network or gate-level layout type.
+ */
+template <typename Ntk>
+class bit_parallel_simulator
+{
+  public:
+    /**
+     * Standard constructor. Determines a topological order of all nodes in the transitive fanin of the primary outputs.
+     *
+     * @param network Logic network or gate-level layout to simulate.
+     */
+    explicit bit_parallel_simulator(const Ntk& network) : ntk{network}
+    {
+        std::vector<uint32_t> pi_position(ntk.size(), no_pi);
+
+        uint32_t pi_counter = 0;
+        ntk.foreach_pi([this, &pi_position, &pi_counter](const auto& pi)
+                       { pi_position[ntk.node_to_index(pi)] = pi_counter++; });
+
+        // slot of each node in the topological order, or one of the states below while the order is computed
+        std::vector<uint32_t> slot(ntk.size(), unvisited);
+
+        std::vector<std::pair<mockturtle::node<Ntk>, bool>> stack{};
+
+        ntk.foreach_po(
+            [&](const auto& po)
+            {
+                stack.emplace_back(ntk.get_node(po), false);
+
+                while (!stack.empty() && acyclic)
+                {
+                    const auto [n, expanded] = stack.back();
+                    stack.pop_back();
+
+                    const auto index = ntk.node_to_index(n);
+
+                    if (expanded)
+                    {
+                        slot[index] = static_cast<uint32_t>(nodes.size());
+                        add_node(n, pi_position[index], slot);
+
+                        continue;
+                    }
+
+                    if (slot[index] == in_progress)
+                    {
+                        // n is its own transitive fanin
+                        acyclic = false;
+                    }
+                    else if (slot[index] == unvisited)
+                    {
+                        slot[index] = in_progress;
+                        stack.emplace_back(n, true);
+
+                        ntk.foreach_fanin(n, [this, &stack](const auto& f)
+                                          { stack.emplace_back(ntk.get_node(f), false); });
+                    }
+                }
+
+                outputs.emplace_back(acyclic ? slot[ntk.node_to_index(ntk.get_node(po))] : 0u, ntk.is_complemented(po));
+            });
+    }
+    /**
+     * Returns whether the simulated network or layout is free of combinational cycles. Cyclic structures cannot be
+     * simulated.
+     *
+     * @return `true` iff all nodes in the transitive fanin of the primary outputs could be ordered topologically.
+     */
+    [[nodiscard]] bool is_acyclic() const noexcept
+    {
+        return acyclic;
+    }
+    /**
+     * Simulates a block of input patterns.
+     *
+     * @param pi_words Input patterns as `num_words` consecutive words per primary input.
+     * @param num_words Number of words per primary input.
+     * @return Output values as `num_words` consecutive words per primary output.
+     */
+    [[nodiscard]] std::vector<uint64_t> simulate(const std::vector<uint64_t>& pi_words, const std::size_t num_words)
+    {
+        values.assign(nodes.size() * num_words, 0ull);
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            auto* const result = &values[i * num_words];
+
+            const auto& sim_node = nodes[i];
+
+            if (sim_node.kind == node_kind::PI)
+            {
+                std::copy_n(&pi_words[sim_node.pi * num_words], num_words, result);
+            }
+            else if (sim_node.kind == node_kind::CONSTANT_ONE)
+            {
+                std::fill_n(result, num_words, std::numeric_limits<uint64_t>::max());
+            }
+            else if (sim_node.kind == node_kind::GATE)
+            {
+                for (std::size_t w = 0; w < num_words; ++w)
+                {
+                    uint64_t sum = 0ull;
+
+                    for (const auto cube : sim_node.cubes)
+                    {
+                        auto product = std::numeric_limits<uint64_t>::max();
+
+                        for (std::size_t j = 0; j < sim_node.fanins.size(); ++j)
+                        {
+                            const auto [fanin_slot, complemented] = sim_node.fanins[j];
+
+                            const auto fanin_value = values[fanin_slot * num_words + w];
+
+                            // a literal is positive if both the cube bit and the complementation are set or unset
+                            product &= (((cube >> j) & 1u) != 0u) != complemented ? fanin_value : ~fanin_value;
+                        }
+
+                        sum |= product;
+                    }
+
+                    result[w] = sim_node.off_set ? ~sum : sum;
+                }
+            }
+            // constant-0 nodes remain 0
+        }
+
+        std::vector<uint64_t> po_words(outputs.size() * num_words);
+
+        for (std::size_t o = 0; o < outputs.size(); ++o)
+        {
+            const auto [po_slot, complemented] = outputs[o];
+
+            for (std::size_t w = 0; w < num_words; ++w)
+            {
+                const auto value = values[po_slot * num_words + w];
+
+                po_words[o * num_words + w] = complemented ? ~value : value;
+            }
+        }
+
+        return po_words;
+    }
+
+  private:
+    /**
+     * Sentinel value for nodes that are no primary inputs.
+     */
+    static constexpr uint32_t no_pi = std::numeric_limits<uint32_t>::max();
+    /**
+     * Marks nodes that have not been visited during the computation of the topological order.
+     */
+    static constexpr uint32_t unvisited = std::numeric_limits<uint32_t>::max();
+    /**
+     * Marks nodes whose fanins are being visited during the computation of the topological order.
+     */
+    static constexpr uint32_t in_progress = std::numeric_limits<uint32_t>::max() - 1;
+    /**
+     * The kinds of simulated nodes.
+     */
+    enum class node_kind : uint8_t
+    {
+        CONSTANT_ZERO,
+        CONSTANT_ONE,
+        PI,
+        GATE
+    };
+    /**
+     * A node in topological order together with everything that is needed to evaluate it.
+     */
+    struct simulation_node
+    {
+        /**
+         * Kind of the node.
+         */
+        node_kind kind{node_kind::CONSTANT_ZERO};
+        /**
+         * Index of the primary input if `kind` is `PI`.
+         */
+        uint32_t pi{0};
+        /**
+         * Slots and complementation flags of the fanins.
+         */
+        std::vector<std::pair<std::size_t, bool>> fanins{};
+        /**
+         * Input assignments of the on-set or off-set of the node function. Fanins that are not connected are
+         * considered to be constant 0.
+         */
+        std::vector<uint64_t> cubes{};
+        /**
+         * Flag to indicate that `cubes` stores the off-set.
+         */
+        bool off_set{false};
+    };
+    /**
+     * The logic network or gate-level layout to simulate.
+     */
+    const Ntk& ntk;
+    /**
+     * Nodes in topological order.
+     */
+    std::vector<simulation_node> nodes{};
+    /**
+     * Slots and complementation flags of the primary outputs.
+     */
+    std::vector<std::pair<std::size_t, bool>> outputs{};
+    /**
+     * Flag to indicate that a topological order exists.
+     */
+    bool acyclic{true};
+    /**
+     * Simulation values of the current block as consecutive words per slot.
+     */
+    std::vector<uint64_t> values{};
+    /**
+     * Appends the given node to the topological order. All of its fanins must have been appended before.
+     *
+     * @param n Node to append.
+     * @param pi Index of `n` if it is a primary input or `no_pi` otherwise.
+     * @param slot Slots of all appended nodes.
+     */
+    void add_node(const mockturtle::node<Ntk>& n, const uint32_t pi, const std::vector<uint32_t>& slot)
+    {
+        simulation_node sim_node{};
+
+        if (ntk.is_constant(n))
+        {
+            sim_node.kind = ntk.constant_value(n) ? node_kind::CONSTANT_ONE : node_kind::CONSTANT_ZERO;
+        }
+        else if (pi != no_pi)
+        {
+            sim_node.kind = node_kind::PI;
+            sim_node.pi   = pi;
+        }
+        else
+        {
+            sim_node.kind = node_kind::GATE;
+
+            ntk.foreach_fanin(n,
+                              [this, &sim_node, &slot](const auto& f)
+                              {
+                                  sim_node.fanins.emplace_back(slot[ntk.node_to_index(ntk.get_node(f))],
+                                                               ntk.is_complemented(f));
+                              });
+
+            const auto function = ntk.node_function(n);
+
+            if (sim_node.fanins.size() > function.num_vars())
+            {
+                sim_node.fanins.resize(function.num_vars());
+            }
+
+            const auto num_minterms = function.num_bits();
+            const auto on_set_size  = static_cast<uint64_t>(kitty::count_ones(function));
+
+            sim_node.off_set = 2 * on_set_size > num_minterms;
+
+            for (uint64_t m = 0; m < num_minterms; ++m)
+            {
+                if (kitty::get_bit(function, m) != sim_node.off_set)
+                {
+                    // fanins beyond the connected ones are constant 0
+                    if ((m >> sim_node.fanins.size()) == 0u)
+                    {
+                        sim_node.cubes.push_back(m);
+                    }
+                }
+            }
+        }
+
+        nodes.push_back(std::move(sim_node));
+    }
+};
+
 template <typename Spec, typename Impl>
 class equivalence_checking_impl
 {
@@ -82,9 +402,10 @@ class equivalence_checking_impl
      * @param st Statistics.
      */
     explicit equivalence_checking_impl(const Spec& specification, const Impl& implementation,
-                                       equivalence_checking_stats& st) :
+                                       const equivalence_checking_params& p, equivalence_checking_stats& st) :
             spec{specification},
             impl{implementation},
+            ps{p},
             pst{st}
     {}
 
@@ -92,76 +413,95 @@ class equivalence_checking_impl
     {
         mockturtle::stopwatch stop{pst.runtime};
 
+        const auto same_io = spec.num_pis() == impl.num_pis() && spec.num_pos() == impl.num_pos();
+
+        // DRV checks run concurrently with the simulation
+        bool spec_has_drvs = false;
+        bool impl_has_drvs = false;
+
+        std::vector<std::thread> drv_checks{};
+
         if constexpr (is_gate_level_layout_v<Spec>)
         {
-            if (has_drvs(spec, &pst.spec_drv_stats))
-            {
-                return eq_type::NO;
-            }
+            drv_checks.emplace_back([this, &spec_has_drvs] { spec_has_drvs = has_drvs(spec, &pst.spec_drv_stats); });
         }
         if constexpr (is_gate_level_layout_v<Impl>)
         {
-            if (has_drvs(impl, &pst.impl_drv_stats))
-            {
-                return eq_type::NO;
-            }
+            drv_checks.emplace_back([this, &impl_has_drvs] { impl_has_drvs = has_drvs(impl, &pst.impl_drv_stats); });
         }
 
-        const auto miter = mockturtle::miter<mockturtle::klut_network>(spec, impl);
+        const auto sim_result = same_io ? simulate() : std::nullopt;
 
-        if (miter)
+        for (auto& check : drv_checks)
         {
-            mockturtle::equivalence_checking_stats st;
+            check.join();
+        }
 
-            const auto eq = mockturtle::equivalence_checking(*miter, {}, &st);
+        if (spec_has_drvs || impl_has_drvs)
+        {
+            pst.counter_example.clear();
 
-            if (eq.has_value())
-            {
-                pst.eq = *eq ? eq_type::STRONG : eq_type::NO;
+            return eq_type::NO;
+        }
 
-                if (pst.eq == eq_type::STRONG)
-                {
-                    // compute TP of specification
-                    if constexpr (fiction::is_gate_level_layout_v<Spec>)
-                    {
-                        const auto cp_tp = fiction::critical_path_length_and_throughput(spec);
+        if (!same_io)
+        {
+            std::cout << "[w] both networks/layouts must have the same number of primary inputs and outputs"
+                      << std::endl;
 
-                        pst.tp_spec = static_cast<int64_t>(cp_tp.throughput);
-                    }
-                    // compute TP of implementation
-                    if constexpr (fiction::is_gate_level_layout_v<Impl>)
-                    {
-                        const auto cp_tp = fiction::critical_path_length_and_throughput(impl);
+            return eq_type::NO;
+        }
 
-                        pst.tp_impl = static_cast<int64_t>(cp_tp.throughput);
-                    }
+        std::optional<bool> eq = sim_result;
 
-                    pst.tp_diff = std::abs(pst.tp_spec - pst.tp_impl);
+        if (!eq.has_value())
+        {
+            const auto miter = mockturtle::miter<mockturtle::klut_network>(spec, impl);
 
-                    if (pst.tp_diff != 0)
-                    {
-                        pst.eq = eq_type::WEAK;
-                    }
-                }
+            mockturtle::equivalence_checking_stats st;
 
-                if (!(*eq))
-                {
-                    pst.counter_example = st.counter_example;
-                }
-            }
-            else
+            pst.sat_solver_invoked = true;
+
+            eq = mockturtle::equivalence_checking(*miter, {}, &st);
+
+            if (!eq.has_value())
             {
                 std::cout << "[e] resource limit exceeded" << std::endl;
 
                 return eq_type::NO;
             }
+
+            if (!(*eq))
+            {
+                pst.counter_example = st.counter_example;
+            }
         }
-        else
+
+        pst.eq = *eq ? eq_type::STRONG : eq_type::NO;
+
+        if (pst.eq == eq_type::STRONG)
         {
-            std::cout << "[w] both networks/layouts must have the same number of primary inputs and outputs"
-                      << std::endl;
+            // compute TP of specification
+            if constexpr (fiction::is_gate_level_layout_v<Spec>)
+            {
+                const auto cp_tp = fiction::critical_path_length_and_throughput(spec);
 
-            return eq_type::NO;
+                pst.tp_spec = static_cast<int64_t>(cp_tp.throughput);
+            }
+            // compute TP of implementation
+            if constexpr (fiction::is_gate_level_layout_v<Impl>)
+            {
+                const auto cp_tp = fiction::critical_path_length_and_throughput(impl);
+
+                pst.tp_impl = static_cast<int64_t>(cp_tp.throughput);
+            }
+
+            pst.tp_diff = std::abs(pst.tp_spec - pst.tp_impl);
+
+            if (pst.tp_diff != 0)
+            {
+                pst.eq = eq_type::WEAK;
+            }
         }
 
         return pst.eq;
@@ -176,8 +516,16 @@ class equivalence_checking_impl
      * Implementation.
      */
     const Impl impl;
+    /**
+     * Parameters.
+     */
+    const equivalence_checking_params ps;
 
     equivalence_checking_stats& pst;
+    /**
+     * Number of words that are simulated at once.
+     */
+    static constexpr std::size_t words_per_block = 16ul;
 
     template <typename NtkOrLyt>
     bool has_drvs(const NtkOrLyt& ntk_or_lyt, gate_level_drv_stats* stats) const noexcept
@@ -192,12 +540,127 @@ class equivalence_checking_impl
 
         return stats->drvs != 0;
     }
+    /**
+     * Simulates `spec` and `impl` on the same input patterns. If the number of primary inputs does not exceed
+     * `max_exhaustive_simulation_pis`, all input patterns are simulated. Otherwise, `num_random_patterns` random input
+     * patterns are simulated. The first input pattern for which the outputs differ is stored as a counter example.
+     *
+     * @return `false` if a counter example was found, `true` if all input patterns were simulated without finding one,
+     * and `std::nullopt` if simulation is inconclusive.
+     */
+    [[nodiscard]] std::optional<bool> simulate()
+    {
+        bit_parallel_simulator<Spec> spec_sim{spec};
+        bit_parallel_simulator<Impl> impl_sim{impl};
+
+        if (!spec_sim.is_acyclic() || !impl_sim.is_acyclic())
+        {
+            return std::nullopt;
+        }
+
+        const auto num_pis    = static_cast<std::size_t>(spec.num_pis());
+        const auto exhaustive = num_pis <= ps.max_exhaustive_simulation_pis && num_pis < 64;
+
+        if (!exhaustive && ps.num_random_patterns == 0)
+        {
+            return std::nullopt;
+        }
+
+        // exhaustive simulation requires one word per 64 input patterns
+        const auto num_words = exhaustive ? (num_pis <= 6 ? 1ull : 1ull << (num_pis - 6)) :
+                                            (ps.num_random_patterns + 63ull) / 64ull;
+
+        // projection functions of the first 6 primary inputs within a word
+        static constexpr std::array<uint64_t, 6> projections{0xaaaaaaaaaaaaaaaaull, 0xccccccccccccccccull,
+                                                             0xf0f0f0f0f0f0f0f0ull, 0xff00ff00ff00ff00ull,
+                                                             0xffff0000ffff0000ull, 0xffffffff00000000ull};
+
+        std::mt19937_64 generator{ps.seed};
+
+        std::vector<uint64_t> pi_words{};
+
+        for (uint64_t first_word = 0; first_word < num_words; first_word += words_per_block)
+        {
+            const auto block_size =
+                static_cast<std::size_t>(std::min<uint64_t>(words_per_block, num_words - first_word));
+
+            pi_words.resize(num_pis * block_size);
+
+            for (std::size_t i = 0; i < num_pis; ++i)
+            {
+                for (std::size_t w = 0; w < block_size; ++w)
+                {
+                    if (!exhaustive)
+                    {
+                        pi_words[i * block_size + w] = generator();
+                    }
+                    else if (i < 6)
+                    {
+                        pi_words[i * block_size + w] = projections[i];
+                    }
+                    else
+                    {
+                        pi_words[i * block_size + w] =
+                            (((first_word + w) >> (i - 6)) & 1u) != 0u ? std::numeric_limits<uint64_t>::max() : 0ull;
+                    }
+                }
+            }
+
+            const auto spec_words = spec_sim.simulate(pi_words, block_size);
+            const auto impl_words = impl_sim.simulate(pi_words, block_size);
+
+            const auto num_pos = spec_words.size() / block_size;
+
+            for (std::size_t w = 0; w < block_size; ++w)
+            {
+                // a pattern is a counter example if any of the outputs differs
+                uint64_t diff = 0ull;
+
+                for (std::size_t o = 0; o < num_pos; ++o)
+                {
+                    diff |= spec_words[o * block_size + w] ^ impl_words[o * block_size + w];
+                }
+
+                if (diff != 0ull)
+                {
+                    uint64_t bit = 0;
+                    while (((diff >> bit) & 1u) == 0u)
+                    {
+                        ++bit;
+                    }
+
+                    pst.simulated_patterns += w * 64ull + bit + 1ull;
+
+                    pst.counter_example.resize(num_pis);
+
+                    for (std::size_t i = 0; i < num_pis; ++i)
+                    {
+                        pst.counter_example[i] = ((pi_words[i * block_size + w] >> bit) & 1u) != 0u;
+                    }
+
+                    return false;
+                }
+            }
+
+            pst.simulated_patterns += block_size * 64ull;
+        }
+
+        if (exhaustive)
+        {
+            // duplicate patterns of networks with less than 6 primary inputs are not counted
+            pst.simulated_patterns = 1ull << num_pis;
+
+            return true;
+        }
+
+        return std::nullopt;
+    }
 };
 
 }  // namespace detail
 
 /**
- * Performs SAT-based equivalence checking between a specification of type `Spec` and an implementation of type `Impl`.
+ * Performs equivalence checking between a specification of type `Spec` and an implementation of type `Impl`.
  * Both `Spec` and `Impl` need to be network types (that is, gate-level layouts can be utilized as well).
  *
  * This implementation enables the comparison of two logic networks, a logic network and a gate-level layout or two
@@ -214,6 +677,11 @@ class equivalence_checking_impl
  * - `STRONG` equivalence: Spec and Impl are logically equivalent and all involved gate-level layouts have TP of
  * \f$\frac{1}{1}\f$.
  *
+ * Logical equivalence is decided in tiers. DRV checks of gate-level layouts run concurrently with a bit-parallel
+ * simulation of `spec` and `impl`. For few primary inputs, all input patterns are simulated, which decides equivalence
+ * without SAT. Otherwise, random input patterns are simulated to find counter examples quickly. Only if simulation is
+ * inconclusive, a miter is constructed and passed to a SAT solver.
+ *
  * This approach was first proposed in \"Verification for Field-coupled Nanocomputing Circuits\" by M. Walter, R. Wille,
  * F. Sill Torres, D. Große, and R. Drechsler in DAC 2020.
  *
@@ -221,17 +689,19 @@ class equivalence_checking_impl
  * @tparam Impl Implementation type.
  * @param spec The specification.
  * @param impl The implementation.
+ * @param ps Parameters.
  * @param pst Statistics.
  * @return The equivalence type of `spec` and `impl`.
  */
 template <typename Spec, typename Impl>
-eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, const equivalence_checking_params& ps,
+                             equivalence_checking_stats* pst = nullptr)
 {
     static_assert(mockturtle::is_network_type_v<Spec>, "Spec is not a network type");
     static_assert(mockturtle::is_network_type_v<Impl>, "Impl is not a network type");
 
     equivalence_checking_stats        st{};
-    detail::equivalence_checking_impl p{spec, impl, st};
+    detail::equivalence_checking_impl p{spec, impl, ps, st};
 
     const auto result = p.run();
 
@@ -242,6 +712,22 @@ eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_che
 
     return result;
 }
+/**
+ * Performs equivalence checking between a specification of type `Spec` and an implementation of type `Impl` with
+ * default parameters. See above for details.
+ *
+ * @tparam Spec Specification type.
+ * @tparam Impl Implementation type.
+ * @param spec The specification.
+ * @param impl The implementation.
+ * @param pst Statistics.
+ * @return The equivalence type of `spec` and `impl`.
+ */
+template <typename Spec, typename Impl>
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+{
+    return equivalence_checking(spec, impl, equivalence_checking_params{}, pst);
+}
 
 }  // namespace fiction
 
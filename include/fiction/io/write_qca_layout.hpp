@@ -7,14 +7,22 @@
 
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/stream_utils.hpp"
 #include "utils/version_info.hpp"
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
+#include <iterator>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -29,6 +37,11 @@ struct write_qca_layout_params
      * Create via cells in between each layer.
      */
     bool create_inter_layer_via_cells = true;
+    /**
+     * Number of threads to render the cells of large layouts concurrently. The output does not depend on this value. By
+     * default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 namespace detail
@@ -188,6 +201,19 @@ class write_qca_layout_impl
     // via cells
     std::vector<cell<Lyt>> via_layer_cells{};
 
+    // float constants as they are written by output streams
+    const std::string cell_size{stream_representation(qcad::CELL_SIZE)};
+    const std::string dot_size{stream_representation(qcad::DOT_SIZE)};
+    const std::string bb_cy_offset{stream_representation(qcad::BB_CY_OFFSET)};
+
+    [[nodiscard]] static std::string stream_representation(const float f)
+    {
+        std::ostringstream ss{};
+        ss << f;
+
+        return ss.str();
+    }
+
     void write_header()
     {
         const auto layout_name = lyt.get_layout_name();
@@ -197,11 +223,26 @@ class write_qca_layout_impl
 
     void write_cell_layers()
     {
+        // collect all non-empty cells per layer; sorting them yields the row-major order of each layer
+        std::vector<std::vector<cell<Lyt>>> layers(static_cast<std::size_t>(lyt.z()) + 1);
+
+        lyt.foreach_cell(
+            [this, &layers](const auto& c)
+            {
+                if (c.x <= lyt.x() && c.y <= lyt.y() && c.z <= lyt.z() && !lyt.is_empty_cell(c))
+                {
+                    layers[static_cast<std::size_t>(c.z)].push_back(c);
+                }
+            });
+
         // for each layer
         for (decltype(lyt.z()) z = 0; z <= lyt.z(); ++z)
         {
             write_via_cells();
 
+            auto& layer_cells = layers[static_cast<std::size_t>(z)];
+            std::sort(layer_cells.begin(), layer_cells.end());
+
             // open design layer
             os << qcad::OPEN_QCAD_LAYER;
 
@@ -210,20 +251,16 @@ class write_qca_layout_impl
             os << qcad::PSZ_DESCRIPTION << ((z == 0) ? "Ground Layer" : ("Crossing Layer " + std::to_string(z)))
                << '\n';
 
-            // for each row
-            for (decltype(lyt.y()) y = 0; y <= lyt.y(); ++y)
-            {
-                // for each cell
-                for (decltype(lyt.x()) x = 0; x <= lyt.x(); ++x)
-                {
-                    const cell<Lyt> c{x, y, z};
+            write_rendered_in_order(
+                os, layer_cells, [this](const auto& c, std::string& buffer) { render_cell(c, buffer); },
+                ps.num_threads);
 
-                    // skip empty cells
-                    if (!lyt.is_empty_cell(c))
-                    {
-                        write_cell(c, ps.create_inter_layer_via_cells);
-                    }
-                }
+            // save via cells for the inter-layer
+            if (ps.create_inter_layer_via_cells)
+            {
+                std::copy_if(layer_cells.cbegin(), layer_cells.cend(), std::back_inserter(via_layer_cells),
+                             [this](const auto& c)
+                             { return qca_technology::is_vertical_cell_mode(lyt.get_cell_mode(c)); });
             }
 
             // close design layer
@@ -231,7 +268,7 @@ class write_qca_layout_impl
         }
     }
 
-    qcad::color write_cell_colors(const cell<Lyt>& c)
+    [[nodiscard]] qcad::color cell_color(const cell<Lyt>& c) const noexcept
     {
         const auto cell_type = lyt.get_cell_type(c);
 
@@ -290,68 +327,62 @@ class write_qca_layout_impl
                 default: break;
             }
         }
-        os << fmt::format(qcad::COLOR, color.red, color.green, color.blue);
 
         return color;
     }
 
-    void write_cell_mode(const cell<Lyt>& c, bool save_via_cells)
+    [[nodiscard]] const char* cell_mode(const cell<Lyt>& c) const noexcept
     {
-        // handle cell mode
-        os << qcad::CELL_OPTIONS_MODE;
         if (const auto mode = lyt.get_cell_mode(c); qca_technology::is_vertical_cell_mode(mode))
         {
-            os << qcad::CELL_MODE_VERTICAL;
-
-            if (save_via_cells)
-            {
-                via_layer_cells.push_back(c);  // save via cell for inter-layer
-            }
+            return qcad::CELL_MODE_VERTICAL;
         }
         else if (lyt.is_crossing_layer(c))
         {
-            os << qcad::CELL_MODE_CROSSOVER;
+            return qcad::CELL_MODE_CROSSOVER;
         }
         else if (qca_technology::is_rotated_cell_mode(mode))
         {
-            os << qcad::CELL_MODE_ROTATED;
-        }
-        else
-        {
-            os << qcad::CELL_MODE_NORMAL;
+            return qcad::CELL_MODE_ROTATED;
         }
+
+        return qcad::CELL_MODE_NORMAL;
     }
 
-    void write_cell_function(const cell<Lyt>& c)
+    [[nodiscard]] const char* cell_function(const cell<Lyt>& c) const noexcept
     {
         const auto cell_type = lyt.get_cell_type(c);
 
-        // handle cell function
-        os << qcad::CELL_FUNCTION;
-
         if (qca_technology::is_normal_cell(cell_type))
         {
-            os << qcad::CELL_FUNCTION_NORMAL;
+            return qcad::CELL_FUNCTION_NORMAL;
         }
-        else if (qca_technology::is_constant_cell(cell_type))
+        if (qca_technology::is_constant_cell(cell_type))
         {
-            os << qcad::CELL_FUNCTION_FIXED;
+            return qcad::CELL_FUNCTION_FIXED;
         }
-        else if (qca_technology::is_input_cell(cell_type))
+        if (qca_technology::is_input_cell(cell_type))
         {
-            os << qcad::CELL_FUNCTION_INPUT;
+            return qcad::CELL_FUNCTION_INPUT;
         }
-        else if (qca_technology::is_output_cell(cell_type))
+        if (qca_technology::is_output_cell(cell_type))
         {
-            os << qcad::CELL_FUNCTION_OUTPUT;
+            return qcad::CELL_FUNCTION_OUTPUT;
         }
+
+        return "";
     }
 
-    void write_quantum_dots(const cell<Lyt>& c, const qcad::cell_pos pos)
+    void render_quantum_dots(const cell<Lyt>& c, const qcad::cell_pos pos, std::string& buffer) const
     {
         const auto cell_type = lyt.get_cell_type(c);
 
-        os << '\n' << qcad::NUMBER_OF_DOTS_4;
+        // determine spin
+        const auto spin = qca_technology::is_input_cell(cell_type) || qca_technology::is_output_cell(cell_type) ?
+                              std::string{qcad::NEGATIVE_SPIN} :
+                              std::to_string(0.0f);
+
+        fmt::format_to(std::back_inserter(buffer), "\n{}", qcad::NUMBER_OF_DOTS_4);
 
         // create quantum dots
         for (int i = 1; i > -2; i -= 2)
@@ -360,52 +391,34 @@ class write_qca_layout_impl
             {
                 int j = i == 1 ? -j2 : j2;
 
-                // open dot
-                os << qcad::OPEN_CELL_DOT;
-
-                os << qcad::X_POS << std::to_string(pos.x + (qcad::CELL_SIZE / 4.0f) * static_cast<float>(i)) << '\n';
-                os << qcad::Y_POS << std::to_string(pos.y + (qcad::CELL_SIZE / 4.0f) * static_cast<float>(j)) << '\n';
-                os << qcad::DIAMETER << qcad::DOT_SIZE << '\n';
-
                 // determine charge
-                os << qcad::CHARGE;
+                const char* charge = "";
                 if (!qca_technology::is_constant_cell(cell_type))
                 {
-                    os << qcad::CHARGE_8;
+                    charge = qcad::CHARGE_8;
                 }
                 else if ((qca_technology::is_const_0_cell(cell_type) && std::abs(i + j) == 2) ||
                          (qca_technology::is_const_1_cell(cell_type) && std::abs(i + j) == 0))
                 {
-                    os << qcad::CHARGE_1;
+                    charge = qcad::CHARGE_1;
                 }
                 else if ((qca_technology::is_const_0_cell(cell_type) && std::abs(i + j) == 0) ||
                          (qca_technology::is_const_1_cell(cell_type) && std::abs(i + j) == 2))
                 {
-                    os << qcad::CHARGE_0;
+                    charge = qcad::CHARGE_0;
                 }
-                os << '\n';
-
-                // determine spin
-                os << qcad::SPIN;
-                if (qca_technology::is_input_cell(cell_type) || qca_technology::is_output_cell(cell_type))
-                {
-                    os << qcad::NEGATIVE_SPIN;
-                }
-                else
-                {
-                    os << std::to_string(0.0f);
-                }
-                os << '\n';
-
-                os << qcad::POTENTIAL << std::to_string(0.0f) << '\n';
 
-                // close dot
-                os << qcad::CLOSE_CELL_DOT;
+                fmt::format_to(std::back_inserter(buffer), "{}{}{:f}\n{}{:f}\n{}{}\n{}{}\n{}{}\n{}{:f}\n{}",
+                               qcad::OPEN_CELL_DOT, qcad::X_POS,
+                               pos.x + (qcad::CELL_SIZE / 4.0f) * static_cast<float>(i), qcad::Y_POS,
+                               pos.y + (qcad::CELL_SIZE / 4.0f) * static_cast<float>(j), qcad::DIAMETER, dot_size,
+                               qcad::CHARGE, charge, qcad::SPIN, spin, qcad::POTENTIAL, 0.0f, qcad::CLOSE_CELL_DOT);
             }
         }
     }
 
-    void write_cell_name(const cell<Lyt>& c, const qcad::cell_pos pos, const qcad::color color)
+    void render_cell_name(const cell<Lyt>& c, const qcad::cell_pos pos, const qcad::color color,
+                          std::string& buffer) const
     {
         const auto cell_type = lyt.get_cell_type(c);
 
@@ -415,80 +428,69 @@ class write_qca_layout_impl
                                                                           lyt.get_cell_name(c);
             !cell_name.empty())
         {
+            const auto out = std::back_inserter(buffer);
+
             // open label
-            os << qcad::OPEN_QCAD_LABEL;
-            os << qcad::OPEN_QCAD_STRETCHY_OBJECT;
-            os << qcad::OPEN_QCAD_DESIGN_OBJECT;
-
-            os << qcad::X_POS << std::to_string(pos.x) << '\n';
-            os << qcad::Y_POS << std::to_string(pos.y - qcad::LABEL_Y_OFFSET) << '\n';
-            os << qcad::B_SELECTED << qcad::SELECTED_FALSE << '\n';
-            os << fmt::format(qcad::COLOR, color.red, color.green, color.blue);
-            os << qcad::BOUNDING_BOX_X << std::to_string(pos.x - qcad::BB_X_OFFSET) << '\n';
-            os << qcad::BOUNDING_BOX_Y << std::to_string(pos.y - qcad::BB_Y_OFFSET) << '\n';
-            os << qcad::BOUNDING_BOX_CX
-               << std::to_string(static_cast<float>(cell_name.size()) * qcad::CHARACTER_WIDTH + qcad::BB_CX_OFFSET)
-               << '\n';
-            os << qcad::BOUNDING_BOX_CY << qcad::BB_CY_OFFSET << '\n';
+            fmt::format_to(out, "{}{}{}", qcad::OPEN_QCAD_LABEL, qcad::OPEN_QCAD_STRETCHY_OBJECT,
+                           qcad::OPEN_QCAD_DESIGN_OBJECT);
+
+            fmt::format_to(out, "{}{:f}\n{}{:f}\n{}{}\n", qcad::X_POS, pos.x, qcad::Y_POS, pos.y - qcad::LABEL_Y_OFFSET,
+                           qcad::B_SELECTED, qcad::SELECTED_FALSE);
+            fmt::format_to(out, qcad::COLOR, color.red, color.green, color.blue);
+            fmt::format_to(out, "{}{:f}\n{}{:f}\n{}{:f}\n{}{}\n", qcad::BOUNDING_BOX_X, pos.x - qcad::BB_X_OFFSET,
+                           qcad::BOUNDING_BOX_Y, pos.y - qcad::BB_Y_OFFSET, qcad::BOUNDING_BOX_CX,
+                           static_cast<float>(cell_name.size()) * qcad::CHARACTER_WIDTH + qcad::BB_CX_OFFSET,
+                           qcad::BOUNDING_BOX_CY, bb_cy_offset);
 
-            os << qcad::CLOSE_QCAD_DESIGN_OBJECT;
-            os << qcad::CLOSE_QCAD_STRETCHY_OBJECT;
+            fmt::format_to(out, "{}{}", qcad::CLOSE_QCAD_DESIGN_OBJECT, qcad::CLOSE_QCAD_STRETCHY_OBJECT);
 
-            os << qcad::PSZ << cell_name << '\n';
+            fmt::format_to(out, "{}{}\n", qcad::PSZ, cell_name);
 
             // close label
-            os << qcad::CLOSE_QCAD_LABEL;
+            fmt::format_to(out, "{}", qcad::CLOSE_QCAD_LABEL);
         }
     };
-
-    void write_cell(const cell<Lyt>& c, const bool save_via_cells)
+    /**
+     * Appends the QCADesigner representation of a cell to a buffer. This function only reads from the layout and can
+     * thus be called concurrently for different cells.
+     *
+     * @param c Cell to render.
+     * @param buffer Buffer to append to.
+     */
+    void render_cell(const cell<Lyt>& c, std::string& buffer) const
     {
-        // open cell
-        os << qcad::OPEN_QCAD_CELL;
-        // open design object
-        os << qcad::OPEN_QCAD_DESIGN_OBJECT;
+        const auto out = std::back_inserter(buffer);
 
         // calculate cell position
         const qcad::cell_pos pos{
             static_cast<float>(c.x * static_cast<decltype(c.x)>(qcad::CELL_DISTANCE) + qcad::X_Y_OFFSET),
             static_cast<float>(c.y * static_cast<decltype(c.y)>(qcad::CELL_DISTANCE) + qcad::X_Y_OFFSET)};
 
-        // write cell position
-        os << qcad::X_POS << std::to_string(pos.x) << '\n';
-        os << qcad::Y_POS << std::to_string(pos.y) << '\n';
-        os << qcad::B_SELECTED << qcad::SELECTED_FALSE << '\n';
+        // open cell and design object, write cell position
+        fmt::format_to(out, "{}{}{}{:f}\n{}{:f}\n{}{}\n", qcad::OPEN_QCAD_CELL, qcad::OPEN_QCAD_DESIGN_OBJECT,
+                       qcad::X_POS, pos.x, qcad::Y_POS, pos.y, qcad::B_SELECTED, qcad::SELECTED_FALSE);
 
         // write cell colors
-        const auto color = write_cell_colors(c);
+        const auto color = cell_color(c);
+        fmt::format_to(out, qcad::COLOR, color.red, color.green, color.blue);
 
-        // write cell bounding box
-        os << qcad::BOUNDING_BOX_X << std::to_string(pos.x - qcad::CELL_SIZE / 2.0f) << '\n';
-        os << qcad::BOUNDING_BOX_Y << std::to_string(pos.y - qcad::CELL_SIZE / 2.0f) << '\n';
-        os << qcad::BOUNDING_BOX_CX << qcad::CELL_SIZE << '\n';
-        os << qcad::BOUNDING_BOX_CY << qcad::CELL_SIZE << '\n';
+        // write cell bounding box and close design object
+        fmt::format_to(out, "{}{:f}\n{}{:f}\n{}{}\n{}{}\n{}", qcad::BOUNDING_BOX_X, pos.x - qcad::CELL_SIZE / 2.0f,
+                       qcad::BOUNDING_BOX_Y, pos.y - qcad::CELL_SIZE / 2.0f, qcad::BOUNDING_BOX_CX, cell_size,
+                       qcad::BOUNDING_BOX_CY, cell_size, qcad::CLOSE_QCAD_DESIGN_OBJECT);
 
-        // close design object
-        os << qcad::CLOSE_QCAD_DESIGN_OBJECT;
+        // write cell options, mode, and function
+        fmt::format_to(out, "{}{}\n{}{}\n{}{}\n{}{}\n{}{}\n{}{}", qcad::CELL_OPTIONS_CX, cell_size,
+                       qcad::CELL_OPTIONS_CY, cell_size, qcad::CELL_OPTIONS_DOT_DIAMETER, dot_size,
+                       qcad::CELL_OPTIONS_CLOCK, static_cast<uint32_t>(lyt.get_clock_number(c)),
+                       qcad::CELL_OPTIONS_MODE, cell_mode(c), qcad::CELL_FUNCTION, cell_function(c));
 
-        // write cell options
-        os << qcad::CELL_OPTIONS_CX << qcad::CELL_SIZE << '\n';
-        os << qcad::CELL_OPTIONS_CY << qcad::CELL_SIZE << '\n';
-        os << qcad::CELL_OPTIONS_DOT_DIAMETER << qcad::DOT_SIZE << '\n';
-        os << qcad::CELL_OPTIONS_CLOCK << std::to_string(lyt.get_clock_number(c)) << '\n';
+        render_quantum_dots(c, pos, buffer);
 
-        // write cell mode
-        write_cell_mode(c, save_via_cells);
-
-        os << '\n';
-
-        write_cell_function(c);
-
-        write_quantum_dots(c, pos);
-
-        write_cell_name(c, pos, color);
+        render_cell_name(c, pos, color, buffer);
 
         // close cell
-        os << qcad::CLOSE_QCAD_CELL;
+        fmt::format_to(out, "{}", qcad::CLOSE_QCAD_CELL);
     }
 
     void write_via_cells()
@@ -505,10 +507,9 @@ class write_qca_layout_impl
         os << qcad::STATUS << "0\n";
         os << qcad::PSZ_DESCRIPTION << "Via Layer " << std::to_string(via_counter++) << '\n';
 
-        for (const auto& v : via_layer_cells)
-        {
-            write_cell(v, false);
-        }
+        write_rendered_in_order(
+            os, via_layer_cells, [this](const auto& c, std::string& buffer) { render_cell(c, buffer); },
+            ps.num_threads);
 
         // close design layer
         os << qcad::CLOSE_QCAD_LAYER;
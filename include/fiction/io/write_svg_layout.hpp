@@ -9,22 +9,27 @@
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/stream_utils.hpp"
 #include "utils/version_info.hpp"
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <optional>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <tuple>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -41,6 +46,11 @@ struct write_qca_layout_svg_params
      * Limit details to create smaller file sizes.
      */
     bool simple = false;
+    /**
+     * Number of threads to render the tiles of large layouts concurrently. The output does not depend on this value. By
+     * default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 /**
@@ -96,6 +106,11 @@ struct write_sidb_layout_svg_params
      * The lattice mode of the SiDB layout.
      */
     sidb_lattice_mode lattice_mode = sidb_lattice_mode::SHOW_LATTICE;
+    /**
+     * Number of threads to render the lattice points and SiDBs of large layouts concurrently. The output does not
+     * depend on this value. By default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
 };
 
 template <typename Coordinate>
@@ -131,7 +146,7 @@ inline constexpr const char* SIDB_DOT_LINE_COLOR_DARK_MODE   = "#ffffff";
 inline constexpr const char* SIDB_DOT_LINE_COLOR_BRIGHT_MODE = "#C8C8C8";
 inline constexpr const char* SI_LATTICE                      = "#6e7175";
 
-// SVG Header with numbered placeholders
+// SVG Header with numbered placeholders; the SVG content follows it and is closed by FOOTER_TEMPLATE
 inline constexpr const char* HEADER_TEMPLATE = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
 <!-- Generated by {0} ({1}) -->
 <svg
@@ -155,7 +170,9 @@ inline constexpr const char* HEADER_TEMPLATE = R"(<?xml version="1.0" encoding="
     {6} <!-- PATH_DEFINITION placeholder -->
     {7} <!-- Background rectangle placeholder -->
     <g>
-        {8} <!-- SVG content placeholder -->
+        )";
+
+inline constexpr const char* FOOTER_TEMPLATE = R"( <!-- SVG content placeholder -->
     </g>
 </svg>)";
 
@@ -210,6 +227,7 @@ inline constexpr const char* HEADER = "<?xml version=\"1.0\" encoding=\"UTF-8\"
                                       "xmlns:cc=\"http://creativecommons.org/ns#\"\n"
                                       "xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
                                       "xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
+                                      "xmlns:xlink=\"http://www.w3.org/1999/xlink\"\n"
                                       "xmlns=\"http://www.w3.org/2000/svg\"\n"
                                       "viewBox=\"0 0 {} {}\"\n"
                                       "version=\"1.1\">\n"
@@ -224,14 +242,29 @@ inline constexpr const char* HEADER = "<?xml version=\"1.0\" encoding=\"UTF-8\"
                                       "</cc:Work>\n"
                                       "</rdf:RDF>\n"
                                       "</metadata>\n"
-                                      "<g>\n"
-                                      "{}\n"
-                                      "</g>\n"
+                                      "<defs>\n";
+
+inline constexpr const char* BODY = "</defs>\n"
+                                    "<g>\n";
+
+inline constexpr const char* FOOTER = "</g>\n"
                                       "</svg>";
 
+// Reusable cell and tile descriptions that are defined once and instanced at each of their positions
+inline constexpr const char* CELL_SYMBOL_PREFIX = "cell";
+inline constexpr const char* TILE_SYMBOL_PREFIX = "tile";
+
+inline constexpr const char* SYMBOL = "<symbol\n"
+                                      "id=\"{0}_{1}\"\n"
+                                      "style=\"overflow:visible\">\n"
+                                      "{2}"
+                                      "</symbol>\n";
+
+inline constexpr const char* USE = "<use\n"
+                                   "xlink:href=\"#{0}_{1}\"\n"
+                                   "transform=\"translate({2},{3})\" />\n";
+
 inline constexpr const char* TILE =
-    "<g\n"
-    "transform=\"translate({0},{1})\">\n"
     "<g>\n"
     "<rect\n"
     "ry=\"1.4357216\"\n"
@@ -239,34 +272,31 @@ inline constexpr const char* TILE =
     "x=\"186.11467\"\n"
     "height=\"118.80357\"\n"
     "width=\"118.80357\"\n"
-    "style=\"fill:#{2};stroke:#000000;\" />\n"
+    "style=\"fill:#{0};stroke:#000000;\" />\n"
     "<text\n"
     "y=\"179.25412\"\n"
     "x=\"288.74234\"\n"
     "style=\"font-style:normal;font-weight:normal;font-size:14.5px;line-height:125%;font-"
-    "family:'Noto Sans';fill:#{4};stroke:none;\"\n"
+    "family:'Noto Sans';fill:#{2};stroke:none;\"\n"
     "xml:space=\"preserve\"><tspan\n"
     "y=\"179.25412\"\n"
-    "x=\"288.74234\">{5}</tspan></text>\n"
+    "x=\"288.74234\">{3}</tspan></text>\n"
     "</g>\n"
     "<g>\n"
-    "{3}\n"
-    "</g>\n"
-    "</g>";
+    "{1}"
+    "</g>\n";
 
 inline constexpr const char* LATCH =
-    "<g\n"
-    "transform=\"translate({0},{1})\">\n"
     "<g>\n"
     "<g>\n"
     "<g>\n"
     "<path\n"
     "d=\"m 613.38686,68.413109 0,118.803571 -118.80358,0\"\n"
-    "style=\"color:#000000;solid-color:#000000;solid-opacity:1;fill:#{2};fill-opacity:1;fill-rule:nonzero;stroke:none;"
+    "style=\"color:#000000;solid-color:#000000;solid-opacity:1;fill:#{0};fill-opacity:1;fill-rule:nonzero;stroke:none;"
     "stroke-width:1.19643486;stroke-opacity:1;enable-background:accumulate\" />\n"
     "<path\n"
     "d=\"m 494.58328,187.21668 0,-118.80357 118.80358,0\"\n"
-    "style=\"color:#000000;solid-color:#000000;solid-opacity:1;fill:#{3};fill-opacity:1;fill-rule:nonzero;stroke:none;"
+    "style=\"color:#000000;solid-color:#000000;solid-opacity:1;fill:#{1};fill-opacity:1;fill-rule:nonzero;stroke:none;"
     "stroke-width:1.19643486;stroke-opacity:1;enable-background:accumulate\" />\n"
     "</g>\n"
     "<rect\n"
@@ -282,27 +312,25 @@ inline constexpr const char* LATCH =
     "y=\"86.340652\"\n"
     "x=\"504.43588\"\n"
     "style=\"font-style:normal;font-weight:normal;font-size:12.5px;line-height:125%;font-family:'Noto "
-    "Sans';letter-spacing:0px;word-spacing:0px;fill:#{5};fill-opacity:1;\"\n"
+    "Sans';letter-spacing:0px;word-spacing:0px;fill:#{3};fill-opacity:1;\"\n"
     "xml:space=\"preserve\"><tspan\n"
     "y=\"86.340652\"\n"
-    "x=\"504.43588\">{6}</tspan></text>\n"
+    "x=\"504.43588\">{4}</tspan></text>\n"
     "<text\n"
     "y=\"178.27962\"\n"
     "x=\"596.48468\"\n"
     "style=\"font-style:normal;font-weight:normal;font-size:12.5px;line-height:125%;font-family:'Noto "
-    "Sans';letter-spacing:0px;word-spacing:0px;fill:#{7};fill-opacity:1;\"\n"
+    "Sans';letter-spacing:0px;word-spacing:0px;fill:#{5};fill-opacity:1;\"\n"
     "xml:space=\"preserve\"><tspan\n"
     "y=\"178.27962\"\n"
-    "x=\"596.48468\">{8}</tspan></text>\n"
+    "x=\"596.48468\">{6}</tspan></text>\n"
     "</g>\n"
     "<g>\n"
-    "{4}\n"
-    "</g>\n"
-    "</g>";
+    "{2}"
+    "</g>\n";
 
 inline constexpr const char* CELL = "<g\n"
-                                    "style=\"fill:#{0};\"\n"
-                                    "transform=\"translate({1},{2})\">\n"
+                                    "style=\"fill:#{0};\">\n"
                                     "<rect\n"
                                     "style=\"fill:#{0};stroke:#000000;\"\n"
                                     "width=\"20\"\n"
@@ -334,11 +362,10 @@ inline constexpr const char* CELL = "<g\n"
                                     "cy=\"118.01437\"\n"
                                     "style=\"opacity:1;fill:#{0};stroke:#000000;\" />\n"
                                     "</g>\n"
-                                    "</g>";
+                                    "</g>\n";
 
 inline constexpr const char* CONST0 = "<g\n"
-                                      "style=\"fill:#000000;fill-opacity:1\"\n"
-                                      "transform=\"translate({1},{2})\">\n"
+                                      "style=\"fill:#000000;fill-opacity:1\">\n"
                                       "<rect\n"
                                       "style=\"fill:#000000;stroke:#000000;\"\n"
                                       "width=\"20\"\n"
@@ -360,11 +387,10 @@ inline constexpr const char* CONST0 = "<g\n"
                                       "cy=\"128.01437\"\n"
                                       "style=\"fill:#ffffff;stroke:#ffffff;\" />\n"
                                       "</g>\n"
-                                      "</g>";
+                                      "</g>\n";
 
 inline constexpr const char* CONST1 = "<g\n"
-                                      "style=\"fill:#000000;\"\n"
-                                      "transform=\"translate({1},{2})\">\n"
+                                      "style=\"fill:#000000;\">\n"
                                       "<rect\n"
                                       "style=\"fill:#000000;stroke:#000000;\"\n"
                                       "width=\"20\"\n"
@@ -386,11 +412,10 @@ inline constexpr const char* CONST1 = "<g\n"
                                       "cy=\"118.01437\"\n"
                                       "style=\"fill:#ffffff;stroke:#ffffff;\" />\n"
                                       "</g>\n"
-                                      "</g>";
+                                      "</g>\n";
 
 inline constexpr const char* VIA = "<g\n"
-                                   "style=\"fill:#{0};\"\n"
-                                   "transform=\"translate({1},{2})\">\n"
+                                   "style=\"fill:#{0};\">\n"
                                    "<g>\n"
                                    "<rect\n"
                                    "transform=\"rotate(90)\"\n"
@@ -407,12 +432,11 @@ inline constexpr const char* VIA = "<g\n"
                                    "cy=\"-195.86807\"\n"
                                    "style=\"fill:none;stroke:#000000;\" />\n"
                                    "</g>\n"
-                                   "</g>";
+                                   "</g>\n";
 
 inline constexpr const char* CROSS =
     "<g\n"
-    "style=\"fill:#{0};fill-opacity:1\"\n"
-    "transform=\"translate({1},{2})\">\n"
+    "style=\"fill:#{0};fill-opacity:1\">\n"
     "<g>\n"
     "<rect\n"
     "transform=\"rotate(90)\"\n"
@@ -433,10 +457,9 @@ inline constexpr const char* CROSS =
     "d=\"m 181.6776,113.42213 c -15.83124,15.83111 -15.85149,15.85137 -15.85149,15.85137\"/>\n"
     "</g>\n"
     "</g>\n"
-    "</g>";
+    "</g>\n";
 
-inline constexpr const char* SIMPLE_CELL = "<g\n"
-                                           "transform=\"translate({1},{2})\">\n"
+inline constexpr const char* SIMPLE_CELL = "<g>\n"
                                            "<rect\n"
                                            "ry=\"1.5\"\n"
                                            "y=\"112.92032\"\n"
@@ -444,7 +467,7 @@ inline constexpr const char* SIMPLE_CELL = "<g\n"
                                            "height=\"20\"\n"
                                            "width=\"20\"\n"
                                            "style=\"fill:#{0};stroke:#000000;\" />\n"
-                                           "</g>";
+                                           "</g>\n";
 
 }  // namespace svg
 
@@ -523,13 +546,13 @@ class write_sidb_layout_svg_impl
      * @param x The x-coordinate of the lattice point.
      * @param y The y-coordinate of the lattice point.
      * @param fill_color The fill color of the lattice point.
-     *
-     * @return The SVG string representing the lattice point.
+     * @param buffer The buffer to append the SVG string representing the lattice point to.
      */
-    [[nodiscard]] std::string generate_lattice_point(const double x, const double y,
-                                                     const std::string& fill_color) const noexcept
+    void generate_lattice_point(const double x, const double y, const std::string& fill_color,
+                                std::string& buffer) const
     {
-        return fmt::format(R"(<use xlink:href="#lattice_point" x="{0}" y="{1}" style="fill:{2};"/>)", x, y, fill_color);
+        fmt::format_to(std::back_inserter(buffer),
+                       R"(<use xlink:href="#lattice_point" x="{0}" y="{1}" style="fill:{2};"/>)", x, y, fill_color);
     }
 
     /**
@@ -537,12 +560,11 @@ class write_sidb_layout_svg_impl
      *
      * @param x The x-coordinate of the SiDB.
      * @param y The y-coordinate of the SiDB.
+     * @param buffer The buffer to append the SVG string representing the SiDB to.
      * @param charge_state The charge state of the SiDB.
-     *
-     * @return The SVG string representing the SiDB.
      */
-    [[nodiscard]] std::string generate_sidb(const double x, const double y,
-                                            const std::optional<sidb_charge_state>& charge_state = std::nullopt) const
+    void generate_sidb(const double x, const double y, std::string& buffer,
+                       const std::optional<sidb_charge_state>& charge_state = std::nullopt) const
     {
         std::string fill_color   = sidb_color;
         std::string border_color = sidb_edge_color;
@@ -579,18 +601,18 @@ class write_sidb_layout_svg_impl
             }
         }
 
-        return fmt::format(
+        fmt::format_to(
+            std::back_inserter(buffer),
             R"(<use xlink:href="#sidb_color" x="{0}" y="{1}" style="fill:{2}; fill-opacity:{3}; stroke:{4}; stroke-width:{5};"/>)",
             x, y, fill_color, fill_opacity, border_color, ps.sidb_border_width);
     }
 
     /**
-     * Generates the SVG layout with both H-Si lattice points and SiDBs.
+     * Generates the SVG layout with both H-Si lattice points and SiDBs. The SVG content is rendered in chunks and
+     * streamed into the output stream.
      */
     void generate_svg() const
     {
-        std::stringstream svg_content{};
-
         // Prepare the PATH_DEFINITION_TEMPLATE with the sizes
         const std::string path_definition_template =
             fmt::format(fiction::detail::svg::PATH_DEFINITION_TEMPLATE, ps.lattice_point_size, ps.sidb_size);
@@ -600,72 +622,6 @@ class write_sidb_layout_svg_impl
         const auto min_coord = bb.get_min();
         const auto max_coord = bb.get_max();
 
-        if (ps.lattice_mode == write_sidb_layout_svg_params::sidb_lattice_mode::SHOW_LATTICE)
-        {
-            // Generate all lattice points
-            const auto all_coords = all_coordinates_in_spanned_area(min_coord, max_coord);
-
-            for (const auto& coord : all_coords)
-            {
-                // Shift coordinates for alignment
-                auto shifted_coord = coord;
-
-                shifted_coord.x += static_cast<decltype(shifted_coord.x)>(1);
-
-                if constexpr (has_siqad_coord_v<Lyt>)
-                {
-                    shifted_coord.y += static_cast<decltype(shifted_coord.y)>(1);
-                }
-                else
-                {
-                    shifted_coord.y += static_cast<decltype(shifted_coord.y)>(2);
-                }
-
-                const auto nm_pos = sidb_nm_position(lyt, shifted_coord);
-
-                svg_content << generate_lattice_point(nm_pos.first * 10, nm_pos.second * 10,
-                                                      fiction::detail::svg::SI_LATTICE);
-            }
-        }
-
-        std::vector<cell<Lyt>> all_cells{};
-        all_cells.reserve(lyt.num_cells());
-        // collect all cells
-        lyt.foreach_cell([&all_cells](const auto& cell) { all_cells.push_back(cell); });
-        std::sort(all_cells.begin(), all_cells.end());
-
-        for (const auto& cell : all_cells)
-        {
-            // Shift coordinates for alignment
-            auto shifted_cell = cell;
-
-            // shift for padding
-            shifted_cell.x += static_cast<decltype(shifted_cell.x)>(1);
-
-            if constexpr (has_siqad_coord_v<Lyt>)
-            {
-                shifted_cell.y += static_cast<decltype(shifted_cell.y)>(1);
-            }
-            else
-            {
-                shifted_cell.y += static_cast<decltype(shifted_cell.y)>(2);
-            }
-
-            const auto nm_pos = sidb_nm_position(lyt, shifted_cell);
-
-            if constexpr (is_charge_distribution_surface_v<Lyt>)
-            {
-                // If the layout has charge distribution information
-                const auto charge_state = lyt.get_charge_state(cell);
-                svg_content << generate_sidb(nm_pos.first * 10, nm_pos.second * 10, charge_state);
-            }
-            else
-            {
-                // Default SiDB dot without charge state
-                svg_content << generate_sidb(nm_pos.first * 10, nm_pos.second * 10);
-            }
-        };
-
         auto shifted_max = max_coord;
 
         // shift for padding
@@ -705,9 +661,81 @@ class write_sidb_layout_svg_impl
             fmt::format(R"(<rect x="{0}" y="{1}" width="{2}" height="{3}" style="fill:{4};"/>)", viewbox_x, viewbox_y,
                         viewbox_width, viewbox_height, background_color);
 
-        // Generate the final SVG content
+        // Write the SVG header
         os << fmt::format(fiction::detail::svg::HEADER_TEMPLATE, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y,
-                          viewbox_width, viewbox_height, path_definition_template, background_rect, svg_content.str());
+                          viewbox_width, viewbox_height, path_definition_template, background_rect);
+
+        if (ps.lattice_mode == write_sidb_layout_svg_params::sidb_lattice_mode::SHOW_LATTICE)
+        {
+            // Generate all lattice points
+            write_rendered_in_order(
+                os, all_coordinates_in_spanned_area(min_coord, max_coord),
+                [this](const auto& coord, std::string& buffer)
+                {
+                    // Shift coordinates for alignment
+                    auto shifted_coord = coord;
+
+                    shifted_coord.x += static_cast<decltype(shifted_coord.x)>(1);
+
+                    if constexpr (has_siqad_coord_v<Lyt>)
+                    {
+                        shifted_coord.y += static_cast<decltype(shifted_coord.y)>(1);
+                    }
+                    else
+                    {
+                        shifted_coord.y += static_cast<decltype(shifted_coord.y)>(2);
+                    }
+
+                    const auto nm_pos = sidb_nm_position(lyt, shifted_coord);
+
+                    generate_lattice_point(nm_pos.first * 10, nm_pos.second * 10, fiction::detail::svg::SI_LATTICE,
+                                           buffer);
+                },
+                ps.num_threads);
+        }
+
+        std::vector<cell<Lyt>> all_cells{};
+        all_cells.reserve(lyt.num_cells());
+        // collect all cells
+        lyt.foreach_cell([&all_cells](const auto& cell) { all_cells.push_back(cell); });
+        std::sort(all_cells.begin(), all_cells.end());
+
+        write_rendered_in_order(
+            os, all_cells,
+            [this](const auto& cell, std::string& buffer)
+            {
+                // Shift coordinates for alignment
+                auto shifted_cell = cell;
+
+                // shift for padding
+                shifted_cell.x += static_cast<decltype(shifted_cell.x)>(1);
+
+                if constexpr (has_siqad_coord_v<Lyt>)
+                {
+                    shifted_cell.y += static_cast<decltype(shifted_cell.y)>(1);
+                }
+                else
+                {
+                    shifted_cell.y += static_cast<decltype(shifted_cell.y)>(2);
+                }
+
+                const auto nm_pos = sidb_nm_position(lyt, shifted_cell);
+
+                if constexpr (is_charge_distribution_surface_v<Lyt>)
+                {
+                    // If the layout has charge distribution information
+                    generate_sidb(nm_pos.first * 10, nm_pos.second * 10, buffer, lyt.get_charge_state(cell));
+                }
+                else
+                {
+                    // Default SiDB dot without charge state
+                    generate_sidb(nm_pos.first * 10, nm_pos.second * 10, buffer);
+                }
+            },
+            ps.num_threads);
+
+        // Close the SVG content
+        os << fiction::detail::svg::FOOTER_TEMPLATE;
     }
 };
 
@@ -744,36 +772,70 @@ class write_qca_layout_svg_impl
     write_qca_layout_svg_params ps;
 
     /**
-     * Alias for an SVG description of a tile containing also its clock zone.
+     * Alias for the SVG description template of a cell and its color. Cells without a visual representation are
+     * described by `nullptr`.
      */
-    using tile_description = std::pair<std::string, typename Lyt::clock_number_t>;
+    using description_color = std::pair<const char*, std::string>;
     /**
-     * Maps coordinates of tiles to their string representation and their clock zone.
+     * A cell description instance that refers to its symbol definition and is placed at an offset.
      */
-    using coord_to_tile_mapping = std::unordered_map<coordinate<Lyt>, tile_description>;
+    struct placed_cell
+    {
+        /**
+         * Index of the cell symbol definition.
+         */
+        std::size_t symbol;
+        /**
+         * Offset in x-direction.
+         */
+        double x;
+        /**
+         * Offset in y-direction.
+         */
+        double y;
+    };
     /**
-     * Maps coordinates of tiles to a string representation of the cells contained within them.
+     * A regular or latch tile with its clock zone and the cell description instances it contains.
      */
-    using coord_to_cell_list_mapping = std::unordered_map<coordinate<Lyt>, std::string>;
+    struct svg_tile
+    {
+        /**
+         * Coordinate of the tile.
+         */
+        coordinate<Lyt> coord;
+        /**
+         * Clock zone of the tile. For latch tiles, this is the clock zone of its upper half.
+         */
+        typename Lyt::clock_number_t clock_zone;
+        /**
+         * Latch delay of the tile. Regular tiles have a latch delay of 0.
+         */
+        uint32_t latch_delay;
+        /**
+         * Cell description instances placed relative to the tile.
+         */
+        std::vector<placed_cell> cells;
+    };
     /**
-     * Alias for an SVG description of a latch tile containing also its clock zone and its offset.
+     * Distinct cell descriptions that are defined as reusable SVG symbols. Their indices form their symbol IDs.
      */
-    using svg_latch = std::tuple<std::string, typename Lyt::clock_number_t, uint32_t>;
+    std::vector<description_color> cell_symbols{};
     /**
-     * Maps coordinates of latch tiles to tuples containing their string representation, their clock zone,
-     * and their latch offset.
+     * Tiles that are rendered by a single thread at least.
      */
-    using coord_to_latch_mapping = std::unordered_map<coordinate<Lyt>, svg_latch>;
+    static constexpr std::size_t min_tiles_per_thread = 256;
 
     /**
-     * Generates and returns a pair of strings representing the description and color of the given cell.
+     * Generates and returns a pair of a description template and a color representing the given cell.
      *
      * @param c The cell for which to generate the description and color.
-     * @return A pair of strings representing the description and color of the given cell `c`.
+     * @return A pair of the description template and the color of the given cell `c`. The template is `nullptr` if `c`
+     * has no visual representation.
      */
-    std::pair<std::string, std::string> generate_description_color(const cell<Lyt>& c)
+    description_color generate_description_color(const cell<Lyt>& c) const
     {
-        std::string cell_description, cell_color{};
+        const char* cell_description = nullptr;
+        std::string cell_color{};
 
         static constexpr const std::array<const char*, 4> cell_colors{
             {svg::CLOCK_ZONE_1_CELL, svg::CLOCK_ZONE_2_CELL, svg::CLOCK_ZONE_3_CELL, svg::CLOCK_ZONE_4_CELL}};
@@ -834,12 +896,12 @@ class write_qca_layout_svg_impl
         }
         else if (Lyt::technology::is_const_0_cell(ct))
         {
-            cell_color       = "#000000";
+            cell_color       = "000000";
             cell_description = ps.simple ? svg::SIMPLE_CELL : svg::CONST0;
         }
         else if (Lyt::technology::is_const_1_cell(ct))
         {
-            cell_color       = "#000000";
+            cell_color       = "000000";
             cell_description = ps.simple ? svg::SIMPLE_CELL : svg::CONST1;
         }
         else
@@ -849,243 +911,348 @@ class write_qca_layout_svg_impl
 
         return std::make_pair(cell_description, cell_color);
     }
+    /**
+     * Returns the index of the symbol definition of the given cell description and creates it if necessary.
+     *
+     * @param desc_col Description template and color of a cell.
+     * @return Index of the symbol definition of `desc_col`.
+     */
+    std::size_t cell_symbol(const description_color& desc_col)
+    {
+        // there are only a handful of distinct cell descriptions
+        if (const auto it = std::find(cell_symbols.cbegin(), cell_symbols.cend(), desc_col); it != cell_symbols.cend())
+        {
+            return static_cast<std::size_t>(std::distance(cell_symbols.cbegin(), it));
+        }
 
+        cell_symbols.push_back(desc_col);
+
+        return cell_symbols.size() - 1;
+    }
     /**
-     * Generates an SVG string representing the cell-based clocked cell layout and appends it to the output stream.
+     * Collects all non-empty cells of the layout in the order of their coordinates.
+     *
+     * @return All non-empty cells sorted by their coordinates.
      */
-    void generate_cell_based_svg()
+    [[nodiscard]] std::vector<cell<Lyt>> sorted_cells() const
     {
-        std::stringstream cell_descriptions{};
+        std::vector<cell<Lyt>> cells{};
+        cells.reserve(lyt.num_cells());
 
-        lyt.foreach_cell_position(
-            [this, &cell_descriptions](const auto& c)
+        lyt.foreach_cell(
+            [this, &cells](const auto& c)
             {
                 if (!lyt.is_empty_cell(c))
                 {
-                    // Determines cell type and color
-                    const auto desc_col = generate_description_color(c);
-
-                    bool is_sync_elem = false;
-                    // Current cell-description can now be appended to the description of all cells
-                    if constexpr (has_synchronization_elements_v<Lyt>)
-                    {
-                        if (lyt.is_synchronization_element(c))
-                        {
-                            cell_descriptions
-                                << fmt::format(fmt::runtime(desc_col.first), desc_col.second,
-                                               svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_LATCH_CELL_X +
-                                                   (c.x * svg::CELL_DISTANCE),
-                                               svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_LATCH_CELL_Y +
-                                                   (c.y * svg::CELL_DISTANCE));
-
-                            is_sync_elem = true;
-                        }
-                    }
-                    if (!is_sync_elem)
-                    {
-                        cell_descriptions << fmt::format(
-                            fmt::runtime(desc_col.first), desc_col.second,
-                            svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_CELL_X + (c.x * svg::CELL_DISTANCE),
-                            svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_CELL_Y + (c.y * svg::CELL_DISTANCE));
-                    }
+                    cells.push_back(c);
                 }
             });
 
-        const double viewbox_x = (2 * svg::VIEWBOX_DISTANCE) + (static_cast<double>(lyt.x() + 1) * svg::CELL_DISTANCE);
-        const double viewbox_y = (2 * svg::VIEWBOX_DISTANCE) + (static_cast<double>(lyt.y() + 1) * svg::CELL_DISTANCE);
+        std::sort(cells.begin(), cells.end());
+
+        return cells;
+    }
+    /**
+     * Appends an instance of the given cell symbol to a buffer.
+     *
+     * @param pc Cell symbol instance.
+     * @param buffer Buffer to append to.
+     */
+    static void render_use(const placed_cell& pc, std::string& buffer)
+    {
+        fmt::format_to(std::back_inserter(buffer), svg::USE, svg::CELL_SYMBOL_PREFIX, pc.symbol, pc.x, pc.y);
+    }
+    /**
+     * Writes the SVG header including the symbol definitions of all cell descriptions.
+     *
+     * @param viewbox_x Width of the view box.
+     * @param viewbox_y Height of the view box.
+     */
+    void write_header(const double viewbox_x, const double viewbox_y) const
+    {
+        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y);
 
-        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y, cell_descriptions.str());
+        for (std::size_t i = 0; i < cell_symbols.size(); ++i)
+        {
+            os << fmt::format(svg::SYMBOL, svg::CELL_SYMBOL_PREFIX, i,
+                              fmt::format(fmt::runtime(cell_symbols[i].first), cell_symbols[i].second));
+        }
     }
 
     /**
-     * Generates an SVG string representing the tile-based clocked cell layout and appends it to the output stream.
+     * Generates an SVG string representing the cell-based clocked cell layout and appends it to the output stream.
      */
-    void generate_tile_based_svg()
+    void generate_cell_based_svg()
     {
-        // Collects ALL tile-descriptions
-        std::stringstream tile_descriptions{};
+        std::vector<placed_cell> cell_instances{};
 
-        // Used for generating tile-descriptions with information about the tile's coordinates and clock zone
-        // It is needed because cells may not be in "tile-order" when read from a cell layout
-        coord_to_tile_mapping      coord_to_tile{};
-        coord_to_cell_list_mapping coord_to_cells{};
-        coord_to_latch_mapping     coord_to_latch_tile{};
-        coord_to_cell_list_mapping coord_to_latch_cells{};
+        for (const auto& c : sorted_cells())
+        {
+            // Determines cell type and color
+            const auto desc_col = generate_description_color(c);
 
+            if (desc_col.first == nullptr)
+            {
+                continue;
+            }
+
+            bool is_sync_elem = false;
+            // Current cell-description can now be instanced
+            if constexpr (has_synchronization_elements_v<Lyt>)
+            {
+                if (lyt.is_synchronization_element(c))
+                {
+                    cell_instances.push_back(
+                        {cell_symbol(desc_col),
+                         svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_LATCH_CELL_X + (c.x * svg::CELL_DISTANCE),
+                         svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_LATCH_CELL_Y + (c.y * svg::CELL_DISTANCE)});
+
+                    is_sync_elem = true;
+                }
+            }
+            if (!is_sync_elem)
+            {
+                cell_instances.push_back(
+                    {cell_symbol(desc_col),
+                     svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_CELL_X + (c.x * svg::CELL_DISTANCE),
+                     svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_CELL_Y + (c.y * svg::CELL_DISTANCE)});
+            }
+        }
+
+        const double viewbox_x = (2 * svg::VIEWBOX_DISTANCE) + (static_cast<double>(lyt.x() + 1) * svg::CELL_DISTANCE);
+        const double viewbox_y = (2 * svg::VIEWBOX_DISTANCE) + (static_cast<double>(lyt.y() + 1) * svg::CELL_DISTANCE);
+
+        write_header(viewbox_x, viewbox_y);
+
+        os << svg::BODY;
+
+        write_rendered_in_order(os, cell_instances, render_use, ps.num_threads);
+
+        os << svg::FOOTER;
+    }
+    /**
+     * Renders the description of a tile without its placement, i.e., its background, its clock zone labels, and its
+     * cell instances. Tiles with equal descriptions are instances of the same symbol.
+     *
+     * @param t Tile to render.
+     * @return The SVG description of `t`.
+     */
+    [[nodiscard]] std::string render_tile(const svg_tile& t) const
+    {
         // Used to determine the color of cells, tiles and text based on its clock zone
         static constexpr const std::array<const char*, 4> tile_colors{
             {svg::CLOCK_ZONE_1_TILE, svg::CLOCK_ZONE_2_TILE, svg::CLOCK_ZONE_3_TILE, svg::CLOCK_ZONE_4_TILE}};
         static constexpr const std::array<const char*, 4> text_colors{
             {svg::CLOCK_ZONE_12_TEXT, svg::CLOCK_ZONE_12_TEXT, svg::CLOCK_ZONE_34_TEXT, svg::CLOCK_ZONE_34_TEXT}};
 
-        // Adds all non-empty cells from the layout to their correct tiles; it generates the "body"
-        // of all the tile-descriptions to be used later
-        lyt.foreach_cell_position(
-            [this, &coord_to_tile, &coord_to_cells, &coord_to_latch_cells, &coord_to_latch_tile](const auto& c)
-            {
-                const auto clock_zone = lyt.get_clock_number(c);
-                const auto tile_coords =
-                    coordinate<Lyt>{std::ceil(c.x / lyt.get_tile_size_x()), std::ceil(c.y / lyt.get_tile_size_y())};
-                std::string current_cells{};
-
-                bool is_sync_elem = false;
+        std::string cell_descriptions{};
+        for (const auto& pc : t.cells)
+        {
+            render_use(pc, cell_descriptions);
+        }
 
-                if constexpr (has_synchronization_elements_v<Lyt>)
-                {
-                    if (const auto latch_delay = lyt.get_synchronization_element(c); latch_delay > 0)
-                    {
-                        if (auto latch_it = coord_to_latch_cells.find(tile_coords);
-                            latch_it != coord_to_latch_cells.end())
-                        {
-                            current_cells = latch_it->second;
-                        }
-                        else
-                        {
-                            // If this is called then there is no tile for the current cell yet
-                            // It also makes sure that all required tiles are created
-                            coord_to_latch_tile[tile_coords] = {svg::LATCH, clock_zone,
-                                                                static_cast<uint32_t>(latch_delay)};
-                        }
-
-                        is_sync_elem = true;
-                    }
-                }
+        const auto czone = t.clock_zone;
 
-                if (!is_sync_elem)
-                {
-                    if (auto cell_it = coord_to_cells.find(tile_coords); cell_it != coord_to_cells.end())
-                    {
-                        current_cells = cell_it->second;
-                    }
-                    else
-                    {
-                        // If this is called, then there is no tile for the current cell yet
-                        // It also makes sure that all required tiles are created
-                        coord_to_tile[tile_coords] = {svg::TILE, clock_zone};
-                    }
-                }
+        if (t.latch_delay == 0)
+        {
+            return fmt::format(svg::TILE, tile_colors[czone], cell_descriptions, ps.simple ? "" : text_colors[czone],
+                               ps.simple ? "" : std::to_string(czone + 1));
+        }
 
-                // Represent the x- and y-coordinates inside the c's tile
-                const coordinate<Lyt> in_tile{c.x % lyt.get_tile_size_x(), c.y % lyt.get_tile_size_y()};
+        const auto czone_lo = czone + (t.latch_delay % lyt.num_clocks());
 
-                // Determines cell type and color
-                const auto desc_col = generate_description_color(c);
+        return fmt::format(svg::LATCH, tile_colors[czone_lo], tile_colors[czone], cell_descriptions, text_colors[czone],
+                           ps.simple ? "" : std::to_string(czone + 1), text_colors[czone_lo],
+                           ps.simple ? "" : std::to_string(czone_lo + 1));
+    }
+    /**
+     * Renders the descriptions of all given tiles. Large numbers of tiles are rendered in parallel.
+     *
+     * @param tiles Tiles to render.
+     * @return The SVG descriptions of all tiles in the order of `tiles`.
+     */
+    [[nodiscard]] std::vector<std::string> render_tiles(const std::vector<svg_tile>& tiles) const
+    {
+        std::vector<std::string> descriptions(tiles.size());
 
-                // Only add cell description if the cell is not empty
-                if (!(lyt.is_empty_cell(c)))
-                {
-                    //  Current cell-description can now be appended to the description of all cells in the current tile
-                    if constexpr (has_synchronization_elements_v<Lyt>)
-                    {
-                        if (const auto latch_delay = lyt.get_synchronization_element(c); latch_delay > 0)
-                        {
-                            coord_to_latch_cells[tile_coords] = current_cells.append(
-                                fmt::format(fmt::runtime(desc_col.first), desc_col.second,
-                                            svg::STARTING_OFFSET_LATCH_CELL_X + (in_tile.x * svg::CELL_DISTANCE),
-                                            svg::STARTING_OFFSET_LATCH_CELL_Y + (in_tile.y * svg::CELL_DISTANCE)));
-
-                            is_sync_elem = true;
-                        }
-                    }
+        const auto num_threads = std::min(std::max(ps.num_threads, std::size_t{1}),
+                                          std::max(tiles.size() / min_tiles_per_thread, std::size_t{1}));
 
-                    if (!is_sync_elem)
-                    {
-                        coord_to_cells[tile_coords] = current_cells.append(
-                            fmt::format(fmt::runtime(desc_col.first), desc_col.second,
-                                        svg::STARTING_OFFSET_CELL_X + (in_tile.x * svg::CELL_DISTANCE),
-                                        svg::STARTING_OFFSET_CELL_Y + (in_tile.y * svg::CELL_DISTANCE)));
-                    }
-                }
-            });
+        // calculate the size of each slice
+        const auto slice_size = (tiles.size() + num_threads - 1) / num_threads;
 
-        // All cell-descriptions are done and tiles have been created
+        // renders the tiles in [start, end); this only reads the layout and writes to distinct descriptions
+        const auto render_slice = [this, &tiles, &descriptions](const std::size_t start, const std::size_t end)
+        {
+            for (auto i = start; i < end; ++i)
+            {
+                descriptions[i] = render_tile(tiles[i]);
+            }
+        };
 
-        // Delete empty tiles in simple designs
-        if (ps.simple)
+        if (num_threads <= 1)
         {
-            std::vector<coordinate<Lyt>> empty_tiles{};
+            render_slice(0, tiles.size());
+        }
+        else
+        {
+            std::vector<std::future<void>> futures{};
+            futures.reserve(num_threads);
 
-            // Find empty tiles via missing cell-descriptions for their coordinates
-            for (const auto& [coord, tdscr] : coord_to_tile)
+            for (std::size_t start = 0; start < tiles.size(); start += slice_size)
             {
-                if (coord_to_cells.count(coord) == 0)
-                {
-                    empty_tiles.emplace_back(coord);
-                }
+                futures.emplace_back(
+                    std::async(std::launch::async, render_slice, start, std::min(start + slice_size, tiles.size())));
             }
 
-            // Delete empty tiles
-            for (const auto& coord : empty_tiles)
+            for (auto& f : futures)
             {
-                coord_to_tile.erase(coord);
+                f.get();
             }
+        }
 
-            if constexpr (has_synchronization_elements_v<Lyt>)
-            {
-                std::vector<coordinate<Lyt>> empty_latches{};
+        return descriptions;
+    }
 
-                // Find empty latches via missing cell-descriptions for their coordinates
-                for (const auto& [coord, ldscr] : coord_to_latch_tile)
-                {
-                    if (auto cell_it = coord_to_latch_cells.find(coord); cell_it == coord_to_latch_cells.end())
-                    {
-                        empty_latches.emplace_back(coord);
-                    }
-                }
+    /**
+     * Generates an SVG string representing the tile-based clocked cell layout and appends it to the output stream.
+     * Tiles with equal descriptions, e.g., multiple instances of the same gate implementation in the same clock zone,
+     * are defined once as a symbol and instanced at each of their positions.
+     */
+    void generate_tile_based_svg()
+    {
+        const auto tile_size_x = lyt.get_tile_size_x();
+        const auto tile_size_y = lyt.get_tile_size_y();
+
+        // Used for collecting the cells of each tile; they are ordered by their coordinates to obtain a deterministic
+        // output
+        std::map<coordinate<Lyt>, svg_tile> regular_tiles{};
+        std::map<coordinate<Lyt>, svg_tile> latch_tiles{};
 
-                // Delete empty latches
-                for (const auto& coord : empty_latches)
+        const auto clock_zone_of = [this, tile_size_x, tile_size_y](const coordinate<Lyt>& tile_coords)
+        { return lyt.get_clock_number(cell<Lyt>{tile_coords.x * tile_size_x, tile_coords.y * tile_size_y}); };
+
+        // All tiles are shown in detailed designs, even if they are empty
+        if (!ps.simple)
+        {
+            for (decltype(lyt.y()) y = 0; y <= lyt.y() / tile_size_y; ++y)
+            {
+                for (decltype(lyt.x()) x = 0; x <= lyt.x() / tile_size_x; ++x)
                 {
-                    coord_to_latch_tile.erase(coord);
+                    const coordinate<Lyt> tile_coords{x, y};
+                    regular_tiles.emplace(tile_coords, svg_tile{tile_coords, clock_zone_of(tile_coords), 0, {}});
                 }
             }
         }
 
-        // Associate tiles with cell-descriptions now; coordinates of tiles are used for tile- and cell-descriptions
-        for (const auto& [coord, tdscr] : coord_to_tile)
+        // Adds all non-empty cells from the layout to their correct tiles; it generates the "body" of all the
+        // tile-descriptions to be used later
+        for (const auto& c : sorted_cells())
         {
-            const auto [descr, czone] = tdscr;
+            const coordinate<Lyt> tile_coords{c.x / tile_size_x, c.y / tile_size_y};
+
+            // Represent the x- and y-coordinates inside the c's tile
+            const coordinate<Lyt> in_tile{c.x % tile_size_x, c.y % tile_size_y};
 
-            const auto cell_descriptions = coord_to_cells[coord];
+            // Determines cell type and color
+            const auto desc_col = generate_description_color(c);
 
-            const double x_pos = svg::STARTING_OFFSET_TILE_X + (coord.x * svg::TILE_DISTANCE);
-            const double y_pos = svg::STARTING_OFFSET_TILE_Y + (coord.y * svg::TILE_DISTANCE);
+            uint32_t latch_delay = 0;
 
-            const auto c_descr =
-                fmt::format(fmt::runtime(descr), x_pos, y_pos, tile_colors[czone], cell_descriptions,
-                            ps.simple ? "" : text_colors[czone], ps.simple ? "" : std::to_string(czone + 1));
+            if constexpr (has_synchronization_elements_v<Lyt>)
+            {
+                latch_delay = static_cast<uint32_t>(lyt.get_synchronization_element(c));
+            }
 
-            tile_descriptions << c_descr;
+            if (latch_delay > 0)
+            {
+                auto& t = latch_tiles
+                              .try_emplace(tile_coords,
+                                           svg_tile{tile_coords, lyt.get_clock_number(c), latch_delay, {}})
+                              .first->second;
+
+                if (desc_col.first != nullptr)
+                {
+                    t.cells.push_back({cell_symbol(desc_col),
+                                       svg::STARTING_OFFSET_LATCH_CELL_X + (in_tile.x * svg::CELL_DISTANCE),
+                                       svg::STARTING_OFFSET_LATCH_CELL_Y + (in_tile.y * svg::CELL_DISTANCE)});
+                }
+            }
+            else
+            {
+                auto& t =
+                    regular_tiles.try_emplace(tile_coords, svg_tile{tile_coords, clock_zone_of(tile_coords), 0, {}})
+                        .first->second;
+
+                if (desc_col.first != nullptr)
+                {
+                    t.cells.push_back({cell_symbol(desc_col),
+                                       svg::STARTING_OFFSET_CELL_X + (in_tile.x * svg::CELL_DISTANCE),
+                                       svg::STARTING_OFFSET_CELL_Y + (in_tile.y * svg::CELL_DISTANCE)});
+                }
+            }
         }
 
-        if constexpr (has_synchronization_elements_v<Lyt>)
+        // Latch tiles are drawn on top of the regular ones
+        std::vector<svg_tile> tiles{};
+        tiles.reserve(regular_tiles.size() + latch_tiles.size());
+
+        for (auto& [coord, t] : regular_tiles)
         {
-            // Add the descriptions of latch-tiles to the whole image
-            for (const auto& [coord, ldscr] : coord_to_latch_tile)
-            {
-                const auto [descr, czone_up, latch_delay] = ldscr;
-                const auto czone_lo                       = czone_up + (latch_delay % lyt.num_clocks());
+            tiles.push_back(std::move(t));
+        }
+        for (auto& [coord, t] : latch_tiles)
+        {
+            tiles.push_back(std::move(t));
+        }
 
-                const auto cell_descriptions = coord_to_latch_cells[coord];
+        const auto descriptions = render_tiles(tiles);
 
-                const double x_pos = svg::STARTING_OFFSET_LATCH_X + (coord.x * svg::TILE_DISTANCE);
-                const double y_pos = svg::STARTING_OFFSET_LATCH_Y + (coord.y * svg::TILE_DISTANCE);
+        // Assign each tile to the symbol of its description; symbols are numbered in order of first occurrence
+        std::unordered_map<std::string_view, std::size_t> tile_symbols{};
+        std::vector<std::size_t>                          tile_symbol_ids{};
+        std::vector<std::size_t>                          distinct_descriptions{};
+        tile_symbol_ids.reserve(tiles.size());
 
-                const auto t_descr =
-                    fmt::format(fmt::runtime(descr), x_pos, y_pos, tile_colors[czone_lo], tile_colors[czone_up],
-                                cell_descriptions, text_colors[czone_up], ps.simple ? "" : std::to_string(czone_up + 1),
-                                text_colors[czone_lo], ps.simple ? "" : std::to_string(czone_lo + 1));
+        for (std::size_t i = 0; i < descriptions.size(); ++i)
+        {
+            const auto [it, inserted] = tile_symbols.try_emplace(descriptions[i], distinct_descriptions.size());
 
-                tile_descriptions << t_descr;
+            if (inserted)
+            {
+                distinct_descriptions.push_back(i);
             }
+
+            tile_symbol_ids.push_back(it->second);
         }
 
-        const coordinate<Lyt> length = {(lyt.x() + 1) / lyt.get_tile_size_x(), (lyt.y() + 1) / lyt.get_tile_size_y()};
+        const coordinate<Lyt> length = {(lyt.x() + 1) / tile_size_x, (lyt.y() + 1) / tile_size_y};
 
         const double viewbox_x = (2 * svg::VIEWBOX_DISTANCE) + (length.x * svg::TILE_DISTANCE);
         const double viewbox_y = (2 * svg::VIEWBOX_DISTANCE) + (length.y * svg::TILE_DISTANCE);
 
-        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y, tile_descriptions.str());
+        write_header(viewbox_x, viewbox_y);
+
+        for (std::size_t i = 0; i < distinct_descriptions.size(); ++i)
+        {
+            os << fmt::format(svg::SYMBOL, svg::TILE_SYMBOL_PREFIX, i, descriptions[distinct_descriptions[i]]);
+        }
+
+        os << svg::BODY;
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            const auto& t = tiles[i];
+
+            const double x_pos = t.latch_delay == 0 ? svg::STARTING_OFFSET_TILE_X + (t.coord.x * svg::TILE_DISTANCE) :
+                                                      svg::STARTING_OFFSET_LATCH_X + (t.coord.x * svg::TILE_DISTANCE);
+            const double y_pos = t.latch_delay == 0 ? svg::STARTING_OFFSET_TILE_Y + (t.coord.y * svg::TILE_DISTANCE) :
+                                                      svg::STARTING_OFFSET_LATCH_Y + (t.coord.y * svg::TILE_DISTANCE);
+
+            os << fmt::format(svg::USE, svg::TILE_SYMBOL_PREFIX, tile_symbol_ids[i], x_pos, y_pos);
+        }
+
+        os << svg::FOOTER;
     }
 };
 
@@ -6,6 +6,7 @@
 #define FICTION_CELL_LEVEL_LAYOUT_HPP
 
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/coordinate_storage.hpp"
 #include "fiction/traits.hpp"
 
 #include <mockturtle/networks/detail/foreach.hpp>
@@ -15,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -45,8 +47,10 @@ namespace fiction
  *
  * @tparam Technology An FCN technology that provides notions of cell types.
  * @tparam ClockedLayout The clocked layout that is to be extended by cell positions.
+ * @tparam StoragePolicy Policy that determines how cell types and modes are stored. See `sparse_coordinate_storage`
+ * (default) and `dense_coordinate_storage`.
  */
-template <typename Technology, typename ClockedLayout>
+template <typename Technology, typename ClockedLayout, typename StoragePolicy = sparse_coordinate_storage>
 class cell_level_layout : public ClockedLayout
 {
   public:
@@ -70,8 +74,8 @@ class cell_level_layout : public ClockedLayout
         uint16_t tile_size_x;
         uint16_t tile_size_y;
 
-        phmap::parallel_flat_hash_map<Cell, cell_type> cell_type_map{};
-        phmap::parallel_flat_hash_map<Cell, cell_mode> cell_mode_map{};
+        typename StoragePolicy::template map<Cell, cell_type> cell_type_map{};
+        typename StoragePolicy::template map<Cell, cell_mode> cell_mode_map{};
 
         phmap::flat_hash_map<Cell, std::string> cell_name_map{};
 
@@ -146,6 +150,24 @@ class cell_level_layout : public ClockedLayout
 
         return copy;
     }
+    /**
+     * Pre-allocates memory for the given number of cells such that bulk insertions, e.g., when applying a gate library
+     * to a large gate-level layout, do not repeatedly grow and rehash the cell type storage. Under
+     * `dense_coordinate_storage`, the cell grid is allocated to span the current layout bounds instead.
+     *
+     * @param num_cells Expected total number of cells.
+     */
+    void reserve(const uint64_t num_cells)
+    {
+        if constexpr (std::is_same_v<StoragePolicy, dense_coordinate_storage>)
+        {
+            strg->cell_type_map.reserve_bounds({ClockedLayout::x(), ClockedLayout::y(), ClockedLayout::z()});
+        }
+        else
+        {
+            strg->cell_type_map.reserve(num_cells);
+        }
+    }
 
 #pragma endregion
 
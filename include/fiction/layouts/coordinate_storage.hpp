@@ -0,0 +1,465 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_COORDINATE_STORAGE_HPP
+#define FICTION_COORDINATE_STORAGE_HPP
+
+#include "fiction/layouts/coordinates.hpp"
+
+#include <phmap.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * An associative container that maps offset coordinates (or keys that are convertible to and from them) to values. In
+ * contrast to a hash map, live coordinates are stored in a dense, row-major, z-layered grid that spans the bounding box
+ * of all coordinates that have ever been inserted. The grid grows on demand. Dead coordinates, e.g., the ones used to
+ * represent constants in `gate_level_layout`, are kept in a small hash map on the side so that the container has
+ * identical semantics to the hash maps it replaces.
+ *
+ * Lookups are a single index computation and no hashing is involved. For layouts that fill most of their bounding box,
+ * e.g., cell-level layouts obtained from the application of a gate library, this is both faster and more memory
+ * efficient than a hash map. For sparsely populated layouts, the opposite is true.
+ *
+ * Iteration order is row-major with the layers outermost followed by the dead coordinates.
+ *
+ * @tparam Key Key type. Must be `offset::ucoord_t` or explicitly convertible to and from it, e.g., `uint64_t`.
+ * @tparam Value Value type.
+ */
+template <typename Key, typename Value>
+class dense_coordinate_map
+{
+    static_assert(std::is_same_v<Key, offset::ucoord_t> || std::is_constructible_v<offset::ucoord_t, Key>,
+                  "Key must be convertible to offset::ucoord_t");
+
+  public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using value_type  = std::pair<Key, Value>;
+    using size_type   = std::size_t;
+
+    /**
+     * Forward iterator over all stored key-value pairs. Key-value pairs are materialized on dereferencing, hence,
+     * stored values cannot be modified through this iterator.
+     */
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename dense_coordinate_map::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const value_type*;
+        using reference         = const value_type&;
+
+        const_iterator() noexcept = default;
+
+        const_iterator(const dense_coordinate_map* m, const std::size_t i,
+                       typename phmap::flat_hash_map<Key, Value>::const_iterator d) noexcept :
+                map{m},
+                index{i},
+                dead_it{d}
+        {
+            skip_empty_slots();
+        }
+
+        reference operator*() const noexcept
+        {
+            return current;
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &current;
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            if (index < map->grid.size())
+            {
+                ++index;
+            }
+            else
+            {
+                ++dead_it;
+            }
+
+            skip_empty_slots();
+
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++(*this);
+
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return index == other.index && dead_it == other.dead_it;
+        }
+
+        bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+      private:
+        const dense_coordinate_map* map{nullptr};
+
+        std::size_t index{0};
+
+        typename phmap::flat_hash_map<Key, Value>::const_iterator dead_it{};
+
+        value_type current{};
+
+        friend class dense_coordinate_map;
+
+        void skip_empty_slots() noexcept
+        {
+            while (index < map->grid.size() && !map->grid[index].has_value())
+            {
+                ++index;
+            }
+
+            if (index < map->grid.size())
+            {
+                current = {map->key_at(index), *map->grid[index]};
+            }
+            else if (dead_it != map->dead_entries.cend())
+            {
+                current = *dead_it;
+            }
+        }
+    };
+
+    using iterator = const_iterator;
+
+    dense_coordinate_map() = default;
+    /**
+     * Constructs the container from a list of key-value pairs.
+     *
+     * @param init Key-value pairs to insert.
+     */
+    dense_coordinate_map(std::initializer_list<value_type> init)
+    {
+        for (const auto& [k, v] : init)
+        {
+            (*this)[k] = v;
+        }
+    }
+    /**
+     * Pre-allocates the grid such that it spans all coordinates up to and including `max`. This avoids repeated
+     * growth if the bounds of the layout are known up front.
+     *
+     * @param max Largest coordinate to allocate space for.
+     */
+    void reserve_bounds(const offset::ucoord_t& max)
+    {
+        if (!max.is_dead())
+        {
+            grow(max);
+        }
+    }
+    /**
+     * Accesses the value associated with `key`. If none is present, a default-constructed value is inserted.
+     *
+     * @param key Key whose value is desired.
+     * @return Reference to the value associated with `key`.
+     */
+    Value& operator[](const Key& key)
+    {
+        const auto c = to_coordinate(key);
+
+        if (c.is_dead())
+        {
+            return dead_entries[key];
+        }
+
+        grow(c);
+
+        auto& slot = grid[grid_index(c)];
+
+        if (!slot.has_value())
+        {
+            slot.emplace();
+            ++num_grid_entries;
+        }
+
+        return *slot;
+    }
+    /**
+     * Looks up `key`.
+     *
+     * @param key Key to look up.
+     * @return Iterator to the key-value pair or `cend()` if `key` is not stored.
+     */
+    [[nodiscard]] const_iterator find(const Key& key) const noexcept
+    {
+        const auto c = to_coordinate(key);
+
+        if (c.is_dead())
+        {
+            if (const auto it = dead_entries.find(key); it != dead_entries.cend())
+            {
+                return const_iterator{this, grid.size(), it};
+            }
+
+            return cend();
+        }
+
+        if (is_within_grid(c))
+        {
+            if (const auto i = grid_index(c); grid[i].has_value())
+            {
+                return const_iterator{this, i, dead_entries.cbegin()};
+            }
+        }
+
+        return cend();
+    }
+    /**
+     * Checks whether `key` is stored.
+     *
+     * @param key Key to look up.
+     * @return `1` if `key` is stored and `0` otherwise.
+     */
+    [[nodiscard]] size_type count(const Key& key) const noexcept
+    {
+        return find(key) != cend() ? 1 : 0;
+    }
+    /**
+     * Removes `key` and its associated value.
+     *
+     * @param key Key to remove.
+     * @return Number of removed elements.
+     */
+    size_type erase(const Key& key) noexcept
+    {
+        const auto c = to_coordinate(key);
+
+        if (c.is_dead())
+        {
+            return dead_entries.erase(key);
+        }
+
+        if (is_within_grid(c))
+        {
+            if (auto& slot = grid[grid_index(c)]; slot.has_value())
+            {
+                slot.reset();
+                --num_grid_entries;
+
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+    /**
+     * Removes the key-value pair pointed to by `it`.
+     *
+     * @param it Iterator to a stored key-value pair.
+     * @return Iterator to the next key-value pair.
+     */
+    const_iterator erase(const const_iterator& it) noexcept
+    {
+        if (it.index < grid.size())
+        {
+            grid[it.index].reset();
+            --num_grid_entries;
+
+            return const_iterator{this, it.index + 1, dead_entries.cbegin()};
+        }
+
+        const auto next = std::next(it.dead_it);
+        const auto key  = it.dead_it->first;
+
+        // erasing from a flat_hash_map does not invalidate iterators to other elements
+        dead_entries.erase(key);
+
+        return const_iterator{this, grid.size(), next};
+    }
+    /**
+     * Removes all stored key-value pairs but keeps the allocated grid.
+     */
+    void clear() noexcept
+    {
+        std::fill(grid.begin(), grid.end(), std::nullopt);
+        num_grid_entries = 0;
+        dead_entries.clear();
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return num_grid_entries + dead_entries.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+        return const_iterator{this, 0, dead_entries.cbegin()};
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+        return const_iterator{this, grid.size(), dead_entries.cend()};
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    /**
+     * Returns the number of bytes allocated for the grid and the dead coordinates.
+     *
+     * @return Allocated memory in bytes.
+     */
+    [[nodiscard]] std::size_t memory_usage() const noexcept
+    {
+        return grid.capacity() * sizeof(std::optional<Value>) +
+               dead_entries.capacity() * (sizeof(value_type) + 1);
+    }
+
+  private:
+    /**
+     * Dense storage of all live coordinates in row-major order with the layers outermost.
+     */
+    std::vector<std::optional<Value>> grid{};
+    /**
+     * Grid extents.
+     */
+    uint64_t width{0}, height{0}, depth{0};
+    /**
+     * Number of occupied grid slots.
+     */
+    std::size_t num_grid_entries{0};
+    /**
+     * Values associated with dead coordinates.
+     */
+    phmap::flat_hash_map<Key, Value> dead_entries{};
+
+    [[nodiscard]] static offset::ucoord_t to_coordinate(const Key& key) noexcept
+    {
+        if constexpr (std::is_same_v<Key, offset::ucoord_t>)
+        {
+            return key;
+        }
+        else
+        {
+            return static_cast<offset::ucoord_t>(key);
+        }
+    }
+
+    [[nodiscard]] bool is_within_grid(const offset::ucoord_t& c) const noexcept
+    {
+        return c.x < width && c.y < height && c.z < depth;
+    }
+
+    [[nodiscard]] std::size_t grid_index(const offset::ucoord_t& c) const noexcept
+    {
+        return static_cast<std::size_t>((c.z * height + c.y) * width + c.x);
+    }
+
+    [[nodiscard]] Key key_at(const std::size_t i) const noexcept
+    {
+        const auto x = i % width;
+        const auto y = (i / width) % height;
+        const auto z = i / (width * height);
+
+        const offset::ucoord_t c{x, y, z};
+
+        if constexpr (std::is_same_v<Key, offset::ucoord_t>)
+        {
+            return c;
+        }
+        else
+        {
+            return static_cast<Key>(c);
+        }
+    }
+    /**
+     * Grows the grid such that it contains `c`. Dimensions that need to grow are enlarged by at least 50 % to amortize
+     * the cost of re-indexing.
+     *
+     * @param c Live coordinate that needs to be contained in the grid.
+     */
+    void grow(const offset::ucoord_t& c)
+    {
+        if (is_within_grid(c))
+        {
+            return;
+        }
+
+        const auto grow_dimension = [](const uint64_t current, const uint64_t required) noexcept
+        { return required <= current ? current : std::max(required, current + current / 2); };
+
+        const auto new_width  = grow_dimension(width, static_cast<uint64_t>(c.x) + 1);
+        const auto new_height = grow_dimension(height, static_cast<uint64_t>(c.y) + 1);
+        const auto new_depth  = std::max(depth, static_cast<uint64_t>(c.z) + 1);
+
+        std::vector<std::optional<Value>> new_grid(static_cast<std::size_t>(new_width * new_height * new_depth));
+
+        for (uint64_t z = 0; z < depth; ++z)
+        {
+            for (uint64_t y = 0; y < height; ++y)
+            {
+                const auto old_row = std::next(grid.begin(), static_cast<std::ptrdiff_t>((z * height + y) * width));
+                const auto new_row =
+                    std::next(new_grid.begin(), static_cast<std::ptrdiff_t>((z * new_height + y) * new_width));
+
+                std::move(old_row, std::next(old_row, static_cast<std::ptrdiff_t>(width)), new_row);
+            }
+        }
+
+        grid   = std::move(new_grid);
+        width  = new_width;
+        height = new_height;
+        depth  = new_depth;
+    }
+};
+/**
+ * Storage policy for layout types that keeps coordinate-indexed data in hash maps. This is the default policy and
+ * suits layouts of all sizes and coordinate types.
+ */
+struct sparse_coordinate_storage
+{
+    template <typename Key, typename Value>
+    using map = phmap::parallel_flat_hash_map<Key, Value>;
+};
+/**
+ * Storage policy for layout types that keeps coordinate-indexed data in dense grids via `dense_coordinate_map`. It
+ * requires offset coordinates and pays off for layouts that fill most of their bounding box.
+ */
+struct dense_coordinate_storage
+{
+    template <typename Key, typename Value>
+    using map = dense_coordinate_map<Key, Value>;
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_COORDINATE_STORAGE_HPP
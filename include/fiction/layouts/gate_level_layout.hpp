@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/verification/design_rule_violations.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/coordinate_storage.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/mockturtle_utils.hpp"
 #include "fiction/utils/range.hpp"
@@ -26,6 +27,7 @@
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -76,8 +78,10 @@ namespace fiction
  * behavior might differ. Information on their functionality can be found in `mockturtle`'s docs.
  *
  * @tparam ClockedLayout The clocked layout that is to be extended by gate functions.
+ * @tparam StoragePolicy Policy that determines how the tile-to-node mapping is stored. See `sparse_coordinate_storage`
+ * (default) and `dense_coordinate_storage`.
  */
-template <typename ClockedLayout>
+template <typename ClockedLayout, typename StoragePolicy = sparse_coordinate_storage>
 class gate_level_layout : public ClockedLayout
 {
   public:
@@ -93,8 +97,8 @@ class gate_level_layout : public ClockedLayout
         const Tile const0{0x8000000000000000ull};
         const Tile const1{0xc000000000000000ull};
 
-        // these maps grow large! use parallel_flat_hashmap for better performance
-        phmap::parallel_flat_hash_map<Tile, Node> tile_node_map{
+        // these maps grow large! use parallel_flat_hashmap for better performance unless a dense storage is requested
+        typename StoragePolicy::template map<Tile, Node> tile_node_map{
             {{const0, static_cast<Node>(0ull)}, {const1, static_cast<Node>(1ull)}}};
         phmap::parallel_flat_hash_map<Node, Tile> node_tile_map{
             {{static_cast<Node>(0ull), const0}, {static_cast<Node>(1ull), const1}}};
@@ -223,6 +227,28 @@ class gate_level_layout : public ClockedLayout
 
         return copy;
     }
+    /**
+     * Pre-allocates memory for the given number of nodes, including the two constants, such that bulk insertions, e.g.,
+     * when remapping all gates of another layout, do not repeatedly grow and rehash the node storage and the mappings
+     * between tiles and nodes. Under `dense_coordinate_storage`, the tile grid is allocated to span the current layout
+     * bounds instead.
+     *
+     * @param num_nodes Expected total number of nodes.
+     */
+    void reserve(const uint64_t num_nodes)
+    {
+        strg->nodes.reserve(num_nodes);
+        strg->data.node_tile_map.reserve(num_nodes);
+
+        if constexpr (std::is_same_v<StoragePolicy, dense_coordinate_storage>)
+        {
+            strg->data.tile_node_map.reserve_bounds({ClockedLayout::x(), ClockedLayout::y(), ClockedLayout::z()});
+        }
+        else
+        {
+            strg->data.tile_node_map.reserve(num_nodes);
+        }
+    }
 
 #pragma endregion
 
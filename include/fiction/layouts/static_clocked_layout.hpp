@@ -0,0 +1,688 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_STATIC_CLOCKED_LAYOUT_HPP
+#define FICTION_STATIC_CLOCKED_LAYOUT_HPP
+
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Clocking policies that can be used to specialize `static_clocked_layout` at compile time. Each regular policy
+ * provides the scheme's name, its number of clock phases, its maximum in- and out-degrees, and a `constexpr` cutout
+ * that is repeated seamlessly in all directions. The cutouts are identical to the ones used by the respective
+ * type-erased clocking schemes in `clocking_scheme.hpp`.
+ */
+namespace static_clocking
+{
+
+/**
+ * Columnar clocking with four clock phases.
+ */
+struct columnar
+{
+    static constexpr std::string_view name           = clock_name::COLUMNAR;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 3u;
+    static constexpr uint8_t          max_out_degree = 2u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{0, 1, 2, 3}},
+         {{0, 1, 2, 3}},
+         {{0, 1, 2, 3}},
+         {{0, 1, 2, 3}}}};
+
+    // clang-format on
+};
+/**
+ * Row clocking with four clock phases.
+ */
+struct row
+{
+    static constexpr std::string_view name           = clock_name::ROW;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 3u;
+    static constexpr uint8_t          max_out_degree = 2u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{0, 0, 0, 0}},
+         {{1, 1, 1, 1}},
+         {{2, 2, 2, 2}},
+         {{3, 3, 3, 3}}}};
+
+    // clang-format on
+};
+/**
+ * 2DDWave clocking with four clock phases.
+ */
+struct twoddwave
+{
+    static constexpr std::string_view name           = clock_name::TWODDWAVE;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 2u;
+    static constexpr uint8_t          max_out_degree = 2u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{0, 1, 2, 3}},
+         {{1, 2, 3, 0}},
+         {{2, 3, 0, 1}},
+         {{3, 0, 1, 2}}}};
+
+    // clang-format on
+};
+/**
+ * USE clocking.
+ */
+struct use
+{
+    static constexpr std::string_view name           = clock_name::USE;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 2u;
+    static constexpr uint8_t          max_out_degree = 2u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{0, 1, 2, 3}},
+         {{3, 2, 1, 0}},
+         {{2, 3, 0, 1}},
+         {{1, 0, 3, 2}}}};
+
+    // clang-format on
+};
+/**
+ * RES clocking.
+ */
+struct res
+{
+    static constexpr std::string_view name           = clock_name::RES;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 3u;
+    static constexpr uint8_t          max_out_degree = 3u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{3, 0, 1, 2}},
+         {{0, 1, 0, 3}},
+         {{1, 2, 3, 0}},
+         {{0, 3, 2, 1}}}};
+
+    // clang-format on
+};
+/**
+ * ESR clocking.
+ */
+struct esr
+{
+    static constexpr std::string_view name           = clock_name::ESR;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 3u;
+    static constexpr uint8_t          max_out_degree = 3u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{3, 0, 1, 2}},
+         {{0, 1, 2, 3}},
+         {{1, 2, 3, 0}},
+         {{0, 3, 2, 1}}}};
+
+    // clang-format on
+};
+/**
+ * CFE clocking.
+ */
+struct cfe
+{
+    static constexpr std::string_view name           = clock_name::CFE;
+    static constexpr uint8_t          num_clocks     = 4u;
+    static constexpr uint8_t          max_in_degree  = 3u;
+    static constexpr uint8_t          max_out_degree = 3u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 4u>, 4u> cutout{
+        {{{0, 1, 0, 1}},
+         {{3, 2, 3, 2}},
+         {{0, 1, 0, 1}},
+         {{3, 2, 3, 2}}}};
+
+    // clang-format on
+};
+/**
+ * BANCS clocking with three clock phases.
+ */
+struct bancs
+{
+    static constexpr std::string_view name           = clock_name::BANCS;
+    static constexpr uint8_t          num_clocks     = 3u;
+    static constexpr uint8_t          max_in_degree  = 2u;
+    static constexpr uint8_t          max_out_degree = 2u;
+
+    // clang-format off
+
+    static constexpr std::array<std::array<uint8_t, 3u>, 6u> cutout{
+        {{{0, 1, 2}},
+         {{2, 1, 0}},
+         {{2, 0, 1}},
+         {{1, 0, 2}},
+         {{1, 2, 0}},
+         {{0, 2, 1}}}};
+
+    // clang-format on
+};
+/**
+ * Irregular clocking whose clock numbers are stored in a dense array that spans the bounds of the layout. This policy
+ * is meant to replace the hash map-based overrides of the OPEN clocking scheme on layouts whose dimensions are known
+ * up front. Clock zones outside the layout bounds are assigned clock number 0.
+ *
+ * @tparam NumClocks Number of clock phases.
+ */
+template <uint8_t NumClocks = 4u>
+struct open
+{
+    static_assert(NumClocks > 0, "Number of clock phases must be positive");
+
+    static constexpr std::string_view name       = clock_name::OPEN;
+    static constexpr uint8_t          num_clocks = NumClocks;
+};
+
+}  // namespace static_clocking
+
+namespace detail
+{
+
+template <typename ClockingPolicy, typename = void>
+struct has_clocking_cutout : std::false_type
+{};
+
+template <typename ClockingPolicy>
+struct has_clocking_cutout<ClockingPolicy, std::void_t<decltype(ClockingPolicy::cutout)>> : std::true_type
+{};
+
+}  // namespace detail
+
+/**
+ * A variant of `clocked_layout` whose clocking is fixed at compile time via a policy from the `static_clocking`
+ * namespace. Regular policies compute clock numbers by a direct lookup in their `constexpr` cutout so that hot loops,
+ * e.g., in path finding or design rule checking, do not have to go through `std::function` dispatch. The irregular
+ * `static_clocking::open` policy stores clock numbers in a dense array over the layout bounds instead of a hash map.
+ *
+ * `static_clocked_layout` provides the same clocking interface as `clocked_layout` and can thus be used as a drop-in
+ * replacement, e.g., as the `ClockedLayout` parameter of `gate_level_layout`. Functions that would change the
+ * clocking scheme at runtime are only available with the irregular policy. `clocked_layout` remains the default
+ * clocked layout type throughout fiction.
+ *
+ * @tparam CoordinateLayout The coordinate layout type whose coordinates should be clocked.
+ * @tparam ClockingPolicy A clocking policy from the `static_clocking` namespace.
+ */
+template <typename CoordinateLayout, typename ClockingPolicy>
+class static_clocked_layout : public CoordinateLayout
+{
+  public:
+#pragma region Types and constructors
+
+    using clock_zone = typename CoordinateLayout::coordinate;
+
+    using clocking_scheme_t = clocking_scheme<clock_zone>;
+    using clock_number_t    = typename clocking_scheme_t::clock_number;
+
+    using degree_t = uint8_t;
+
+    using clocking_policy = ClockingPolicy;
+
+    static constexpr bool is_regular = detail::has_clocking_cutout<ClockingPolicy>::value;
+
+    struct static_clocked_layout_storage
+    {
+        /**
+         * Clock numbers of all clock zones within the layout bounds in row-major order with the layers outermost. Only
+         * used by irregular clocking policies.
+         */
+        std::vector<clock_number_t> clock_numbers{};
+    };
+
+    using base_type = static_clocked_layout;
+
+    using storage = std::shared_ptr<static_clocked_layout_storage>;
+
+    /**
+     * Standard constructor. Creates a clocked layout of the given aspect ratio that is clocked by `ClockingPolicy`.
+     *
+     * @param ar Highest possible position in the layout.
+     */
+    explicit static_clocked_layout(const typename CoordinateLayout::aspect_ratio& ar = {}) :
+            CoordinateLayout(ar),
+            strg{std::make_shared<static_clocked_layout_storage>()}
+    {
+        static_assert(is_coordinate_layout_v<CoordinateLayout>, "CoordinateLayout is not a coordinate layout type");
+
+        initialize_clock_numbers();
+    }
+    /**
+     * Standard constructor. Creates a clocked layout of the given aspect ratio. For regular policies, the given scheme
+     * is expected to be the type-erased counterpart of `ClockingPolicy`. For irregular policies, the clock numbers of
+     * the given scheme are evaluated and stored for all clock zones within the layout bounds.
+     *
+     * @param ar Highest possible position in the layout.
+     * @param scheme Clocking scheme to apply to this layout.
+     */
+    static_clocked_layout(const typename CoordinateLayout::aspect_ratio& ar,
+                          [[maybe_unused]] const clocking_scheme_t& scheme) :
+            static_clocked_layout(ar)
+    {
+        if constexpr (!is_regular)
+        {
+            replace_clocking_scheme(scheme);
+        }
+        else
+        {
+            assert(scheme == std::string{ClockingPolicy::name} && "scheme does not match the clocking policy");
+        }
+    }
+    /**
+     * Copy constructor from another layout's storage.
+     *
+     * @param s Storage of another static_clocked_layout.
+     */
+    explicit static_clocked_layout(std::shared_ptr<static_clocked_layout_storage> s) : strg{std::move(s)}
+    {
+        static_assert(is_coordinate_layout_v<CoordinateLayout>, "CoordinateLayout is not a coordinate layout type");
+    }
+    /**
+     * Copy constructor from another `CoordinateLayout`.
+     *
+     * @param lyt Coordinate layout.
+     */
+    explicit static_clocked_layout(const CoordinateLayout& lyt) :
+            CoordinateLayout(lyt),
+            strg{std::make_shared<static_clocked_layout_storage>()}
+    {
+        static_assert(is_coordinate_layout_v<CoordinateLayout>, "CoordinateLayout is not a coordinate layout type");
+
+        initialize_clock_numbers();
+    }
+    /**
+     * Clones the layout returning a deep copy.
+     *
+     * @return Deep copy of the layout.
+     */
+    [[nodiscard]] static_clocked_layout clone() const noexcept
+    {
+        auto copy = static_clocked_layout(CoordinateLayout::clone());
+        copy.strg = std::make_shared<static_clocked_layout_storage>(*strg);
+
+        return copy;
+    }
+
+#pragma endregion
+
+#pragma region Structural properties
+    /**
+     * Updates the layout's dimensions, effectively resizing it. For irregular policies, the clock numbers of all clock
+     * zones that are located within both the old and the new bounds are preserved.
+     *
+     * @param ar New aspect ratio.
+     */
+    void resize(const typename CoordinateLayout::aspect_ratio& ar) noexcept
+    {
+        if constexpr (is_regular)
+        {
+            CoordinateLayout::resize(ar);
+        }
+        else
+        {
+            const auto old_layout = CoordinateLayout::clone();
+            const auto old_clocks = std::move(strg->clock_numbers);
+
+            CoordinateLayout::resize(ar);
+            initialize_clock_numbers();
+
+            old_layout.foreach_coordinate(
+                [this, &old_layout, &old_clocks](const auto& cz)
+                {
+                    if (CoordinateLayout::is_within_bounds(cz))
+                    {
+                        strg->clock_numbers[index(cz)] = old_clocks[index(old_layout, cz)];
+                    }
+                });
+        }
+    }
+
+#pragma endregion
+
+#pragma region Clocking
+    /**
+     * Replaces the stored clock numbers with the ones of the provided scheme for all clock zones within the layout
+     * bounds. Only available for irregular policies.
+     *
+     * @param scheme New clocking scheme.
+     */
+    template <bool Regular = is_regular, std::enable_if_t<!Regular, bool> = true>
+    void replace_clocking_scheme(const clocking_scheme_t& scheme) noexcept
+    {
+        CoordinateLayout::foreach_coordinate(
+            [this, &scheme](const auto& cz)
+            { strg->clock_numbers[index(cz)] = static_cast<clock_number_t>(scheme(cz) % num_clocks()); });
+    }
+    /**
+     * Overrides a clock number. Only available for irregular policies. Clock zones outside the layout bounds are
+     * ignored.
+     *
+     * @param cz Clock zone to override.
+     * @param cn New clock number for `cz`.
+     */
+    template <bool Regular = is_regular, std::enable_if_t<!Regular, bool> = true>
+    void assign_clock_number(const clock_zone& cz, const clock_number_t cn) noexcept
+    {
+        if (CoordinateLayout::is_within_bounds(cz))
+        {
+            strg->clock_numbers[index(cz)] = static_cast<clock_number_t>(cn % num_clocks());
+        }
+    }
+    /**
+     * Returns the clock number for the given clock zone.
+     *
+     * @param cz Clock zone.
+     * @return Clock number of `cz`.
+     */
+    [[nodiscard]] clock_number_t get_clock_number(const clock_zone& cz) const noexcept
+    {
+        if constexpr (is_regular)
+        {
+            constexpr auto height = ClockingPolicy::cutout.size();
+            constexpr auto width  = ClockingPolicy::cutout[0].size();
+
+            return ClockingPolicy::cutout[static_cast<std::size_t>(cz.y) % height]
+                                         [static_cast<std::size_t>(cz.x) % width];
+        }
+        else
+        {
+            if (!CoordinateLayout::is_within_bounds(cz))
+            {
+                return clock_number_t{0};
+            }
+
+            return strg->clock_numbers[index(cz)];
+        }
+    }
+    /**
+     * Returns the number of clock phases in the layout.
+     *
+     * @return The number of different clock signals in the layout.
+     */
+    [[nodiscard]] static constexpr clock_number_t num_clocks() noexcept
+    {
+        return ClockingPolicy::num_clocks;
+    }
+    /**
+     * Returns whether the layout is clocked by a regular clocking scheme.
+     *
+     * @return `true` iff `ClockingPolicy` is regular.
+     */
+    [[nodiscard]] static constexpr bool is_regularly_clocked() noexcept
+    {
+        return is_regular;
+    }
+    /**
+     * Compares the name of `ClockingPolicy` against the provided one.
+     *
+     * @param name Clocking scheme name.
+     * @return `true` iff the layout is clocked by a clocking scheme of name `name`.
+     */
+    [[nodiscard]] static constexpr bool is_clocking_scheme(const std::string_view& name) noexcept
+    {
+        return ClockingPolicy::name == name;
+    }
+    /**
+     * Returns a type-erased clocking scheme object that is equivalent to `ClockingPolicy`. For irregular policies, all
+     * clock zones within the layout bounds are overridden with their stored clock numbers.
+     *
+     * @return A clocking scheme object that is equivalent to the layout's clocking.
+     */
+    [[nodiscard]] clocking_scheme_t get_clocking_scheme() const noexcept
+    {
+        if constexpr (is_regular)
+        {
+            static const clocking_scheme_t scheme{
+                ClockingPolicy::name,
+                [](const clock_zone& cz) noexcept
+                {
+                    return ClockingPolicy::cutout[static_cast<std::size_t>(cz.y) % ClockingPolicy::cutout.size()]
+                                                 [static_cast<std::size_t>(cz.x) % ClockingPolicy::cutout[0].size()];
+                },
+                static_cast<typename clocking_scheme_t::degree>(
+                    std::min(CoordinateLayout::max_fanin_size, static_cast<unsigned>(ClockingPolicy::max_in_degree))),
+                ClockingPolicy::max_out_degree, ClockingPolicy::num_clocks, true};
+
+            return scheme;
+        }
+        else
+        {
+            auto scheme = open_clocking<static_clocked_layout>(num_clocks() == 3u ? num_clks::THREE : num_clks::FOUR);
+
+            CoordinateLayout::foreach_coordinate([this, &scheme](const auto& cz)
+                                                 { scheme.override_clock_number(cz, get_clock_number(cz)); });
+
+            return scheme;
+        }
+    }
+    /**
+     * Evaluates whether clock zone `cz2` feeds information to clock zone `cz1`, i.e., whether `cz2` is clocked with a
+     * clock number that is lower by 1 modulo `num_clocks()`.
+     *
+     * @param cz1 Base clock zone.
+     * @param cz2 Clock zone to check whether its clock number is lower by 1.
+     * @return `true` iff `cz2` can feed information to `cz1`.
+     */
+    [[nodiscard]] bool is_incoming_clocked(const clock_zone& cz1, const clock_zone& cz2) const noexcept
+    {
+        if (cz1 == cz2)
+        {
+            return false;
+        }
+
+        return static_cast<clock_number_t>((get_clock_number(cz2) + static_cast<clock_number_t>(1)) % num_clocks()) ==
+               get_clock_number(cz1);
+    }
+    /**
+     * Evaluates whether clock zone `cz2` accepts information from clock zone `cz1`, i.e., whether `cz2` is clocked with
+     * a clock number that is higher by 1 modulo `num_clocks()`.
+     *
+     * @param cz1 Base clock zone.
+     * @param cz2 Clock zone to check whether its clock number is higher by 1.
+     * @return `true` iff `cz2` can accept information from `cz1`.
+     */
+    [[nodiscard]] bool is_outgoing_clocked(const clock_zone& cz1, const clock_zone& cz2) const noexcept
+    {
+        if (cz1 == cz2)
+        {
+            return false;
+        }
+
+        return static_cast<clock_number_t>((get_clock_number(cz1) + static_cast<clock_number_t>(1)) % num_clocks()) ==
+               get_clock_number(cz2);
+    }
+
+#pragma endregion
+
+#pragma region Iteration
+    /**
+     * Returns a container with all clock zones that are incoming to the given one.
+     *
+     * @param cz Base clock zone.
+     * @return A container with all clock zones that are incoming to `cz`.
+     */
+    [[nodiscard]] auto incoming_clocked_zones(const clock_zone& cz) const noexcept
+    {
+        std::vector<clock_zone> incoming{};
+        incoming.reserve(CoordinateLayout::max_fanin_size + 1);  // reserve memory
+
+        foreach_incoming_clocked_zone(cz, [&incoming](const auto& ct) { incoming.push_back(ct); });
+
+        return incoming;
+    }
+    /**
+     * Applies a function to all incoming clock zones of a given one.
+     *
+     * @tparam Fn Functor type.
+     * @param cz Base clock zone.
+     * @param fn Functor to apply to each of `cz`'s incoming clock zones.
+     */
+    template <typename Fn>
+    void foreach_incoming_clocked_zone(const clock_zone& cz, Fn&& fn) const
+    {
+        CoordinateLayout::foreach_adjacent_coordinate(cz,
+                                                      [this, &cz, &fn](const auto& ct)
+                                                      {
+                                                          if (is_incoming_clocked(cz, ct))
+                                                          {
+                                                              std::invoke(std::forward<Fn>(fn), ct);
+                                                          }
+                                                      });
+    }
+    /**
+     * Returns a container with all clock zones that are outgoing from the given one.
+     *
+     * @param cz Base clock zone.
+     * @return A container with all clock zones that are outgoing from `cz`.
+     */
+    [[nodiscard]] auto outgoing_clocked_zones(const clock_zone& cz) const noexcept
+    {
+        std::vector<clock_zone> outgoing{};
+        outgoing.reserve(CoordinateLayout::max_fanin_size + 1);  // reserve memory
+
+        foreach_outgoing_clocked_zone(cz, [&outgoing](const auto& ct) { outgoing.push_back(ct); });
+
+        return outgoing;
+    }
+    /**
+     * Applies a function to all outgoing clock zones of a given one.
+     *
+     * @tparam Fn Functor type.
+     * @param cz Base clock zone.
+     * @param fn Functor to apply to each of `cz`'s outgoing clock zones.
+     */
+    template <typename Fn>
+    void foreach_outgoing_clocked_zone(const clock_zone& cz, Fn&& fn) const
+    {
+        CoordinateLayout::foreach_adjacent_coordinate(cz,
+                                                      [this, &cz, &fn](const auto& ct)
+                                                      {
+                                                          if (is_outgoing_clocked(cz, ct))
+                                                          {
+                                                              std::invoke(std::forward<Fn>(fn), ct);
+                                                          }
+                                                      });
+    }
+
+#pragma endregion
+
+#pragma region Structural properties
+    /**
+     * Returns the number of incoming clock zones to the given one.
+     *
+     * @param cz Base clock zone.
+     * @return Number of `cz`'s incoming clock zones.
+     */
+    [[nodiscard]] degree_t in_degree(const clock_zone& cz) const noexcept
+    {
+        degree_t idg{0};
+        foreach_incoming_clocked_zone(cz, [&idg](const auto&) { ++idg; });
+
+        return idg;
+    }
+    /**
+     * Returns the number of outgoing clock zones from the given one.
+     *
+     * @param cz Base clock zone.
+     * @return Number of `cz`'s outgoing clock zones.
+     */
+    [[nodiscard]] degree_t out_degree(const clock_zone& cz) const noexcept
+    {
+        degree_t odg{0};
+        foreach_outgoing_clocked_zone(cz, [&odg](const auto&) { ++odg; });
+
+        return odg;
+    }
+    /**
+     * Returns the number of incoming plus outgoing clock zones of the given one.
+     *
+     * @param cz Base clock zone.
+     * @return Number of `cz`'s incoming plus outgoing clock zones.
+     */
+    [[nodiscard]] degree_t degree(const clock_zone& cz) const noexcept
+    {
+        return static_cast<degree_t>(in_degree(cz) + out_degree(cz));
+    }
+
+#pragma endregion
+
+  private:
+    storage strg;
+    /**
+     * Computes the index of a clock zone within the bounds of the given layout in the dense clock number array.
+     *
+     * @param lyt Layout whose bounds determine the index.
+     * @param cz Clock zone within the bounds of `lyt`.
+     * @return Index of `cz`.
+     */
+    [[nodiscard]] static std::size_t index(const CoordinateLayout& lyt, const clock_zone& cz) noexcept
+    {
+        const auto width  = static_cast<std::size_t>(lyt.x()) + 1;
+        const auto height = static_cast<std::size_t>(lyt.y()) + 1;
+
+        return (static_cast<std::size_t>(cz.z) * height + static_cast<std::size_t>(cz.y)) * width +
+               static_cast<std::size_t>(cz.x);
+    }
+    /**
+     * Computes the index of a clock zone within the layout bounds in the dense clock number array.
+     *
+     * @param cz Clock zone within the layout bounds.
+     * @return Index of `cz`.
+     */
+    [[nodiscard]] std::size_t index(const clock_zone& cz) const noexcept
+    {
+        return index(*this, cz);
+    }
+    /**
+     * Allocates the dense clock number array for irregular policies. All clock zones are assigned clock number 0.
+     */
+    void initialize_clock_numbers() noexcept
+    {
+        if constexpr (!is_regular)
+        {
+            strg->clock_numbers.assign((static_cast<std::size_t>(CoordinateLayout::x()) + 1) *
+                                           (static_cast<std::size_t>(CoordinateLayout::y()) + 1) *
+                                           (static_cast<std::size_t>(CoordinateLayout::z()) + 1),
+                                       clock_number_t{0});
+        }
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_STATIC_CLOCKED_LAYOUT_HPP
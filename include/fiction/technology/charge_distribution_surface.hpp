@@ -13,6 +13,7 @@
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/profiling.hpp"
 
 #include <algorithm>
 #include <array>
@@ -198,13 +199,15 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
       private:
         /**
-         * The distance matrix is a vector of vectors storing the Euclidean distance in nm.
+         * The distance matrix is a square matrix stored contiguously in row-major order storing the Euclidean distance
+         * in nm.
          */
-        using distance_matrix = std::vector<std::vector<double>>;
+        using distance_matrix = std::vector<double>;
         /**
-         * The potential matrix is a vector of vectors storing the charge-less electrostatic potentials in Volt (V).
+         * The potential matrix is a square matrix stored contiguously in row-major order storing the charge-less
+         * electrostatic potentials in Volt (V).
          */
-        using potential_matrix = std::vector<std::vector<double>>;
+        using potential_matrix = std::vector<double>;
         /**
          * It is a vector that stores the local electrostatic potential in Volt (V).
          */
@@ -257,6 +260,10 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          * Electrostatic potential between SiDBs are stored as matrix (here, still charge-independent, unit: V).
          */
         potential_matrix pot_mat;
+        /**
+         * Number of rows (and columns) of the distance and the potential matrix.
+         */
+        uint64_t matrix_dimension{0};
         /**
          * External electrostatic potential in V at each SiDB position (can be used when different potentials are
          * applied to different SiDBs).
@@ -585,6 +592,176 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             this->charge_distribution_to_index();
         }
     }
+    /**
+     * This function changes the charge state of the SiDB at the given index and incrementally updates the local
+     * internal electrostatic potentials of all SiDBs as well as the system's electrostatic potential energy. While
+     * `update_after_charge_change` recomputes all local potentials in \f$\mathcal{O}(N^2)\f$ time, this update
+     * requires \f$\mathcal{O}(N)\f$ time only, where \f$N\f$ is the number of SiDBs. It is therefore suited for
+     * local search algorithms that change one charge state at a time. Neither the charge index nor the physical
+     * validity are updated.
+     *
+     * @note The local electrostatic potentials at defect positions are not updated.
+     *
+     * @param index The index of the SiDB whose charge state is to be changed.
+     * @param cs The new charge state of the SiDB.
+     */
+    void change_charge_state_by_index(const uint64_t index, const sidb_charge_state cs) noexcept
+    {
+        assert(index < strg->cell_charge.size() && "SiDB index out of range");
+
+        const auto charge_diff =
+            static_cast<double>(charge_state_to_sign(cs) - charge_state_to_sign(strg->cell_charge[index]));
+
+        if (charge_diff == 0.0)
+        {
+            return;
+        }
+
+        // the self-potential is zero, i.e., the local potential at the changed SiDB itself is not affected
+        strg->system_energy += charge_diff * (strg->local_int_pot[index] + strg->local_ext_pot[index]);
+
+        for (uint64_t j = 0u; j < strg->sidb_order.size(); ++j)
+        {
+            strg->local_int_pot[j] += strg->pot_mat[matrix_index(index, j)] * charge_diff;
+        }
+
+        strg->cell_charge[index] = cs;
+    }
+    /**
+     * This function moves an SiDB to an empty cell and incrementally updates the distance and potential matrices, the
+     * local electrostatic potentials of all SiDBs, and the system's electrostatic potential energy. While assigning
+     * cell types reinitializes the charge distribution surface in \f$\mathcal{O}(N^2)\f$ time, this update requires
+     * \f$\mathcal{O}(N)\f$ time only, where \f$N\f$ is the number of SiDBs. The moved SiDB keeps its cell type, its
+     * charge state, and its index. Hence, the order of SiDBs may differ from the one of a freshly constructed charge
+     * distribution surface. A local external potential that is stored for `from` is carried over to `to`. Neither the
+     * charge index nor the physical validity are updated.
+     *
+     * @note Cells that were determined by `is_three_state_simulation_required` are not updated.
+     *
+     * @param from Cell of the SiDB to move.
+     * @param to Empty cell to move the SiDB to.
+     */
+    void move_sidb(const typename Lyt::cell& from, const typename Lyt::cell& to) noexcept
+    {
+        const auto index = cell_to_index(from);
+
+        if (index == -1 || from == to)
+        {
+            return;
+        }
+
+        assert(Lyt::is_empty_cell(to) && "the target cell is not empty");
+
+        const auto k = static_cast<uint64_t>(index);
+
+        Lyt::assign_cell_type(to, Lyt::get_cell_type(from));
+        Lyt::assign_cell_type(from, technology<Lyt>::cell_type::EMPTY);
+
+        strg->sidb_order[k] = to;
+
+        if (strg->dependent_cell == from)
+        {
+            strg->dependent_cell = to;
+        }
+
+        if (const auto it = strg->local_external_potential_map.find(from);
+            it != strg->local_external_potential_map.cend())
+        {
+            strg->local_external_potential_map[to] += it->second;
+            strg->local_external_potential_map.erase(from);
+        }
+
+        if (strg->matrix_dimension != strg->sidb_order.size())
+        {
+            // the electrostatic properties were not computed, i.e., only charge locations are stored
+            return;
+        }
+
+        const auto moved_charge = static_cast<double>(charge_state_to_sign(strg->cell_charge[k]));
+
+        double local_potential_of_moved_sidb = 0.0;
+
+        for (uint64_t j = 0u; j < strg->sidb_order.size(); ++j)
+        {
+            if (j == k)
+            {
+                continue;
+            }
+
+            const auto distance = sidb_nm_distance<Lyt>(*this, to, strg->sidb_order[j]);
+
+            strg->nm_dist_mat[matrix_index(k, j)] = distance;
+            strg->nm_dist_mat[matrix_index(j, k)] = distance;
+
+            const auto potential      = calculate_chargeless_potential_between_sidbs_by_index(k, j);
+            const auto potential_diff = potential - strg->pot_mat[matrix_index(k, j)];
+
+            strg->pot_mat[matrix_index(k, j)] = potential;
+            strg->pot_mat[matrix_index(j, k)] = potential;
+
+            strg->local_int_pot[j] += potential_diff * moved_charge;
+
+            local_potential_of_moved_sidb +=
+                potential * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
+        }
+
+        double defect_potential_of_moved_sidb = 0.0;
+
+        for (const auto& [c, defect] : strg->defects)
+        {
+            defect_potential_of_moved_sidb +=
+                chargeless_potential_generated_by_defect_at_given_distance(sidb_nm_distance<Lyt>(*this, to, c),
+                                                                           defect) *
+                static_cast<double>(defect.charge);
+        }
+
+        strg->local_pot_caused_by_defects[k] = defect_potential_of_moved_sidb;
+        strg->local_int_pot[k]               = local_potential_of_moved_sidb + defect_potential_of_moved_sidb;
+
+        if (const auto it = strg->local_external_potential_map.find(to);
+            it != strg->local_external_potential_map.cend())
+        {
+            strg->local_ext_pot[k] = it->second;
+        }
+        else
+        {
+            strg->local_ext_pot[k] = 0.0;
+        }
+
+        determine_effective_charge_transition_thresholds();
+        recompute_electrostatic_potential_energy();
+    }
+    /**
+     * This function applies a change of SiDB positions, e.g., the change between two input patterns that is reported by
+     * `bdl_input_iterator`. Each removed SiDB is paired with an added one and moved via `move_sidb` in
+     * \f$\mathcal{O}(N)\f$ time. If the numbers of removed and added SiDBs differ, the surplus SiDBs are removed or
+     * added via `assign_cell_type`, which reinitializes the charge distribution surface.
+     *
+     * @param removed_sidbs Cells whose SiDBs are removed.
+     * @param added_sidbs Empty cells to which SiDBs are added.
+     * @param added_type Cell type of surplus added SiDBs. Moved SiDBs keep their cell type.
+     */
+    void apply_sidb_delta(const std::vector<typename Lyt::cell>& removed_sidbs,
+                          const std::vector<typename Lyt::cell>& added_sidbs,
+                          const typename Lyt::cell_type&         added_type) noexcept
+    {
+        const auto num_moves = std::min(removed_sidbs.size(), added_sidbs.size());
+
+        for (std::size_t i = 0; i < num_moves; ++i)
+        {
+            move_sidb(removed_sidbs[i], added_sidbs[i]);
+        }
+
+        for (std::size_t i = num_moves; i < removed_sidbs.size(); ++i)
+        {
+            assign_cell_type(removed_sidbs[i], technology<Lyt>::cell_type::EMPTY);
+        }
+
+        for (std::size_t i = num_moves; i < added_sidbs.size(); ++i)
+        {
+            assign_cell_type(added_sidbs[i], added_type);
+        }
+    }
     /**
      * This function assigns the charge state of all SiDBs in the layout to a given charge state.
      *
@@ -757,6 +934,18 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         return strg->cell_charge;
     }
+    /**
+     * This function returns a reference to the charge states of all placed SiDBs, which are stored contiguously in the
+     * order given by `get_sidb_order()`. In contrast to `get_all_sidb_charges`, no copy is created.
+     *
+     * @note The reference is invalidated if cells are assigned or the surface is copy-assigned.
+     *
+     * @return Reference to the vector of SiDB charge states.
+     */
+    [[nodiscard]] const std::vector<sidb_charge_state>& get_all_sidb_charges_ref() const noexcept
+    {
+        return strg->cell_charge;
+    }
     /**
      * This function can be used to detect which SiDBs must be negatively charged due to their location. Important:
      * This function must be applied to a charge layout where all SiDBs are negatively initialized.
@@ -794,7 +983,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->nm_dist_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return strg->nm_dist_mat[matrix_index(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2))];
         }
 
         return 0.0;
@@ -809,7 +998,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] double get_nm_distance_by_indices(const uint64_t index1, const uint64_t index2) const noexcept
     {
-        return strg->nm_dist_mat[index1][index2];
+        return strg->nm_dist_mat[matrix_index(index1, index2)];
     }
     /**
      * This function calculates and returns the chargeless electrostatic potential between two cells (SiDBs) in Volt
@@ -824,13 +1013,15 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         assert(strg->simulation_parameters.lambda_tf > 0.0 && "lambda_tf has to be > 0.0");
 
-        if (strg->nm_dist_mat[index1][index2] == 0.0)
+        const auto distance = strg->nm_dist_mat[matrix_index(index1, index2)];
+
+        if (distance == 0.0)
         {
             return 0.0;
         }
 
-        return (strg->simulation_parameters.k() / (strg->nm_dist_mat[index1][index2] * 1E-9) *
-                std::exp(-strg->nm_dist_mat[index1][index2] / strg->simulation_parameters.lambda_tf) *
+        return (strg->simulation_parameters.k() / (distance * 1E-9) *
+                std::exp(-distance / strg->simulation_parameters.lambda_tf) *
                 constants::physical::ELEMENTARY_CHARGE);
     }
     /**
@@ -864,7 +1055,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return strg->pot_mat[matrix_index(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2))];
         }
 
         return 0.0;
@@ -879,7 +1070,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] double get_chargeless_potential_by_indices(const uint64_t index1,
                                                              const uint64_t index2) const noexcept
     {
-        return strg->pot_mat[index1][index2];
+        return strg->pot_mat[matrix_index(index1, index2)];
     }
     /**
      * This function calculates and returns the electrostatic potential at one cell (`c1`) generated by another cell
@@ -897,7 +1088,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)] *
+            return strg->pot_mat[matrix_index(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2))] *
                    charge_state_to_sign(get_charge_state(c2));
         }
 
@@ -923,7 +1114,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                 double collect = 0.0;
                 for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                 {
-                    collect += strg->pot_mat[i][j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
+                    collect += strg->pot_mat[matrix_index(i, j)] *
+                               static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
                 }
 
                 strg->local_int_pot[i] += collect;
@@ -935,13 +1127,12 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             {
                 if (strg->cell_history_gray_code.first != -1)
                 {
-                    const auto cell_charge = charge_state_to_sign(
-                        strg->cell_charge[static_cast<uint64_t>(strg->cell_history_gray_code.first)]);
-                    const auto charge_diff = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
+                    const auto changed_cell = static_cast<uint64_t>(strg->cell_history_gray_code.first);
+                    const auto cell_charge  = charge_state_to_sign(strg->cell_charge[changed_cell]);
+                    const auto charge_diff  = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
                     for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                     {
-                        const double pot_diff =
-                            strg->pot_mat[static_cast<uint64_t>(strg->cell_history_gray_code.first)][j] * charge_diff;
+                        const double pot_diff = strg->pot_mat[matrix_index(changed_cell, j)] * charge_diff;
                         strg->local_int_pot[j] += pot_diff;
                     }
                 }
@@ -953,7 +1144,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                     for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
                     {
                         const double pot_diff =
-                            strg->pot_mat[changed_cell][j] *
+                            strg->pot_mat[matrix_index(changed_cell, j)] *
                             (static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge);
                         strg->local_int_pot[j] += pot_diff;
                     }
@@ -967,7 +1158,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void update_local_external_potential() noexcept
     {
-        strg->local_ext_pot = std::vector<double>(this->num_cells(), 0.0);
+        strg->local_ext_pot.assign(this->num_cells(), 0.0);
         strg->local_ext_pot_at_defect.clear();
 
         for (const auto& [c, external_pot] : strg->local_external_potential_map)
@@ -1260,7 +1451,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             [this](const uint64_t c1, const uint64_t c2)  // energy change when charge hops between two SiDBs.
         {
             return strg->local_ext_pot[c1] - strg->local_ext_pot[c2] +
-                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat[c1][c2]));
+                   (0.5 * (strg->local_int_pot[c1] - strg->local_int_pot[c2] - strg->pot_mat[matrix_index(c1, c2)]));
         };
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
@@ -1295,6 +1486,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void validity_check() noexcept
     {
+        FICTION_PROFILE_SCOPE("charge_distribution_surface::validity_check");
+
         // this for-loop checks if the "population stability" is fulfilled.
         for (uint64_t i = 0; i < strg->sidb_order.size(); ++i)
         {
@@ -1592,7 +1785,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         strg->system_energy += -strg->local_int_pot[random_element];
 
-        for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
+        for (uint64_t i = 0u; i < strg->matrix_dimension; ++i)
         {
             strg->local_int_pot[i] += -this->get_chargeless_potential_by_indices(i, random_element);
         }
@@ -1907,6 +2100,46 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         return strg->local_pot_caused_by_defects;
     }
+    /**
+     * This function returns a reference to the local internal electrostatic potentials, i.e., the potentials generated
+     * by charged SiDBs and defects, at each SiDB in the order given by `get_sidb_order()` (unit: V). No copy is
+     * created.
+     *
+     * @note The reference is invalidated if cells are assigned or the surface is copy-assigned.
+     *
+     * @return Reference to the vector of local internal electrostatic potentials.
+     */
+    [[nodiscard]] const std::vector<double>& get_local_internal_potentials() const noexcept
+    {
+        return strg->local_int_pot;
+    }
+    /**
+     * This function returns a reference to the local external electrostatic potentials at each SiDB in the order given
+     * by `get_sidb_order()` (unit: V). No copy is created.
+     *
+     * @note The reference is invalidated if cells are assigned or the surface is copy-assigned.
+     *
+     * @return Reference to the vector of local external electrostatic potentials.
+     */
+    [[nodiscard]] const std::vector<double>& get_local_external_potentials() const noexcept
+    {
+        return strg->local_ext_pot;
+    }
+    /**
+     * This function returns a reference to the matrix of chargeless electrostatic potentials between all pairs of SiDBs
+     * (unit: V). The matrix has one row and one column per SiDB in the order given by `get_sidb_order()` and is stored
+     * contiguously in row-major order, i.e., the potential between the SiDBs with indices `i` and `j` is located at
+     * position `i * num_cells() + j`. No copy is created.
+     *
+     * @note The matrix is empty if the surface was initialized with `cds_configuration::CHARGE_LOCATION_ONLY`. The
+     * reference is invalidated if cells are assigned or the surface is copy-assigned.
+     *
+     * @return Reference to the row-major chargeless potential matrix.
+     */
+    [[nodiscard]] const std::vector<double>& get_chargeless_potential_matrix() const noexcept
+    {
+        return strg->pot_mat;
+    }
     /**
      * This function returns the defects.
      *
@@ -2265,19 +2498,35 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
     }
 
+    /**
+     * Returns the position of the entry in row `row` and column `column` of the row-major distance and potential
+     * matrices.
+     *
+     * @param row Row index.
+     * @param column Column index.
+     * @return Position of the matrix entry in the underlying contiguous storage.
+     */
+    [[nodiscard]] uint64_t matrix_index(const uint64_t row, const uint64_t column) const noexcept
+    {
+        return row * strg->matrix_dimension + column;
+    }
     /**
      * Initializes the distance matrix between all the cells of the layout.
      */
     void initialize_nm_distance_matrix() noexcept
     {
-        strg->nm_dist_mat =
-            std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
+        FICTION_PROFILE_SCOPE("charge_distribution_surface::initialize_nm_distance_matrix");
+
+        strg->matrix_dimension = this->num_cells();
+        // reuses the existing buffer if the number of SiDBs did not change
+        strg->nm_dist_mat.assign(strg->matrix_dimension * strg->matrix_dimension, 0.0);
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
         {
             for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
             {
-                strg->nm_dist_mat[i][j] = sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], strg->sidb_order[j]);
+                strg->nm_dist_mat[matrix_index(i, j)] =
+                    sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], strg->sidb_order[j]);
             }
         }
     }
@@ -2286,14 +2535,17 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void initialize_potential_matrix() noexcept
     {
-        strg->pot_mat =
-            std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
+        FICTION_PROFILE_SCOPE("charge_distribution_surface::initialize_potential_matrix");
+
+        strg->matrix_dimension = this->num_cells();
+        // reuses the existing buffer if the number of SiDBs did not change
+        strg->pot_mat.assign(strg->matrix_dimension * strg->matrix_dimension, 0.0);
 
         for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
         {
             for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
             {
-                strg->pot_mat[i][j] = calculate_chargeless_potential_between_sidbs_by_index(i, j);
+                strg->pot_mat[matrix_index(i, j)] = calculate_chargeless_potential_between_sidbs_by_index(i, j);
             }
         }
     }
@@ -0,0 +1,381 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_GATE_DESIGN_CACHE_HPP
+#define FICTION_GATE_DESIGN_CACHE_HPP
+
+#include <phmap.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace fiction
+{
+
+/**
+ * A thread-safe memo table for gate implementations that are designed on the fly, e.g., by
+ * `sidb_on_the_fly_gate_library`. Designing a gate is expensive, yet many tiles of a layout require the same Boolean
+ * function with the same ports in the same (possibly defective) environment. This cache stores the result of each
+ * design task under a canonical key that encodes all of these requirements such that repeated tasks can be answered by
+ * a lookup. Besides successful designs, the cache also records tasks for which no gate implementation exists.
+ *
+ * A cache may be shared by multiple threads and by multiple runs as long as the key identifies all parameters that
+ * affect the design result. If a directory is provided, each design result is additionally stored in a file of that
+ * directory such that it persists across program executions and can be shared between concurrently running processes.
+ * Persistence requires `Gate` to be a two-dimensional `std::array` of integral or enumeration values, which is the case
+ * for `fcn_gate`.
+ *
+ * @tparam Gate Gate implementation type, e.g., `fcn_gate`.
+ */
+template <typename Gate>
+class gate_design_cache
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty in-memory cache.
+     */
+    gate_design_cache() = default;
+    /**
+     * Constructor for a persistent cache. Design results that are stored in `dir` by previous runs are loaded on demand
+     * and new results are written to `dir`. The directory is created if it does not exist.
+     *
+     * @param dir Directory to store the design results in.
+     * @throws std::filesystem::filesystem_error if `dir` cannot be created.
+     */
+    explicit gate_design_cache(std::filesystem::path dir) : directory{std::move(dir)}
+    {
+        static_assert(is_persistable, "Gate is not a two-dimensional array of integral or enumeration values");
+
+        std::filesystem::create_directories(*directory);
+    }
+    /**
+     * Looks up the design result that is stored under `key`.
+     *
+     * @param key Canonical key of the design task.
+     * @return `std::nullopt` if no result is stored under `key`. Otherwise, the stored result, which is itself
+     * `std::nullopt` if the design task was found to be impossible.
+     */
+    [[nodiscard]] std::optional<std::optional<Gate>> find(const std::string& key) const
+    {
+        {
+            const std::lock_guard lock{mutex};
+
+            if (const auto it = entries.find(key); it != entries.cend())
+            {
+                ++hits;
+
+                return it->second;
+            }
+        }
+
+        if constexpr (is_persistable)
+        {
+            if (directory.has_value())
+            {
+                // the file is read without holding the lock to not block other threads during disk access
+                if (const auto loaded = load(key); loaded.has_value())
+                {
+                    ++hits;
+
+                    const std::lock_guard lock{mutex};
+
+                    // another thread might have stored a result in the meantime, which takes precedence
+                    return entries.try_emplace(key, *loaded).first->second;
+                }
+            }
+        }
+
+        ++misses;
+
+        return std::nullopt;
+    }
+    /**
+     * Stores the design result of a task under `key`. An existing result is kept, i.e., the first result that is
+     * stored for a key wins if multiple threads design the same gate concurrently. If the cache is persistent, new
+     * results are written to its directory as well. Failing to write a result does not affect the in-memory cache.
+     *
+     * @param key Canonical key of the design task.
+     * @param gate Designed gate implementation or `std::nullopt` if the design task is impossible.
+     */
+    void insert(const std::string& key, const std::optional<Gate>& gate)
+    {
+        bool inserted = false;
+
+        {
+            const std::lock_guard lock{mutex};
+
+            inserted = entries.try_emplace(key, gate).second;
+        }
+
+        if constexpr (is_persistable)
+        {
+            // the file is written without holding the lock to not block other threads during disk access
+            if (inserted && directory.has_value())
+            {
+                store(key, gate);
+            }
+        }
+    }
+    /**
+     * Returns the number of stored design results.
+     *
+     * @return Number of stored design results.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::lock_guard lock{mutex};
+
+        return entries.size();
+    }
+    /**
+     * Returns the directory in which design results are persisted.
+     *
+     * @return Directory of a persistent cache or `std::nullopt` if the cache is held in memory only.
+     */
+    [[nodiscard]] const std::optional<std::filesystem::path>& get_directory() const noexcept
+    {
+        return directory;
+    }
+    /**
+     * Removes all design results that are held in memory and resets the hit and miss counters. Files in the directory
+     * of a persistent cache are kept.
+     */
+    void clear()
+    {
+        const std::lock_guard lock{mutex};
+
+        entries.clear();
+        hits   = 0;
+        misses = 0;
+    }
+    /**
+     * Returns the number of lookups that were answered by a stored result.
+     *
+     * @return Number of cache hits.
+     */
+    [[nodiscard]] uint64_t num_hits() const noexcept
+    {
+        return hits;
+    }
+    /**
+     * Returns the number of lookups that found no stored result.
+     *
+     * @return Number of cache misses.
+     */
+    [[nodiscard]] uint64_t num_misses() const noexcept
+    {
+        return misses;
+    }
+
+  private:
+    /**
+     * Detects two-dimensional `std::array`s of integral or enumeration values.
+     */
+    template <typename T>
+    struct is_cell_array : std::false_type
+    {};
+
+    template <typename T, std::size_t X, std::size_t Y>
+    struct is_cell_array<std::array<std::array<T, X>, Y>>
+            : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T>>
+    {};
+    /**
+     * Whether design results of type `Gate` can be written to and read from files.
+     */
+    static constexpr bool is_persistable = is_cell_array<Gate>::value;
+    /**
+     * First line of each file. It identifies the file format and its version such that files of other formats are
+     * ignored. The version has to be incremented whenever the file format changes.
+     */
+    static constexpr const char* format_header = "fiction gate design cache v1";
+    /**
+     * File header of impossible design tasks.
+     */
+    static constexpr const char* impossible_header = "impossible";
+    /**
+     * File header of designed gates.
+     */
+    static constexpr const char* gate_header = "gate";
+    /**
+     * Directory of a persistent cache.
+     */
+    std::optional<std::filesystem::path> directory{};
+    /**
+     * Stored design results by their canonical keys. Lookups in a persistent cache add results that are loaded from
+     * the directory.
+     */
+    mutable phmap::flat_hash_map<std::string, std::optional<Gate>> entries{};
+    /**
+     * Mutex that protects `entries`.
+     */
+    mutable std::mutex mutex{};
+    /**
+     * Number of cache hits.
+     */
+    mutable std::atomic<uint64_t> hits{0};
+    /**
+     * Number of cache misses.
+     */
+    mutable std::atomic<uint64_t> misses{0};
+    /**
+     * Computes the path of the file that stores the design result of `key`. Keys are hashed via 64-bit FNV-1a, which,
+     * unlike `std::hash`, is stable across platforms and program executions.
+     *
+     * @param key Canonical key of the design task.
+     * @return Path of the file that belongs to `key`.
+     */
+    [[nodiscard]] std::filesystem::path file_of(const std::string& key) const
+    {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (const auto c : key)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        std::ostringstream name{};
+        name << std::hex << hash << ".gate";
+
+        return *directory / name.str();
+    }
+    /**
+     * Reads the design result of `key` from the directory. Each file starts with the format header, followed by the
+     * full key to detect hash collisions, a header, and the rows of the gate as space-separated cell values. Files of
+     * other formats or versions are ignored.
+     *
+     * @param key Canonical key of the design task.
+     * @return The stored design result or `std::nullopt` if there is no valid file for `key`.
+     */
+    [[nodiscard]] std::optional<std::optional<Gate>> load(const std::string& key) const
+    {
+        std::ifstream is{file_of(key)};
+
+        if (!is.is_open())
+        {
+            return std::nullopt;
+        }
+
+        std::string format{};
+        std::string stored_key{};
+        std::string header{};
+
+        if (!std::getline(is, format) || format != format_header || !std::getline(is, stored_key) ||
+            stored_key != key || !std::getline(is, header))
+        {
+            return std::nullopt;
+        }
+
+        if (header == impossible_header)
+        {
+            return std::optional<Gate>{std::nullopt};
+        }
+
+        if (header != gate_header)
+        {
+            return std::nullopt;
+        }
+
+        Gate gate{};
+
+        for (auto& row : gate)
+        {
+            for (auto& value : row)
+            {
+                int64_t v{};
+
+                if (!(is >> v))
+                {
+                    return std::nullopt;
+                }
+
+                value = static_cast<std::decay_t<decltype(value)>>(v);
+            }
+        }
+
+        return std::optional<Gate>{gate};
+    }
+    /**
+     * Writes the design result of `key` to the directory. The file is written under a temporary name first and renamed
+     * afterward such that concurrent readers never observe partially written files. Temporary names carry a random
+     * suffix since multiple threads and processes may store the same result concurrently.
+     *
+     * @param key Canonical key of the design task.
+     * @param gate Designed gate implementation or `std::nullopt` if the design task is impossible.
+     */
+    void store(const std::string& key, const std::optional<Gate>& gate) const
+    {
+        const auto file = file_of(key);
+
+        std::random_device rd{};
+
+        std::ostringstream tmp_name{};
+        tmp_name << file.filename().string() << '.' << std::hex << rd() << rd() << ".tmp";
+
+        const auto tmp_file = *directory / tmp_name.str();
+
+        std::error_code ec{};
+
+        {
+            std::ofstream os{tmp_file, std::ofstream::out | std::ofstream::trunc};
+
+            if (!os.is_open())
+            {
+                return;
+            }
+
+            os << format_header << '\n' << key << '\n';
+
+            if (!gate.has_value())
+            {
+                os << impossible_header << '\n';
+            }
+            else
+            {
+                os << gate_header << '\n';
+
+                for (const auto& row : *gate)
+                {
+                    for (const auto& value : row)
+                    {
+                        os << static_cast<int64_t>(value) << ' ';
+                    }
+
+                    os << '\n';
+                }
+            }
+
+            if (!os.good())
+            {
+                os.close();
+                std::filesystem::remove(tmp_file, ec);
+
+                return;
+            }
+        }
+
+        std::filesystem::rename(tmp_file, file, ec);
+
+        if (ec)
+        {
+            std::filesystem::remove(tmp_file, ec);
+        }
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_GATE_DESIGN_CACHE_HPP
@@ -11,6 +11,7 @@
 #include "fiction/technology/cell_ports.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/fcn_gate_library.hpp"
+#include "fiction/technology/gate_design_cache.hpp"
 #include "fiction/technology/is_sidb_gate_design_impossible.hpp"
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/traits.hpp"
@@ -18,15 +19,20 @@
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
 
+#include <fmt/format.h>
+#include <kitty/print.hpp>
 #include <phmap.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -95,6 +101,10 @@ class gate_design_exception : public std::exception
     const port_list<port_direction> p;
 };
 
+/**
+ * Cache of SiDB gates that are designed on-the-fly. It can be kept in memory or persisted in a directory.
+ */
+using sidb_gate_design_cache = gate_design_cache<fcn_gate_library<sidb_technology, 60, 46>::fcn_gate>;
 /**
  * This struct encapsulates parameters for the parameterized SiDB gate library.
  *
@@ -136,6 +146,13 @@ struct sidb_on_the_fly_gate_library_params
      * incorporated into the gate design.
      */
     double influence_radius_charged_defects = 15;  // (unit: nm)
+    /**
+     * Optional cache of designed gates. If set, gate design tasks with identical Boolean functions, skeletons (i.e.,
+     * ports), atomic defects relative to the tile, and design parameters are answered from the cache instead of being
+     * designed again. The cache can be shared between tiles, threads, and layouts. A cache that is constructed with a
+     * directory additionally persists the designed gates across program executions.
+     */
+    std::shared_ptr<sidb_gate_design_cache> design_cache{};
 };
 
 /**
@@ -147,6 +164,12 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
 {
   public:
     explicit sidb_on_the_fly_gate_library() = delete;
+    /**
+     * Version of the gate design process that is part of each design cache key. It has to be incremented whenever a
+     * change to this library or to `design_sidb_gates` alters the designed gates such that results that were persisted
+     * by previous versions are no longer served.
+     */
+    static constexpr uint32_t design_cache_version = 1;
     /**
      * Overrides the corresponding function in fcn_gate_library. Given a tile `t`, this function takes all necessary
      * information from the stored grid into account to design the correct fcn_gate representation for that tile. In
@@ -564,6 +587,74 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
 
         throw unsupported_gate_type_exception(t);
     }
+    /**
+     * Computes a canonical key for a gate design task that identifies the expected Boolean function, the skeleton's
+     * cells, which encode the ports, the atomic defects in the skeleton's coordinates, and all design parameters that
+     * affect the result, including the simulation, BDL detection, and operational analysis parameters. Keys are prefixed
+     * with `design_cache_version`. Two tasks with the same key yield the same gate implementation.
+     *
+     * @tparam LytSkeleton The cell-level layout of the skeleton.
+     * @tparam TT Truth table type.
+     * @param skeleton Skeleton with atomic defects if available.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param parameters Parameters for the SiDB gate design process.
+     * @return Canonical key of the design task.
+     */
+    template <typename LytSkeleton, typename TT>
+    [[nodiscard]] static std::string design_cache_key(const LytSkeleton& skeleton, const std::vector<TT>& spec,
+                                                      const design_sidb_gates_params<cell<LytSkeleton>>& parameters)
+    {
+        const auto& op_params  = parameters.operational_params;
+        const auto& sim_params = op_params.simulation_parameters;
+        const auto& bdl_params = op_params.input_bdl_iterator_params;
+
+        auto key = fmt::format("v{}|{};{};{};{};{}|", design_cache_version, static_cast<int>(parameters.design_mode),
+                               parameters.canvas.first, parameters.canvas.second, parameters.number_of_canvas_sidbs,
+                               static_cast<int>(parameters.termination_cond));
+
+        key += fmt::format("{};{};{};{};{};{};{}|", static_cast<int>(op_params.sim_engine),
+                           static_cast<int>(op_params.op_condition),
+                           static_cast<int>(op_params.strategy_to_analyze_operational_status), sim_params.epsilon_r,
+                           sim_params.lambda_tf, sim_params.mu_minus, sim_params.base);
+
+        key += fmt::format("{};{};{};{};{}|", bdl_params.bdl_wire_params.threshold_bdl_interdistance,
+                           bdl_params.bdl_wire_params.bdl_pairs_params.minimum_distance,
+                           bdl_params.bdl_wire_params.bdl_pairs_params.maximum_distance,
+                           static_cast<int>(bdl_params.input_bdl_config), static_cast<int>(bdl_params.input_order));
+
+        for (const auto& table : spec)
+        {
+            key += fmt::format("{};", kitty::to_hex(table));
+        }
+
+        // cells are sorted to be independent of the storage order
+        std::vector<std::pair<cell<LytSkeleton>, typename technology<LytSkeleton>::cell_type>> cells{};
+        cells.reserve(skeleton.num_cells());
+        skeleton.foreach_cell([&skeleton, &cells](const auto& c) { cells.emplace_back(c, skeleton.get_cell_type(c)); });
+        std::sort(cells.begin(), cells.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        key += '|';
+        for (const auto& [c, type] : cells)
+        {
+            key += fmt::format("{}{};", c, static_cast<int>(type));
+        }
+
+        if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
+        {
+            std::vector<std::pair<cell<LytSkeleton>, sidb_defect>> defects{};
+            skeleton.foreach_sidb_defect([&defects](const auto& cd) { defects.emplace_back(cd.first, cd.second); });
+            std::sort(defects.begin(), defects.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            key += '|';
+            for (const auto& [c, defect] : defects)
+            {
+                key += fmt::format("{}{},{},{},{};", c, static_cast<int>(defect.type), defect.charge, defect.epsilon_r,
+                                   defect.lambda_tf);
+            }
+        }
+
+        return key;
+    }
 
   private:
     /**
@@ -698,34 +789,46 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
         static_assert(has_sidb_technology_v<CellLyt>, "CellLyt is not an SiDB layout");
         static_assert(has_cube_coord_v<CellLyt>, "CellLyt is not based on cube coordinates");
 
-        const auto params = is_sidb_gate_design_impossible_params{
-            parameters.design_gate_params.operational_params.simulation_parameters};
+        // the identity is reported for complex gates whose multi-output functions cannot be expressed by a single tt
+        const auto error_tt = spec == create_crossing_wire_tt() || spec == create_double_wire_tt() ? create_id_tt() :
+                                                                                                    spec.front();
+
+        std::string cache_key{};
 
-        if (spec == create_crossing_wire_tt() || spec == create_double_wire_tt())
+        if (parameters.design_cache != nullptr)
         {
-            if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
+            cache_key = design_cache_key(skeleton, spec, parameters.design_gate_params);
+
+            if (const auto cached = parameters.design_cache->find(cache_key); cached.has_value())
             {
-                if (is_sidb_gate_design_impossible(skeleton, spec, params))
+                if (!cached->has_value())
                 {
-                    throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                    throw gate_design_exception<tt, GateLyt>(tile, error_tt, p);
                 }
-            }
 
-            const auto found_gate_layouts = design_sidb_gates(skeleton, spec, parameters.design_gate_params);
+                return **cached;
+            }
+        }
 
-            if (found_gate_layouts.empty())
+        // stores the design result in the cache if available
+        const auto memoize = [&parameters, &cache_key](const std::optional<fcn_gate>& gate)
+        {
+            if (parameters.design_cache != nullptr)
             {
-                throw gate_design_exception<tt, GateLyt>(tile, create_id_tt(), p);
+                parameters.design_cache->insert(cache_key, gate);
             }
-
-            return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
-        }
+        };
 
         if constexpr (is_sidb_defect_surface_v<LytSkeleton>)
         {
+            const auto params = is_sidb_gate_design_impossible_params{
+                parameters.design_gate_params.operational_params.simulation_parameters};
+
             if (is_sidb_gate_design_impossible(skeleton, spec, params))
             {
-                throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
+                memoize(std::nullopt);
+
+                throw gate_design_exception<tt, GateLyt>(tile, error_tt, p);
             }
         }
 
@@ -733,10 +836,16 @@ class sidb_on_the_fly_gate_library : public fcn_gate_library<sidb_technology, 60
 
         if (found_gate_layouts.empty())
         {
-            throw gate_design_exception<tt, GateLyt>(tile, spec.front(), p);
+            memoize(std::nullopt);
+
+            throw gate_design_exception<tt, GateLyt>(tile, error_tt, p);
         }
 
-        return cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
+        const auto gate = cell_list_to_gate<char>(cell_level_layout_to_list(found_gate_layouts.front()));
+
+        memoize(gate);
+
+        return gate;
     }
     /**
      * The function generates a layout where each cell is assigned a specific
@@ -929,6 +929,20 @@ template <class Lyt>
 inline constexpr bool has_is_empty_v = has_is_empty<Lyt>::value;
 #pragma endregion
 
+#pragma region has_reserve
+template <class Lyt, class = void>
+struct has_reserve : std::false_type
+{};
+
+template <class Lyt>
+struct has_reserve<Lyt, std::void_t<decltype(std::declval<Lyt>().reserve(std::declval<uint64_t>()))>>
+        : std::true_type
+{};
+
+template <class Lyt>
+inline constexpr bool has_reserve_v = has_reserve<Lyt>::value;
+#pragma endregion
+
 /**
  * Obstruction layout
  */
@@ -5,6 +5,15 @@
 #ifndef FICTION_EXECUTION_UTILS_HPP
 #define FICTION_EXECUTION_UTILS_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
 // if the library supports parallel algorithms and execution policies
 #if (__cpp_lib_parallel_algorithm || __cpp_lib_execution) && (!__GNUC__ || __GNUC__ > 9)  // GCC Version >= 9
 
@@ -60,4 +69,83 @@
 
 #endif
 
+namespace fiction::detail
+{
+
+/**
+ * Runs `task(i)` for all \f$i \in [0, \texttt{num_tasks})\f$ on at most `num_threads` threads. Tasks are distributed
+ * dynamically to balance differing runtimes.
+ *
+ * @param num_tasks Number of tasks.
+ * @param num_threads Maximum number of threads.
+ * @param task Function that executes the task with the given index.
+ */
+template <typename TaskFunc>
+void run_on_bounded_threads(const std::size_t num_tasks, const std::size_t num_threads, TaskFunc&& task)
+{
+    const auto num_workers = std::min(std::max(num_threads, std::size_t{1}), num_tasks);
+
+    if (num_workers <= 1)
+    {
+        for (std::size_t i = 0; i < num_tasks; ++i)
+        {
+            task(i);
+        }
+
+        return;
+    }
+
+    std::atomic<std::size_t> next_task{0};
+
+    const auto worker = [&next_task, &task, num_tasks]
+    {
+        for (auto i = next_task.fetch_add(1, std::memory_order_relaxed); i < num_tasks;
+             i      = next_task.fetch_add(1, std::memory_order_relaxed))
+        {
+            task(i);
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_workers);
+
+    for (std::size_t t = 0; t < num_workers; ++t)
+    {
+        threads.emplace_back(worker);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+/**
+ * Creates the random number generator of the task with index `stream`. Generators of different streams are
+ * independent of each other, which allows parallel tasks to draw reproducible random numbers regardless of the
+ * number of threads they are executed on.
+ *
+ * @param seed Base seed.
+ * @param stream Index of the random stream.
+ * @return A generator whose state is derived from both `seed` and `stream`.
+ */
+[[nodiscard]] inline std::mt19937_64 make_stream_generator(const uint64_t seed, const uint64_t stream) noexcept
+{
+    std::seed_seq seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32u), static_cast<uint32_t>(stream),
+                      static_cast<uint32_t>(stream >> 32u)};
+
+    return std::mt19937_64{seq};
+}
+/**
+ * Returns `seed` or a random one if none is provided.
+ *
+ * @param seed Optional base seed.
+ * @return Base seed.
+ */
+[[nodiscard]] inline uint64_t seed_or_random(const std::optional<uint64_t>& seed) noexcept
+{
+    return seed.value_or((static_cast<uint64_t>(std::random_device{}()) << 32u) | std::random_device{}());
+}
+
+}  // namespace fiction::detail
+
 #endif  // FICTION_EXECUTION_UTILS_HPP
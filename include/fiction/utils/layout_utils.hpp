@@ -12,9 +12,11 @@
 #include "fiction/technology/sidb_lattice.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
+#include "fiction/utils/hash.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -569,20 +571,21 @@ template <typename LytDest, typename LytSrc>
     }
 }
 /**
- * Generates a random coordinate within the region spanned by two given coordinates. The two given coordinates form the
- * top left corner and the bottom right corner of the spanned region.
+ * Generates a random coordinate within the region spanned by two given coordinates using the given random number
+ * generator. The two given coordinates form the top left corner and the bottom right corner of the spanned region.
  *
  * @tparam CoordinateType The coordinate implementation to be used.
+ * @tparam RandomEngine Type of the random number generator.
  * @param coordinate1 Top left Coordinate.
  * @param coordinate2 Bottom right Coordinate (coordinate order is not important, automatically swapped if
  * necessary).
+ * @param generator Random number generator to draw from.
  * @return Randomly generated coordinate.
  */
-template <typename CoordinateType>
-CoordinateType random_coordinate(CoordinateType coordinate1, CoordinateType coordinate2) noexcept
+template <typename CoordinateType, typename RandomEngine>
+CoordinateType random_coordinate(CoordinateType coordinate1, CoordinateType coordinate2,
+                                 RandomEngine& generator) noexcept
 {
-    static std::mt19937_64 generator(std::random_device{}());
-
     if (coordinate1 > coordinate2)
     {
         std::swap(coordinate1, coordinate2);
@@ -606,6 +609,26 @@ CoordinateType random_coordinate(CoordinateType coordinate1, CoordinateType coor
         return {dist_x(generator), dist_y(generator), dist_z(generator)};
     }
 }
+/**
+ * Generates a random coordinate within the region spanned by two given coordinates. The two given coordinates form the
+ * top left corner and the bottom right corner of the spanned region.
+ *
+ * @note This function draws from a random number generator that is shared by all threads. For concurrent use, call the
+ * overload that takes a random number generator with one generator per thread instead.
+ *
+ * @tparam CoordinateType The coordinate implementation to be used.
+ * @param coordinate1 Top left Coordinate.
+ * @param coordinate2 Bottom right Coordinate (coordinate order is not important, automatically swapped if
+ * necessary).
+ * @return Randomly generated coordinate.
+ */
+template <typename CoordinateType>
+CoordinateType random_coordinate(CoordinateType coordinate1, CoordinateType coordinate2) noexcept
+{
+    static std::mt19937_64 generator(std::random_device{}());
+
+    return random_coordinate(coordinate1, coordinate2, generator);
+}
 // data types cannot properly be converted to bit field types
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -803,6 +826,60 @@ template <typename Lyt>
 
     return true;
 }
+/**
+ * Computes a hash value of the given cell-level layout that does not depend on the order in which its cells were
+ * assigned. It covers the same properties as `are_cell_layouts_identical`, i.e., the positions and types of all cells,
+ * defects (if applicable), and charge states (if applicable). Hence, layouts that are identical have identical hash
+ * values, which allows to find identical layouts in large collections without pairwise comparisons.
+ *
+ * @note Different layouts can have identical hash values. Use `are_cell_layouts_identical` to confirm a match.
+ *
+ * @tparam Lyt The layout type. Must be a cell-level layout.
+ * @param lyt The layout to hash.
+ * @return Hash value of `lyt`.
+ */
+template <typename Lyt>
+[[nodiscard]] inline std::size_t canonical_cell_layout_hash(const Lyt& lyt) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+
+    std::vector<std::pair<cell<Lyt>, typename technology<Lyt>::cell_type>> cells{};
+    cells.reserve(lyt.num_cells());
+
+    lyt.foreach_cell([&lyt, &cells](const auto& c) { cells.emplace_back(c, lyt.get_cell_type(c)); });
+
+    std::sort(cells.begin(), cells.end());
+
+    std::size_t seed = cells.size();
+
+    for (const auto& [c, type] : cells)
+    {
+        hash_combine(seed, c, type);
+
+        if constexpr (is_charge_distribution_surface_v<Lyt>)
+        {
+            hash_combine(seed, lyt.get_charge_state(c));
+        }
+    }
+
+    if constexpr (is_sidb_defect_surface_v<Lyt>)
+    {
+        std::vector<std::pair<cell<Lyt>, sidb_defect>> defects{};
+        defects.reserve(lyt.num_defects());
+
+        lyt.foreach_sidb_defect([&defects](const auto& d) { defects.emplace_back(d.first, d.second); });
+
+        std::sort(defects.begin(), defects.end(),
+                  [](const auto& d1, const auto& d2) { return d1.first < d2.first; });
+
+        for (const auto& [c, defect] : defects)
+        {
+            hash_combine(seed, c, defect.type, defect.charge, defect.epsilon_r, defect.lambda_tf);
+        }
+    }
+
+    return seed;
+}
 
 }  // namespace fiction
 
@@ -5,12 +5,14 @@
 #ifndef FICTION_MATH_UTILS_HPP
 #define FICTION_MATH_UTILS_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <combinations.h>
@@ -195,6 +197,57 @@ cartesian_combinations(const std::vector<std::vector<VectorDataType>>& sets) noe
     return chi;
 }
 
+/**
+ * Computes the Wilson score interval of a binomial proportion, i.e., a confidence interval for the success probability
+ * of a random experiment that succeeded `successes` times in `trials` independent trials. Unlike the normal
+ * approximation, the interval never exceeds \f$[0, 1]\f$ and remains reliable for probabilities close to 0 or 1.
+ *
+ * @param successes Number of successful trials.
+ * @param trials Total number of trials.
+ * @param confidence_level Probability that the interval contains the true success probability, e.g., 0.95.
+ * @return Lower and upper bound of the confidence interval. If `trials` is 0, the interval is \f$[0, 1]\f$.
+ */
+[[nodiscard]] inline std::pair<double, double> wilson_score_interval(const uint64_t successes, const uint64_t trials,
+                                                                     const double confidence_level) noexcept
+{
+    if (trials == 0)
+    {
+        return {0.0, 1.0};
+    }
+
+    // determine the quantile z of the standard normal distribution with Phi(z) = 1 - (1 - confidence_level) / 2 via
+    // bisection, where Phi(z) = erfc(-z / sqrt(2)) / 2
+    const auto target = 1.0 - (1.0 - std::clamp(confidence_level, 0.0, 1.0)) / 2.0;
+
+    double low  = 0.0;
+    double high = 40.0;
+
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        const auto mid = (low + high) / 2.0;
+
+        if (std::erfc(-mid / std::sqrt(2.0)) / 2.0 < target)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    const auto z  = (low + high) / 2.0;
+    const auto n  = static_cast<double>(trials);
+    const auto p  = static_cast<double>(std::min(successes, trials)) / n;
+    const auto z2 = z * z;
+
+    const auto denominator = 1.0 + z2 / n;
+    const auto center      = (p + z2 / (2.0 * n)) / denominator;
+    const auto half_width  = z / denominator * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n));
+
+    return {std::max(0.0, center - half_width), std::min(1.0, center + half_width)};
+}
+
 }  // namespace fiction
 
 #endif  // FICTION_MATH_UTILS_HPP
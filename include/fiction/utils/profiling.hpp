@@ -0,0 +1,664 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_PROFILING_HPP
+#define FICTION_PROFILING_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Indicates whether the instrumentation macros `FICTION_PROFILE_SCOPE`, `FICTION_PROFILE_COUNT`, and
+ * `FICTION_PROFILE_VALUE` as well as `thread_idle_recorder` were compiled in. This is the case if `FICTION_PROFILING`
+ * is defined, which can be achieved via the CMake option `FICTION_PROFILING`. Otherwise, all instrumentation is
+ * removed at compile time and fiction's algorithms do not record any data. The recording functions of the `profiler`
+ * remain available for direct calls.
+ */
+#if defined(FICTION_PROFILING)
+inline constexpr bool profiling_compiled_in = true;
+#else
+inline constexpr bool profiling_compiled_in = false;
+#endif
+
+/**
+ * Parameters for the `profiler`.
+ */
+struct profiling_params
+{
+    /**
+     * Flag to indicate that, in addition to the aggregated statistics, every timed scope should be recorded as an
+     * individual event that can be exported in the Chrome trace event format.
+     */
+    bool record_trace{false};
+    /**
+     * Maximum number of trace events to record. Further events are dropped and counted to bound the memory
+     * consumption of long runs.
+     */
+    std::size_t max_trace_events{1'000'000ul};
+};
+
+/**
+ * A process-wide collector of instrumentation data, i.e., timers, counters, and histograms, that are recorded by the
+ * instrumentation macros in the hot paths of fiction's algorithms.
+ *
+ * Each thread records into its own buffer such that recording does not contend on a shared lock. The buffers are
+ * merged only when a summary or trace is exported. Profiling is disabled by default and has to be enabled via
+ * `enable`. While disabled, the instrumentation macros reduce to a single relaxed atomic load. Direct calls of
+ * `record_duration`, `increment`, and `record_value` record regardless of whether profiling is enabled.
+ *
+ * Names of timers, counters, and histograms have to be string literals or otherwise have static storage duration.
+ */
+class profiler
+{
+  public:
+    /**
+     * Clock used for all time measurements.
+     */
+    using clock = std::chrono::steady_clock;
+    /**
+     * Returns the process-wide profiler instance.
+     *
+     * @return The profiler.
+     */
+    [[nodiscard]] static profiler& instance() noexcept
+    {
+        static profiler p{};
+
+        return p;
+    }
+    /**
+     * Starts the collection of instrumentation data. Data that was collected before is kept. Call `reset` to discard
+     * it.
+     *
+     * @param ps Profiling parameters.
+     */
+    void enable(const profiling_params& ps = {}) noexcept
+    {
+        record_trace.store(ps.record_trace, std::memory_order_relaxed);
+        max_trace_events.store(ps.max_trace_events, std::memory_order_relaxed);
+        enabled.store(true, std::memory_order_release);
+    }
+    /**
+     * Stops the collection of instrumentation data. The collected data remains available for export.
+     */
+    void disable() noexcept
+    {
+        enabled.store(false, std::memory_order_release);
+    }
+    /**
+     * Checks whether instrumentation data is being collected.
+     *
+     * @return `true` iff profiling was compiled in and is enabled.
+     */
+    [[nodiscard]] bool is_enabled() const noexcept
+    {
+        return profiling_compiled_in && enabled.load(std::memory_order_relaxed);
+    }
+    /**
+     * Discards all collected data and restarts the trace clock.
+     */
+    void reset()
+    {
+        const std::lock_guard lock{buffers_mutex};
+
+        for (const auto& buffer : buffers)
+        {
+            const std::lock_guard buffer_lock{buffer->mutex};
+
+            buffer->timers.clear();
+            buffer->counters.clear();
+            buffer->histograms.clear();
+            buffer->events.clear();
+        }
+
+        num_trace_events.store(0, std::memory_order_relaxed);
+        num_dropped_trace_events.store(0, std::memory_order_relaxed);
+        epoch = clock::now();
+    }
+    /**
+     * Records the duration of a timed scope.
+     *
+     * @param name Name of the scope.
+     * @param start Point in time at which the scope was entered.
+     * @param end Point in time at which the scope was left.
+     */
+    void record_duration(const char* name, const clock::time_point start, const clock::time_point end)
+    {
+        auto& buffer = local_buffer();
+
+        const auto duration = std::chrono::duration<double>(end - start).count();
+
+        const std::lock_guard lock{buffer.mutex};
+
+        auto& timer = buffer.timers[name];
+        ++timer.count;
+        timer.total += duration;
+        timer.min = std::min(timer.min, duration);
+        timer.max = std::max(timer.max, duration);
+
+        if (record_trace.load(std::memory_order_relaxed))
+        {
+            if (num_trace_events.fetch_add(1, std::memory_order_relaxed) <
+                max_trace_events.load(std::memory_order_relaxed))
+            {
+                buffer.events.push_back({name, start, end});
+            }
+            else
+            {
+                num_dropped_trace_events.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    /**
+     * Increments a counter.
+     *
+     * @param name Name of the counter.
+     * @param value Value to add to the counter.
+     */
+    void increment(const char* name, const uint64_t value = 1)
+    {
+        auto& buffer = local_buffer();
+
+        const std::lock_guard lock{buffer.mutex};
+
+        buffer.counters[name] += value;
+    }
+    /**
+     * Adds a value to a histogram. Histograms use logarithmic buckets where bucket :math:`i > 0` holds all values in
+     * :math:`[2^{i-1}, 2^i)` and bucket :math:`0` holds all values smaller than :math:`1`. Infinite and NaN values are
+     * ignored.
+     *
+     * @param name Name of the histogram.
+     * @param value Value to add.
+     */
+    void record_value(const char* name, const double value)
+    {
+        // non-finite values cannot be assigned to a bucket
+        if (!std::isfinite(value))
+        {
+            return;
+        }
+
+        auto& buffer = local_buffer();
+
+        const std::lock_guard lock{buffer.mutex};
+
+        buffer.histograms[name].add(value);
+    }
+    /**
+     * Returns the aggregated data of all threads as a JSON object with the keys `timers`, `counters`, and
+     * `histograms`. Each entry is keyed by its name.
+     *
+     * @return Summary of the collected data.
+     */
+    [[nodiscard]] nlohmann::json summary() const
+    {
+        std::map<std::string, timer_statistics>     timers{};
+        std::map<std::string, uint64_t>             counters{};
+        std::map<std::string, histogram_statistics> histograms{};
+
+        {
+            const std::lock_guard lock{buffers_mutex};
+
+            for (const auto& buffer : buffers)
+            {
+                const std::lock_guard buffer_lock{buffer->mutex};
+
+                for (const auto& [name, timer] : buffer->timers)
+                {
+                    timers[name].merge(timer);
+                }
+                for (const auto& [name, counter] : buffer->counters)
+                {
+                    counters[name] += counter;
+                }
+                for (const auto& [name, histogram] : buffer->histograms)
+                {
+                    histograms[name].merge(histogram);
+                }
+            }
+        }
+
+        nlohmann::json result{{"timers", nlohmann::json::object()},
+                              {"counters", counters},
+                              {"histograms", nlohmann::json::object()},
+                              {"dropped trace events", num_dropped_trace_events.load(std::memory_order_relaxed)}};
+
+        for (const auto& [name, timer] : timers)
+        {
+            result["timers"][name] = {{"count", timer.count},
+                                      {"total in seconds", timer.total},
+                                      {"mean in seconds", timer.total / static_cast<double>(timer.count)},
+                                      {"min in seconds", timer.min},
+                                      {"max in seconds", timer.max}};
+        }
+
+        for (const auto& [name, histogram] : histograms)
+        {
+            auto buckets = nlohmann::json::array();
+
+            for (std::size_t i = 0; i < histogram.buckets.size(); ++i)
+            {
+                if (histogram.buckets[i] != 0)
+                {
+                    buckets.push_back({{"upper bound", std::ldexp(1.0, static_cast<int>(i))},
+                                       {"count", histogram.buckets[i]}});
+                }
+            }
+
+            result["histograms"][name] = {{"count", histogram.count},
+                                          {"sum", histogram.sum},
+                                          {"mean", histogram.sum / static_cast<double>(histogram.count)},
+                                          {"min", histogram.min},
+                                          {"max", histogram.max},
+                                          {"buckets", buckets}};
+        }
+
+        return result;
+    }
+    /**
+     * Returns all recorded trace events in the Chrome trace event format, which can be loaded into `chrome://tracing`
+     * or Perfetto. Trace events are only recorded if profiling was enabled with `profiling_params::record_trace`.
+     *
+     * @return Trace events as a JSON object.
+     */
+    [[nodiscard]] nlohmann::json chrome_trace() const
+    {
+        auto events = nlohmann::json::array();
+
+        const std::lock_guard lock{buffers_mutex};
+
+        for (const auto& buffer : buffers)
+        {
+            const std::lock_guard buffer_lock{buffer->mutex};
+
+            events.push_back({{"name", "thread_name"},
+                              {"ph", "M"},
+                              {"pid", 0},
+                              {"tid", buffer->thread_id},
+                              {"args", {{"name", "thread " + std::to_string(buffer->thread_id)}}}});
+
+            for (const auto& e : buffer->events)
+            {
+                events.push_back({{"name", e.name},
+                                  {"ph", "X"},
+                                  {"pid", 0},
+                                  {"tid", buffer->thread_id},
+                                  {"ts", std::chrono::duration<double, std::micro>(e.start - epoch).count()},
+                                  {"dur", std::chrono::duration<double, std::micro>(e.end - e.start).count()}});
+            }
+        }
+
+        return {{"traceEvents", events}, {"displayTimeUnit", "ms"}};
+    }
+    /**
+     * Writes the summary of the collected data to a JSON file.
+     *
+     * @param filename Name of the file to write.
+     * @throws std::ofstream::failure if the file could not be opened.
+     */
+    void write_summary(const std::string_view& filename) const
+    {
+        write_json(summary(), filename);
+    }
+    /**
+     * Writes the recorded trace events to a file in the Chrome trace event format.
+     *
+     * @param filename Name of the file to write.
+     * @throws std::ofstream::failure if the file could not be opened.
+     */
+    void write_chrome_trace(const std::string_view& filename) const
+    {
+        write_json(chrome_trace(), filename);
+    }
+
+  private:
+    /**
+     * Aggregated durations of a timed scope in seconds.
+     */
+    struct timer_statistics
+    {
+        uint64_t count{0};
+        double   total{0.0};
+        double   min{std::numeric_limits<double>::infinity()};
+        double   max{0.0};
+
+        void merge(const timer_statistics& other) noexcept
+        {
+            count += other.count;
+            total += other.total;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+        }
+    };
+    /**
+     * Aggregated values of a histogram.
+     */
+    struct histogram_statistics
+    {
+        uint64_t                 count{0};
+        double                   sum{0.0};
+        double                   min{std::numeric_limits<double>::infinity()};
+        double                   max{-std::numeric_limits<double>::infinity()};
+        std::array<uint64_t, 64> buckets{};
+
+        void add(const double value) noexcept
+        {
+            ++count;
+            sum += value;
+            min = std::min(min, value);
+            max = std::max(max, value);
+
+            const auto bucket = value < 1.0 ? 0 : std::ilogb(value) + 1;
+            ++buckets[static_cast<std::size_t>(std::clamp(bucket, 0, static_cast<int>(buckets.size()) - 1))];
+        }
+
+        void merge(const histogram_statistics& other) noexcept
+        {
+            count += other.count;
+            sum += other.sum;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+
+            for (std::size_t i = 0; i < buckets.size(); ++i)
+            {
+                buckets[i] += other.buckets[i];
+            }
+        }
+    };
+    /**
+     * A single timed scope.
+     */
+    struct trace_event
+    {
+        const char*       name;
+        clock::time_point start;
+        clock::time_point end;
+    };
+    /**
+     * Data recorded by a single thread. The mutex is only contended while data is being exported.
+     *
+     * Names are keyed by their address, which is cheaper than hashing the string and merges identical literals of the
+     * same call site. Entries of equal names but different addresses are merged during export.
+     */
+    struct thread_buffer
+    {
+        explicit thread_buffer(const uint32_t id) noexcept : thread_id{id} {}
+
+        uint32_t                                                  thread_id;
+        mutable std::mutex                                        mutex{};
+        std::unordered_map<const char*, timer_statistics>         timers{};
+        std::unordered_map<const char*, uint64_t>                 counters{};
+        std::unordered_map<const char*, histogram_statistics>     histograms{};
+        std::vector<trace_event>                                  events{};
+    };
+    /**
+     * Hands a thread's buffer back to the profiler when the thread exits such that it can be reused by threads that
+     * are created later. This keeps the number of buffers bounded by the maximum number of concurrent threads instead
+     * of the total number of threads created during a run. The recorded data of the buffer is kept.
+     */
+    struct buffer_handle
+    {
+        thread_buffer* buffer{nullptr};
+
+        ~buffer_handle()
+        {
+            if (buffer != nullptr)
+            {
+                profiler::instance().release_buffer(buffer);
+            }
+        }
+    };
+
+    profiler() noexcept = default;
+
+    [[nodiscard]] thread_buffer& local_buffer()
+    {
+        thread_local buffer_handle handle{};
+
+        if (handle.buffer == nullptr)
+        {
+            handle.buffer = acquire_buffer();
+        }
+
+        return *handle.buffer;
+    }
+
+    [[nodiscard]] thread_buffer* acquire_buffer()
+    {
+        const std::lock_guard lock{buffers_mutex};
+
+        if (!free_buffers.empty())
+        {
+            auto* const buffer = free_buffers.back();
+            free_buffers.pop_back();
+
+            return buffer;
+        }
+
+        buffers.push_back(std::make_unique<thread_buffer>(static_cast<uint32_t>(buffers.size())));
+
+        return buffers.back().get();
+    }
+
+    void release_buffer(thread_buffer* buffer) noexcept
+    {
+        try
+        {
+            const std::lock_guard lock{buffers_mutex};
+
+            free_buffers.push_back(buffer);
+        }
+        catch (...)  // NOLINT(bugprone-empty-catch): the buffer is simply not reused
+        {}
+    }
+
+    static void write_json(const nlohmann::json& json, const std::string_view& filename)
+    {
+        std::ofstream os{filename.data(), std::ofstream::out};
+
+        if (!os.is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+
+        os << json.dump(4) << '\n';
+    }
+
+    std::atomic<bool>        enabled{false};
+    std::atomic<bool>        record_trace{false};
+    std::atomic<std::size_t> max_trace_events{1'000'000ul};
+    std::atomic<std::size_t> num_trace_events{0};
+    std::atomic<std::size_t> num_dropped_trace_events{0};
+
+    clock::time_point epoch{clock::now()};
+
+    mutable std::mutex                          buffers_mutex{};
+    std::vector<std::unique_ptr<thread_buffer>> buffers{};
+    std::vector<thread_buffer*>                 free_buffers{};
+};
+
+/**
+ * Measures the time between its construction and destruction and records it in the `profiler` under the given name.
+ * Use the `FICTION_PROFILE_SCOPE` macro instead of instantiating this class directly so that the measurement is
+ * compiled out if profiling is disabled.
+ */
+class scoped_timer
+{
+  public:
+    /**
+     * Standard constructor. Starts the measurement if profiling is enabled.
+     *
+     * @param n Name of the timed scope. Must have static storage duration.
+     */
+    explicit scoped_timer(const char* n) noexcept : name{n}, active{profiler::instance().is_enabled()}
+    {
+        if (active)
+        {
+            start = profiler::clock::now();
+        }
+    }
+    /**
+     * Destructor. Records the measurement.
+     */
+    ~scoped_timer()
+    {
+        if (active)
+        {
+            try
+            {
+                profiler::instance().record_duration(name, start, profiler::clock::now());
+            }
+            catch (...)  // NOLINT(bugprone-empty-catch): a failed measurement must not abort the algorithm
+            {}
+        }
+    }
+
+    scoped_timer(const scoped_timer&)            = delete;
+    scoped_timer& operator=(const scoped_timer&) = delete;
+    scoped_timer(scoped_timer&&)                 = delete;
+    scoped_timer& operator=(scoped_timer&&)      = delete;
+
+  private:
+    const char*                 name;
+    bool                        active;
+    profiler::clock::time_point start{};
+};
+
+/**
+ * Records the idle time of the worker threads of a thread pool, i.e., the time between a worker running out of work and
+ * all workers being joined. Each worker calls `worker_finished` as its last action and the spawning thread calls
+ * `threads_joined` after joining all workers. The idle time of each worker is added in milliseconds to the histogram of
+ * the given name and the sum of all idle times to the timer of the same name.
+ *
+ * All member functions are no-ops if profiling is not compiled in or not enabled.
+ */
+class thread_idle_recorder
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param n Name of the thread pool. Must have static storage duration.
+     */
+    explicit thread_idle_recorder(const char* n) noexcept : name{n} {}
+    /**
+     * Marks the calling worker as idle. Thread-safe.
+     */
+    void worker_finished() noexcept
+    {
+        if constexpr (profiling_compiled_in)
+        {
+            if (profiler::instance().is_enabled())
+            {
+                const auto now = profiler::clock::now();
+
+                try
+                {
+                    const std::lock_guard lock{mutex};
+                    finish_times.push_back(now);
+                }
+                catch (...)  // NOLINT(bugprone-empty-catch): a failed measurement must not abort the algorithm
+                {}
+            }
+        }
+    }
+    /**
+     * Records the idle times of all workers that have called `worker_finished`.
+     */
+    void threads_joined() noexcept
+    {
+        if constexpr (profiling_compiled_in)
+        {
+            if (!profiler::instance().is_enabled() || finish_times.empty())
+            {
+                return;
+            }
+
+            const auto now = profiler::clock::now();
+
+            auto& p = profiler::instance();
+
+            try
+            {
+                for (const auto& t : finish_times)
+                {
+                    p.record_value(name, std::chrono::duration<double, std::milli>(now - t).count());
+                    p.record_duration(name, t, now);
+                }
+            }
+            catch (...)  // NOLINT(bugprone-empty-catch): a failed measurement must not abort the algorithm
+            {}
+
+            finish_times.clear();
+        }
+    }
+
+  private:
+    const char*                              name;
+    std::mutex                               mutex{};
+    std::vector<profiler::clock::time_point> finish_times{};
+};
+
+}  // namespace fiction
+
+#if defined(FICTION_PROFILING)
+
+#define FICTION_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FICTION_PROFILE_CONCAT(a, b) FICTION_PROFILE_CONCAT_IMPL(a, b)
+/**
+ * Measures the runtime of the enclosing scope and records it in the `profiler` under the given name.
+ */
+#define FICTION_PROFILE_SCOPE(name)                                                                                    \
+    const fiction::scoped_timer FICTION_PROFILE_CONCAT(fiction_scoped_timer_, __LINE__)(name)
+/**
+ * Adds the given value to the counter of the given name in the `profiler`.
+ */
+#define FICTION_PROFILE_COUNT(name, value)                                                                             \
+    do {                                                                                                               \
+        if (auto& fiction_profiler = fiction::profiler::instance(); fiction_profiler.is_enabled())                     \
+        {                                                                                                              \
+            fiction_profiler.increment(name, value);                                                                   \
+        }                                                                                                              \
+    } while (false)
+/**
+ * Adds the given value to the histogram of the given name in the `profiler`.
+ */
+#define FICTION_PROFILE_VALUE(name, value)                                                                             \
+    do {                                                                                                               \
+        if (auto& fiction_profiler = fiction::profiler::instance(); fiction_profiler.is_enabled())                     \
+        {                                                                                                              \
+            fiction_profiler.record_value(name, static_cast<double>(value));                                           \
+        }                                                                                                              \
+    } while (false)
+
+#else
+
+#define FICTION_PROFILE_SCOPE(name) static_cast<void>(0)
+#define FICTION_PROFILE_COUNT(name, value) static_cast<void>(0)
+#define FICTION_PROFILE_VALUE(name, value) static_cast<void>(0)
+
+#endif
+
+#endif  // FICTION_PROFILING_HPP
@@ -9,7 +9,11 @@
 
 #include <mockturtle/traits.hpp>
 
+#include <phmap.h>
+
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <set>
 #include <vector>
@@ -122,6 +126,130 @@ class path_set : public std::set<Path>
     using base::base;
 };
 
+/**
+ * A set of coordinates of a given layout that is tailored to the visited sets of path finding algorithms. If `Lyt` uses
+ * `offset::ucoord_t` as its coordinate type, membership of coordinates within the layout bounds is stored in a bitset
+ * over their indices in row-major order with the layers outermost. This requires a single bit per coordinate and avoids
+ * hashing entirely. All other coordinates are stored in a hash set.
+ *
+ * @tparam Lyt Coordinate layout type.
+ */
+template <typename Lyt>
+class coordinate_set
+{
+  public:
+    /**
+     * Standard constructor. Allocates the bitset for the bounds of the given layout.
+     *
+     * @param lyt Layout whose coordinates are to be stored.
+     */
+    explicit coordinate_set(const Lyt& lyt) noexcept
+    {
+        if constexpr (is_dense)
+        {
+            width  = static_cast<uint64_t>(lyt.x()) + 1;
+            height = static_cast<uint64_t>(lyt.y()) + 1;
+            depth  = static_cast<uint64_t>(lyt.z()) + 1;
+
+            bits.resize(static_cast<std::size_t>(width * height * depth), false);
+        }
+    }
+    /**
+     * Adds the given coordinate to the set.
+     *
+     * @param c Coordinate to add.
+     */
+    void insert(const coordinate<Lyt>& c) noexcept
+    {
+        if constexpr (is_dense)
+        {
+            if (is_within_bitset(c))
+            {
+                bits[index(c)] = true;
+
+                return;
+            }
+        }
+
+        sparse.insert(c);
+    }
+    /**
+     * Removes the given coordinate from the set.
+     *
+     * @param c Coordinate to remove.
+     */
+    void erase(const coordinate<Lyt>& c) noexcept
+    {
+        if constexpr (is_dense)
+        {
+            if (is_within_bitset(c))
+            {
+                bits[index(c)] = false;
+
+                return;
+            }
+        }
+
+        sparse.erase(c);
+    }
+    /**
+     * Checks whether the given coordinate is contained in the set.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is contained in the set.
+     */
+    [[nodiscard]] bool contains(const coordinate<Lyt>& c) const noexcept
+    {
+        if constexpr (is_dense)
+        {
+            if (is_within_bitset(c))
+            {
+                return bits[index(c)];
+            }
+        }
+
+        return sparse.count(c) > 0;
+    }
+
+  private:
+    /**
+     * Offset coordinates can be mapped to consecutive indices.
+     */
+    static constexpr bool is_dense = is_offset_ucoord_v<coordinate<Lyt>>;
+    /**
+     * Extents of the bitset.
+     */
+    uint64_t width{0}, height{0}, depth{0};
+    /**
+     * Membership of all coordinates within the layout bounds.
+     */
+    std::vector<bool> bits{};
+    /**
+     * Coordinates that cannot be stored in the bitset.
+     */
+    phmap::flat_hash_set<coordinate<Lyt>> sparse{};
+    /**
+     * Checks whether the given coordinate can be stored in the bitset.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is not dead and lies within the layout bounds passed to the constructor.
+     */
+    [[nodiscard]] bool is_within_bitset(const coordinate<Lyt>& c) const noexcept
+    {
+        return !c.is_dead() && c.x < width && c.y < height && c.z < depth;
+    }
+    /**
+     * Computes the bitset index of the given coordinate.
+     *
+     * @param c Coordinate within the bitset.
+     * @return Index of `c` in `bits`.
+     */
+    [[nodiscard]] std::size_t index(const coordinate<Lyt>& c) const noexcept
+    {
+        return static_cast<std::size_t>((c.z * height + c.y) * width + c.x);
+    }
+};
+
 /**
  * Checks whether a given coordinate `successor` hosts a crossable wire when coming from coordinate `src` in a given
  * layout. A wire is said to be crossable if a potential cross-over would not result in running along the same
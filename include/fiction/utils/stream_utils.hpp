@@ -0,0 +1,99 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_STREAM_UTILS_HPP
+#define FICTION_STREAM_UTILS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <ios>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Renders the textual representations of the given items into an output stream while preserving their order. Items are
+ * processed in batches of `items_per_thread` items per thread. Each thread renders a contiguous slice of the current
+ * batch into a local buffer and the buffers are written to the stream in order before the next batch is rendered. Thus,
+ * the output is identical to a sequential rendering and the required memory is bounded by the batch size instead of the
+ * size of the entire output.
+ *
+ * Exceptions thrown by `render` are passed on to the caller. In this case, the items of all previous batches have
+ * already been written to `os`.
+ *
+ * @tparam T Item type.
+ * @tparam RenderFn Functor type that complies with the signature `void(const T&, std::string&)`. It must be safe to
+ * call concurrently for different items.
+ * @param os The output stream to write into.
+ * @param items The items to render in order.
+ * @param render Functor that appends the representation of an item to a buffer.
+ * @param num_threads Maximum number of threads to render with.
+ * @param items_per_thread Number of items that each thread renders per batch. Fewer items are rendered sequentially.
+ */
+template <typename T, typename RenderFn>
+void write_rendered_in_order(std::ostream& os, const std::vector<T>& items, RenderFn&& render,
+                             const std::size_t num_threads, const std::size_t items_per_thread = 4096ul)
+{
+    if (items.empty())
+    {
+        return;
+    }
+
+    const auto slice_size = std::max(items_per_thread, std::size_t{1});
+    const auto threads =
+        std::clamp(items.size() / slice_size, std::size_t{1}, std::max(num_threads, std::size_t{1}));
+
+    // renders the items in [start, end) into a local buffer
+    const auto render_slice = [&items, &render](const std::size_t start, const std::size_t end)
+    {
+        std::string buffer{};
+
+        for (auto i = start; i < end; ++i)
+        {
+            render(items[i], buffer);
+        }
+
+        return buffer;
+    };
+
+    const auto write_buffer = [&os](const std::string& buffer)
+    { os.write(buffer.data(), static_cast<std::streamsize>(buffer.size())); };
+
+    const auto batch_size = threads * slice_size;
+
+    for (std::size_t batch_start = 0; batch_start < items.size(); batch_start += batch_size)
+    {
+        const auto batch_end = std::min(batch_start + batch_size, items.size());
+
+        if (threads == 1)
+        {
+            write_buffer(render_slice(batch_start, batch_end));
+
+            continue;
+        }
+
+        std::vector<std::future<std::string>> futures{};
+        futures.reserve(threads);
+
+        for (auto start = batch_start; start < batch_end; start += slice_size)
+        {
+            futures.emplace_back(
+                std::async(std::launch::async, render_slice, start, std::min(start + slice_size, batch_end)));
+        }
+
+        // write the buffers in item order; exceptions thrown by render are passed through here
+        for (auto& f : futures)
+        {
+            write_buffer(f.get());
+        }
+    }
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_STREAM_UTILS_HPP
@@ -11,6 +11,7 @@
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/layouts/gate_level_layout.hpp>
 
+#include <cstddef>
 #include <vector>
 
 using namespace fiction;
@@ -253,3 +254,49 @@ TEST_CASE("EPG on 4x4 layouts with obstruction", "[generate-edge-intersection-gr
         }
     }
 }
+
+TEST_CASE("EPG generation is independent of the number of threads", "[generate-edge-intersection-graph]")
+{
+    using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    const gate_lyt layout{{4, 4}, twoddwave_clocking<gate_lyt>()};
+
+    const std::vector<routing_objective<gate_lyt>> objectives{
+        {{0, 0}, {3, 3}}, {{0, 1}, {4, 2}}, {{1, 0}, {2, 4}}, {{0, 0}, {3, 3}}, {{2, 0}, {4, 4}}};
+
+    const auto check_thread_independence = [&layout, &objectives](generate_edge_intersection_graph_params ps)
+    {
+        generate_edge_intersection_graph_stats st_seq{};
+        generate_edge_intersection_graph_stats st_par{};
+
+        ps.num_threads       = 1;
+        const auto graph_seq = generate_edge_intersection_graph(layout, objectives, ps, &st_seq);
+
+        ps.num_threads       = 4;
+        const auto graph_par = generate_edge_intersection_graph(layout, objectives, ps, &st_par);
+
+        CHECK(st_seq.cliques == st_par.cliques);
+        CHECK(st_seq.number_of_unroutable_objectives == st_par.number_of_unroutable_objectives);
+
+        REQUIRE(graph_seq.size_vertices() == graph_par.size_vertices());
+        CHECK(graph_seq.size_edges() == graph_par.size_edges());
+
+        for (std::size_t v = 0; v < graph_seq.size_vertices(); ++v)
+        {
+            CHECK(graph_seq.at_vertex(v) == graph_par.at_vertex(v));
+        }
+    };
+
+    SECTION("all paths without crossings")
+    {
+        check_thread_independence({false});
+    }
+    SECTION("all paths with crossings")
+    {
+        check_thread_independence({true});
+    }
+    SECTION("k shortest paths")
+    {
+        check_thread_independence({false, 5});
+    }
+}
@@ -153,6 +153,44 @@ void check_brian_crites_engine(const Graph& graph, const std::size_t expected_ch
     }
 }
 
+template <typename Graph>
+void check_portfolio_coloring_engine(const Graph& graph, const std::size_t expected_chromatic_number,
+                                     std::vector<typename Graph::vertex_id_type> clique = {})
+{
+    determine_vertex_coloring_params<Graph> ps{graph_coloring_engine::PORTFOLIO, {}, {}, true};
+    ps.sat_params.cliques = {{clique}};
+
+    determine_vertex_coloring_stats pst{};
+
+    SECTION("PORTFOLIO")
+    {
+        SECTION("default")
+        {
+            const auto coloring = determine_vertex_coloring(graph, ps, &pst);
+
+            check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
+        }
+        SECTION("single SAT worker")
+        {
+            ps.portfolio_params.num_threads = 1;
+
+            const auto coloring = determine_vertex_coloring(graph, ps, &pst);
+
+            check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
+        }
+        SECTION("SAT workers only")
+        {
+            ps.portfolio_params.heuristic_engines = {};
+            ps.portfolio_params.num_threads       = 4;
+            ps.portfolio_params.conflict_limit    = 10;
+
+            const auto coloring = determine_vertex_coloring(graph, ps, &pst);
+
+            check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
+        }
+    }
+}
+
 template <typename Graph>
 void check_coloring_engines(const Graph& graph, const std::size_t expected_chromatic_number,
                             std::vector<typename Graph::vertex_id_type> clique = {})
@@ -162,6 +200,7 @@ void check_coloring_engines(const Graph& graph, const std::size_t expected_chrom
     SECTION("with clique information")
     {
         check_sat_coloring_engine(graph, expected_chromatic_number, clique);
+        check_portfolio_coloring_engine(graph, expected_chromatic_number, clique);
     }
     SECTION("without clique information")
     {
@@ -169,6 +208,7 @@ void check_coloring_engines(const Graph& graph, const std::size_t expected_chrom
         if (graph.size_edges() < 30)
         {
             check_sat_coloring_engine(graph, expected_chromatic_number);
+            check_portfolio_coloring_engine(graph, expected_chromatic_number);
         }
     }
 }
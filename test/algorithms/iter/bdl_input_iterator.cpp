@@ -490,3 +490,117 @@ TEST_CASE("SiQAD's AND gate iteration", "[bdl-input-iterator]")
         }
     }
 }
+
+TEST_CASE("SiQAD's AND gate iteration in Gray code order", "[bdl-input-iterator]")
+{
+    const auto lyt = blueprints::siqad_and_gate<sidb_cell_clk_lyt_siqad>();
+
+    const sidb_100_cell_clk_lyt_siqad lat{lyt};
+
+    bdl_input_iterator_params params{};
+    params.input_order = bdl_input_iterator_params::input_pattern_order::GRAY_CODE;
+
+    bdl_input_iterator<sidb_100_cell_clk_lyt_siqad> bii{lat, params};
+
+    CHECK(bii.num_input_pairs() == 2);
+
+    for (auto i = 0; bii < 4; ++bii, ++i)
+    {
+        const auto& delta = bii.get_delta();
+
+        switch (i)
+        {
+            case 0:
+            {
+                CHECK(bii.get_current_input_index() == 0);
+
+                CHECK((*bii).get_cell_type({0, 0, 1}) == sidb_technology::cell_type::INPUT);
+                CHECK((*bii).get_cell_type({2, 1, 1}) == sidb_technology::cell_type::EMPTY);
+
+                CHECK((*bii).get_cell_type({20, 0, 1}) == sidb_technology::cell_type::INPUT);
+                CHECK((*bii).get_cell_type({18, 1, 1}) == sidb_technology::cell_type::EMPTY);
+
+                break;
+            }
+            case 1:
+            {
+                CHECK(bii.get_current_input_index() == 1);
+
+                REQUIRE(delta.removed_sidbs.size() == 1);
+                REQUIRE(delta.added_sidbs.size() == 1);
+
+                CHECK(delta.removed_sidbs.front() == siqad::coord_t{20, 0, 1});
+                CHECK(delta.added_sidbs.front() == siqad::coord_t{18, 1, 1});
+
+                break;
+            }
+            case 2:
+            {
+                // only the first input changes
+                CHECK(bii.get_current_input_index() == 3);
+
+                CHECK((*bii).get_cell_type({0, 0, 1}) == sidb_technology::cell_type::EMPTY);
+                CHECK((*bii).get_cell_type({2, 1, 1}) == sidb_technology::cell_type::INPUT);
+
+                CHECK((*bii).get_cell_type({20, 0, 1}) == sidb_technology::cell_type::EMPTY);
+                CHECK((*bii).get_cell_type({18, 1, 1}) == sidb_technology::cell_type::INPUT);
+
+                REQUIRE(delta.removed_sidbs.size() == 1);
+                REQUIRE(delta.added_sidbs.size() == 1);
+
+                CHECK(delta.removed_sidbs.front() == siqad::coord_t{0, 0, 1});
+                CHECK(delta.added_sidbs.front() == siqad::coord_t{2, 1, 1});
+
+                break;
+            }
+            case 3:
+            {
+                CHECK(bii.get_current_input_index() == 2);
+
+                REQUIRE(delta.removed_sidbs.size() == 1);
+                REQUIRE(delta.added_sidbs.size() == 1);
+
+                CHECK(delta.removed_sidbs.front() == siqad::coord_t{18, 1, 1});
+                CHECK(delta.added_sidbs.front() == siqad::coord_t{20, 0, 1});
+
+                break;
+            }
+            default:
+            {
+                CHECK(false);
+            }
+        }
+    }
+
+    SECTION("setting the same input state again does not change any SiDBs")
+    {
+        bii = 2;
+        bii = 2;
+
+        CHECK(bii.get_delta().removed_sidbs.empty());
+        CHECK(bii.get_delta().added_sidbs.empty());
+    }
+    SECTION("setting an input pattern selects the input state that applies it")
+    {
+        bii.set_input_pattern(2);
+
+        CHECK(bii == 3);
+        CHECK(bii.get_current_input_index() == 2);
+
+        CHECK((*bii).get_cell_type({0, 0, 1}) == sidb_technology::cell_type::EMPTY);
+        CHECK((*bii).get_cell_type({2, 1, 1}) == sidb_technology::cell_type::INPUT);
+
+        CHECK((*bii).get_cell_type({20, 0, 1}) == sidb_technology::cell_type::INPUT);
+        CHECK((*bii).get_cell_type({18, 1, 1}) == sidb_technology::cell_type::EMPTY);
+
+        bii.set_input_pattern(3);
+
+        CHECK(bii == 2);
+        CHECK(bii.get_current_input_index() == 3);
+
+        for (uint64_t state = 0; state < 4; ++state)
+        {
+            CHECK(bii.get_input_pattern_of_state(state) == (state ^ (state >> 1u)));
+        }
+    }
+}
@@ -10,8 +10,11 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <random>
+#include <vector>
 
 using namespace fiction;
 
@@ -230,3 +233,163 @@ TEST_CASE("Simulated Annealing for optimizing the 2D Drop-Wave function", "[sim-
                   << std::endl;
     }
 }
+
+/**
+ * This function implements a randomized initial state generator for the 1D Schwefel function that draws from the
+ * random stream of its annealing instance.
+ *
+ * @param generator Random number generator of the annealing instance.
+ * @return A random value in the range [-500, 500].
+ */
+double seeded_schwefel_1d_init_state_generator(simulated_annealing_generator& generator) noexcept
+{
+    return std::uniform_real_distribution<double>{-500.0, 500.0}(generator);
+}
+/**
+ * This function implements a randomized adjacent state generator for the 1D Schwefel function that draws from the
+ * random stream of its annealing instance.
+ *
+ * @param x The current state.
+ * @param generator Random number generator of the annealing instance.
+ * @return A randomized adjacent state.
+ */
+double seeded_random_next_schwefel(const double& x, simulated_annealing_generator& generator) noexcept
+{
+    return std::clamp(std::uniform_real_distribution<double>{x - 100, x + 100}(generator), -500.0, 500.0);
+}
+
+TEST_CASE("Reproducible Simulated Annealing", "[sim-anneal]")
+{
+    constexpr const auto init_temp  = 5000.0;
+    constexpr const auto final_temp = 1.0;
+    constexpr const auto cycles     = 10u;
+    constexpr const auto instances  = 20u;
+
+    simulated_annealing_params params{};
+    params.seed = 42;
+
+    SECTION("Single instance")
+    {
+        const auto first = simulated_annealing(0.0, init_temp, final_temp, cycles, schwefel_function_1d,
+                                               geometric_temperature_schedule, seeded_random_next_schwefel, params);
+        const auto second = simulated_annealing(0.0, init_temp, final_temp, cycles, schwefel_function_1d,
+                                                geometric_temperature_schedule, seeded_random_next_schwefel, params);
+
+        CHECK(first == second);
+        CHECK(first.second < schwefel_function_1d(0.0));
+    }
+    SECTION("Multiple instances are independent of the number of threads")
+    {
+        params.num_threads = 1;
+        const auto sequential =
+            multi_simulated_annealing(init_temp, final_temp, cycles, instances, seeded_schwefel_1d_init_state_generator,
+                                      schwefel_function_1d, geometric_temperature_schedule, seeded_random_next_schwefel,
+                                      params);
+
+        params.num_threads = 4;
+        const auto parallel =
+            multi_simulated_annealing(init_temp, final_temp, cycles, instances, seeded_schwefel_1d_init_state_generator,
+                                      schwefel_function_1d, geometric_temperature_schedule, seeded_random_next_schwefel,
+                                      params);
+
+        CHECK(sequential == parallel);
+        CHECK_THAT(schwefel_function_1d(parallel.first), Catch::Matchers::WithinAbs(parallel.second, 0.00001));
+    }
+}
+
+TEST_CASE("Delta-cost Simulated Annealing", "[sim-anneal]")
+{
+    // minimize the number of adjacent equal entries in a vector of +1/-1 values by flipping single entries
+    using state = std::vector<int>;
+
+    const auto cost = [](const state& s)
+    {
+        int64_t equal_pairs = 0;
+
+        for (std::size_t i = 0; i + 1 < s.size(); ++i)
+        {
+            equal_pairs += s[i] == s[i + 1] ? 1 : 0;
+        }
+
+        return equal_pairs;
+    };
+
+    std::size_t last_flip = 0;
+
+    const auto flip_delta = [](const state& s, const std::size_t i)
+    {
+        int64_t delta = 0;
+
+        if (i > 0)
+        {
+            delta += s[i - 1] == s[i] ? -1 : 1;
+        }
+        if (i + 1 < s.size())
+        {
+            delta += s[i + 1] == s[i] ? -1 : 1;
+        }
+
+        return delta;
+    };
+
+    const auto move = [&last_flip, &flip_delta](state& s, simulated_annealing_generator& generator)
+    {
+        last_flip = std::uniform_int_distribution<std::size_t>{0, s.size() - 1}(generator);
+
+        const auto delta = flip_delta(s, last_flip);
+        s[last_flip]     = -s[last_flip];
+
+        return delta;
+    };
+
+    const auto undo = [&last_flip](state& s) { s[last_flip] = -s[last_flip]; };
+
+    const state init_state(64, 1);
+
+    simulated_annealing_params params{};
+    params.seed = 7;
+
+    const auto [result, result_cost] =
+        delta_simulated_annealing(init_state, 10.0, 0.01, 200u, cost, geometric_temperature_schedule, move, undo, params);
+
+    CHECK(result_cost == cost(result));
+    CHECK(result_cost < cost(init_state));
+    CHECK(result_cost == 0);
+}
+
+TEST_CASE("Parallel tempering", "[sim-anneal]")
+{
+    const auto temperatures = geometric_temperature_ladder(1.0, 5000.0, 8);
+
+    REQUIRE(temperatures.size() == 8);
+    CHECK_THAT(temperatures.front(), Catch::Matchers::WithinAbs(1.0, 0.00001));
+    CHECK_THAT(temperatures.back(), Catch::Matchers::WithinAbs(5000.0, 0.00001));
+    CHECK(std::is_sorted(temperatures.cbegin(), temperatures.cend()));
+
+    simulated_annealing_params params{};
+    params.seed = 42;
+
+    SECTION("1D Schwefel function")
+    {
+        params.num_threads = 1;
+        const auto sequential =
+            parallel_tempering(temperatures, 200u, 10u, seeded_schwefel_1d_init_state_generator, schwefel_function_1d,
+                               seeded_random_next_schwefel, params);
+
+        params.num_threads = 4;
+        const auto parallel =
+            parallel_tempering(temperatures, 200u, 10u, seeded_schwefel_1d_init_state_generator, schwefel_function_1d,
+                               seeded_random_next_schwefel, params);
+
+        // replicas are not evenly distributed among the threads
+        params.num_threads = 3;
+        const auto uneven =
+            parallel_tempering(temperatures, 200u, 10u, seeded_schwefel_1d_init_state_generator, schwefel_function_1d,
+                               seeded_random_next_schwefel, params);
+
+        CHECK(sequential == parallel);
+        CHECK(sequential == uneven);
+        CHECK_THAT(schwefel_function_1d(parallel.first), Catch::Matchers::WithinAbs(parallel.second, 0.00001));
+        CHECK_THAT(parallel.first, Catch::Matchers::WithinAbs(420.9687, 1.0));
+    }
+}
@@ -384,3 +384,50 @@ TEST_CASE("Enumerate all paths on 4x4 gate-level layouts with connection obstruc
         }
     }
 }
+
+TEST_CASE("Lazy path enumeration", "[enumerate-all-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+    SECTION("Paths are generated in the order of enumerate_all_paths")
+    {
+        const auto collection = enumerate_all_paths<path>(layout, {{0, 0}, {3, 3}});
+
+        REQUIRE(!collection.empty());
+
+        all_paths_enumerator<path, clk_lyt> enumerator{layout, {{0, 0}, {3, 3}}};
+
+        for (const auto& p : collection)
+        {
+            const auto next = enumerator.next();
+
+            REQUIRE(next.has_value());
+            CHECK(*next == p);
+        }
+
+        // all paths have been generated
+        CHECK(!enumerator.next().has_value());
+        CHECK(!enumerator.next().has_value());
+    }
+    SECTION("Source and target are identical")
+    {
+        all_paths_enumerator<path, clk_lyt> enumerator{layout, {{1, 1}, {1, 1}}};
+
+        const auto next = enumerator.next();
+
+        REQUIRE(next.has_value());
+        CHECK(*next == path{{{1, 1}}});
+        CHECK(!enumerator.next().has_value());
+    }
+    SECTION("No path")
+    {
+        const clk_lyt twoddwave_layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+        all_paths_enumerator<path, clk_lyt> enumerator{twoddwave_layout, {{3, 3}, {0, 0}}};
+
+        CHECK(!enumerator.next().has_value());
+    }
+}
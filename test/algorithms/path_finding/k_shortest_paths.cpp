@@ -12,6 +12,8 @@
 #include <fiction/layouts/gate_level_layout.hpp>
 #include <fiction/layouts/obstruction_layout.hpp>
 
+#include <algorithm>
+
 using namespace fiction;
 
 TEST_CASE("Yen's algorithm on 2x2 layouts", "[k-shortest-paths]")
@@ -784,3 +786,58 @@ TEST_CASE("Yen's algorithm on 4x4 gate-level layouts with connection obstruction
         }
     }
 }
+
+TEST_CASE("Yen's algorithm returns paths in order of their length", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{4, 4}, res_clocking<clk_lyt>()};
+
+    const auto collection = yen_k_shortest_paths<path>(layout, {{2, 3}, {4, 4}}, 20);
+
+    // all 6 paths are found
+    REQUIRE(collection.size() == 6);
+    CHECK(collection.back().size() == 14);
+
+    for (auto i = 1ul; i < collection.size(); ++i)
+    {
+        CHECK(collection[i - 1].size() <= collection[i].size());
+    }
+}
+
+TEST_CASE("Yen's algorithm is independent of the number of threads", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    obstruction_layout<clk_lyt> layout{clk_lyt{{19, 19}, use_clocking<clk_lyt>()}};
+
+    layout.obstruct_coordinate({5, 5});
+    layout.obstruct_coordinate({6, 12});
+    layout.obstruct_coordinate({13, 3});
+    layout.obstruct_connection({8, 8}, {9, 8});
+
+    yen_k_shortest_paths_params params{};
+    params.num_threads = 1;
+
+    const auto single_threaded = yen_k_shortest_paths<path>(layout, {{0, 0}, {19, 19}}, 30, params);
+
+    params.num_threads = 4;
+
+    const auto multi_threaded = yen_k_shortest_paths<path>(layout, {{0, 0}, {19, 19}}, 30, params);
+
+    REQUIRE(single_threaded.size() == 30);
+    CHECK(single_threaded == multi_threaded);
+
+    for (const auto& p : single_threaded)
+    {
+        CHECK(p.source() == coordinate<clk_lyt>{0, 0});
+        CHECK(p.target() == coordinate<clk_lyt>{19, 19});
+        CHECK(std::find(p.cbegin(), p.cend(), coordinate<clk_lyt>{5, 5}) == p.cend());
+    }
+
+    // temporary obstructions are not written into the layout
+    CHECK(layout.is_obstructed_coordinate({5, 5}));
+    CHECK(!layout.is_obstructed_coordinate({1, 0}));
+}
@@ -9,6 +9,7 @@
 
 #include <fiction/algorithms/physical_design/apply_gate_library.hpp>
 #include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
 #include <fiction/algorithms/simulation/sidb/is_operational.hpp>
 #include <fiction/io/read_sqd_layout.hpp>
 #include <fiction/layouts/clocking_scheme.hpp>
@@ -22,6 +23,8 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/truth_table_utils.hpp>
 
+#include <mockturtle/networks/aig.hpp>
+
 #include <string>
 #include <vector>
 
@@ -592,3 +595,46 @@ TEST_CASE("Applying the QCA ONE gate library", "[apply-gate-library]")
         CHECK(layout.z() == 1);
     }
 }
+
+TEST_CASE("Parallel application of a static gate library", "[apply-gate-library]")
+{
+    // XOR chain whose orthogonal layout has enough tiles to be expanded by multiple threads
+    mockturtle::aig_network ntk{};
+
+    std::vector<mockturtle::aig_network::signal> pis{};
+    for (auto i = 0u; i < 32u; ++i)
+    {
+        pis.push_back(ntk.create_pi());
+    }
+
+    auto chain = pis.front();
+    for (auto i = 1u; i < pis.size(); ++i)
+    {
+        chain = ntk.create_xor(chain, pis[i]);
+    }
+    ntk.create_po(chain);
+
+    const auto gate_lyt = orthogonal<cart_gate_clk_lyt>(ntk, {});
+
+    apply_gate_library_params params{};
+
+    params.num_threads    = 1;
+    const auto sequential = apply_gate_library<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt, params);
+
+    params.num_threads  = 4;
+    const auto parallel = apply_gate_library<stacked_qca_cell_clk_lyt, qca_one_library>(gate_lyt, params);
+
+    CHECK(parallel.x() == sequential.x());
+    CHECK(parallel.y() == sequential.y());
+    CHECK(parallel.z() == sequential.z());
+    CHECK(parallel.num_cells() == sequential.num_cells());
+    CHECK(parallel.num_pis() == sequential.num_pis());
+    CHECK(parallel.num_pos() == sequential.num_pos());
+
+    sequential.foreach_cell(
+        [&parallel, &sequential](const auto& c)
+        {
+            CHECK(parallel.get_cell_type(c) == sequential.get_cell_type(c));
+            CHECK(parallel.get_cell_name(c) == sequential.get_cell_name(c));
+        });
+}
@@ -46,6 +46,11 @@ TEST_CASE("Simple wire connection", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("PORTFOLIO")
+    {
+        ps.engine = graph_coloring_engine::PORTFOLIO;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Two paths wire connections", "[color-routing]")
@@ -70,6 +75,11 @@ TEST_CASE("Two paths wire connections", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("PORTFOLIO")
+    {
+        ps.engine = graph_coloring_engine::PORTFOLIO;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Three paths wire connections", "[color-routing]")
@@ -94,6 +104,11 @@ TEST_CASE("Three paths wire connections", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("PORTFOLIO")
+    {
+        ps.engine = graph_coloring_engine::PORTFOLIO;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Direct gate connections", "[color-routing]")
@@ -118,6 +133,11 @@ TEST_CASE("Direct gate connections", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("PORTFOLIO")
+    {
+        ps.engine = graph_coloring_engine::PORTFOLIO;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Partial routing", "[color-routing]")
@@ -144,6 +164,11 @@ TEST_CASE("Partial routing", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("PORTFOLIO")
+    {
+        ps.engine = graph_coloring_engine::PORTFOLIO;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Routing with crossings", "[color-routing]")
@@ -171,6 +196,11 @@ TEST_CASE("Routing with crossings", "[color-routing]")
             ps.engine = graph_coloring_engine::SAT;
             check_color_routing(spec_layout, impl_layout, objectives, ps);
         }
+        SECTION("PORTFOLIO")
+        {
+            ps.engine = graph_coloring_engine::PORTFOLIO;
+            check_color_routing(spec_layout, impl_layout, objectives, ps);
+        }
     }
     SECTION("With path limit")
     {
@@ -186,6 +216,11 @@ TEST_CASE("Routing with crossings", "[color-routing]")
             ps.engine = graph_coloring_engine::SAT;
             check_color_routing(spec_layout, impl_layout, objectives, ps);
         }
+        SECTION("PORTFOLIO")
+        {
+            ps.engine = graph_coloring_engine::PORTFOLIO;
+            check_color_routing(spec_layout, impl_layout, objectives, ps);
+        }
     }
 }
 
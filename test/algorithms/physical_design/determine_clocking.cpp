@@ -65,6 +65,28 @@ void remove_assign_and_check_clocking(Lyt lyt)
     }
 }
 
+template <typename Lyt>
+void check_data_flow_clocking(const Lyt& lyt)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    lyt.foreach_node(
+        [&lyt](const auto& n)
+        {
+            if (lyt.is_constant(n))
+            {
+                return;
+            }
+
+            const auto t = lyt.get_tile(n);
+
+            for (const auto& fanin : lyt.template incoming_data_flow<false>(t))
+            {
+                CHECK(lyt.is_incoming_clocked(t, fanin));
+            }
+        });
+}
+
 TEST_CASE("Determine clock numbers for an empty layout", "[determine-clocking]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
@@ -145,3 +167,86 @@ TEST_CASE("Determine clock numbers for a non-clockable layout", "[determine-cloc
 
     CHECK(determine_clocking(lyt) == false);
 }
+
+TEST_CASE("Determine clock numbers for a layout with multiple components", "[determine-clocking]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    gate_layout layout{gate_layout::aspect_ratio{2, 2, 0}, open_clocking<gate_layout>()};
+
+    const auto x0 = layout.create_pi("x0", {0, 0});
+    const auto w0 = layout.create_buf(x0, {0, 1});
+    layout.create_po(w0, "f0", {0, 2});
+
+    const auto x1 = layout.create_pi("x1", {2, 0});
+    const auto w1 = layout.create_buf(x1, {2, 1});
+    layout.create_po(w1, "f1", {2, 2});
+
+    determine_clocking_params params{};
+    determine_clocking_stats  stats{};
+
+    SECTION("decomposed into components")
+    {
+        params.num_threads = 2;
+
+        CHECK(determine_clocking(layout, params, &stats) == true);
+        CHECK(stats.num_components == 2);
+
+        check_data_flow_clocking(layout);
+    }
+    SECTION("single SAT instance")
+    {
+        params.decompose_into_components = false;
+
+        CHECK(determine_clocking(layout, params, &stats) == true);
+        CHECK(stats.num_components == 1);
+
+        check_data_flow_clocking(layout);
+    }
+}
+
+TEST_CASE("Incrementally determine clock numbers after layout edits", "[determine-clocking]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    gate_layout layout{gate_layout::aspect_ratio{2, 2, 0}, open_clocking<gate_layout>()};
+
+    const auto x0  = layout.create_pi("x0", {0, 0});
+    const auto fo  = layout.create_buf(x0, {0, 1});
+    const auto inv = layout.create_not(fo, {0, 2});
+    const auto w   = layout.create_buf(inv, {1, 2});
+    layout.create_po(w, "f", {1, 1});
+
+    incremental_clocking<gate_layout> clocking{layout};
+
+    CHECK(clocking.num_encoded_tiles() == 5);
+    CHECK(clocking.determine_clocks() == true);
+
+    check_data_flow_clocking(layout);
+
+    // replace the PO by an AND gate whose fanins cannot be clocked consistently (cf. unclockable_gate_layout)
+    layout.clear_tile({1, 1});
+    const auto a = layout.create_and(fo, w, {1, 1});
+    layout.create_po(a, "f", {2, 1});
+
+    clocking.update({{1, 1}, {2, 1}});
+
+    CHECK(clocking.num_encoded_tiles() == 6);
+    CHECK(clocking.determine_clocks() == false);
+
+    // revert the edit
+    layout.clear_tile({2, 1});
+    layout.clear_tile({1, 1});
+    layout.create_po(w, "f", {1, 1});
+
+    clocking.update({{1, 1}, {2, 1}});
+
+    CHECK(clocking.num_encoded_tiles() == 5);
+
+    determine_clocking_stats stats{};
+
+    CHECK(clocking.determine_clocks(&stats) == true);
+    CHECK(stats.num_components == 1);
+
+    check_data_flow_clocking(layout);
+}
@@ -712,6 +712,33 @@ TEST_CASE("Exact physical design timeout", "[exact]")
     CHECK(!layout.has_value());
 }
 
+TEST_CASE("Coordinated multithreaded exact physical design", "[exact]")
+{
+    const auto mux = blueprints::mux21_network<technology_network>();
+
+    exact_physical_design_stats sync_stats{};
+    const auto sync_layout = exact<cart_gate_clk_lyt>(mux, twoddwave(crossings(configuration())), &sync_stats);
+
+    REQUIRE(sync_layout.has_value());
+
+    // transposed aspect ratios yield identical instances under 2DDWave clocking and are only examined once
+    CHECK(sync_stats.num_symmetric_aspect_ratios > 0);
+    CHECK(sync_stats.time_solver_per_thread.empty());
+
+    exact_physical_design_stats async_stats{};
+    const auto async_layout =
+        exact<cart_gate_clk_lyt>(mux, async(4, twoddwave(crossings(configuration()))), &async_stats);
+
+    REQUIRE(async_layout.has_value());
+
+    check_eq(mux, *async_layout);
+    check_drvs(*async_layout);
+
+    // coordination must not sacrifice optimality
+    CHECK(async_stats.x_size * async_stats.y_size == sync_stats.x_size * sync_stats.y_size);
+    CHECK(async_stats.time_solver_per_thread.size() == 4);
+}
+
 TEST_CASE("Name conservation after exact physical design", "[exact]")
 {
     auto maj = blueprints::maj1_network<mockturtle::names_view<mockturtle::mig_network>>();
@@ -20,6 +20,8 @@
 
 #include <mockturtle/networks/aig.hpp>
 
+#include <vector>
+
 using namespace fiction;
 
 template <typename Lyt, typename Ntk>
@@ -258,3 +260,40 @@ TEST_CASE("Cartesian to hexagonal")
     CHECK(detail::to_hex<gate_layout, hex_lyt>(coordinate<gate_layout>(2, 2, 1), layout_height) ==
           offset::ucoord_t(1, 4, 1));
 }
+
+TEST_CASE("Parallel hexagonalization", "[hexagonalization]")
+{
+    // XOR chain whose orthogonal layout has enough diagonals to be remapped by multiple threads
+    mockturtle::aig_network ntk{};
+
+    std::vector<mockturtle::aig_network::signal> pis{};
+    for (auto i = 0u; i < 24u; ++i)
+    {
+        pis.push_back(ntk.create_pi());
+    }
+
+    auto chain = pis.front();
+    for (auto i = 1u; i < pis.size(); ++i)
+    {
+        chain = ntk.create_xor(chain, pis[i]);
+    }
+    ntk.create_po(chain);
+
+    const auto layout = orthogonal<cart_gate_clk_lyt>(ntk, {});
+
+    hexagonalization_params params{};
+
+    params.num_threads    = 1;
+    const auto sequential = hexagonalization<hex_even_row_gate_clk_lyt, cart_gate_clk_lyt>(layout, params);
+
+    params.num_threads  = 4;
+    const auto parallel = hexagonalization<hex_even_row_gate_clk_lyt, cart_gate_clk_lyt>(layout, params);
+
+    CHECK(parallel.x() == sequential.x());
+    CHECK(parallel.y() == sequential.y());
+    CHECK(parallel.num_gates() == sequential.num_gates());
+    CHECK(parallel.num_wires() == sequential.num_wires());
+
+    check_eq(ntk, parallel);
+    check_eq(sequential, parallel);
+}
@@ -21,6 +21,9 @@
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <cstdint>
+#include <vector>
+
 using namespace fiction;
 
 template <typename Lyt, typename Ntk>
@@ -151,6 +154,20 @@ TEST_CASE("Layout equivalence", "[wiring_reduction]")
         check_eq(blueprints::mux21_network<technology_network>(), layout);
     }
 
+    SECTION("Single-threaded")
+    {
+        using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
+
+        const auto layout = orthogonal<gate_layout>(blueprints::full_adder_network<technology_network>(), {});
+
+        wiring_reduction_stats  stats{};
+        wiring_reduction_params params{};
+        params.enable_multithreading = false;
+        wiring_reduction<gate_layout>(layout, params, &stats);
+
+        check_eq(blueprints::full_adder_network<technology_network>(), layout);
+    }
+
     SECTION("Timeout exceeded")
     {
         using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
@@ -198,6 +215,56 @@ TEST_CASE("Search Direction", "[wiring_reduction]")
     }
 }
 
+TEST_CASE("Collect cuts", "[wiring_reduction]")
+{
+    using wiring_reduction_lyt = detail::wiring_reduction_layout_type<offset::ucoord_t>;
+
+    SECTION("Left to right")
+    {
+        wiring_reduction_lyt lyt{
+            detail::wiring_reduction_layout<offset::ucoord_t>{{4, 3, 1}, detail::search_direction::HORIZONTAL}};
+        detail::add_obstructions(lyt);
+        lyt.obstruct_coordinate({2, 1, 0});
+
+        layout_coordinate_path<wiring_reduction_lyt> to_delete{};
+
+        CHECK(detail::collect_cuts<wiring_reduction_lyt>(lyt, to_delete) == 1);
+
+        REQUIRE(to_delete.size() == 3);
+        CHECK(to_delete[0] == offset::ucoord_t{0, 0});
+        CHECK(to_delete[1] == offset::ucoord_t{1, 1});
+        CHECK(to_delete[2] == offset::ucoord_t{2, 0});
+
+        // the cut is obstructed afterward such that no further cut exists
+        CHECK(detail::get_path(lyt, {0, 0}, {lyt.x(), lyt.y()}).empty());
+
+        const auto offsets = detail::calculate_offset_matrix<wiring_reduction_lyt>(lyt, to_delete);
+
+        CHECK(offsets[0] == std::vector<uint64_t>{0, 0, 0, 0, 0});
+        CHECK(offsets[1] == std::vector<uint64_t>{1, 0, 1, 0, 0});
+        CHECK(offsets[2] == std::vector<uint64_t>{1, 1, 1, 0, 0});
+        CHECK(offsets[3] == std::vector<uint64_t>{1, 1, 1, 0, 0});
+    }
+    SECTION("Top to bottom")
+    {
+        wiring_reduction_lyt lyt{
+            detail::wiring_reduction_layout<offset::ucoord_t>{{4, 3, 1}, detail::search_direction::VERTICAL}};
+        detail::add_obstructions(lyt);
+        lyt.obstruct_coordinate({2, 1, 0});
+
+        layout_coordinate_path<wiring_reduction_lyt> to_delete{};
+
+        CHECK(detail::collect_cuts<wiring_reduction_lyt>(lyt, to_delete) == 2);
+        CHECK(to_delete.size() == 4);
+        CHECK(detail::get_path(lyt, {0, 0}, {lyt.x(), lyt.y()}).empty());
+
+        const auto offsets = detail::calculate_offset_matrix<wiring_reduction_lyt>(lyt, to_delete);
+
+        CHECK(offsets[0] == std::vector<uint64_t>{0, 1, 1, 2, 2});
+        CHECK(offsets[1] == std::vector<uint64_t>{0, 0, 1, 2, 2});
+    }
+}
+
 TEST_CASE("PI and PO border validation", "[wiring_reduction]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
@@ -855,6 +855,57 @@ TEMPLATE_TEST_CASE("Test critical_temperature function, using offset coordinates
     }
 }
 
+TEMPLATE_TEST_CASE("Critical temperature with energy window restriction and multiple threads",
+                   "[critical-temperature]", sidb_100_cell_clk_lyt_siqad, cds_sidb_100_cell_clk_lyt_siqad)
+{
+    const auto lyt = blueprints::bestagon_and<TestType>();
+
+    critical_temperature_params params{};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32, 5.6, 5.0};
+    params.operational_params.sim_engine            = sidb_simulation_engine::QUICKEXACT;
+    params.confidence_level                         = 0.99;
+    params.max_temperature                          = 350;
+
+    params.energy_window  = critical_temperature_params::energy_window_restriction::OFF;
+    params.number_threads = 1;
+
+    critical_temperature_stats reference_stats{};
+
+    const auto reference_ct =
+        critical_temperature_gate_based(lyt, std::vector<tt>{create_and_tt()}, params, &reference_stats);
+
+    const auto check_against_reference = [&]()
+    {
+        critical_temperature_stats critical_stats{};
+
+        const auto ct = critical_temperature_gate_based(lyt, std::vector<tt>{create_and_tt()}, params, &critical_stats);
+
+        CHECK_THAT(ct, Catch::Matchers::WithinAbs(reference_ct, 0.01));
+        CHECK_THAT(critical_stats.energy_between_ground_state_and_first_erroneous,
+                   Catch::Matchers::WithinAbs(reference_stats.energy_between_ground_state_and_first_erroneous, 0.01));
+    };
+
+    SECTION("Energy window restriction")
+    {
+        params.energy_window = critical_temperature_params::energy_window_restriction::ON;
+
+        check_against_reference();
+    }
+    SECTION("Multiple threads")
+    {
+        params.number_threads = 4;
+
+        check_against_reference();
+    }
+    SECTION("Energy window restriction and multiple threads")
+    {
+        params.energy_window  = critical_temperature_params::energy_window_restriction::ON;
+        params.number_threads = 4;
+
+        check_against_reference();
+    }
+}
+
 // to save runtime in the CI, this test is only run in RELEASE mode
 #ifdef NDEBUG
 TEMPLATE_TEST_CASE("Critical temperature of Bestagon CX, QuickExact", "[critical-temperature], [quality]",
@@ -216,6 +216,96 @@ TEST_CASE("Determine the probability of fabricating an operational BDL wire with
     }
 }
 
+TEST_CASE("Estimate the probability of fabricating an operational BDL wire via Monte-Carlo sampling",
+          "[displacement-robustness-domain]")
+{
+    const auto lyt = blueprints::bdl_wire<sidb_cell_clk_lyt_siqad>();
+
+    displacement_robustness_domain_params<cell<sidb_cell_clk_lyt_siqad>> params{};
+    params.displacement_variations                  = {0, 1};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance       = 3.0;
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.maximum_distance = 2.0;
+    params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.minimum_distance = 0.2;
+    params.analysis_mode =
+        displacement_robustness_domain_params<cell<sidb_cell_clk_lyt_siqad>>::displacement_analysis_mode::MONTE_CARLO;
+    params.confidence_interval_width = 0.05;
+    params.seed                      = 42;
+
+    SECTION("estimate converges to the exhaustively determined probability")
+    {
+        displacement_robustness_domain_stats stats{};
+
+        const auto result = determine_probability_of_fabricating_operational_gate(
+            lyt, std::vector<tt>{create_id_tt()}, params, 1.0, &stats);
+
+        CHECK(stats.confidence_interval_upper_bound - stats.confidence_interval_lower_bound <=
+              params.confidence_interval_width);
+        CHECK(stats.confidence_interval_lower_bound <= result);
+        CHECK(result <= stats.confidence_interval_upper_bound);
+
+        // the exhaustively determined probability is 0.67578125
+        CHECK_THAT(result, Catch::Matchers::WithinAbs(0.67578125, 0.05));
+    }
+
+    SECTION("results are independent of the number of threads")
+    {
+        params.number_of_threads = 1;
+
+        displacement_robustness_domain_stats single_threaded_stats{};
+
+        const auto single_threaded = determine_probability_of_fabricating_operational_gate(
+            lyt, std::vector<tt>{create_id_tt()}, params, 0.5, &single_threaded_stats);
+
+        params.number_of_threads = 4;
+
+        displacement_robustness_domain_stats multi_threaded_stats{};
+
+        const auto multi_threaded = determine_probability_of_fabricating_operational_gate(
+            lyt, std::vector<tt>{create_id_tt()}, params, 0.5, &multi_threaded_stats);
+
+        CHECK_THAT(single_threaded, Catch::Matchers::WithinAbs(multi_threaded, constants::ERROR_MARGIN));
+        CHECK(single_threaded_stats.num_operational_sidb_displacements ==
+              multi_threaded_stats.num_operational_sidb_displacements);
+        CHECK(single_threaded_stats.num_non_operational_sidb_displacements ==
+              multi_threaded_stats.num_non_operational_sidb_displacements);
+    }
+
+    SECTION("sampling stops after the maximum number of samples")
+    {
+        params.confidence_interval_width = 0.0;
+        params.max_number_of_samples     = 100;
+        params.batch_size                = 30;
+
+        displacement_robustness_domain_stats stats{};
+
+        const auto domain =
+            determine_displacement_robustness_domain(lyt, std::vector<tt>{create_id_tt()}, params, &stats);
+
+        CHECK(domain.operational_values.size() == 100);
+        check_identical_information_of_stats_and_domain(domain, stats);
+
+        for (const auto& [displaced_lyt, status] : domain.operational_values)
+        {
+            CHECK(displaced_lyt.num_cells() == lyt.num_cells());
+        }
+    }
+
+    SECTION("no samples are drawn if the maximum number of samples is 0")
+    {
+        params.max_number_of_samples = 0;
+
+        displacement_robustness_domain_stats stats{};
+
+        const auto result = determine_probability_of_fabricating_operational_gate(
+            lyt, std::vector<tt>{create_id_tt()}, params, 1.0, &stats);
+
+        CHECK_THAT(result, Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
+        CHECK(stats.num_operational_sidb_displacements == 0);
+        CHECK(stats.num_non_operational_sidb_displacements == 0);
+    }
+}
+
 TEST_CASE("Determine the probability of fabricating an operational BDL, offset coordinates",
           "[displacement-robustness-domain]")
 {
@@ -301,6 +301,38 @@ TEST_CASE("Bestagon AND gate", "[is-operational]")
     }
 }
 
+TEST_CASE("Bestagon AND gate with input patterns in Gray code order", "[is-operational]")
+{
+    const auto lyt = blueprints::bestagon_and<sidb_100_cell_clk_lyt_siqad>();
+
+    is_operational_params binary_params{sidb_simulation_parameters{2, -0.30}, sidb_simulation_engine::QUICKEXACT};
+
+    auto gray_code_params = binary_params;
+
+    gray_code_params.input_bdl_iterator_params.input_order =
+        bdl_input_iterator_params::input_pattern_order::GRAY_CODE;
+
+    SECTION("non-operational gate")
+    {
+        CHECK(is_operational(lyt, std::vector<tt>{create_and_tt()}, gray_code_params) ==
+              is_operational(lyt, std::vector<tt>{create_and_tt()}, binary_params));
+
+        const auto op_inputs = operational_input_patterns(lyt, std::vector<tt>{create_and_tt()}, gray_code_params);
+
+        CHECK(op_inputs == operational_input_patterns(lyt, std::vector<tt>{create_and_tt()}, binary_params));
+        CHECK(op_inputs == std::set<uint64_t>{3});
+    }
+    SECTION("operational gate")
+    {
+        gray_code_params.simulation_parameters.mu_minus = -0.32;
+
+        CHECK(is_operational(lyt, std::vector<tt>{create_and_tt()}, gray_code_params).first ==
+              operational_status::OPERATIONAL);
+        CHECK(operational_input_patterns(lyt, std::vector<tt>{create_and_tt()}, gray_code_params) ==
+              std::set<uint64_t>{0, 1, 2, 3});
+    }
+}
+
 TEST_CASE("SiQAD AND gate", "[is-operational]")
 {
     auto lyt = blueprints::siqad_and_gate<sidb_defect_cell_clk_lyt_siqad>();
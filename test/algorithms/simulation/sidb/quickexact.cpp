@@ -8,6 +8,7 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
 #include <fiction/algorithms/simulation/sidb/quickexact.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
@@ -22,6 +23,8 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/math_utils.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <set>
 
@@ -1796,6 +1799,66 @@ TEMPLATE_TEST_CASE("QuickExact simulation of positively charged SiDBs", "[quicke
     }
 }
 
+TEMPLATE_TEST_CASE("QuickExact simulation within an energy window", "[quickexact]",
+                   (sidb_lattice<sidb_100_lattice, sidb_cell_clk_lyt_siqad>))
+{
+    TestType lyt{};
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 1, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({13, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({15, 2, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({17, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({9, 4, 1}, TestType::cell_type::NORMAL);
+
+    const auto check_energy_window = [&lyt](const sidb_simulation_parameters& sim_params)
+    {
+        using params_type = quickexact_params<cell<TestType>>;
+
+        params_type params{sim_params, params_type::automatic_base_number_detection::OFF};
+
+        const auto all_results = quickexact<TestType>(lyt, params);
+
+        REQUIRE(!all_results.charge_distributions.empty());
+
+        const auto ground_state_energy =
+            minimum_energy(all_results.charge_distributions.cbegin(), all_results.charge_distributions.cend());
+
+        for (const auto window : {0.0, 0.01, 0.1, 1.0})
+        {
+            params.energy_window = window;
+
+            const auto windowed_results = quickexact<TestType>(lyt, params);
+
+            const auto expected_num_charge_distributions =
+                std::count_if(all_results.charge_distributions.cbegin(), all_results.charge_distributions.cend(),
+                              [&](const auto& cds)
+                              {
+                                  return cds.get_electrostatic_potential_energy() <=
+                                         ground_state_energy + window + constants::ERROR_MARGIN;
+                              });
+
+            CHECK(windowed_results.charge_distributions.size() ==
+                  static_cast<std::size_t>(expected_num_charge_distributions));
+            CHECK_THAT(minimum_energy(windowed_results.charge_distributions.cbegin(),
+                                      windowed_results.charge_distributions.cend()),
+                       Catch::Matchers::WithinAbs(ground_state_energy, constants::ERROR_MARGIN));
+        }
+    };
+
+    SECTION("2-state simulation")
+    {
+        check_energy_window(sidb_simulation_parameters{2, -0.32});
+    }
+    SECTION("3-state simulation")
+    {
+        check_energy_window(sidb_simulation_parameters{3, -0.32});
+    }
+}
+
 TEMPLATE_TEST_CASE("Special test cases", "[quickexact]", sidb_100_cell_clk_lyt_siqad)
 {
     SECTION("Test case 1")
@@ -377,6 +377,33 @@ TEST_CASE("Random offset::ucoord_t layout generation", "[random-sidb-layout-gene
         CHECK(!are_cell_layouts_identical(first_lyt, second_lyt));
     }
 
+    SECTION("Check uniqueness of multiple layouts generated in parallel")
+    {
+        generate_random_sidb_layout_params<offset::ucoord_t> params{
+            {{0, 0}, {30, 30}},
+            8,
+            generate_random_sidb_layout_params<offset::ucoord_t>::positive_charges::FORBIDDEN,
+            sidb_simulation_parameters{},
+            static_cast<uint64_t>(10E6),
+            20};
+        params.number_threads = 4;
+
+        const auto result_lyts = generate_multiple_random_sidb_layouts<sidb_100_cell_clk_lyt>(params);
+        REQUIRE(result_lyts.has_value());
+        REQUIRE(result_lyts.value().size() == 20);
+
+        for (auto i = 0u; i < result_lyts.value().size(); ++i)
+        {
+            CHECK(result_lyts.value()[i].num_cells() == 8);
+            CHECK(!can_positive_charges_occur(result_lyts.value()[i], sidb_simulation_parameters{}));
+
+            for (auto j = i + 1; j < result_lyts.value().size(); ++j)
+            {
+                CHECK(!are_cell_layouts_identical(result_lyts.value()[i], result_lyts.value()[j]));
+            }
+        }
+    }
+
     SECTION("Check correct use of skeleton layout when generating only one random layout")
     {
         const generate_random_sidb_layout_params<offset::ucoord_t> params{{{0, 0}, {9, 9}}, 10};
@@ -0,0 +1,201 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
+#include <fiction/algorithms/simulation/sidb/sim_anneal.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/constants.hpp>
+#include <fiction/technology/sidb_charge_state.hpp>
+#include <fiction/types.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Empty layout SimAnneal simulation", "[sim-anneal]", (sidb_100_cell_clk_lyt_siqad),
+                   (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    const TestType lyt{};
+
+    const auto simulation_results = sim_anneal<TestType>(lyt, sim_anneal_params{sidb_simulation_parameters{2, -0.32}});
+
+    CHECK(!simulation_results.has_value());
+}
+
+TEMPLATE_TEST_CASE("SimAnneal simulation without chains", "[sim-anneal]", (sidb_100_cell_clk_lyt_siqad),
+                   (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+
+    sim_anneal_params params{sidb_simulation_parameters{2, -0.32}};
+    params.number_of_chains = 0;
+
+    const auto simulation_results = sim_anneal<TestType>(lyt, params);
+
+    CHECK(!simulation_results.has_value());
+}
+
+TEMPLATE_TEST_CASE("Single SiDB SimAnneal simulation", "[sim-anneal]", (sidb_100_cell_clk_lyt_siqad),
+                   (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+
+    const auto simulation_results = sim_anneal<TestType>(lyt, sim_anneal_params{sidb_simulation_parameters{2, -0.32}});
+
+    REQUIRE(simulation_results.has_value());
+    REQUIRE(simulation_results->charge_distributions.size() == 1);
+
+    CHECK(simulation_results->algorithm_name == sidb_simulation_engine_name(sidb_simulation_engine::SIMANNEAL));
+    CHECK(simulation_results->charge_distributions.front().get_charge_state({1, 3, 0}) ==
+          sidb_charge_state::NEGATIVE);
+}
+
+TEMPLATE_TEST_CASE("SimAnneal simulation of a BDL wire", "[sim-anneal]", (sidb_100_cell_clk_lyt_siqad),
+                   (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({-13, -1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({-9, -1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({-7, -1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({-3, -1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({-1, -1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({3, -1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, -1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({9, -1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({11, -1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({15, -1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({17, -1, 1}, TestType::cell_type::NORMAL);
+
+    sim_anneal_params params{sidb_simulation_parameters{2, -0.32}};
+    params.seed = 42;
+
+    const auto simulation_results = sim_anneal<TestType>(lyt, params);
+
+    REQUIRE(simulation_results.has_value());
+    REQUIRE(!simulation_results->charge_distributions.empty());
+
+    for (const auto& cds : simulation_results->charge_distributions)
+    {
+        CHECK(cds.is_physically_valid());
+        CHECK(!cds.charge_exists(sidb_charge_state::POSITIVE));
+    }
+
+    const auto ground_state = simulation_results->groundstates();
+
+    REQUIRE(ground_state.size() == 1);
+
+    const auto& charge_lyt = ground_state.front();
+
+    CHECK(charge_lyt.get_charge_state({-13, -1, 1}) == sidb_charge_state::NEGATIVE);
+
+    CHECK(charge_lyt.get_charge_state({-9, -1, 1}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt.get_charge_state({-7, -1, 1}) == sidb_charge_state::NEGATIVE);
+
+    CHECK(charge_lyt.get_charge_state({-3, -1, 1}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt.get_charge_state({-1, -1, 1}) == sidb_charge_state::NEGATIVE);
+
+    CHECK(charge_lyt.get_charge_state({3, -1, 1}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt.get_charge_state({5, -1, 1}) == sidb_charge_state::NEGATIVE);
+
+    CHECK(charge_lyt.get_charge_state({9, -1, 1}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt.get_charge_state({11, -1, 1}) == sidb_charge_state::NEGATIVE);
+
+    CHECK(charge_lyt.get_charge_state({15, -1, 1}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt.get_charge_state({17, -1, 1}) == sidb_charge_state::NEGATIVE);
+}
+
+TEMPLATE_TEST_CASE("SimAnneal finds the ground state determined by QuickExact", "[sim-anneal]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({2, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({0, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 6, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({9, 6, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 9, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({11, 9, 1}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters sim_params{2, -0.32};
+
+    const auto exact_results = quickexact(lyt, quickexact_params<cell<TestType>>{sim_params});
+
+    REQUIRE(!exact_results.charge_distributions.empty());
+
+    sim_anneal_params params{sim_params};
+    params.seed = 7;
+
+    const auto simulation_results = sim_anneal<TestType>(lyt, params);
+
+    REQUIRE(simulation_results.has_value());
+
+    const auto exact_energy =
+        minimum_energy(exact_results.charge_distributions.cbegin(), exact_results.charge_distributions.cend());
+
+    CHECK_THAT(minimum_energy(simulation_results->charge_distributions.cbegin(),
+                              simulation_results->charge_distributions.cend()),
+               Catch::Matchers::WithinAbs(exact_energy, constants::ERROR_MARGIN));
+}
+
+TEMPLATE_TEST_CASE("SimAnneal results are reproducible for a given seed", "[sim-anneal]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 10, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 10, 0}, TestType::cell_type::NORMAL);
+
+    sim_anneal_params params{sidb_simulation_parameters{2, -0.30}};
+    params.seed           = 1234;
+    params.number_threads = 1;
+
+    const auto single_threaded = sim_anneal<TestType>(lyt, params);
+
+    params.number_threads = 4;
+
+    const auto multi_threaded = sim_anneal<TestType>(lyt, params);
+
+    REQUIRE(single_threaded.has_value());
+    REQUIRE(multi_threaded.has_value());
+
+    REQUIRE(single_threaded->charge_distributions.size() == multi_threaded->charge_distributions.size());
+
+    for (auto i = 0u; i < single_threaded->charge_distributions.size(); ++i)
+    {
+        CHECK(single_threaded->charge_distributions[i].get_all_sidb_charges() ==
+              multi_threaded->charge_distributions[i].get_all_sidb_charges());
+    }
+
+    CHECK(single_threaded->additional_simulation_parameters.at("seed").has_value());
+}
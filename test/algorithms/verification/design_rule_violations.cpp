@@ -7,8 +7,14 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/verification/design_rule_violations.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <cstdint>
 #include <sstream>
 
 using namespace fiction;
@@ -66,3 +72,148 @@ TEST_CASE("DRVs", "[drv]")
 {
     check_for_drvs(blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>(), 50, 1);
 }
+
+namespace
+{
+
+/**
+ * Creates a 2DDWave-clocked layout of parallel wires from western PIs to eastern POs. In every fourth row, one wire
+ * segment skips its western neighbor, which yields non-adjacent, improperly clocked, and missing connections.
+ */
+cart_gate_clk_lyt wire_array_layout(const uint64_t width, const uint64_t height)
+{
+    cart_gate_clk_lyt layout{{width - 1, height - 1}, twoddwave_clocking<cart_gate_clk_lyt>()};
+
+    for (uint64_t y = 0; y < height; ++y)
+    {
+        auto s = layout.create_pi(fmt::format("x{}", y), {0, y});
+
+        for (uint64_t x = 1; x < width - 1; ++x)
+        {
+            if (y % 4 == 0 && x == width / 2)
+            {
+                s = layout.make_signal(layout.get_node({x - 2, y}));
+            }
+
+            s = layout.create_buf(s, {x, y});
+        }
+
+        layout.create_po(s, fmt::format("f{}", y), {width - 1, y});
+    }
+
+    return layout;
+}
+
+template <typename Lyt>
+gate_level_drv_stats get_drvs(const Lyt& lyt, const std::size_t num_threads)
+{
+    gate_level_drv_params ps{};
+    gate_level_drv_stats  st{};
+
+    // suppress standard output
+    std::stringstream ss{};
+    ps.out         = &ss;
+    ps.num_threads = num_threads;
+
+    gate_level_drvs(lyt, ps, &st);
+
+    return st;
+}
+
+template <typename Lyt>
+gate_level_drv_stats get_incremental_drvs(const incremental_gate_level_drvs<Lyt>& inc)
+{
+    gate_level_drv_stats st{};
+
+    inc.check(&st);
+
+    return st;
+}
+
+void check_equal_stats(const gate_level_drv_stats& st1, const gate_level_drv_stats& st2)
+{
+    CHECK(st1.drvs == st2.drvs);
+    CHECK(st1.warnings == st2.warnings);
+    CHECK(st1.report == st2.report);
+}
+
+}  // namespace
+
+TEST_CASE("Parallel DRV checking", "[drv]")
+{
+    SECTION("Blueprints")
+    {
+        const auto layout = blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>();
+
+        check_equal_stats(get_drvs(layout, 1), get_drvs(layout, 4));
+    }
+    SECTION("Large layout")
+    {
+        const auto layout = wire_array_layout(64, 64);
+
+        const auto st1 = get_drvs(layout, 1);
+        const auto st4 = get_drvs(layout, 4);
+
+        // each of the 16 faulty rows has a non-adjacent and improperly clocked connection and three tiles with missing
+        // connections
+        CHECK(st1.drvs == 80);
+        CHECK(st1.warnings == 0);
+
+        check_equal_stats(st1, st4);
+    }
+}
+
+TEST_CASE("Incremental DRV checking", "[drv]")
+{
+    SECTION("Unchanged layouts")
+    {
+        const auto layout = blueprints::non_structural_all_function_gate_layout<cart_gate_clk_lyt>();
+
+        gate_level_drv_params ps{};
+        std::stringstream     ss{};
+        ps.out = &ss;
+
+        const incremental_gate_level_drvs inc{layout, ps};
+
+        check_equal_stats(get_incremental_drvs(inc), get_drvs(layout));
+    }
+    SECTION("Edited layout")
+    {
+        auto layout = wire_array_layout(32, 32);
+
+        gate_level_drv_params ps{};
+        std::stringstream     ss{};
+        ps.out = &ss;
+
+        incremental_gate_level_drvs inc{layout, ps};
+
+        check_equal_stats(get_incremental_drvs(inc), get_drvs(layout));
+        CHECK(get_incremental_drvs(inc).drvs == 40);
+
+        const tile<cart_gate_clk_lyt> t1{10, 1};
+
+        // remove a wire segment, which disconnects its neighbors
+        layout.clear_tile(t1);
+        inc.update({t1});
+
+        check_equal_stats(get_incremental_drvs(inc), get_drvs(layout));
+        CHECK(get_incremental_drvs(inc).drvs > 40);
+
+        // restore it
+        layout.create_buf(layout.make_signal(layout.get_node({9, 1})), t1);
+        inc.update({t1});
+
+        check_equal_stats(get_incremental_drvs(inc), get_drvs(layout));
+        CHECK(get_incremental_drvs(inc).drvs == 40);
+
+        const tile<cart_gate_clk_lyt> t2{16, 0};
+
+        // repair a faulty row
+        layout.clear_tile(t2);
+        layout.create_buf(layout.make_signal(layout.get_node({15, 0})), t2);
+        inc.update({t2});
+
+        check_equal_stats(get_incremental_drvs(inc), get_drvs(layout));
+        CHECK(get_incremental_drvs(inc).drvs == 35);
+    }
+}
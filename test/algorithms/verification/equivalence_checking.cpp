@@ -12,11 +12,15 @@
 #include <fiction/networks/technology_network.hpp>
 #include <fiction/types.hpp>
 
+#include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
 
+#include <cstdint>
+#include <vector>
+
 using namespace fiction;
 
 template <typename Spec, typename Impl>
@@ -182,3 +186,75 @@ TEST_CASE("No equivalence", "[equiv]")
     check_for_no_equiv(blueprints::and_not_gate_layout<hex_odd_row_gate_clk_lyt>(),
                        blueprints::and_or_gate_layout<hex_even_col_gate_clk_lyt>());
 }
+
+TEST_CASE("Simulation-based equivalence checking", "[equiv]")
+{
+    equivalence_checking_stats st{};
+
+    SECTION("Exhaustive simulation")
+    {
+        const auto spec = blueprints::maj4_network<mockturtle::aig_network>();
+        const auto impl = blueprints::maj4_network<mockturtle::mig_network>();
+
+        CHECK(equivalence_checking(spec, impl, &st) == eq_type::STRONG);
+        CHECK(st.simulated_patterns == (1ull << spec.num_pis()));
+        CHECK(!st.sat_solver_invoked);
+
+        const auto lyt = blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>();
+
+        CHECK(equivalence_checking(lyt, blueprints::xor_maj_gate_layout<hex_even_col_gate_clk_lyt>(), &st) ==
+              eq_type::STRONG);
+        CHECK(st.simulated_patterns == (1ull << lyt.num_pis()));
+        CHECK(!st.sat_solver_invoked);
+    }
+    SECTION("Random simulation finds a counter example")
+    {
+        const auto spec = blueprints::and_or_network<mockturtle::xag_network>();
+        const auto impl = blueprints::half_adder_network<fiction::technology_network>();
+
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_pis = 0;
+        ps.num_random_patterns           = 256;
+
+        CHECK(equivalence_checking(spec, impl, ps, &st) == eq_type::NO);
+        CHECK(!st.sat_solver_invoked);
+        CHECK(st.simulated_patterns > 0);
+
+        REQUIRE(st.counter_example.size() == spec.num_pis());
+
+        const mockturtle::default_simulator<bool> sim{st.counter_example};
+        CHECK(mockturtle::simulate<bool>(spec, sim) != mockturtle::simulate<bool>(impl, sim));
+    }
+    SECTION("Exhaustive simulation finds the first counter example")
+    {
+        mockturtle::xag_network spec{};
+        const auto              a = spec.create_pi();
+        const auto              b = spec.create_pi();
+        spec.create_po(spec.create_and(a, b));
+        spec.create_po(spec.create_or(a, b));
+
+        // the first output differs for input pattern 1 only, the second one already for input pattern 0
+        mockturtle::xag_network impl{};
+        const auto              c = impl.create_pi();
+        const auto              d = impl.create_pi();
+        impl.create_po(c);
+        impl.create_po(!impl.create_xor(c, d));
+
+        CHECK(equivalence_checking(spec, impl, &st) == eq_type::NO);
+        CHECK(!st.sat_solver_invoked);
+        CHECK(st.simulated_patterns == 1);
+        CHECK(st.counter_example == std::vector<bool>{false, false});
+    }
+    SECTION("SAT-based fallback")
+    {
+        equivalence_checking_params ps{};
+        ps.max_exhaustive_simulation_pis = 0;
+        ps.num_random_patterns           = 0;
+
+        CHECK(equivalence_checking(blueprints::maj4_network<mockturtle::xag_network>(),
+                                   blueprints::maj4_network<fiction::technology_network>(), ps,
+                                   &st) == eq_type::STRONG);
+        CHECK(st.sat_solver_invoked);
+        CHECK(st.simulated_patterns == 0);
+    }
+}
@@ -0,0 +1,65 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#ifndef FICTION_BENCHMARK_NETWORKS_HPP
+#define FICTION_BENCHMARK_NETWORKS_HPP
+
+#include <fiction/io/network_reader.hpp>
+
+#include <array>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace benchmark_networks
+{
+
+/**
+ * Small benchmark networks from Fontes et al., ISCAS 2018, for which all physical design engines terminate quickly.
+ */
+inline constexpr std::array<const char*, 8> fontes18{
+    {"xor.v", "majority.v", "1bitAdderAOIG.v", "1bitAdderMaj.v", "2bitAdderMaj.v", "t.v", "c17.v", "cm82a_5.v"}};
+/**
+ * ISCAS85 benchmark networks in increasing size.
+ */
+inline constexpr std::array<const char*, 5> iscas85{{"c17.v", "c432.v", "c499.v", "c880.v", "c1908.v"}};
+/**
+ * EPFL benchmark networks of the random/control category that are small enough for scalable physical design.
+ */
+inline constexpr std::array<const char*, 4> epfl{{"ctrl.v", "int2float.v", "router.v", "cavlc.v"}};
+/**
+ * Large EPFL benchmark networks to measure parsing throughput.
+ */
+inline constexpr std::array<const char*, 3> epfl_large{{"sin.v", "voter.v", "multiplier.v"}};
+
+/**
+ * Reads a network from the `benchmarks` folder of the repository.
+ *
+ * @tparam Ntk Logic network type.
+ * @param set Name of the benchmark set, i.e., the subfolder of `benchmarks`.
+ * @param file Name of the file within the benchmark set.
+ * @return The parsed logic network.
+ */
+template <typename Ntk>
+Ntk read(const std::string& set, const std::string& file)
+{
+    const auto path = std::string{BENCHMARK_PATH} + set + "/" + file;
+
+    std::stringstream                           messages{};
+    fiction::network_reader<std::shared_ptr<Ntk>> reader{path, messages};
+
+    const auto& networks = reader.get_networks();
+
+    if (networks.empty())
+    {
+        throw std::runtime_error("could not read benchmark " + path + ": " + messages.str());
+    }
+
+    return *networks.front();
+}
+
+}  // namespace benchmark_networks
+
+#endif  // FICTION_BENCHMARK_NETWORKS_HPP
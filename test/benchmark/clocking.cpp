@@ -0,0 +1,63 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/static_clocked_layout.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+template <typename Lyt>
+uint64_t sum_degrees(const Lyt& layout) noexcept
+{
+    uint64_t sum = 0;
+    layout.foreach_coordinate([&layout, &sum](const auto& cz) { sum += layout.degree(cz); });
+
+    return sum;
+}
+
+TEST_CASE("Benchmark clocking schemes", "[benchmark]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    const aspect_ratio<clk_lyt> ar{99, 99};
+
+    const clk_lyt use_layout{ar, use_clocking<clk_lyt>()};
+
+    BENCHMARK("USE (type-erased)")
+    {
+        return sum_degrees(use_layout);
+    };
+
+    const static_clocked_layout<cartesian_layout<offset::ucoord_t>, static_clocking::use> static_use_layout{ar};
+
+    BENCHMARK("USE (static)")
+    {
+        return sum_degrees(static_use_layout);
+    };
+
+    clk_lyt open_layout{ar, open_clocking<clk_lyt>()};
+    open_layout.foreach_coordinate([&open_layout, &use_layout](const auto& cz)
+                                   { open_layout.assign_clock_number(cz, use_layout.get_clock_number(cz)); });
+
+    BENCHMARK("OPEN (type-erased)")
+    {
+        return sum_degrees(open_layout);
+    };
+
+    static_clocked_layout<cartesian_layout<offset::ucoord_t>, static_clocking::open<>> static_open_layout{ar};
+    static_open_layout.replace_clocking_scheme(use_layout.get_clocking_scheme());
+
+    BENCHMARK("OPEN (static)")
+    {
+        return sum_degrees(static_open_layout);
+    };
+}
@@ -0,0 +1,136 @@
+"""Collects the results of fiction's Catch2 benchmarks and compares them against a stored baseline.
+
+The benchmark executables are expected to have been run with ``--reporter XML::out=<file>.xml``. All XML files in the
+given directory are parsed and their results are merged into a single JSON object that maps
+``<file> / <test case> / <benchmark>`` to the mean runtime and its standard deviation in nanoseconds. This object can
+be written to a file and later be used as the baseline of another run.
+
+A benchmark is reported as a regression if its mean runtime exceeds the baseline's by more than the given relative
+threshold and if the difference is larger than the combined standard deviations of both measurements. In that case,
+the script exits with a non-zero status.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import math
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+
+
+def parse_catch2_xml(path: Path) -> dict[str, dict[str, float]]:
+    """Extracts all benchmark results from a Catch2 XML report."""
+    results = {}
+
+    root = ET.parse(path).getroot()
+
+    for test_case in root.iter("TestCase"):
+        for benchmark in test_case.iter("BenchmarkResults"):
+            mean = benchmark.find("mean")
+            std_dev = benchmark.find("standardDeviation")
+
+            if mean is None:
+                continue
+
+            key = f"{path.stem} / {test_case.get('name')} / {benchmark.get('name')}"
+            results[key] = {
+                "mean": float(mean.get("value")),
+                "std_dev": float(std_dev.get("value")) if std_dev is not None else 0.0,
+            }
+
+    return results
+
+
+def collect_results(directory: Path) -> dict[str, dict[str, float]]:
+    """Merges the benchmark results of all Catch2 XML reports in the given directory."""
+    results = {}
+
+    for path in sorted(directory.glob("*.xml")):
+        results.update(parse_catch2_xml(path))
+
+    return results
+
+
+def format_time(nanoseconds: float) -> str:
+    """Formats a duration in nanoseconds using an appropriate unit."""
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= factor:
+            return f"{nanoseconds / factor:.2f} {unit}"
+
+    return f"{nanoseconds:.2f} ns"
+
+
+def compare(results: dict[str, dict[str, float]], baseline: dict[str, dict[str, float]], threshold: float) -> bool:
+    """Prints a comparison table of the given results and the baseline and returns whether a regression occurred."""
+    regression = False
+
+    rows = []
+    for key, result in sorted(results.items()):
+        if key not in baseline:
+            rows.append((key, "-", format_time(result["mean"]), "new", ""))
+            continue
+
+        base = baseline[key]
+        change = result["mean"] / base["mean"] - 1.0 if base["mean"] > 0 else 0.0
+        noise = math.sqrt(result["std_dev"] ** 2 + base["std_dev"] ** 2)
+
+        status = ""
+        if change > threshold and result["mean"] - base["mean"] > noise:
+            status = "REGRESSION"
+            regression = True
+        elif change < -threshold and base["mean"] - result["mean"] > noise:
+            status = "improvement"
+
+        rows.append((key, format_time(base["mean"]), format_time(result["mean"]), f"{change:+.1%}", status))
+
+    for key in sorted(set(baseline) - set(results)):
+        rows.append((key, format_time(baseline[key]["mean"]), "-", "missing", ""))
+
+    header = ("Benchmark", "Baseline", "Current", "Change", "")
+    widths = [max(len(row[i]) for row in [header, *rows]) for i in range(len(header))]
+
+    for row in [header, *rows]:
+        print("  ".join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+
+    return regression
+
+
+def main() -> int:
+    """Entry point of the script."""
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("results", type=Path, help="directory containing the Catch2 XML reports")
+    parser.add_argument("-o", "--output", type=Path, help="JSON file to write the collected results to")
+    parser.add_argument("-b", "--baseline", type=Path, help="JSON file of stored results to compare against")
+    parser.add_argument(
+        "-t",
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="relative slowdown that is considered a regression (default: 0.1)",
+    )
+    args = parser.parse_args()
+
+    results = collect_results(args.results)
+
+    if not results:
+        print(f"No benchmark results found in '{args.results}'", file=sys.stderr)
+        return 1
+
+    if args.output is not None:
+        args.output.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+
+    if args.baseline is None:
+        for key, result in sorted(results.items()):
+            print(f"{key}: {format_time(result['mean'])} (+/- {format_time(result['std_dev'])})")
+
+        return 0
+
+    baseline = json.loads(args.baseline.read_text(encoding="utf-8"))
+
+    return 1 if compare(results, baseline, args.threshold) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -59,6 +59,36 @@ TEST_CASE("Benchmark SAT-based clocking determination", "[benchmark]")
         return determine_clocking(lyt, params);
     };
 
+    BENCHMARK("determine_clocking: bsat2 (single SAT instance)")
+    {
+        params.sat_engine                = bill::solvers::bsat2;
+        params.decompose_into_components = false;
+
+        const auto result = determine_clocking(lyt, params);
+
+        params.decompose_into_components = true;
+
+        return result;
+    };
+
+    BENCHMARK("incremental_clocking: bsat2 (re-clocking after an edit)")
+    {
+        incremental_clocking<gate_layout, bill::solvers::bsat2> clocking{lyt};
+
+        const auto first_result = clocking.determine_clocks();
+
+        // report the first PO tile as edited, which re-encodes it and its neighborhood
+        lyt.foreach_po(
+            [&lyt, &clocking](const auto& po)
+            {
+                clocking.update({lyt.get_tile(lyt.get_node(po))});
+
+                return false;
+            });
+
+        return first_result && clocking.determine_clocks();
+    };
+
 #if !defined(BILL_WINDOWS_PLATFORM)
     BENCHMARK("determine_clocking: maple")
     {
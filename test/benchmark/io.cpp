@@ -0,0 +1,144 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "benchmark_networks.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/simulation/sidb/random_sidb_layout_generator.hpp>
+#include <fiction/io/read_fgl_layout.hpp>
+#include <fiction/io/read_fqca_layout.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/io/write_fgl_layout.hpp>
+#include <fiction/io/write_fqca_layout.hpp>
+#include <fiction/io/write_qca_layout.hpp>
+#include <fiction/io/write_sqd_layout.hpp>
+#include <fiction/io/write_svg_layout.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark reading Verilog files", "[benchmark]")
+{
+    for (const auto* const file : benchmark_networks::epfl_large)
+    {
+        BENCHMARK(fmt::format("read Verilog: EPFL/{}", file))
+        {
+            return benchmark_networks::read<tec_nt>("EPFL", file);
+        };
+    }
+}
+
+TEST_CASE("Benchmark gate-level layout I/O", "[benchmark]")
+{
+    const auto layout = orthogonal<cart_gate_clk_lyt>(benchmark_networks::read<tec_nt>("ISCAS85", "c1908.v"));
+
+    std::stringstream fgl{};
+    write_fgl_layout(layout, fgl);
+    const auto fgl_content = fgl.str();
+
+    BENCHMARK("write FGL: ISCAS85/c1908.v")
+    {
+        std::stringstream ss{};
+        write_fgl_layout(layout, ss);
+
+        return ss.str().size();
+    };
+
+    BENCHMARK("read FGL: ISCAS85/c1908.v")
+    {
+        std::istringstream ss{fgl_content};
+
+        return read_fgl_layout<cart_gate_clk_lyt>(ss);
+    };
+}
+
+TEST_CASE("Benchmark QCA cell-level layout I/O", "[benchmark]")
+{
+    const auto layout = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(
+        orthogonal<cart_gate_clk_lyt>(benchmark_networks::read<tec_nt>("ISCAS85", "c432.v")));
+
+    std::stringstream fqca{};
+    write_fqca_layout(layout, fqca);
+    const auto fqca_content = fqca.str();
+
+    BENCHMARK("write QCADesigner: ISCAS85/c432.v")
+    {
+        std::stringstream ss{};
+        write_qca_layout(layout, ss);
+
+        return ss.str().size();
+    };
+
+    BENCHMARK("write FQCA: ISCAS85/c432.v")
+    {
+        std::stringstream ss{};
+        write_fqca_layout(layout, ss);
+
+        return ss.str().size();
+    };
+
+    BENCHMARK("read FQCA: ISCAS85/c432.v")
+    {
+        std::istringstream ss{fqca_content};
+
+        return read_fqca_layout<qca_cell_clk_lyt>(ss);
+    };
+
+    BENCHMARK("write SVG: ISCAS85/c432.v")
+    {
+        std::stringstream ss{};
+        write_qca_layout_svg(layout, ss);
+
+        return ss.str().size();
+    };
+}
+
+TEST_CASE("Benchmark SiDB layout I/O", "[benchmark]")
+{
+    using lattice = sidb_100_cell_clk_lyt_siqad;
+
+    constexpr uint64_t number_of_sidbs = 5'000;
+
+    generate_random_sidb_layout_params<cell<lattice>> params{};
+    params.coordinate_pair = {{0, 0, 0}, {500, 100, 1}};
+    params.number_of_sidbs = number_of_sidbs;
+
+    // use a fixed seed to benchmark the same layout in each run
+    std::mt19937_64 generator{number_of_sidbs};
+
+    const auto layout = detail::generate_random_sidb_layout<lattice>(params, std::optional<lattice>{}, generator);
+    REQUIRE(layout.has_value());
+
+    std::stringstream sqd{};
+    write_sqd_layout(*layout, sqd);
+    const auto sqd_content = sqd.str();
+
+    BENCHMARK("write SQD: 5000 SiDBs")
+    {
+        std::stringstream ss{};
+        write_sqd_layout(*layout, ss);
+
+        return ss.str().size();
+    };
+
+    BENCHMARK("read SQD: 5000 SiDBs")
+    {
+        std::istringstream ss{sqd_content};
+
+        return read_sqd_layout<lattice>(ss);
+    };
+}
@@ -0,0 +1,124 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinate_storage.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+
+#include <fmt/format.h>
+#include <phmap.h>
+
+#include <cstdint>
+
+using namespace fiction;
+
+template <typename Lyt>
+Lyt checkerboard_layout(const typename Lyt::aspect_ratio& ar)
+{
+    Lyt layout{ar, twoddwave_clocking<Lyt>()};
+
+    layout.foreach_cell_position(
+        [&layout](const auto& c)
+        {
+            if ((c.x + c.y) % 4 != 0)
+            {
+                layout.assign_cell_type(c, qca_technology::cell_type::NORMAL);
+            }
+        });
+
+    return layout;
+}
+
+template <typename Lyt>
+uint64_t count_empty_cells(const Lyt& layout) noexcept
+{
+    uint64_t count = 0;
+    layout.foreach_cell_position([&layout, &count](const auto& c) { count += layout.is_empty_cell(c) ? 1 : 0; });
+
+    return count;
+}
+
+template <typename Lyt>
+uint64_t sum_cell_coordinates(const Lyt& layout) noexcept
+{
+    uint64_t sum = 0;
+    layout.foreach_cell([&sum](const auto& c) { sum += c.x + c.y; });
+
+    return sum;
+}
+
+TEST_CASE("Benchmark layout storage", "[benchmark]")
+{
+    using base_layout   = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using sparse_layout = cell_level_layout<qca_technology, base_layout>;
+    using dense_layout  = cell_level_layout<qca_technology, base_layout, dense_coordinate_storage>;
+
+    const typename base_layout::aspect_ratio ar{999, 999};
+
+    const auto sparse = checkerboard_layout<sparse_layout>(ar);
+    const auto dense  = checkerboard_layout<dense_layout>(ar);
+
+    BENCHMARK("Construction (sparse)")
+    {
+        return checkerboard_layout<sparse_layout>(ar);
+    };
+
+    BENCHMARK("Construction (dense)")
+    {
+        return checkerboard_layout<dense_layout>(ar);
+    };
+
+    BENCHMARK("Lookup (sparse)")
+    {
+        return count_empty_cells(sparse);
+    };
+
+    BENCHMARK("Lookup (dense)")
+    {
+        return count_empty_cells(dense);
+    };
+
+    BENCHMARK("Iteration (sparse)")
+    {
+        return sum_cell_coordinates(sparse);
+    };
+
+    BENCHMARK("Iteration (dense)")
+    {
+        return sum_cell_coordinates(dense);
+    };
+}
+
+TEST_CASE("Memory footprint of layout storage", "[benchmark]")
+{
+    phmap::parallel_flat_hash_map<offset::ucoord_t, qca_technology::cell_type> sparse{};
+    dense_coordinate_map<offset::ucoord_t, qca_technology::cell_type>          dense{};
+
+    for (uint64_t y = 0; y < 1000; ++y)
+    {
+        for (uint64_t x = 0; x < 1000; ++x)
+        {
+            if ((x + y) % 4 != 0)
+            {
+                sparse[{x, y}] = qca_technology::cell_type::NORMAL;
+                dense[{x, y}]  = qca_technology::cell_type::NORMAL;
+            }
+        }
+    }
+
+    const auto sparse_bytes =
+        sparse.capacity() * (sizeof(typename decltype(sparse)::value_type) + 1);  // one control byte per slot
+
+    fmt::print("[i] storage of {} cells: sparse = {} KiB, dense = {} KiB\n", dense.size(), sparse_bytes / 1024,
+               dense.memory_usage() / 1024);
+
+    CHECK(sparse.size() == dense.size());
+}
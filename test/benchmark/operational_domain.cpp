@@ -0,0 +1,70 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+using lattice = sidb_100_cell_clk_lyt_siqad;
+
+TEST_CASE("Benchmark operational domain computation", "[benchmark]")
+{
+    const auto layout = blueprints::bestagon_and_gate<lattice>();
+    const auto spec   = std::vector<tt>{create_and_tt()};
+
+    operational_domain_params params{};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+    params.sweep_dimensions                         = {{sweep_parameter::EPSILON_R, 5.0, 6.0, 0.1},
+                                                       {sweep_parameter::LAMBDA_TF, 4.5, 5.5, 0.1}};
+
+    BENCHMARK("operational domain: grid search")
+    {
+        return operational_domain_grid_search(layout, spec, params);
+    };
+
+    BENCHMARK("operational domain: random sampling")
+    {
+        return operational_domain_random_sampling(layout, spec, 100, params);
+    };
+
+    BENCHMARK("operational domain: flood fill")
+    {
+        return operational_domain_flood_fill(layout, spec, 10, params);
+    };
+
+    BENCHMARK("operational domain: contour tracing")
+    {
+        return operational_domain_contour_tracing(layout, spec, 10, params);
+    };
+}
+
+TEST_CASE("Benchmark critical temperature computation", "[benchmark]")
+{
+    const auto layout = blueprints::bestagon_and_gate<lattice>();
+    const auto spec   = std::vector<tt>{create_and_tt()};
+
+    critical_temperature_params params{};
+    params.operational_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+
+    BENCHMARK("critical temperature: gate-based")
+    {
+        return critical_temperature_gate_based(layout, spec, params);
+    };
+
+    BENCHMARK("critical temperature: non-gate-based")
+    {
+        return critical_temperature_non_gate_based(layout, params);
+    };
+}
@@ -0,0 +1,124 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "benchmark_networks.hpp"
+
+#include <fiction/algorithms/physical_design/graph_oriented_layout_design.hpp>
+#include <fiction/algorithms/physical_design/hexagonalization.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/types.hpp>
+
+#if (FICTION_Z3_SOLVER)
+#include <fiction/algorithms/physical_design/exact.hpp>
+#endif
+
+#include <fmt/format.h>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark orthogonal physical design", "[benchmark]")
+{
+    for (const auto* const file : benchmark_networks::fontes18)
+    {
+        const auto ntk = benchmark_networks::read<tec_nt>("fontes18", file);
+
+        BENCHMARK(fmt::format("orthogonal: fontes18/{}", file))
+        {
+            return orthogonal<cart_gate_clk_lyt>(ntk);
+        };
+    }
+
+    for (const auto* const file : benchmark_networks::iscas85)
+    {
+        const auto ntk = benchmark_networks::read<tec_nt>("ISCAS85", file);
+
+        BENCHMARK(fmt::format("orthogonal: ISCAS85/{}", file))
+        {
+            return orthogonal<cart_gate_clk_lyt>(ntk);
+        };
+    }
+
+    for (const auto* const file : benchmark_networks::epfl)
+    {
+        const auto ntk = benchmark_networks::read<tec_nt>("EPFL", file);
+
+        BENCHMARK(fmt::format("orthogonal: EPFL/{}", file))
+        {
+            return orthogonal<cart_gate_clk_lyt>(ntk);
+        };
+    }
+}
+
+TEST_CASE("Benchmark graph-oriented layout design", "[benchmark]")
+{
+    graph_oriented_layout_design_params params{};
+    params.mode = graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY;
+
+    for (const auto* const file : benchmark_networks::fontes18)
+    {
+        auto ntk = benchmark_networks::read<tec_nt>("fontes18", file);
+
+        BENCHMARK(fmt::format("gold: fontes18/{}", file))
+        {
+            return graph_oriented_layout_design<cart_gate_clk_lyt>(ntk, params);
+        };
+    }
+
+    for (const auto* const file : {"c17.v", "c432.v"})
+    {
+        auto ntk = benchmark_networks::read<tec_nt>("ISCAS85", file);
+
+        BENCHMARK(fmt::format("gold: ISCAS85/{}", file))
+        {
+            return graph_oriented_layout_design<cart_gate_clk_lyt>(ntk, params);
+        };
+    }
+}
+
+TEST_CASE("Benchmark hexagonalization", "[benchmark]")
+{
+    for (const auto* const file : benchmark_networks::iscas85)
+    {
+        const auto layout = orthogonal<cart_gate_clk_lyt>(benchmark_networks::read<tec_nt>("ISCAS85", file));
+
+        BENCHMARK(fmt::format("hexagonalization: ISCAS85/{}", file))
+        {
+            return hexagonalization<hex_even_row_gate_clk_lyt>(layout);
+        };
+    }
+
+    for (const auto* const file : benchmark_networks::epfl)
+    {
+        const auto layout = orthogonal<cart_gate_clk_lyt>(benchmark_networks::read<tec_nt>("EPFL", file));
+
+        BENCHMARK(fmt::format("hexagonalization: EPFL/{}", file))
+        {
+            return hexagonalization<hex_even_row_gate_clk_lyt>(layout);
+        };
+    }
+}
+
+#if (FICTION_Z3_SOLVER)
+TEST_CASE("Benchmark exact physical design", "[benchmark]")
+{
+    exact_physical_design_params params{};
+    params.scheme    = "2DDWave";
+    params.crossings = true;
+    params.border_io = false;
+    params.timeout   = 60'000u;  // 1 minute
+
+    for (const auto* const file : {"xor.v", "majority.v", "1bitAdderAOIG.v", "1bitAdderMaj.v", "t.v", "c17.v"})
+    {
+        const auto ntk = benchmark_networks::read<tec_nt>("fontes18", file);
+
+        BENCHMARK(fmt::format("exact: fontes18/{}", file))
+        {
+            return exact<cart_gate_clk_lyt>(ntk, params);
+        };
+    }
+}
+#endif  // FICTION_Z3_SOLVER
@@ -0,0 +1,89 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/random_sidb_layout_generator.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/traits.hpp>
+#include <fiction/types.hpp>
+
+#if (FICTION_ALGLIB_ENABLED)
+#include <fiction/algorithms/simulation/sidb/clustercomplete.hpp>
+#endif
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <stdexcept>
+
+using namespace fiction;
+
+using lattice = sidb_100_cell_clk_lyt_siqad;
+
+/**
+ * Generates a reproducible random layout of the given number of SiDBs. The area grows with the number of SiDBs to
+ * keep the density constant.
+ */
+lattice random_layout(const uint64_t number_of_sidbs)
+{
+    generate_random_sidb_layout_params<cell<lattice>> params{};
+    params.coordinate_pair = {{0, 0, 0}, {static_cast<int32_t>(2 * number_of_sidbs), 6, 1}};
+    params.number_of_sidbs = number_of_sidbs;
+    params.positive_sidbs  = generate_random_sidb_layout_params<cell<lattice>>::positive_charges::FORBIDDEN;
+
+    std::mt19937_64 generator{number_of_sidbs};
+
+    // use a fixed seed to benchmark the same layouts in each run
+    const auto layout = detail::generate_random_sidb_layout<lattice>(params, std::optional<lattice>{}, generator);
+
+    if (!layout.has_value())
+    {
+        throw std::runtime_error(fmt::format("could not generate a random layout of {} SiDBs", number_of_sidbs));
+    }
+
+    return *layout;
+}
+
+TEST_CASE("Benchmark exact simulators on scaling random layouts", "[benchmark]")
+{
+    const sidb_simulation_parameters sim_params{2, -0.32};
+
+    for (const auto number_of_sidbs : {8ul, 12ul, 16ul, 20ul})
+    {
+        const auto layout = random_layout(number_of_sidbs);
+
+        BENCHMARK(fmt::format("QuickExact: {} SiDBs", number_of_sidbs))
+        {
+            return quickexact<lattice>(layout, quickexact_params<cell<lattice>>{sim_params});
+        };
+
+#if (FICTION_ALGLIB_ENABLED)
+        BENCHMARK(fmt::format("ClusterComplete: {} SiDBs", number_of_sidbs))
+        {
+            return clustercomplete<lattice>(layout, clustercomplete_params<cell<lattice>>{sim_params});
+        };
+#endif  // FICTION_ALGLIB_ENABLED
+    }
+}
+
+TEST_CASE("Benchmark heuristic simulation on scaling random layouts", "[benchmark]")
+{
+    const quicksim_params params{sidb_simulation_parameters{2, -0.32}};
+
+    for (const auto number_of_sidbs : {10ul, 20ul, 40ul, 80ul})
+    {
+        const auto layout = random_layout(number_of_sidbs);
+
+        BENCHMARK(fmt::format("QuickSim: {} SiDBs", number_of_sidbs))
+        {
+            return quicksim<lattice>(layout, params);
+        };
+    }
+}
@@ -8,6 +8,7 @@
 #include "utils/version_info.hpp"
 
 #include <fiction/io/write_svg_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
 #include <fiction/technology/cell_technologies.hpp>
 #include <fiction/technology/charge_distribution_surface.hpp>
 #include <fiction/technology/sidb_charge_state.hpp>
@@ -17,8 +18,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 using namespace fiction;
 
@@ -40,6 +43,25 @@ using namespace fiction;
     return result;
 };
 
+/**
+ * Counts the non-overlapping occurrences of a pattern in a string.
+ *
+ * @param str The string to search in.
+ * @param pattern The pattern to count.
+ * @return The number of occurrences of `pattern` in `str`.
+ */
+[[nodiscard]] static std::size_t count_occurrences(const std::string& str, const std::string_view& pattern) noexcept
+{
+    std::size_t count = 0;
+
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size()))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
 inline const std::string EXPECTED_SVG_LIGHT_CELL_LEVEL =
     fmt::format(R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
 <!-- Generated by {} ({}) -->
@@ -627,3 +649,54 @@ TEMPLATE_TEST_CASE("Generate SiDB layout on the H-Si(111)-1x1 surface in SVG for
         }
     }
 };
+
+TEST_CASE("Generate tile-based QCA layout in SVG with reusable tile and cell symbols", "[write-qca-layout-svg]")
+{
+    // two tiles of size 5x5 in the same clock zone
+    qca_cell_clk_lyt layout{{9, 4}, open_clocking<qca_cell_clk_lyt>(), "wires", 5, 5};
+
+    for (auto x = 0u; x < 10u; ++x)
+    {
+        layout.assign_cell_type({x, 2}, qca_technology::cell_type::NORMAL);
+    }
+
+    const auto write_svg = [&layout](const std::size_t num_threads)
+    {
+        std::stringstream ss{};
+
+        write_qca_layout_svg_params params{};
+        params.num_threads = num_threads;
+        write_qca_layout_svg(layout, ss, params);
+
+        return ss.str();
+    };
+
+    SECTION("equal tiles share their symbol")
+    {
+        const auto svg = write_svg(1);
+
+        CHECK(svg.find("xmlns:xlink=\"http://www.w3.org/1999/xlink\"") != std::string::npos);
+
+        // one cell symbol and one tile symbol
+        CHECK(count_occurrences(svg, "<symbol") == 2);
+        CHECK(count_occurrences(svg, "xlink:href=\"#cell_0\"") == 5);
+        CHECK(count_occurrences(svg, "xlink:href=\"#tile_0\"") == 2);
+        CHECK(count_occurrences(svg, "xlink:href=\"#tile_1\"") == 0);
+
+        CHECK(svg == write_svg(4));
+    }
+    SECTION("different tiles have their own symbols")
+    {
+        layout.assign_cell_type({0, 2}, qca_technology::cell_type::INPUT);
+        layout.assign_cell_type({9, 2}, qca_technology::cell_type::OUTPUT);
+
+        const auto svg = write_svg(1);
+
+        // three cell symbols and two tile symbols
+        CHECK(count_occurrences(svg, "<symbol") == 5);
+        CHECK(count_occurrences(svg, "xlink:href=\"#tile_0\"") == 1);
+        CHECK(count_occurrences(svg, "xlink:href=\"#tile_1\"") == 1);
+
+        CHECK(svg == write_svg(4));
+    }
+}
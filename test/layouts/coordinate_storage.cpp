@@ -0,0 +1,217 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+#include "utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinate_storage.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+#include <cstdint>
+#include <iterator>
+
+using namespace fiction;
+
+TEST_CASE("Dense coordinate map", "[coordinate-storage]")
+{
+    dense_coordinate_map<offset::ucoord_t, int> map{};
+
+    CHECK(map.empty());
+    CHECK(map.size() == 0);
+    CHECK(map.cbegin() == map.cend());
+    CHECK(map.find({0, 0}) == map.cend());
+
+    map[{0, 0}]    = 1;
+    map[{3, 2}]    = 2;
+    map[{1, 1, 1}] = 3;
+
+    const offset::ucoord_t dead{};
+    map[dead] = 4;
+
+    CHECK(map.size() == 4);
+    CHECK(!map.empty());
+
+    CHECK(map.find({0, 0})->second == 1);
+    CHECK(map.find({3, 2})->second == 2);
+    CHECK(map.find({1, 1, 1})->second == 3);
+    CHECK(map.find(dead)->second == 4);
+
+    CHECK(map.find({1, 0}) == map.cend());
+    CHECK(map.find({100, 100}) == map.cend());
+    CHECK(map.count({3, 2}) == 1);
+    CHECK(map.count({2, 3}) == 0);
+
+    // iteration is row-major with layers outermost, dead coordinates last
+    CHECK(std::distance(map.cbegin(), map.cend()) == 4);
+
+    auto it = map.cbegin();
+    CHECK(it->first == offset::ucoord_t{0, 0});
+    ++it;
+    CHECK(it->first == offset::ucoord_t{3, 2});
+    ++it;
+    CHECK(it->first == offset::ucoord_t{1, 1, 1});
+    ++it;
+    CHECK(it->first == dead);
+    ++it;
+    CHECK(it == map.cend());
+
+    SECTION("Growth preserves entries")
+    {
+        map[{20, 30, 1}] = 5;
+
+        CHECK(map.size() == 5);
+        CHECK(map.find({0, 0})->second == 1);
+        CHECK(map.find({3, 2})->second == 2);
+        CHECK(map.find({1, 1, 1})->second == 3);
+        CHECK(map.find({20, 30, 1})->second == 5);
+    }
+    SECTION("Erase")
+    {
+        CHECK(map.erase({3, 2}) == 1);
+        CHECK(map.erase({3, 2}) == 0);
+        CHECK(map.erase({50, 50}) == 0);
+        CHECK(map.find({3, 2}) == map.cend());
+        CHECK(map.size() == 3);
+
+        map.erase(map.find(dead));
+        CHECK(map.find(dead) == map.cend());
+        CHECK(map.size() == 2);
+
+        const auto next = map.erase(map.find({0, 0}));
+        CHECK(next->first == offset::ucoord_t{1, 1, 1});
+        CHECK(map.size() == 1);
+
+        map.clear();
+        CHECK(map.empty());
+        CHECK(map.find({1, 1, 1}) == map.cend());
+    }
+}
+
+TEST_CASE("Dense coordinate map with integer keys", "[coordinate-storage]")
+{
+    const auto const0 = static_cast<uint64_t>(0x8000000000000000ull);
+    const auto const1 = static_cast<uint64_t>(0xc000000000000000ull);
+
+    dense_coordinate_map<uint64_t, uint32_t> map{{const0, 0u}, {const1, 1u}};
+
+    CHECK(map.size() == 2);
+    CHECK(map.find(const0)->second == 0);
+    CHECK(map.find(const1)->second == 1);
+
+    map[static_cast<uint64_t>(offset::ucoord_t{2, 1})] = 2;
+
+    CHECK(map.size() == 3);
+    CHECK(static_cast<offset::ucoord_t>(map.cbegin()->first) == offset::ucoord_t{2, 1});
+}
+
+TEST_CASE("Dense gate-level layout storage", "[coordinate-storage]")
+{
+    using base_layout   = clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>;
+    using sparse_layout = gate_level_layout<base_layout>;
+    using dense_layout  = gate_level_layout<base_layout, dense_coordinate_storage>;
+
+    const auto check_identical = [](const auto& layout, const auto& reference)
+    {
+        CHECK(layout.x() == reference.x());
+        CHECK(layout.y() == reference.y());
+        CHECK(layout.num_gates() == reference.num_gates());
+        CHECK(layout.num_wires() == reference.num_wires());
+        CHECK(layout.num_crossings() == reference.num_crossings());
+
+        reference.foreach_tile(
+            [&layout, &reference](const auto& t)
+            {
+                CHECK(layout.is_empty_tile(t) == reference.is_empty_tile(t));
+
+                if (!reference.is_empty_tile(t))
+                {
+                    CHECK(layout.get_node(t) == reference.get_node(t));
+                    CHECK(layout.get_tile(layout.get_node(t)) == t);
+                    CHECK(layout.fanin_size(layout.get_node(t)) == reference.fanin_size(reference.get_node(t)));
+                    CHECK(layout.fanout_size(layout.get_node(t)) == reference.fanout_size(reference.get_node(t)));
+                }
+            });
+    };
+
+    SECTION("Blueprint")
+    {
+        check_identical(blueprints::xor_maj_gate_layout<dense_layout>(),
+                        blueprints::xor_maj_gate_layout<sparse_layout>());
+    }
+    SECTION("Physical design")
+    {
+        const auto ntk = blueprints::maj4_network<mockturtle::aig_network>();
+
+        check_identical(orthogonal<dense_layout>(ntk), orthogonal<sparse_layout>(ntk));
+    }
+    SECTION("Node removal and movement")
+    {
+        auto layout    = blueprints::and_or_gate_layout<dense_layout>();
+        auto reference = blueprints::and_or_gate_layout<sparse_layout>();
+
+        const auto move = [](auto& lyt)
+        {
+            const auto n = lyt.get_node({3, 1});
+            lyt.move_node(n, {3, 0});
+            lyt.clear_tile({0, 0});
+        };
+
+        move(layout);
+        move(reference);
+
+        check_identical(layout, reference);
+    }
+    SECTION("Deep copy")
+    {
+        const auto original = blueprints::xor_maj_gate_layout<dense_layout>();
+
+        auto copy = original.clone();
+        copy.clear_tile({2, 1});
+
+        CHECK(!original.is_empty_tile({2, 1}));
+        CHECK(copy.is_empty_tile({2, 1}));
+    }
+}
+
+TEST_CASE("Dense cell-level layout storage", "[coordinate-storage]")
+{
+    using gate_layout   = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+    using sparse_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    using dense_layout =
+        cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>, dense_coordinate_storage>;
+
+    const auto layout = orthogonal<gate_layout>(blueprints::maj4_network<mockturtle::aig_network>());
+
+    const auto dense  = apply_gate_library<dense_layout, qca_one_library>(layout);
+    const auto sparse = apply_gate_library<sparse_layout, qca_one_library>(layout);
+
+    CHECK(dense.num_cells() == sparse.num_cells());
+    CHECK(dense.num_pis() == sparse.num_pis());
+    CHECK(dense.num_pos() == sparse.num_pos());
+
+    sparse.foreach_cell_position(
+        [&dense, &sparse](const auto& c)
+        {
+            CHECK(dense.get_cell_type(c) == sparse.get_cell_type(c));
+            CHECK(dense.get_cell_mode(c) == sparse.get_cell_mode(c));
+        });
+
+    uint64_t num_iterated_cells = 0;
+    dense.foreach_cell([&num_iterated_cells](const auto&) { ++num_iterated_cells; });
+
+    CHECK(num_iterated_cells == sparse.num_cells());
+}
@@ -0,0 +1,195 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/static_clocked_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+#include <fiction/traits.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+TEST_CASE("Static clocked layout traits", "[static-clocked-layout]")
+{
+    using layout = static_clocked_layout<cartesian_layout<offset::ucoord_t>, static_clocking::twoddwave>;
+
+    CHECK(is_clocked_layout_v<layout>);
+    CHECK(has_is_incoming_clocked_v<layout>);
+    CHECK(has_is_outgoing_clocked_v<layout>);
+    CHECK(has_foreach_incoming_clocked_zone_v<layout>);
+    CHECK(has_foreach_outgoing_clocked_zone_v<layout>);
+
+    using open_layout = static_clocked_layout<cartesian_layout<offset::ucoord_t>, static_clocking::open<>>;
+
+    CHECK(is_clocked_layout_v<open_layout>);
+}
+
+TEMPLATE_TEST_CASE("Static clocking policies match their type-erased counterparts", "[static-clocked-layout]",
+                   static_clocking::columnar, static_clocking::row, static_clocking::twoddwave, static_clocking::use,
+                   static_clocking::res, static_clocking::esr, static_clocking::cfe, static_clocking::bancs)
+{
+    using static_lyt = static_clocked_layout<cartesian_layout<offset::ucoord_t>, TestType>;
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    const static_lyt static_layout{{11, 11}};
+
+    const auto scheme = get_clocking_scheme<clk_lyt>(TestType::name);
+
+    REQUIRE(scheme.has_value());
+
+    const clk_lyt layout{{11, 11}, *scheme};
+
+    CHECK(static_layout.is_regularly_clocked());
+    CHECK(static_layout.is_clocking_scheme(TestType::name));
+    CHECK(static_layout.num_clocks() == layout.num_clocks());
+    CHECK(static_layout.get_clocking_scheme().max_in_degree == layout.get_clocking_scheme().max_in_degree);
+    CHECK(static_layout.get_clocking_scheme().max_out_degree == layout.get_clocking_scheme().max_out_degree);
+
+    layout.foreach_coordinate(
+        [&static_layout, &layout](const auto& cz)
+        {
+            CHECK(static_layout.get_clock_number(cz) == layout.get_clock_number(cz));
+            CHECK(static_layout.get_clocking_scheme()(cz) == layout.get_clock_number(cz));
+            CHECK(static_layout.in_degree(cz) == layout.in_degree(cz));
+            CHECK(static_layout.out_degree(cz) == layout.out_degree(cz));
+        });
+}
+
+TEST_CASE("Dense irregular clocking", "[static-clocked-layout]")
+{
+    using clk_lyt = static_clocked_layout<cartesian_layout<offset::ucoord_t>, static_clocking::open<>>;
+
+    clk_lyt layout{clk_lyt::aspect_ratio{1, 1, 1}};
+
+    CHECK(!layout.is_regularly_clocked());
+    CHECK(layout.is_clocking_scheme(clock_name::OPEN));
+    CHECK(layout.num_clocks() == 4);
+
+    layout.foreach_coordinate([&layout](const auto& cz) { CHECK(layout.get_clock_number(cz) == 0); });
+
+    layout.assign_clock_number({1, 0}, 1);
+    layout.assign_clock_number({0, 1}, 1);
+    layout.assign_clock_number({1, 1}, 2);
+    layout.assign_clock_number({1, 1, 1}, 6);  // clock numbers are taken modulo the number of clocks
+
+    CHECK(layout.get_clock_number({0, 0}) == 0);
+    CHECK(layout.get_clock_number({1, 0}) == 1);
+    CHECK(layout.get_clock_number({0, 1}) == 1);
+    CHECK(layout.get_clock_number({1, 1}) == 2);
+    CHECK(layout.get_clock_number({1, 1, 1}) == 2);
+
+    CHECK(layout.is_incoming_clocked({1, 0}, {0, 0}));
+    CHECK(layout.is_incoming_clocked({1, 1}, {0, 1}));
+    CHECK(!layout.is_incoming_clocked({1, 1}, {0, 0}));
+    CHECK(layout.is_outgoing_clocked({0, 0}, {0, 1}));
+
+    // zones outside the layout bounds are not stored
+    layout.assign_clock_number({5, 5}, 3);
+    CHECK(layout.get_clock_number({5, 5}) == 0);
+
+    SECTION("Type-erased clocking scheme")
+    {
+        const auto scheme = layout.get_clocking_scheme();
+
+        CHECK(!scheme.is_regular());
+
+        layout.foreach_coordinate([&layout, &scheme](const auto& cz)
+                                  { CHECK(scheme(cz) == layout.get_clock_number(cz)); });
+    }
+    SECTION("Resizing preserves clock numbers")
+    {
+        layout.resize({2, 3, 1});
+
+        CHECK(layout.get_clock_number({1, 0}) == 1);
+        CHECK(layout.get_clock_number({0, 1}) == 1);
+        CHECK(layout.get_clock_number({1, 1}) == 2);
+        CHECK(layout.get_clock_number({1, 1, 1}) == 2);
+        CHECK(layout.get_clock_number({2, 3}) == 0);
+
+        layout.resize({0, 0, 0});
+
+        CHECK(layout.get_clock_number({0, 0}) == 0);
+        CHECK(layout.get_clock_number({1, 1}) == 0);
+    }
+    SECTION("Replace clocking scheme")
+    {
+        layout.replace_clocking_scheme(use_clocking<clk_lyt>());
+
+        const clocked_layout<cartesian_layout<offset::ucoord_t>> use_layout{
+            {1, 1, 1}, use_clocking<clocked_layout<cartesian_layout<offset::ucoord_t>>>()};
+
+        layout.foreach_coordinate([&layout, &use_layout](const auto& cz)
+                                  { CHECK(layout.get_clock_number(cz) == use_layout.get_clock_number(cz)); });
+    }
+    SECTION("Deep copy")
+    {
+        auto copy = layout.clone();
+
+        copy.assign_clock_number({1, 0}, 3);
+
+        CHECK(layout.get_clock_number({1, 0}) == 1);
+        CHECK(copy.get_clock_number({1, 0}) == 3);
+    }
+}
+
+TEST_CASE("Gate-level layouts on static clocked layouts", "[static-clocked-layout]")
+{
+    SECTION("Regular clocking")
+    {
+        using gate_layout = gate_level_layout<
+            static_clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>, static_clocking::twoddwave>>;
+        using reference_layout =
+            gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+        const auto layout    = blueprints::straight_wire_gate_layout<gate_layout>();
+        const auto reference = blueprints::straight_wire_gate_layout<reference_layout>();
+
+        CHECK(layout.num_pis() == reference.num_pis());
+        CHECK(layout.num_pos() == reference.num_pos());
+        CHECK(layout.num_wires() == reference.num_wires());
+
+        reference.foreach_ground_tile(
+            [&layout, &reference](const auto& t)
+            {
+                if (!reference.is_empty_tile(t))
+                {
+                    CHECK(layout.fanin_size(layout.get_node(t)) == reference.fanin_size(reference.get_node(t)));
+                    CHECK(layout.fanout_size(layout.get_node(t)) == reference.fanout_size(reference.get_node(t)));
+                }
+            });
+    }
+    SECTION("Dense irregular clocking")
+    {
+        using gate_layout = gate_level_layout<
+            static_clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>, static_clocking::open<>>>;
+        using reference_layout =
+            gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+        const auto layout    = blueprints::xor_maj_gate_layout<gate_layout>();
+        const auto reference = blueprints::xor_maj_gate_layout<reference_layout>();
+
+        CHECK(layout.num_gates() == reference.num_gates());
+
+        reference.foreach_ground_tile(
+            [&layout, &reference](const auto& t)
+            {
+                CHECK(layout.get_clock_number(t) == reference.get_clock_number(t));
+
+                if (!reference.is_empty_tile(t))
+                {
+                    CHECK(layout.fanin_size(layout.get_node(t)) == reference.fanin_size(reference.get_node(t)));
+                    CHECK(layout.fanout_size(layout.get_node(t)) == reference.fanout_size(reference.get_node(t)));
+                }
+            });
+    }
+}
@@ -670,6 +670,56 @@ TEMPLATE_TEST_CASE("Assign and delete charge states without defects", "[charge-d
         CHECK(charge_layout.get_electrostatic_potential_energy() > 0.0);
     }
 
+    SECTION("Incremental update after changing a single charge state")
+    {
+        lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({1, 2, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+
+        charge_distribution_surface charge_layout{lyt, sidb_simulation_parameters{2, -0.32},
+                                                  sidb_charge_state::NEUTRAL};
+        charge_layout.assign_local_external_potential({{{3, 0, 0}, -0.05}});
+        charge_layout.update_after_charge_change();
+
+        auto reference_layout = charge_layout;
+
+        const auto check_against_full_update = [&charge_layout, &reference_layout]
+        {
+            reference_layout.update_after_charge_change();
+
+            for (uint64_t i = 0; i < charge_layout.num_cells(); ++i)
+            {
+                CHECK_THAT(charge_layout.get_local_potential_by_index(i).value(),
+                           Catch::Matchers::WithinAbs(reference_layout.get_local_potential_by_index(i).value(),
+                                                      constants::ERROR_MARGIN));
+            }
+
+            CHECK_THAT(charge_layout.get_electrostatic_potential_energy(),
+                       Catch::Matchers::WithinAbs(reference_layout.get_electrostatic_potential_energy(),
+                                                  constants::ERROR_MARGIN));
+        };
+
+        charge_layout.change_charge_state_by_index(0, sidb_charge_state::NEGATIVE);
+        reference_layout.assign_charge_state_by_index(0, sidb_charge_state::NEGATIVE);
+        check_against_full_update();
+
+        charge_layout.change_charge_state_by_index(2, sidb_charge_state::NEGATIVE);
+        reference_layout.assign_charge_state_by_index(2, sidb_charge_state::NEGATIVE);
+        check_against_full_update();
+
+        // unchanged charge state
+        charge_layout.change_charge_state_by_index(2, sidb_charge_state::NEGATIVE);
+        check_against_full_update();
+
+        charge_layout.change_charge_state_by_index(0, sidb_charge_state::NEUTRAL);
+        reference_layout.assign_charge_state_by_index(0, sidb_charge_state::NEUTRAL);
+        check_against_full_update();
+
+        CHECK(charge_layout.get_charge_state_by_index(0) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_layout.get_charge_state_by_index(2) == sidb_charge_state::NEGATIVE);
+    }
+
     SECTION("Physical validity check under different physical parameters")
     {
         TestType layout{};
@@ -2239,6 +2289,75 @@ TEST_CASE("Assign charge index", "[charge-distribution-surface]")
     }
 }
 
+TEST_CASE("Contiguous charge state and potential storage", "[charge-distribution-surface]")
+{
+    using TestType = sidb_100_cell_clk_lyt_siqad;
+    TestType lyt{};
+
+    lyt.assign_cell_type({0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 1}, TestType::cell_type::NORMAL);
+
+    charge_distribution_surface charge_layout{lyt, sidb_simulation_parameters{}, sidb_charge_state::NEUTRAL};
+    charge_layout.assign_charge_state({3, 0}, sidb_charge_state::NEGATIVE);
+    charge_layout.update_after_charge_change();
+
+    const auto& charges    = charge_layout.get_all_sidb_charges_ref();
+    const auto& local_pots = charge_layout.get_local_internal_potentials();
+    const auto& pot_matrix = charge_layout.get_chargeless_potential_matrix();
+
+    REQUIRE(charges.size() == 3);
+    REQUIRE(local_pots.size() == 3);
+    REQUIRE(pot_matrix.size() == 9);
+    CHECK(charge_layout.get_local_external_potentials().size() == 3);
+
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        CHECK(charges[i] == charge_layout.get_charge_state_by_index(i));
+        CHECK_THAT(local_pots[i], Catch::Matchers::WithinAbs(
+                                      charge_layout.get_local_internal_potential_by_index(i).value(), 0.0));
+
+        for (uint64_t j = 0; j < 3; ++j)
+        {
+            CHECK_THAT(pot_matrix[i * 3 + j],
+                       Catch::Matchers::WithinAbs(charge_layout.get_chargeless_potential_by_indices(i, j), 0.0));
+            CHECK_THAT(pot_matrix[i * 3 + j], Catch::Matchers::WithinAbs(pot_matrix[j * 3 + i], 0.0));
+        }
+    }
+
+    SECTION("References reflect updates in place")
+    {
+        const auto* const charge_data = charges.data();
+        const auto* const pot_data    = local_pots.data();
+        const auto* const matrix_data = pot_matrix.data();
+
+        charge_layout.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+        charge_layout.update_after_charge_change();
+        charge_layout.assign_physical_parameters(sidb_simulation_parameters{3, -0.32, 4.1});
+
+        CHECK(charges.data() == charge_data);
+        CHECK(local_pots.data() == pot_data);
+        CHECK(pot_matrix.data() == matrix_data);
+
+        CHECK(charges[0] == sidb_charge_state::NEGATIVE);
+        CHECK(charges[1] == sidb_charge_state::NEGATIVE);
+        CHECK(charges[2] == sidb_charge_state::NEGATIVE);
+        CHECK_THAT(local_pots[0], Catch::Matchers::WithinAbs(
+                                      charge_layout.get_local_internal_potential_by_index(0).value(), 0.0));
+        CHECK_THAT(pot_matrix[1], Catch::Matchers::WithinAbs(charge_layout.get_chargeless_potential_by_indices(0, 1),
+                                                              0.0));
+    }
+    SECTION("Charge locations only")
+    {
+        const charge_distribution_surface charge_location_layout{lyt, sidb_simulation_parameters{},
+                                                                  sidb_charge_state::NEGATIVE,
+                                                                  cds_configuration::CHARGE_LOCATION_ONLY};
+
+        CHECK(charge_location_layout.get_all_sidb_charges_ref().size() == 3);
+        CHECK(charge_location_layout.get_chargeless_potential_matrix().empty());
+    }
+}
+
 TEMPLATE_TEST_CASE("Charge distribution surface defect vs SiDB equivalence", "[charge-distribution-surface]",
                    sidb_100_cell_clk_lyt_siqad, cds_sidb_100_cell_clk_lyt_siqad)
 {
@@ -2293,6 +2412,104 @@ TEMPLATE_TEST_CASE("Charge distribution surface defect vs SiDB equivalence", "[c
                Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
 }
 
+TEST_CASE("Move SiDBs and apply SiDB deltas incrementally", "[charge-distribution-surface]")
+{
+    sidb_defect_surface<sidb_100_cell_clk_lyt_siqad> lyt{};
+    lyt.assign_cell_type({0, 0, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+    lyt.assign_cell_type({4, 1, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 1, 1}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 2, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::OUTPUT);
+
+    const auto sim_params = sidb_simulation_parameters{3, -0.28};
+
+    lyt.assign_sidb_defect({6, 5, 0}, sidb_defect{sidb_defect_type::UNKNOWN, -1, sim_params.epsilon_r,
+                                                  sim_params.lambda_tf});
+
+    // reference layout in which the input SiDB is located at {2, 1, 1}
+    auto moved_lyt = lyt.clone();
+    moved_lyt.assign_cell_type({0, 0, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::EMPTY);
+    moved_lyt.assign_cell_type({2, 1, 1}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+
+    const auto check_equivalence = [](const auto& incremental, const auto& reference)
+    {
+        CHECK(incremental.num_cells() == reference.num_cells());
+        CHECK(incremental.is_physically_valid() == reference.is_physically_valid());
+        CHECK_THAT(incremental.get_electrostatic_potential_energy() - reference.get_electrostatic_potential_energy(),
+                   Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
+
+        reference.foreach_cell(
+            [&](const auto& c1)
+            {
+                CHECK(incremental.get_cell_type(c1) == reference.get_cell_type(c1));
+                CHECK(incremental.get_charge_state(c1) == reference.get_charge_state(c1));
+
+                REQUIRE(incremental.get_local_potential(c1).has_value());
+                CHECK_THAT(incremental.get_local_potential(c1).value() - reference.get_local_potential(c1).value(),
+                           Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
+
+                reference.foreach_cell(
+                    [&](const auto& c2)
+                    {
+                        CHECK_THAT(incremental.get_chargeless_potential_between_sidbs(c1, c2) -
+                                       reference.get_chargeless_potential_between_sidbs(c1, c2),
+                                   Catch::Matchers::WithinAbs(0.0, constants::ERROR_MARGIN));
+                    });
+            });
+    };
+
+    SECTION("Move a single SiDB")
+    {
+        charge_distribution_surface charge_lyt{lyt, sim_params, sidb_charge_state::NEGATIVE};
+        charge_lyt.assign_local_external_potential({{{0, 0, 0}, 0.01}});
+        charge_lyt.assign_charge_state({4, 1, 0}, sidb_charge_state::NEUTRAL);
+        charge_lyt.update_after_charge_change();
+
+        charge_lyt.move_sidb({0, 0, 0}, {2, 1, 1});
+
+        CHECK(charge_lyt.get_cell_type({0, 0, 0}) == sidb_100_cell_clk_lyt_siqad::cell_type::EMPTY);
+        CHECK(charge_lyt.get_cell_type({2, 1, 1}) == sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+        CHECK(charge_lyt.get_charge_state({2, 1, 1}) == sidb_charge_state::NEGATIVE);
+
+        charge_lyt.update_after_charge_change();
+
+        charge_distribution_surface reference{moved_lyt, sim_params, sidb_charge_state::NEGATIVE};
+        reference.assign_local_external_potential({{{2, 1, 1}, 0.01}});
+        reference.assign_charge_state({4, 1, 0}, sidb_charge_state::NEUTRAL);
+        reference.update_after_charge_change();
+
+        check_equivalence(charge_lyt, reference);
+    }
+
+    SECTION("Apply an SiDB delta and revert it")
+    {
+        charge_distribution_surface charge_lyt{lyt, sim_params, sidb_charge_state::NEGATIVE};
+
+        charge_lyt.apply_sidb_delta({{0, 0, 0}}, {{2, 1, 1}}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+        charge_lyt.update_after_charge_change();
+
+        check_equivalence(charge_lyt,
+                          charge_distribution_surface{moved_lyt, sim_params, sidb_charge_state::NEGATIVE});
+
+        charge_lyt.apply_sidb_delta({{2, 1, 1}}, {{0, 0, 0}}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+        charge_lyt.update_after_charge_change();
+
+        check_equivalence(charge_lyt, charge_distribution_surface{lyt, sim_params, sidb_charge_state::NEGATIVE});
+    }
+
+    SECTION("Apply an SiDB delta that adds an SiDB")
+    {
+        charge_distribution_surface charge_lyt{lyt, sim_params, sidb_charge_state::NEGATIVE};
+
+        charge_lyt.apply_sidb_delta({}, {{2, 1, 1}}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+
+        auto extended_lyt = lyt.clone();
+        extended_lyt.assign_cell_type({2, 1, 1}, sidb_100_cell_clk_lyt_siqad::cell_type::INPUT);
+
+        check_equivalence(charge_lyt,
+                          charge_distribution_surface{extended_lyt, sim_params, sidb_charge_state::NEGATIVE});
+    }
+}
+
 TEST_CASE("Tests for Si-111 lattice orientation", "[charge-distribution-surface]")
 {
     sidb_111_cell_clk_lyt_siqad lyt{};
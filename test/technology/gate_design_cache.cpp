@@ -0,0 +1,223 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/technology/gate_design_cache.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Gate design cache lookups", "[gate-design-cache]")
+{
+    gate_design_cache<std::string> cache{};
+
+    CHECK(cache.size() == 0);
+    CHECK(!cache.find("and").has_value());
+    CHECK(cache.num_hits() == 0);
+    CHECK(cache.num_misses() == 1);
+
+    SECTION("Designed gate")
+    {
+        cache.insert("and", "AND");
+
+        const auto result = cache.find("and");
+
+        REQUIRE(result.has_value());
+        REQUIRE(result->has_value());
+        CHECK(**result == "AND");
+        CHECK(cache.size() == 1);
+        CHECK(cache.num_hits() == 1);
+        CHECK(cache.num_misses() == 1);
+    }
+    SECTION("Impossible design")
+    {
+        cache.insert("and", std::nullopt);
+
+        const auto result = cache.find("and");
+
+        REQUIRE(result.has_value());
+        CHECK(!result->has_value());
+        CHECK(cache.size() == 1);
+    }
+    SECTION("First result wins")
+    {
+        cache.insert("and", "AND");
+        cache.insert("and", "NAND");
+
+        CHECK(cache.find("and").value() == "AND");
+        CHECK(cache.size() == 1);
+    }
+    SECTION("Clear")
+    {
+        cache.insert("and", "AND");
+        cache.insert("or", "OR");
+
+        CHECK(cache.size() == 2);
+
+        cache.clear();
+
+        CHECK(cache.size() == 0);
+        CHECK(!cache.find("and").has_value());
+        CHECK(cache.num_hits() == 0);
+        CHECK(cache.num_misses() == 1);
+    }
+}
+
+TEST_CASE("Concurrent gate design cache access", "[gate-design-cache]")
+{
+    gate_design_cache<std::size_t> cache{};
+
+    static constexpr std::size_t num_threads = 4;
+    static constexpr std::size_t num_keys    = 100;
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&cache]
+            {
+                for (std::size_t k = 0; k < num_keys; ++k)
+                {
+                    if (!cache.find(std::to_string(k)).has_value())
+                    {
+                        cache.insert(std::to_string(k), k);
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(cache.size() == num_keys);
+    CHECK(cache.num_hits() + cache.num_misses() == num_threads * num_keys);
+
+    for (std::size_t k = 0; k < num_keys; ++k)
+    {
+        CHECK(cache.find(std::to_string(k)).value() == k);
+    }
+}
+
+TEST_CASE("Persistent gate design cache", "[gate-design-cache]")
+{
+    enum class cell_type : uint8_t
+    {
+        EMPTY,
+        NORMAL,
+        INPUT,
+        OUTPUT
+    };
+
+    using gate = std::array<std::array<cell_type, 3>, 2>;
+
+    const gate wire{{{{cell_type::INPUT, cell_type::EMPTY, cell_type::EMPTY}},
+                     {{cell_type::EMPTY, cell_type::NORMAL, cell_type::OUTPUT}}}};
+
+    const auto directory = std::filesystem::temp_directory_path() / "fiction_gate_design_cache_test";
+    std::filesystem::remove_all(directory);
+
+    {
+        gate_design_cache<gate> cache{directory};
+
+        REQUIRE(cache.get_directory().has_value());
+        CHECK(*cache.get_directory() == directory);
+
+        cache.insert("wire", wire);
+        cache.insert("impossible", std::nullopt);
+    }
+
+    SECTION("Results are loaded by another cache")
+    {
+        gate_design_cache<gate> cache{directory};
+
+        CHECK(cache.size() == 0);
+
+        const auto stored_wire = cache.find("wire");
+
+        REQUIRE(stored_wire.has_value());
+        REQUIRE(stored_wire->has_value());
+        CHECK(**stored_wire == wire);
+
+        const auto stored_impossible = cache.find("impossible");
+
+        REQUIRE(stored_impossible.has_value());
+        CHECK(!stored_impossible->has_value());
+
+        CHECK(!cache.find("and").has_value());
+
+        CHECK(cache.size() == 2);
+        CHECK(cache.num_hits() == 2);
+        CHECK(cache.num_misses() == 1);
+    }
+    SECTION("Clearing keeps the files")
+    {
+        gate_design_cache<gate> cache{directory};
+
+        CHECK(cache.find("wire").has_value());
+
+        cache.clear();
+
+        CHECK(cache.size() == 0);
+        CHECK(cache.find("wire").has_value());
+    }
+    SECTION("Files of other formats are ignored")
+    {
+        // files written by a previous format version start with the key
+        {
+            std::ofstream os{directory / "outdated.gate"};
+            os << "wire\ngate\n0 0 0\n0 0 0\n";
+        }
+
+        for (const auto& entry : std::filesystem::directory_iterator{directory})
+        {
+            if (entry.path().filename() != "outdated.gate")
+            {
+                std::filesystem::copy_file(directory / "outdated.gate", entry.path(),
+                                           std::filesystem::copy_options::overwrite_existing);
+            }
+        }
+
+        gate_design_cache<gate> cache{directory};
+
+        CHECK(!cache.find("wire").has_value());
+        CHECK(!cache.find("impossible").has_value());
+
+        // storing the result again replaces the outdated file
+        cache.insert("wire", wire);
+
+        gate_design_cache<gate> other_cache{directory};
+
+        CHECK(other_cache.find("wire").value() == wire);
+    }
+    SECTION("No temporary files are left behind")
+    {
+        for (const auto& entry : std::filesystem::directory_iterator{directory})
+        {
+            CHECK(entry.path().extension() == ".gate");
+        }
+    }
+    SECTION("In-memory caches do not access the directory")
+    {
+        gate_design_cache<gate> cache{};
+
+        CHECK(!cache.get_directory().has_value());
+        CHECK(!cache.find("wire").has_value());
+    }
+
+    std::filesystem::remove_all(directory);
+}
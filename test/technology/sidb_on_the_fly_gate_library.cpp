@@ -4,9 +4,16 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <fiction/algorithms/iter/bdl_input_iterator.hpp>
+#include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
 #include <fiction/technology/sidb_on_the_fly_gate_library.hpp>
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <string>
+#include <vector>
 
 using namespace fiction;
 
@@ -17,3 +24,69 @@ TEST_CASE("Parameterized gate library traits", "[parameterized-gate-library]")
     CHECK(!has_post_layout_optimization_v<sidb_on_the_fly_gate_library, sidb_cell_clk_lyt>);
     CHECK(!has_post_layout_optimization_v<sidb_on_the_fly_gate_library, cart_gate_clk_lyt>);
 }
+
+TEST_CASE("Design cache keys of the parameterized gate library", "[parameterized-gate-library]")
+{
+    using lyt = sidb_100_cell_clk_lyt_siqad;
+
+    lyt skeleton{};
+    skeleton.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::INPUT);
+    skeleton.assign_cell_type({2, 1, 0}, sidb_technology::cell_type::NORMAL);
+    skeleton.assign_cell_type({10, 4, 0}, sidb_technology::cell_type::OUTPUT);
+
+    const std::vector<tt> spec{create_and_tt()};
+
+    const design_sidb_gates_params<cell<lyt>> reference_params{};
+
+    const auto reference_key = sidb_on_the_fly_gate_library::design_cache_key(skeleton, spec, reference_params);
+
+    CHECK(reference_key == sidb_on_the_fly_gate_library::design_cache_key(skeleton, spec, reference_params));
+
+    const auto check_separate_entry = [&](const design_sidb_gates_params<cell<lyt>>& params)
+    {
+        const auto key = sidb_on_the_fly_gate_library::design_cache_key(skeleton, spec, params);
+
+        CHECK(key != reference_key);
+
+        sidb_gate_design_cache cache{};
+        cache.insert(reference_key, std::nullopt);
+
+        CHECK(!cache.find(key).has_value());
+    };
+
+    auto params = reference_params;
+
+    SECTION("BDL wire threshold")
+    {
+        params.operational_params.input_bdl_iterator_params.bdl_wire_params.threshold_bdl_interdistance = 3.0;
+
+        check_separate_entry(params);
+    }
+    SECTION("BDL pair distances")
+    {
+        params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.minimum_distance = 0.5;
+
+        check_separate_entry(params);
+
+        params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.minimum_distance =
+            reference_params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params
+                .minimum_distance;
+        params.operational_params.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params.maximum_distance = 2.0;
+
+        check_separate_entry(params);
+    }
+    SECTION("Input BDL configuration")
+    {
+        params.operational_params.input_bdl_iterator_params.input_bdl_config =
+            bdl_input_iterator_params::input_bdl_configuration::PERTURBER_ABSENCE_ENCODED;
+
+        check_separate_entry(params);
+    }
+    SECTION("Operational analysis strategy")
+    {
+        params.operational_params.strategy_to_analyze_operational_status =
+            is_operational_params::operational_analysis_strategy::FILTER_THEN_SIMULATION;
+
+        check_separate_entry(params);
+    }
+}
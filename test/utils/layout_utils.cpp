@@ -992,3 +992,53 @@ TEST_CASE("Test identity of two layouts", "[layout-utils]")
         }
     }
 }
+
+TEST_CASE("Test canonical hash of layouts", "[layout-utils]")
+{
+    sidb_cell_clk_lyt_siqad lyt_first{{5, 3}};
+
+    lyt_first.assign_cell_type({5, 3}, sidb_cell_clk_lyt::cell_type::NORMAL);
+    lyt_first.assign_cell_type({0, 0}, sidb_cell_clk_lyt::cell_type::INPUT);
+    lyt_first.assign_cell_type({2, 2}, sidb_cell_clk_lyt::cell_type::OUTPUT);
+
+    // same cells, different insertion order
+    sidb_cell_clk_lyt_siqad lyt_second{{5, 3}};
+
+    lyt_second.assign_cell_type({2, 2}, sidb_cell_clk_lyt::cell_type::OUTPUT);
+    lyt_second.assign_cell_type({0, 0}, sidb_cell_clk_lyt::cell_type::INPUT);
+    lyt_second.assign_cell_type({5, 3}, sidb_cell_clk_lyt::cell_type::NORMAL);
+
+    SECTION("cell-level layout")
+    {
+        CHECK(canonical_cell_layout_hash(lyt_first) == canonical_cell_layout_hash(lyt_second));
+        CHECK(canonical_cell_layout_hash(lyt_first) == canonical_cell_layout_hash(lyt_first.clone()));
+
+        lyt_second.assign_cell_type({5, 3}, sidb_cell_clk_lyt::cell_type::INPUT);
+        CHECK(canonical_cell_layout_hash(lyt_first) != canonical_cell_layout_hash(lyt_second));
+    }
+    SECTION("charge distribution surface")
+    {
+        charge_distribution_surface cds_first{lyt_first};
+        charge_distribution_surface cds_second{lyt_second};
+
+        CHECK(canonical_cell_layout_hash(cds_first) == canonical_cell_layout_hash(cds_second));
+
+        cds_second.assign_charge_state({5, 3}, sidb_charge_state::POSITIVE);
+        CHECK(canonical_cell_layout_hash(cds_first) != canonical_cell_layout_hash(cds_second));
+    }
+    SECTION("SiDB defect surface")
+    {
+        sidb_defect_surface defect_first{lyt_first};
+        defect_first.assign_sidb_defect({1, 1}, sidb_defect{sidb_defect_type::UNKNOWN});
+        defect_first.assign_sidb_defect({1, 2}, sidb_defect{sidb_defect_type::SI_VACANCY});
+
+        sidb_defect_surface defect_second{lyt_second};
+        defect_second.assign_sidb_defect({1, 2}, sidb_defect{sidb_defect_type::SI_VACANCY});
+        defect_second.assign_sidb_defect({1, 1}, sidb_defect{sidb_defect_type::UNKNOWN});
+
+        CHECK(canonical_cell_layout_hash(defect_first) == canonical_cell_layout_hash(defect_second));
+
+        defect_second.assign_sidb_defect({1, 2}, sidb_defect{sidb_defect_type::DB});
+        CHECK(canonical_cell_layout_hash(defect_first) != canonical_cell_layout_hash(defect_second));
+    }
+}
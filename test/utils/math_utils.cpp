@@ -3,6 +3,7 @@
 //
 
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <fiction/utils/math_utils.hpp>
 
@@ -290,3 +291,32 @@ TEST_CASE("Less entities than positions", "[determine-all-combinations-of-distri
     REQUIRE(result[1] == std::vector<std::size_t>{0, 2});
     REQUIRE(result[2] == std::vector<std::size_t>{1, 2});
 }
+
+TEST_CASE("Wilson score interval", "[wilson-score-interval]")
+{
+    SECTION("no trials")
+    {
+        const auto [lower, upper] = wilson_score_interval(0, 0, 0.95);
+        CHECK_THAT(lower, Catch::Matchers::WithinAbs(0.0, 1e-6));
+        CHECK_THAT(upper, Catch::Matchers::WithinAbs(1.0, 1e-6));
+    }
+    SECTION("half of the trials succeed")
+    {
+        const auto [lower, upper] = wilson_score_interval(50, 100, 0.95);
+        CHECK_THAT(lower, Catch::Matchers::WithinAbs(0.403832, 1e-6));
+        CHECK_THAT(upper, Catch::Matchers::WithinAbs(0.596168, 1e-6));
+    }
+    SECTION("no trial succeeds")
+    {
+        const auto [lower, upper] = wilson_score_interval(0, 10, 0.95);
+        CHECK_THAT(lower, Catch::Matchers::WithinAbs(0.0, 1e-6));
+        CHECK_THAT(upper, Catch::Matchers::WithinAbs(0.277533, 1e-6));
+    }
+    SECTION("higher confidence levels lead to wider intervals")
+    {
+        const auto [lower_95, upper_95] = wilson_score_interval(30, 40, 0.95);
+        const auto [lower_99, upper_99] = wilson_score_interval(30, 40, 0.99);
+        CHECK(lower_99 < lower_95);
+        CHECK(upper_99 > upper_95);
+    }
+}
@@ -0,0 +1,223 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/utils/profiling.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Profiler aggregation", "[profiling]")
+{
+    auto& p = profiler::instance();
+    p.reset();
+
+    const auto start = profiler::clock::now();
+
+    SECTION("Timers")
+    {
+        p.record_duration("timer", start, start + std::chrono::milliseconds{2});
+        p.record_duration("timer", start, start + std::chrono::milliseconds{4});
+
+        const auto summary = p.summary();
+
+        CHECK(summary["timers"]["timer"]["count"] == 2);
+        CHECK_THAT(summary["timers"]["timer"]["total in seconds"].get<double>(),
+                   Catch::Matchers::WithinAbs(0.006, 1e-12));
+        CHECK_THAT(summary["timers"]["timer"]["min in seconds"].get<double>(),
+                   Catch::Matchers::WithinAbs(0.002, 1e-12));
+        CHECK_THAT(summary["timers"]["timer"]["max in seconds"].get<double>(),
+                   Catch::Matchers::WithinAbs(0.004, 1e-12));
+    }
+    SECTION("Counters and histograms across threads")
+    {
+        std::vector<std::thread> threads{};
+
+        for (auto t = 0u; t < 4u; ++t)
+        {
+            threads.emplace_back(
+                [&p]
+                {
+                    for (auto i = 0u; i < 100u; ++i)
+                    {
+                        p.increment("counter");
+                        p.record_value("histogram", static_cast<double>(i));
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto summary = p.summary();
+
+        CHECK(summary["counters"]["counter"] == 400);
+        CHECK(summary["histograms"]["histogram"]["count"] == 400);
+        CHECK(summary["histograms"]["histogram"]["min"].get<double>() == 0.0);
+        CHECK(summary["histograms"]["histogram"]["max"].get<double>() == 99.0);
+
+        uint64_t bucket_sum = 0;
+        for (const auto& bucket : summary["histograms"]["histogram"]["buckets"])
+        {
+            bucket_sum += bucket["count"].get<uint64_t>();
+        }
+        CHECK(bucket_sum == 400);
+    }
+    SECTION("Non-finite histogram values")
+    {
+        p.record_value("histogram", std::numeric_limits<double>::infinity());
+        p.record_value("histogram", std::numeric_limits<double>::quiet_NaN());
+
+        CHECK(p.summary()["histograms"].empty());
+
+        p.record_value("histogram", 3.0);
+        p.record_value("histogram", -std::numeric_limits<double>::infinity());
+
+        const auto summary = p.summary();
+
+        CHECK(summary["histograms"]["histogram"]["count"] == 1);
+        CHECK(summary["histograms"]["histogram"]["min"].get<double>() == 3.0);
+    }
+    SECTION("Reset")
+    {
+        p.increment("counter", 3);
+        p.reset();
+
+        CHECK(p.summary()["counters"].empty());
+    }
+}
+
+TEST_CASE("Profiler Chrome trace", "[profiling]")
+{
+    auto& p = profiler::instance();
+    p.reset();
+
+    const auto start = profiler::clock::now();
+
+    SECTION("Trace recording disabled")
+    {
+        p.enable({false});
+        p.record_duration("scope", start, start + std::chrono::microseconds{10});
+        p.disable();
+
+        for (const auto& e : p.chrome_trace()["traceEvents"])
+        {
+            CHECK(e["ph"] != "X");
+        }
+    }
+    SECTION("Trace recording enabled with limit")
+    {
+        p.enable({true, 2});
+        for (auto i = 0u; i < 3u; ++i)
+        {
+            p.record_duration("scope", start, start + std::chrono::microseconds{10});
+        }
+        p.disable();
+
+        uint64_t num_events = 0;
+        for (const auto& e : p.chrome_trace()["traceEvents"])
+        {
+            if (e["ph"] == "X")
+            {
+                CHECK(e["name"] == "scope");
+                CHECK_THAT(e["dur"].get<double>(), Catch::Matchers::WithinAbs(10.0, 1e-9));
+                ++num_events;
+            }
+        }
+
+        CHECK(num_events == 2);
+        CHECK(p.summary()["dropped trace events"] == 1);
+        CHECK(p.summary()["timers"]["scope"]["count"] == 3);
+    }
+
+    p.reset();
+}
+
+TEST_CASE("Instrumentation macros", "[profiling]")
+{
+    auto& p = profiler::instance();
+    p.reset();
+
+    const auto instrumented = []
+    {
+        FICTION_PROFILE_SCOPE("macro scope");
+        FICTION_PROFILE_COUNT("macro counter", 2);
+        FICTION_PROFILE_VALUE("macro histogram", 42);
+    };
+
+    SECTION("Profiling disabled at runtime")
+    {
+        instrumented();
+
+        const auto summary = p.summary();
+
+        CHECK(summary["timers"].empty());
+        CHECK(summary["counters"].empty());
+        CHECK(summary["histograms"].empty());
+    }
+    SECTION("Profiling enabled at runtime")
+    {
+        p.enable();
+        instrumented();
+        instrumented();
+        p.disable();
+
+        const auto summary = p.summary();
+
+        if constexpr (profiling_compiled_in)
+        {
+            CHECK(summary["timers"]["macro scope"]["count"] == 2);
+            CHECK(summary["counters"]["macro counter"] == 4);
+            CHECK(summary["histograms"]["macro histogram"]["count"] == 2);
+        }
+        else
+        {
+            CHECK(summary["timers"].empty());
+            CHECK(summary["counters"].empty());
+            CHECK(summary["histograms"].empty());
+        }
+    }
+    SECTION("Thread idle times")
+    {
+        p.enable();
+
+        thread_idle_recorder idle{"pool"};
+
+        std::vector<std::thread> threads{};
+        for (auto t = 0u; t < 3u; ++t)
+        {
+            threads.emplace_back([&idle] { idle.worker_finished(); });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        idle.threads_joined();
+        p.disable();
+
+        const auto summary = p.summary();
+
+        if constexpr (profiling_compiled_in)
+        {
+            CHECK(summary["histograms"]["pool"]["count"] == 3);
+            CHECK(summary["timers"]["pool"]["count"] == 3);
+        }
+        else
+        {
+            CHECK(summary["histograms"].empty());
+        }
+    }
+
+    p.reset();
+}
@@ -0,0 +1,87 @@
+//
+// Created by marcel on 16.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/stream_utils.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Write rendered items in order", "[stream-utils]")
+{
+    std::vector<std::size_t> items(1000);
+    std::iota(items.begin(), items.end(), 0ul);
+
+    const auto render = [](const std::size_t i, std::string& buffer) { buffer.append(std::to_string(i)).append(","); };
+
+    std::string expected{};
+    for (const auto i : items)
+    {
+        render(i, expected);
+    }
+
+    SECTION("empty input")
+    {
+        std::stringstream ss{};
+        write_rendered_in_order(ss, std::vector<std::size_t>{}, render, 4);
+
+        CHECK(ss.str().empty());
+    }
+    SECTION("single thread")
+    {
+        std::stringstream ss{};
+        write_rendered_in_order(ss, items, render, 1, 7);
+
+        CHECK(ss.str() == expected);
+    }
+    SECTION("multiple threads")
+    {
+        for (const auto num_threads : {2ul, 4ul, 16ul})
+        {
+            for (const auto items_per_thread : {1ul, 7ul, 64ul, 4096ul})
+            {
+                std::stringstream ss{};
+                write_rendered_in_order(ss, items, render, num_threads, items_per_thread);
+
+                CHECK(ss.str() == expected);
+            }
+        }
+    }
+    SECTION("zero threads and items per thread")
+    {
+        std::stringstream ss{};
+        write_rendered_in_order(ss, items, render, 0, 0);
+
+        CHECK(ss.str() == expected);
+    }
+}
+
+TEST_CASE("Exceptions thrown while rendering are passed on", "[stream-utils]")
+{
+    std::vector<std::size_t> items(100);
+    std::iota(items.begin(), items.end(), 0ul);
+
+    const auto render = [](const std::size_t i, std::string& buffer)
+    {
+        if (i == 42)
+        {
+            throw std::invalid_argument("cannot render item");
+        }
+
+        buffer.append(std::to_string(i));
+    };
+
+    std::stringstream ss{};
+
+    CHECK_THROWS_AS(write_rendered_in_order(ss, items, render, 4, 10), std::invalid_argument);
+    // all batches before the failing one have been written
+    CHECK(ss.str().rfind("0123456789", 0) == 0);
+}